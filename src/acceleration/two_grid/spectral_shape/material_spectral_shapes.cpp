@@ -11,8 +11,8 @@ MaterialSpectralShapes::MaterialSpectralShapes(std::unique_ptr<SpectralShapeCalc
 }
 void MaterialSpectralShapes::CalculateMaterialSpectralShapes(std::shared_ptr<CrossSections> cross_sections_ptr) {
   using DealiiMatrix = dealii::FullMatrix<double>;
-  const auto sigma_s_matrix_map{ cross_sections_ptr->sigma_s() };
-  const auto sigma_t_vector_map{ cross_sections_ptr->sigma_t() };
+  const auto& sigma_s_matrix_map{ cross_sections_ptr->sigma_s() };
+  const auto& sigma_t_vector_map{ cross_sections_ptr->sigma_t() };
   const int n_materials = sigma_t_vector_map.size();
   const int n_groups = sigma_t_vector_map.begin()->second.size();
 
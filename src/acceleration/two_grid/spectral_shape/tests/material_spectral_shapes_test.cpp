@@ -11,7 +11,7 @@
 namespace  {
 
 using namespace bart;
-using ::testing::NiceMock, ::testing::Return, ::testing::DoDefault, ::testing::_;
+using ::testing::NiceMock, ::testing::Return, ::testing::ReturnRefOfCopy, ::testing::DoDefault, ::testing::_;
 
 class CalculatorTwoGridMaterialSpectralShapes : public ::testing::Test {
  public:
@@ -54,8 +54,8 @@ auto CalculatorTwoGridMaterialSpectralShapes::SetUp() -> void {
   }
 
   // set expectations
-  ON_CALL(*cross_sections_ptr_, sigma_s()).WillByDefault(Return(sigma_s));
-  ON_CALL(*cross_sections_ptr_, sigma_t()).WillByDefault(Return(sigma_t));
+  ON_CALL(*cross_sections_ptr_, sigma_s()).WillByDefault(ReturnRefOfCopy(sigma_s));
+  ON_CALL(*cross_sections_ptr_, sigma_t()).WillByDefault(ReturnRefOfCopy(sigma_t));
   for (int group = 0; group < n_groups; ++group) {
     ON_CALL(*spectral_shape_calculator_obs_ptr_, CalculateSpectralShape(sigma_t_matrices.at(group),
                                                                         sigma_s.at(group)))
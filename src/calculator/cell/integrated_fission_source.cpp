@@ -36,14 +36,15 @@ auto IntegratedFissionSource<dim>::CellValue(CellPtr cell_ptr, MomentPtr system_
     finite_element_ptr_->SetCell(cell_ptr);
 
     const int total_groups = system_moments_ptr->total_groups();
-    const auto nu_sigma_f = cross_sections_ptr_->nu_sigma_f().at(material_id);
+    const auto& nu_sigma_f = cross_sections_ptr_->nu_sigma_f().at(material_id);
 
+    const auto scalar_flux_at_cell_quadrature = scratch_arena_.Get(0, cell_quadrature_points_);
     for (int group = 0; group < total_groups; ++group) {
-      auto scalar_flux_at_cell_quadrature =
-          finite_element_ptr_->ValueAtQuadrature(system_moments_ptr->GetMoment({group, 0, 0}));
+      finite_element_ptr_->ValueAtQuadrature(system_moments_ptr->GetMoment({group, 0, 0}),
+                                             scalar_flux_at_cell_quadrature);
 
       for (int q = 0; q < cell_quadrature_points_; ++q) {
-        double scalar_flux = scalar_flux_at_cell_quadrature.at(q) * finite_element_ptr_->Jacobian(q);
+        double scalar_flux = scalar_flux_at_cell_quadrature[q] * finite_element_ptr_->Jacobian(q);
         fission_source += nu_sigma_f.at(group) * scalar_flux;
       }
     }
@@ -7,6 +7,7 @@
 #include "calculator/cell/integrated_fission_source_i.hpp"
 #include "domain/domain_types.hpp"
 #include "utility/has_dependencies.h"
+#include "utility/scratch_arena.hpp"
 
 namespace bart {
 
@@ -64,6 +65,8 @@ class IntegratedFissionSource : public IntegratedFissionSourceI<dim>, public uti
   std::shared_ptr<FiniteElement> finite_element_ptr_;
   std::shared_ptr<data::cross_sections::CrossSectionsI> cross_sections_ptr_;
   const int cell_quadrature_points_;
+  //! Buffer for the scalar flux at cell quadrature points
+  mutable utility::ScratchArena scratch_arena_{};
 };
 
 } // namespace calculator::cell
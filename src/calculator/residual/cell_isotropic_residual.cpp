@@ -30,7 +30,7 @@ auto CellIsotropicResidual<dim>::CalculateCellResidual(dealii::Vector<double> &t
                                                        const int group) -> void {
   //finite_element_ptr_->SetCell(cell_ptr);
   const int total_groups = current_flux_moments_ptr->total_groups();
-  const auto sigma_s{ cross_sections_ptr_->sigma_s().at(cell_ptr->material_id()) };
+  const auto& sigma_s{ cross_sections_ptr_->sigma_s().at(cell_ptr->material_id()) };
   const int cell_dofs = this->finite_element_ptr_->dofs_per_cell();
   std::vector<unsigned int> cell_global_dofs_indices(cell_dofs);
   cell_ptr->get_dof_indices(cell_global_dofs_indices);
@@ -12,6 +12,7 @@ namespace  {
 
 using namespace bart;
 using ::testing::NiceMock, ::testing::Return, ::testing::DoDefault, ::testing::AtLeast, ::testing::_, ::testing::ReturnRef;
+using ::testing::ReturnRefOfCopy;
 
 template <typename DimensionWrapper>
 class CellIsotropicResidualTest : public bart::testing::DealiiTestDomain<DimensionWrapper::value>, public ::testing::Test {
@@ -63,7 +64,7 @@ auto CellIsotropicResidualTest<DimensionWrapper>::SetUp() -> void {
   std::array<double, 9> sigma_s_values{2, 0.5, 0.25, 1.0/3.0, 3, 2.0/3.0, 1.0/5.0, 2.0/5.0, 5};
   dealii::FullMatrix<double> sigma_s_matrix(3, 3, sigma_s_values.data());
   MaterialIDMappedToSigmaS sigma_s_map{{material_id_, sigma_s_matrix}};
-  ON_CALL(*cross_sections_mock_ptr_, sigma_s()).WillByDefault(Return(sigma_s_map));
+  ON_CALL(*cross_sections_mock_ptr_, sigma_s()).WillByDefault(ReturnRefOfCopy(sigma_s_map));
 
   test_calculator_ = std::make_unique<CellIsotropicResidualCalculator>(cross_sections_mock_ptr_,
                                                                        finite_element_mock_ptr_);
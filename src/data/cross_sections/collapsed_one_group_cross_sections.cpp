@@ -48,7 +48,7 @@ auto collapse_matrix = [](MaterialIDMappedTo<FullMatrix> to_collapse) {
 } // namespace
 
 CollapsedOneGroupCrossSections::CollapsedOneGroupCrossSections(const CrossSectionsI &to_collapse) {
-  const auto sigma_s{ to_collapse.sigma_s() };
+  const auto& sigma_s{ to_collapse.sigma_s() };
   diffusion_coef_ = collapse_vector(to_collapse.diffusion_coef());
   sigma_t_ = collapse_vector(to_collapse.sigma_t());
   inverse_sigma_t_ = collapse_vector(to_collapse.inverse_sigma_t());
@@ -78,7 +78,7 @@ CollapsedOneGroupCrossSections::CollapsedOneGroupCrossSections(const CrossSectio
 CollapsedOneGroupCrossSections::CollapsedOneGroupCrossSections(
     const CrossSectionsI &to_collapse,
     const MaterialIDMappedTo<std::vector<double>>& scaling_factor_by_group) {
-  const auto sigma_s{ to_collapse.sigma_s() };
+  const auto& sigma_s{ to_collapse.sigma_s() };
   diffusion_coef_ = collapse_vector(ScaleVector(to_collapse.diffusion_coef(), scaling_factor_by_group));
   sigma_t_ = collapse_vector(ScaleVector(to_collapse.sigma_t(), scaling_factor_by_group));
   auto inverse_scaling_factor_by_group{ scaling_factor_by_group };
@@ -98,8 +98,8 @@ CollapsedOneGroupCrossSections::CollapsedOneGroupCrossSections(
   MaterialIDMappedTo<FullMatrix> transposed_fiss_transfer;
   MaterialIDMappedTo<FullMatrix> transposed_fiss_transfer_per_ster;
 
-  const auto fission_transfer = to_collapse.fiss_transfer();
-  const auto fission_transfer_per_ster = to_collapse.fiss_transfer_per_ster();
+  const auto& fission_transfer = to_collapse.fiss_transfer();
+  const auto& fission_transfer_per_ster = to_collapse.fiss_transfer_per_ster();
 
   for (const auto& [id, matrix] : fission_transfer) {
     transposed_fiss_transfer[id] = FullMatrix();
@@ -12,17 +12,19 @@ class CrossSections : public CrossSectionsI {
   using CrossSectionsI::DealiiMatrix;
   using CrossSectionsI::MaterialIDMappedTo;
 
-  auto diffusion_coef() const -> MaterialIDMappedTo<std::vector<double>> override { return diffusion_coef_; }
-  auto sigma_t() const -> MaterialIDMappedTo<std::vector<double>> override { return sigma_t_; }
-  auto inverse_sigma_t() const -> MaterialIDMappedTo<std::vector<double>> override { return inverse_sigma_t_; }
-  auto sigma_s() const -> MaterialIDMappedTo<DealiiMatrix> override { return sigma_s_; }
-  auto sigma_s_per_ster() const -> MaterialIDMappedTo<DealiiMatrix> override { return sigma_s_per_ster_; }
-  auto q() const -> MaterialIDMappedTo<std::vector<double>> override { return q_; }
-  auto q_per_ster() const -> MaterialIDMappedTo<std::vector<double>> override { return q_per_ster_; }
-  auto is_material_fissile() const -> MaterialIDMappedTo<bool> override { return is_material_fissile_; }
-  auto nu_sigma_f() const -> MaterialIDMappedTo<std::vector<double>> override { return nu_sigma_f_; }
-  auto fiss_transfer() const -> MaterialIDMappedTo<DealiiMatrix> override { return fiss_transfer_; }
-  auto fiss_transfer_per_ster() const -> MaterialIDMappedTo<DealiiMatrix> override { return fiss_transfer_per_ster_; }
+  auto diffusion_coef() const -> const MaterialIDMappedTo<std::vector<double>>& override { return diffusion_coef_; }
+  auto sigma_t() const -> const MaterialIDMappedTo<std::vector<double>>& override { return sigma_t_; }
+  auto inverse_sigma_t() const -> const MaterialIDMappedTo<std::vector<double>>& override { return inverse_sigma_t_; }
+  auto sigma_s() const -> const MaterialIDMappedTo<DealiiMatrix>& override { return sigma_s_; }
+  auto sigma_s_per_ster() const -> const MaterialIDMappedTo<DealiiMatrix>& override { return sigma_s_per_ster_; }
+  auto q() const -> const MaterialIDMappedTo<std::vector<double>>& override { return q_; }
+  auto q_per_ster() const -> const MaterialIDMappedTo<std::vector<double>>& override { return q_per_ster_; }
+  auto is_material_fissile() const -> const MaterialIDMappedTo<bool>& override { return is_material_fissile_; }
+  auto nu_sigma_f() const -> const MaterialIDMappedTo<std::vector<double>>& override { return nu_sigma_f_; }
+  auto fiss_transfer() const -> const MaterialIDMappedTo<DealiiMatrix>& override { return fiss_transfer_; }
+  auto fiss_transfer_per_ster() const -> const MaterialIDMappedTo<DealiiMatrix>& override {
+    return fiss_transfer_per_ster_;
+  }
 
  protected:
   MaterialIDMappedTo<std::vector<double>> diffusion_coef_;
@@ -9,6 +9,11 @@
 //! \brief Nuclear cross-section data
 namespace bart::data::cross_sections {
 
+/*! \brief Interface for cross-section data.
+ *
+ * Getters return references to data held by the object, so that they can be called for every cell without copying
+ * the data for all materials. References are valid for the lifetime of the object.
+ */
 class CrossSectionsI {
  public:
   using DealiiMatrix = dealii::FullMatrix<double>;
@@ -19,26 +24,26 @@ class CrossSectionsI {
   virtual ~CrossSectionsI() = default;
 
   //! Diffusion coefficient of all groups for all materials.
-  virtual auto diffusion_coef() const -> MaterialIDMappedTo<std::vector<double>> = 0;
+  virtual auto diffusion_coef() const -> const MaterialIDMappedTo<std::vector<double>>& = 0;
   //! \f$\sigma_\mathrm{t}\f$ of all groups for all materials.
-  virtual auto sigma_t() const -> MaterialIDMappedTo<std::vector<double>> = 0;
+  virtual auto sigma_t() const -> const MaterialIDMappedTo<std::vector<double>>& = 0;
   //! \f$1/\sigma_\mathrm{t}\f$ of all groups for all materials.
-  virtual auto inverse_sigma_t() const -> MaterialIDMappedTo<std::vector<double>> = 0;
+  virtual auto inverse_sigma_t() const -> const MaterialIDMappedTo<std::vector<double>>& = 0;
   //! Scattering matrices for all materials (i.e. \f$\sigma_\mathrm{s,g'\to g}\f$).
-  virtual auto sigma_s() const -> MaterialIDMappedTo<dealii::FullMatrix<double>> = 0;
+  virtual auto sigma_s() const -> const MaterialIDMappedTo<dealii::FullMatrix<double>>& = 0;
   //! \f$\sigma_\mathrm{s,g'\to g}/(4\pi)\f$
-  virtual auto sigma_s_per_ster() const -> MaterialIDMappedTo<dealii::FullMatrix<double>> = 0;
+  virtual auto sigma_s_per_ster() const -> const MaterialIDMappedTo<dealii::FullMatrix<double>>& = 0;
   //! \f$Q\f$ values of all groups for all materials.
-  virtual auto q() const -> MaterialIDMappedTo<std::vector<double>> = 0;
+  virtual auto q() const -> const MaterialIDMappedTo<std::vector<double>>& = 0;
   //! \f$Q/(4\pi)\f$ values of all groups for all materials.
-  virtual auto q_per_ster() const -> MaterialIDMappedTo<std::vector<double>> = 0;
-  virtual auto is_material_fissile() const -> MaterialIDMappedTo<bool> = 0;
+  virtual auto q_per_ster() const -> const MaterialIDMappedTo<std::vector<double>>& = 0;
+  virtual auto is_material_fissile() const -> const MaterialIDMappedTo<bool>& = 0;
   //! \f$\nu\sigma_\mathrm{f}\f$ of all groups for all fissile materials.
-  virtual auto nu_sigma_f() const -> MaterialIDMappedTo<std::vector<double>> = 0;
+  virtual auto nu_sigma_f() const -> const MaterialIDMappedTo<std::vector<double>>& = 0;
   //! \f$\chi\nu\sigma_\mathrm{f}\f$ of all incident and outgoing groups for fissile materials.
-  virtual auto fiss_transfer() const -> MaterialIDMappedTo<dealii::FullMatrix<double>> = 0;
+  virtual auto fiss_transfer() const -> const MaterialIDMappedTo<dealii::FullMatrix<double>>& = 0;
   //! \f$\chi\nu\sigma_\mathrm{f}/(4\pi)\f$ for fissile materials.
-  virtual auto fiss_transfer_per_ster() const -> MaterialIDMappedTo<dealii::FullMatrix<double>> = 0;
+  virtual auto fiss_transfer_per_ster() const -> const MaterialIDMappedTo<dealii::FullMatrix<double>>& = 0;
 };
 
 } // namespace bart::data::cross_sections
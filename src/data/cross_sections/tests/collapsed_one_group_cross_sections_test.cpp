@@ -10,7 +10,7 @@
 namespace  {
 
 using namespace bart;
-using ::testing::NiceMock, ::testing::Return, ::testing::DoDefault, ::testing::ContainerEq;
+using ::testing::NiceMock, ::testing::Return, ::testing::ReturnRefOfCopy, ::testing::DoDefault, ::testing::ContainerEq;
 
 class DataCrossSectionsCollapsedOneGroup : public ::testing::Test {
  public:
@@ -167,17 +167,17 @@ auto DataCrossSectionsCollapsedOneGroup::SetUp() -> void {
   collapsed_fiss_transfer_per_ster_ = CollapseMatrix(fission_transfer_per_ster);
   scaled_collapsed_fiss_transfer_per_ster_ = ScaleAndCollapseMatrix(transposed_fission_transfer_per_ster, scaling_factor_by_group_);
 
-  ON_CALL(*cross_sections_mock_ptr_, diffusion_coef()).WillByDefault(Return(diffusion_coef));
-  ON_CALL(*cross_sections_mock_ptr_, sigma_t()).WillByDefault(Return(sigma_t));
-  ON_CALL(*cross_sections_mock_ptr_, inverse_sigma_t()).WillByDefault(Return(inverse_sigma_t));
-  ON_CALL(*cross_sections_mock_ptr_, sigma_s()).WillByDefault(Return(sigma_s));
-  ON_CALL(*cross_sections_mock_ptr_, sigma_s_per_ster()).WillByDefault(Return(sigma_s_per_ster));
-  ON_CALL(*cross_sections_mock_ptr_, q()).WillByDefault(Return(q));
-  ON_CALL(*cross_sections_mock_ptr_, q_per_ster()).WillByDefault(Return(q_per_ster));
-  ON_CALL(*cross_sections_mock_ptr_, is_material_fissile()).WillByDefault(Return(is_material_fissile_));
-  ON_CALL(*cross_sections_mock_ptr_, nu_sigma_f()).WillByDefault(Return(nu_sigma_f));
-  ON_CALL(*cross_sections_mock_ptr_, fiss_transfer()).WillByDefault(Return(fission_transfer));
-  ON_CALL(*cross_sections_mock_ptr_, fiss_transfer_per_ster()).WillByDefault(Return(fission_transfer_per_ster));
+  ON_CALL(*cross_sections_mock_ptr_, diffusion_coef()).WillByDefault(ReturnRefOfCopy(diffusion_coef));
+  ON_CALL(*cross_sections_mock_ptr_, sigma_t()).WillByDefault(ReturnRefOfCopy(sigma_t));
+  ON_CALL(*cross_sections_mock_ptr_, inverse_sigma_t()).WillByDefault(ReturnRefOfCopy(inverse_sigma_t));
+  ON_CALL(*cross_sections_mock_ptr_, sigma_s()).WillByDefault(ReturnRefOfCopy(sigma_s));
+  ON_CALL(*cross_sections_mock_ptr_, sigma_s_per_ster()).WillByDefault(ReturnRefOfCopy(sigma_s_per_ster));
+  ON_CALL(*cross_sections_mock_ptr_, q()).WillByDefault(ReturnRefOfCopy(q));
+  ON_CALL(*cross_sections_mock_ptr_, q_per_ster()).WillByDefault(ReturnRefOfCopy(q_per_ster));
+  ON_CALL(*cross_sections_mock_ptr_, is_material_fissile()).WillByDefault(ReturnRefOfCopy(is_material_fissile_));
+  ON_CALL(*cross_sections_mock_ptr_, nu_sigma_f()).WillByDefault(ReturnRefOfCopy(nu_sigma_f));
+  ON_CALL(*cross_sections_mock_ptr_, fiss_transfer()).WillByDefault(ReturnRefOfCopy(fission_transfer));
+  ON_CALL(*cross_sections_mock_ptr_, fiss_transfer_per_ster()).WillByDefault(ReturnRefOfCopy(fission_transfer_per_ster));
 }
 
 TEST_F(DataCrossSectionsCollapsedOneGroup, Constructor) {
@@ -12,17 +12,17 @@ class CrossSectionsMock : public CrossSectionsI {
   using CrossSectionsI::DealiiMatrix;
   using CrossSectionsI::MaterialIDMappedTo;
 
-  MOCK_METHOD(MaterialIDMappedTo<std::vector<double>>, diffusion_coef, (), (const, override));
-  MOCK_METHOD(MaterialIDMappedTo<std::vector<double>>, sigma_t, (), (const, override));
-  MOCK_METHOD(MaterialIDMappedTo<std::vector<double>>, inverse_sigma_t, (), (const, override));
-  MOCK_METHOD(MaterialIDMappedTo<DealiiMatrix>, sigma_s, (), (const, override));
-  MOCK_METHOD(MaterialIDMappedTo<DealiiMatrix>, sigma_s_per_ster, (), (const, override));
-  MOCK_METHOD(MaterialIDMappedTo<std::vector<double>>, q, (), (const, override));
-  MOCK_METHOD(MaterialIDMappedTo<std::vector<double>>, q_per_ster, (), (const, override));
-  MOCK_METHOD(MaterialIDMappedTo<bool>, is_material_fissile, (), (const, override));
-  MOCK_METHOD(MaterialIDMappedTo<std::vector<double>>, nu_sigma_f, (), (const, override));
-  MOCK_METHOD(MaterialIDMappedTo<DealiiMatrix>, fiss_transfer, (), (const, override));
-  MOCK_METHOD(MaterialIDMappedTo<DealiiMatrix>, fiss_transfer_per_ster, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<std::vector<double>>&, diffusion_coef, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<std::vector<double>>&, sigma_t, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<std::vector<double>>&, inverse_sigma_t, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<DealiiMatrix>&, sigma_s, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<DealiiMatrix>&, sigma_s_per_ster, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<std::vector<double>>&, q, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<std::vector<double>>&, q_per_ster, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<bool>&, is_material_fissile, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<std::vector<double>>&, nu_sigma_f, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<DealiiMatrix>&, fiss_transfer, (), (const, override));
+  MOCK_METHOD(const MaterialIDMappedTo<DealiiMatrix>&, fiss_transfer_per_ster, (), (const, override));
 };
 
 } // namespace bart::data::cross_sections
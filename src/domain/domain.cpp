@@ -8,18 +8,31 @@
 namespace bart::domain {
 
 namespace  {
+// Limiting level differences at vertices is only required to build the multigrid hierarchy
 template <int dim>
-auto MeshSmoothing = typename dealii::Triangulation<dim>::MeshSmoothing(
-    dealii::Triangulation<dim>::smoothing_on_refinement | dealii::Triangulation<dim>::smoothing_on_coarsening);
+auto MeshSmoothing(const bool build_multigrid_hierarchy) -> typename dealii::Triangulation<dim>::MeshSmoothing {
+  using Triangulation = dealii::Triangulation<dim>;
+  if (build_multigrid_hierarchy) {
+    return typename Triangulation::MeshSmoothing(Triangulation::smoothing_on_refinement
+                                                     | Triangulation::smoothing_on_coarsening
+                                                     | Triangulation::limit_level_difference_at_vertices);
+  }
+  return typename Triangulation::MeshSmoothing(Triangulation::smoothing_on_refinement
+                                                   | Triangulation::smoothing_on_coarsening);
+}
 } // namespace
 
 template <int dim>
 Domain<dim>::Domain(std::unique_ptr<domain::mesh::MeshI<dim>> mesh,
                     std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
-                    problem::DiscretizationType discretization)
+                    problem::DiscretizationType discretization,
+                    const bool build_multigrid_hierarchy)
     : mesh_(std::move(mesh)),                     
       finite_element_(finite_element),
-      triangulation_(MPI_COMM_WORLD, MeshSmoothing<dim>),
+      build_multigrid_hierarchy_(build_multigrid_hierarchy),
+      triangulation_(MPI_COMM_WORLD, MeshSmoothing<dim>(build_multigrid_hierarchy),
+                     build_multigrid_hierarchy ? TriangulationType<dim>::type::construct_multigrid_hierarchy
+                                               : TriangulationType<dim>::type::default_setting),
       dof_handler_(triangulation_),
       discretization_type_(discretization) {
   AssertPointerNotNull(mesh_.get(), "mesh", "domain constructor");
@@ -38,10 +51,12 @@ template <>
 Domain<1>::Domain(
     std::unique_ptr<domain::mesh::MeshI<1>> mesh,
     std::shared_ptr<domain::finite_element::FiniteElementI<1>> finite_element,
-    problem::DiscretizationType discretization)
+    problem::DiscretizationType discretization,
+    const bool build_multigrid_hierarchy)
     : mesh_(std::move(mesh)),
       finite_element_(finite_element),
-      triangulation_(MeshSmoothing<1>),
+      build_multigrid_hierarchy_(build_multigrid_hierarchy),
+      triangulation_(MeshSmoothing<1>(build_multigrid_hierarchy)),
       dof_handler_(triangulation_),
       discretization_type_(discretization) {
   AssertPointerNotNull(mesh_.get(), "mesh", "domain constructor");
@@ -57,8 +72,10 @@ Domain<1>::Domain(
 
 template <int dim>
 Domain<dim>& Domain<dim>::SetUpDOF() {
-  // Setup dof Handler
+  // Setup dof Handler, level degrees of freedom are only used by geometric multigrid preconditioners
   dof_handler_.distribute_dofs(*(finite_element_->finite_element()));
+  if (build_multigrid_hierarchy_)
+    dof_handler_.distribute_mg_dofs();
   // Populate dof IndexSets
   locally_owned_dofs_ = dof_handler_.locally_owned_dofs();
   dealii::DoFTools::extract_locally_relevant_dofs(dof_handler_, locally_relevant_dofs_);
@@ -87,6 +104,8 @@ Domain<dim>& Domain<dim>::SetUpDOF() {
                                                      MPI_COMM_WORLD, locally_relevant_dofs_);
 
   constraint_matrix_.condense(dynamic_sparsity_pattern_);
+  SetUpBoundarySparsityPattern();
+  SetUpSystemMatrixStores();
 
   return *this;
 }
@@ -99,6 +118,8 @@ Domain<1>& Domain<1>::SetUpDOF() {
   dealii::GridTools::partition_triangulation(n_mpi_processes, triangulation_);
   dof_handler_.distribute_dofs(*(finite_element_)->finite_element());
   dealii::DoFRenumbering::subdomain_wise(dof_handler_);
+  if (build_multigrid_hierarchy_)
+    dof_handler_.distribute_mg_dofs();
 
   for (auto cell = dof_handler_.begin_active(); cell != dof_handler_.end(); ++cell) {
     if (cell->is_locally_owned())
@@ -119,10 +140,46 @@ Domain<1>& Domain<1>::SetUpDOF() {
   } else {
     dealii::DoFTools::make_sparsity_pattern(dof_handler_, dynamic_sparsity_pattern_, constraint_matrix_, false);
   }
+  SetUpBoundarySparsityPattern();
+  SetUpSystemMatrixStores();
 
   return *this;
 }
 
+template <int dim>
+auto Domain<dim>::SetUpBoundarySparsityPattern() -> void {
+  if constexpr (dim == 1) {
+    boundary_sparsity_pattern_.reinit(dof_handler_.n_dofs(), dof_handler_.n_dofs());
+  } else {
+    boundary_sparsity_pattern_.reinit(locally_relevant_dofs_.size(), locally_relevant_dofs_.size(),
+                                      locally_relevant_dofs_);
+  }
+
+  std::vector<dealii::types::global_dof_index> cell_dof_indices(dof_handler_.get_fe().dofs_per_cell);
+  for (const auto& cell : local_cells_) {
+    if (cell->at_boundary()) {
+      cell->get_dof_indices(cell_dof_indices);
+      constraint_matrix_.add_entries_local_to_global(cell_dof_indices, boundary_sparsity_pattern_, false);
+    }
+  }
+
+  if constexpr (dim > 1) {
+    dealii::SparsityTools::distribute_sparsity_pattern(boundary_sparsity_pattern_, locally_owned_dofs_,
+                                                       MPI_COMM_WORLD, locally_relevant_dofs_);
+    constraint_matrix_.condense(boundary_sparsity_pattern_);
+  }
+}
+
+template <int dim>
+auto Domain<dim>::SetUpSystemMatrixStores() -> void {
+  // Each pattern is stored once in a template matrix, its indices are copied to the store and the template released
+  system::MPISparseMatrix sparsity_template;
+  sparsity_template.reinit(locally_owned_dofs_, locally_owned_dofs_, dynamic_sparsity_pattern_, MPI_COMM_WORLD);
+  system_matrix_store_ptr_ = std::make_unique<system::SharedSparsityMatrixStore>(sparsity_template);
+  sparsity_template.reinit(locally_owned_dofs_, locally_owned_dofs_, boundary_sparsity_pattern_, MPI_COMM_WORLD);
+  boundary_matrix_store_ptr_ = std::make_unique<system::SharedSparsityMatrixStore>(sparsity_template);
+}
+
 template <int dim>
 Domain<dim>& Domain<dim>::SetUpMesh() {return SetUpMesh(0); }
 
@@ -153,9 +210,17 @@ auto Domain<dim>::GetCellVector() const -> dealii::Vector<double> {
 
 template<int dim>
 std::shared_ptr<system::MPISparseMatrix> Domain<dim>::MakeSystemMatrix() const {
-  auto system_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
-  system_matrix_ptr->reinit(locally_owned_dofs_, locally_owned_dofs_, dynamic_sparsity_pattern_, MPI_COMM_WORLD);
-  return system_matrix_ptr;
+  AssertThrow(system_matrix_store_ptr_ != nullptr,
+              dealii::ExcMessage("Error in Domain function MakeSystemMatrix: degrees of freedom are not set up"))
+  return system_matrix_store_ptr_->MakeMatrix();
+}
+
+template<int dim>
+std::shared_ptr<system::MPISparseMatrix> Domain<dim>::MakeBoundarySystemMatrix() const {
+  AssertThrow(boundary_matrix_store_ptr_ != nullptr,
+              dealii::ExcMessage("Error in Domain function MakeBoundarySystemMatrix: degrees of freedom are not set "
+                                 "up"))
+  return boundary_matrix_store_ptr_->MakeMatrix();
 }
 
 template<int dim>
@@ -14,6 +14,7 @@
 #include "domain/finite_element/finite_element_i.hpp"
 #include "domain/mesh/mesh_i.hpp"
 #include "problem/parameter_types.hpp"
+#include "system/shared_sparsity_matrix_store.hpp"
 #include "system/system_types.h"
 #include "utility/has_dependencies.h"
 
@@ -58,10 +59,16 @@ class Domain : public DomainI<dim>, public utility::HasDependencies {
   /*! \brief Constructor.
    * Takes ownership of injected dependencies (MeshI and FiniteElementI) and
    * sets the type of discretization (default: continuous FEM).
+   *
+   * If build_multigrid_hierarchy is true, the triangulation keeps the levels
+   * created by refinement with limited level differences at vertices, and
+   * SetUpDOF distributes level degrees of freedom, as required by geometric
+   * multigrid preconditioners. Otherwise neither is set up.
    */
   Domain(std::unique_ptr<domain::mesh::MeshI<dim>> mesh,
          std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element,
-         problem::DiscretizationType discretization = problem::DiscretizationType::kContinuousFEM);
+         problem::DiscretizationType discretization = problem::DiscretizationType::kContinuousFEM,
+         bool build_multigrid_hierarchy = false);
   ~Domain() = default;
 
   auto SetUpDOF() -> Domain<dim>& override;
@@ -71,6 +78,7 @@ class Domain : public DomainI<dim>, public utility::HasDependencies {
   auto GetCellMatrix() const -> dealii::FullMatrix<double> override;
   auto GetCellVector() const -> dealii::Vector<double> override;
   auto MakeSystemMatrix() const -> std::shared_ptr<system::MPISparseMatrix> override;
+  auto MakeBoundarySystemMatrix() const -> std::shared_ptr<system::MPISparseMatrix> override;
   auto MakeSystemVector() const -> std::shared_ptr<system::MPIVector> override;
 
   auto Cells() const -> CellRange override { return local_cells_; };
@@ -78,6 +86,7 @@ class Domain : public DomainI<dim>, public utility::HasDependencies {
   auto total_degrees_of_freedom() const -> int override ;
   auto dof_handler() const -> const dealii::DoFHandler<dim>& override { return dof_handler_; }
   auto locally_owned_dofs() const -> dealii::IndexSet override { return locally_owned_dofs_; }
+  auto build_multigrid_hierarchy() const -> bool { return build_multigrid_hierarchy_; }
 
  private:
 
@@ -87,6 +96,9 @@ class Domain : public DomainI<dim>, public utility::HasDependencies {
   //! Internal owned finite element object
   std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_;
 
+  //! Indicates if the multigrid hierarchy and level degrees of freedom are set up
+  const bool build_multigrid_hierarchy_;
+
   //! Internal distributed triangulation object
   typename TriangulationType<dim>::type triangulation_;
 
@@ -111,6 +123,21 @@ class Domain : public DomainI<dim>, public utility::HasDependencies {
   /*! Dynamic sparsity pattern for MPI matrices */
   dealii::DynamicSparsityPattern dynamic_sparsity_pattern_;
 
+  /*! Dynamic sparsity pattern for MPI matrices that couple degrees of freedom on boundary cells only */
+  dealii::DynamicSparsityPattern boundary_sparsity_pattern_;
+
+  /*! Sets up the boundary sparsity pattern, couplings between all degrees of freedom of each boundary cell */
+  auto SetUpBoundarySparsityPattern() -> void;
+
+  /*! Store of system matrices, all system matrices share the sparsity indices of the dynamic sparsity pattern */
+  std::unique_ptr<system::SharedSparsityMatrixStore> system_matrix_store_ptr_{ nullptr };
+
+  /*! Store of boundary system matrices, sharing the sparsity indices of the boundary sparsity pattern */
+  std::unique_ptr<system::SharedSparsityMatrixStore> boundary_matrix_store_ptr_{ nullptr };
+
+  /*! Sets up the system matrix stores from the dynamic and boundary sparsity patterns */
+  auto SetUpSystemMatrixStores() -> void;
+
   /*! local cells */
   CellRange local_cells_;
 
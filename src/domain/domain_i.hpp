@@ -75,6 +75,9 @@ class DomainI : public utility::HasDescription {
   /*! Get an MPI matrix suitable for the system */
   virtual auto MakeSystemMatrix() const -> std::shared_ptr<bart::system::MPISparseMatrix> = 0;
 
+  /*! Get an MPI matrix suitable for terms that only couple degrees of freedom on cells at the boundary */
+  virtual auto MakeBoundarySystemMatrix() const -> std::shared_ptr<bart::system::MPISparseMatrix> = 0;
+
   /*! Get an MPI vector suitable for the system */
   virtual auto MakeSystemVector() const -> std::shared_ptr<bart::system::MPIVector> = 0;
 
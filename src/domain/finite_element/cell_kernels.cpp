@@ -0,0 +1,61 @@
+#include "domain/finite_element/cell_kernels.hpp"
+
+namespace bart::domain::finite_element {
+
+namespace {
+
+constexpr auto IntegerPower(int base, int exponent) -> int {
+  int result{ 1 };
+  for (int i = 0; i < exponent; ++i)
+    result *= base;
+  return result;
+}
+
+/* Kernels for a Lagrange element of the given degree with a Gaussian quadrature of order degree + 1, which has
+ * (degree + 1)^dim degrees of freedom and cell quadrature points, and (degree + 1)^(dim - 1) face quadrature points. */
+template <int dim, int degree>
+auto SpecializedCellKernels() -> const CellKernels& {
+  constexpr int n_dofs{ IntegerPower(degree + 1, dim) };
+  constexpr int n_cell_quad_pts{ IntegerPower(degree + 1, dim) };
+  constexpr int n_face_quad_pts{ IntegerPower(degree + 1, dim - 1) };
+  static const CellKernels kernels{
+      .cell_weighted_matrix_sum = &kernel::WeightedMatrixSum<n_dofs, n_cell_quad_pts>,
+      .cell_weighted_vector_sum = &kernel::WeightedVectorSum<n_dofs, n_cell_quad_pts>,
+      .face_weighted_outer_product_sum = &kernel::WeightedOuterProductSum<n_dofs, n_face_quad_pts>,
+      .cell_batched_weighted_matrix_sum = &kernel::BatchedWeightedMatrixSum<n_dofs, n_cell_quad_pts>,
+      .dofs_per_cell = n_dofs,
+      .n_cell_quad_pts = n_cell_quad_pts,
+      .n_face_quad_pts = n_face_quad_pts};
+  return kernels;
+}
+
+} // namespace
+
+auto GenericCellKernels() -> const CellKernels& {
+  static const CellKernels kernels{
+      .cell_weighted_matrix_sum = &kernel::WeightedMatrixSum,
+      .cell_weighted_vector_sum = &kernel::WeightedVectorSum,
+      .face_weighted_outer_product_sum = &kernel::WeightedOuterProductSum,
+      .cell_batched_weighted_matrix_sum = &kernel::BatchedWeightedMatrixSum};
+  return kernels;
+}
+
+template <int dim>
+auto SelectCellKernels(const int polynomial_degree) -> const CellKernels& {
+  switch (polynomial_degree) {
+    case 1:
+      return SpecializedCellKernels<dim, 1>();
+    case 2:
+      return SpecializedCellKernels<dim, 2>();
+    case 3:
+      return SpecializedCellKernels<dim, 3>();
+    default:
+      return GenericCellKernels();
+  }
+}
+
+template auto SelectCellKernels<1>(int) -> const CellKernels&;
+template auto SelectCellKernels<2>(int) -> const CellKernels&;
+template auto SelectCellKernels<3>(int) -> const CellKernels&;
+
+} // namespace bart::domain::finite_element
@@ -0,0 +1,217 @@
+#ifndef BART_SRC_DOMAIN_FINITE_ELEMENT_CELL_KERNELS_HPP_
+#define BART_SRC_DOMAIN_FINITE_ELEMENT_CELL_KERNELS_HPP_
+
+#include <array>
+
+#include <deal.II/base/vectorization.h>
+
+namespace bart::domain::finite_element {
+
+/*! \brief Dense loops used by formulations to integrate cell and face terms.
+ *
+ * Formulations precalculate the values they need at each quadrature point in flat, row-major tables and then integrate
+ * by taking a weighted sum over quadrature points. These loops are where cell matrices spend most of their time, and
+ * their trip counts are fixed once the finite element is chosen. Each kernel therefore has a generic implementation
+ * using runtime sizes, and specialized implementations for common elements where the number of degrees of freedom and
+ * quadrature points are compile-time constants so that the loops can be unrolled and vectorized.
+ *
+ * All kernels share a signature so that they can be stored as function pointers, specialized kernels ignore the passed
+ * sizes. The sizes a specialized set was built for are stored in the struct and must match the finite element it is
+ * used with, see CellKernels::Matches.
+ */
+struct CellKernels {
+  /*! \brief Adds a weighted sum of matrices, \f$A_{ij} \mathrel{+}= \sum_q w_q M^q_{ij}\f$.
+   *
+   * \param to_fill row-major \f$n \times n\f$ matrix to add to.
+   * \param weights weight for each quadrature point.
+   * \param matrices row-major \f$n \times n\f$ matrix for each quadrature point, stored contiguously.
+   * \param n_dofs number of degrees of freedom \f$n\f$.
+   * \param n_quadrature_points number of quadrature points.
+   */
+  using WeightedMatrixSum = void (*)(double* to_fill, const double* weights, const double* matrices, int n_dofs,
+                                     int n_quadrature_points);
+  /*! \brief Adds a weighted sum of vectors, \f$b_i \mathrel{+}= \sum_q w_q v^q_i\f$.
+   *
+   * \param to_fill vector of length \f$n\f$ to add to.
+   * \param weights weight for each quadrature point.
+   * \param vectors vector of length \f$n\f$ for each quadrature point, stored contiguously.
+   * \param n_dofs number of degrees of freedom \f$n\f$.
+   * \param n_quadrature_points number of quadrature points.
+   */
+  using WeightedVectorSum = void (*)(double* to_fill, const double* weights, const double* vectors, int n_dofs,
+                                     int n_quadrature_points);
+  /*! \brief Adds a weighted sum of outer products, \f$A_{ij} \mathrel{+}= \sum_q w_q v^q_i v^q_j\f$.
+   *
+   * Parameters are as for WeightedVectorSum, with to_fill a row-major \f$n \times n\f$ matrix.
+   */
+  using WeightedOuterProductSum = void (*)(double* to_fill, const double* weights, const double* vectors, int n_dofs,
+                                           int n_quadrature_points);
+  /*! \brief Adds a weighted sum of matrices for a batch of cells, one cell per SIMD lane.
+   *
+   * As WeightedMatrixSum, but each lane of the weights and of the result belongs to a different cell. The tables are
+   * shared by all cells in the batch, so each table entry is loaded once and used for every lane.
+   *
+   * \param to_fill row-major \f$n \times n\f$ matrix to add to, with one cell in each lane.
+   * \param weights weight for each quadrature point, with one cell in each lane.
+   */
+  using BatchedWeightedMatrixSum = void (*)(dealii::VectorizedArray<double>* to_fill,
+                                            const dealii::VectorizedArray<double>* weights, const double* matrices,
+                                            int n_dofs, int n_quadrature_points);
+
+  //! Weighted sum of matrices over cell quadrature points
+  WeightedMatrixSum cell_weighted_matrix_sum{ nullptr };
+  //! Weighted sum of vectors over cell quadrature points
+  WeightedVectorSum cell_weighted_vector_sum{ nullptr };
+  //! Weighted sum of outer products over face quadrature points
+  WeightedOuterProductSum face_weighted_outer_product_sum{ nullptr };
+  //! Weighted sum of matrices over cell quadrature points for a batch of cells
+  BatchedWeightedMatrixSum cell_batched_weighted_matrix_sum{ nullptr };
+
+  //! Degrees of freedom per cell for a specialized set, 0 for the generic set
+  int dofs_per_cell{ 0 };
+  //! Cell quadrature points for a specialized set, 0 for the generic set
+  int n_cell_quad_pts{ 0 };
+  //! Face quadrature points for a specialized set, 0 for the generic set
+  int n_face_quad_pts{ 0 };
+
+  /*! \brief Returns true if the kernels use compile-time sizes. */
+  [[nodiscard]] auto is_specialized() const -> bool { return dofs_per_cell > 0; }
+  /*! \brief Returns true if the kernels can be used with a finite element with the given sizes. */
+  [[nodiscard]] auto Matches(int dofs, int cell_quad_pts, int face_quad_pts) const -> bool {
+    return !is_specialized() || (dofs == dofs_per_cell && cell_quad_pts == n_cell_quad_pts &&
+        face_quad_pts == n_face_quad_pts);
+  }
+};
+
+/*! \brief Returns kernels that work for any finite element. */
+auto GenericCellKernels() -> const CellKernels&;
+
+/*! \brief Returns the kernels to use for a Lagrange element with a Gaussian quadrature of order degree + 1.
+ *
+ * Specialized kernels are returned for polynomial degrees 1 to 3, other degrees fall back to the generic kernels.
+ *
+ * \tparam dim spatial dimension.
+ * \param polynomial_degree polynomial degree of the finite element.
+ */
+template <int dim>
+auto SelectCellKernels(int polynomial_degree) -> const CellKernels&;
+
+namespace kernel {
+
+// Generic implementations =============================================================================================
+
+inline auto WeightedMatrixSum(double* to_fill, const double* weights, const double* matrices, const int n_dofs,
+                              const int n_quadrature_points) -> void {
+  const int block_size{ n_dofs * n_dofs };
+  for (int q = 0; q < n_quadrature_points; ++q) {
+    const double weight{ weights[q] };
+    const double* matrix{ matrices + q * block_size };
+    for (int k = 0; k < block_size; ++k)
+      to_fill[k] += weight * matrix[k];
+  }
+}
+
+inline auto WeightedVectorSum(double* to_fill, const double* weights, const double* vectors, const int n_dofs,
+                              const int n_quadrature_points) -> void {
+  for (int q = 0; q < n_quadrature_points; ++q) {
+    const double weight{ weights[q] };
+    const double* vector{ vectors + q * n_dofs };
+    for (int i = 0; i < n_dofs; ++i)
+      to_fill[i] += weight * vector[i];
+  }
+}
+
+inline auto WeightedOuterProductSum(double* to_fill, const double* weights, const double* vectors, const int n_dofs,
+                                    const int n_quadrature_points) -> void {
+  for (int q = 0; q < n_quadrature_points; ++q) {
+    const double* vector{ vectors + q * n_dofs };
+    for (int i = 0; i < n_dofs; ++i) {
+      const double weighted_i{ weights[q] * vector[i] };
+      for (int j = 0; j < n_dofs; ++j)
+        to_fill[i * n_dofs + j] += weighted_i * vector[j];
+    }
+  }
+}
+
+inline auto BatchedWeightedMatrixSum(dealii::VectorizedArray<double>* to_fill,
+                                     const dealii::VectorizedArray<double>* weights, const double* matrices,
+                                     const int n_dofs, const int n_quadrature_points) -> void {
+  const int block_size{ n_dofs * n_dofs };
+  for (int q = 0; q < n_quadrature_points; ++q) {
+    const dealii::VectorizedArray<double> weight{ weights[q] };
+    const double* matrix{ matrices + q * block_size };
+    for (int k = 0; k < block_size; ++k)
+      to_fill[k] += weight * matrix[k];
+  }
+}
+
+// Specialized implementations =========================================================================================
+/* These accumulate into local fixed-size arrays so the compiler knows the output does not alias the inputs, and the
+ * constant trip counts let the inner loops be fully unrolled and vectorized. */
+
+template <int n_dofs, int n_quadrature_points>
+auto WeightedMatrixSum(double* to_fill, const double* weights, const double* matrices, int /*n_dofs*/,
+                       int /*n_quadrature_points*/) -> void {
+  constexpr int block_size{ n_dofs * n_dofs };
+  std::array<double, block_size> sum{};
+  for (int q = 0; q < n_quadrature_points; ++q) {
+    const double weight{ weights[q] };
+    const double* matrix{ matrices + q * block_size };
+    for (int k = 0; k < block_size; ++k)
+      sum[k] += weight * matrix[k];
+  }
+  for (int k = 0; k < block_size; ++k)
+    to_fill[k] += sum[k];
+}
+
+template <int n_dofs, int n_quadrature_points>
+auto WeightedVectorSum(double* to_fill, const double* weights, const double* vectors, int /*n_dofs*/,
+                       int /*n_quadrature_points*/) -> void {
+  std::array<double, n_dofs> sum{};
+  for (int q = 0; q < n_quadrature_points; ++q) {
+    const double weight{ weights[q] };
+    const double* vector{ vectors + q * n_dofs };
+    for (int i = 0; i < n_dofs; ++i)
+      sum[i] += weight * vector[i];
+  }
+  for (int i = 0; i < n_dofs; ++i)
+    to_fill[i] += sum[i];
+}
+
+template <int n_dofs, int n_quadrature_points>
+auto WeightedOuterProductSum(double* to_fill, const double* weights, const double* vectors, int /*n_dofs*/,
+                             int /*n_quadrature_points*/) -> void {
+  std::array<double, n_dofs * n_dofs> sum{};
+  for (int q = 0; q < n_quadrature_points; ++q) {
+    std::array<double, n_dofs> vector;
+    for (int i = 0; i < n_dofs; ++i)
+      vector[i] = vectors[q * n_dofs + i];
+    for (int i = 0; i < n_dofs; ++i) {
+      const double weighted_i{ weights[q] * vector[i] };
+      for (int j = 0; j < n_dofs; ++j)
+        sum[i * n_dofs + j] += weighted_i * vector[j];
+    }
+  }
+  for (int k = 0; k < n_dofs * n_dofs; ++k)
+    to_fill[k] += sum[k];
+}
+
+/* The batched sum accumulates directly into the output, a local copy would hold a full matrix per lane and is too
+ * large to keep on the stack for higher order elements. */
+template <int n_dofs, int n_quadrature_points>
+auto BatchedWeightedMatrixSum(dealii::VectorizedArray<double>* to_fill, const dealii::VectorizedArray<double>* weights,
+                              const double* matrices, int /*n_dofs*/, int /*n_quadrature_points*/) -> void {
+  constexpr int block_size{ n_dofs * n_dofs };
+  for (int q = 0; q < n_quadrature_points; ++q) {
+    const dealii::VectorizedArray<double> weight{ weights[q] };
+    const double* matrix{ matrices + q * block_size };
+    for (int k = 0; k < block_size; ++k)
+      to_fill[k] += weight * matrix[k];
+  }
+}
+
+} // namespace kernel
+
+} // namespace bart::domain::finite_element
+
+#endif //BART_SRC_DOMAIN_FINITE_ELEMENT_CELL_KERNELS_HPP_
@@ -1,18 +1,23 @@
 #include "domain/finite_element/finite_element.hpp"
 
+#include <algorithm>
+#include <atomic>
+
 namespace bart::domain::finite_element {
 
 template <int dim>
 auto FiniteElement<dim>::SetCell(const domain::CellPtr<dim> &to_set) -> bool {
+  auto& current_context = context();
   bool already_set{ false };
 
-  if (values_reinit_called_) {
-    already_set = (values_->get_cell()->id() == to_set->id());
+  if (current_context.values_reinit_called) {
+    already_set = (current_context.values->get_cell()->id() == to_set->id());
   }
 
   if (!already_set) {
-    values_->reinit(to_set);
-    values_reinit_called_ = true;
+    current_context.values->reinit(to_set);
+    current_context.values_reinit_called = true;
+    current_context.cell = to_set;
   }
 
   return !already_set;
@@ -20,18 +25,20 @@ auto FiniteElement<dim>::SetCell(const domain::CellPtr<dim> &to_set) -> bool {
 
 template <int dim>
 auto FiniteElement<dim>::SetFace(const domain::CellPtr<dim> &to_set, const domain::FaceIndex face) -> bool{
+  auto& current_context = context();
   bool already_set{ false };
   bool cell_already_set{ false };
 
-  if (face_values_reinit_called_) {
-    cell_already_set = (face_values_->get_cell()->id() == to_set->id());
-    bool face_already_set = (static_cast<int>(face_values_->get_face_index()) == face.get());
+  if (current_context.face_values_reinit_called) {
+    cell_already_set = (current_context.face_values->get_cell()->id() == to_set->id());
+    bool face_already_set = (static_cast<int>(current_context.face_values->get_face_index()) == face.get());
     already_set = (cell_already_set && face_already_set);
   }
 
   if (!already_set) {
-    face_values_->reinit(to_set, face.get());
-    face_values_reinit_called_ = true;
+    current_context.face_values->reinit(to_set, face.get());
+    current_context.face_values_reinit_called = true;
+    current_context.face_cell = to_set;
   }
 
   return !cell_already_set;
@@ -40,17 +47,145 @@ auto FiniteElement<dim>::SetFace(const domain::CellPtr<dim> &to_set, const domai
 template<int dim>
 auto FiniteElement<dim>::ValueAtQuadrature(const DealiiVector& values_at_dofs) const -> std::vector<double> {
   std::vector<double> return_vector(n_cell_quad_pts(), 0);
-  values_->get_function_values(values_at_dofs, return_vector);
+  ValueAtQuadrature(values_at_dofs, return_vector);
   return return_vector;
 }
 
 template<int dim>
 auto FiniteElement<dim>::ValueAtFaceQuadrature(const DealiiVector& values_at_dofs) const -> std::vector<double> {
   std::vector<double> return_vector(n_face_quad_pts(), 0);
-  face_values_->get_function_values(values_at_dofs, return_vector);
+  ValueAtFaceQuadrature(values_at_dofs, return_vector);
   return return_vector;
 }
 
+template<int dim>
+auto FiniteElement<dim>::ValueAtQuadrature(const DealiiVector& values_at_dofs,
+                                           std::span<double> to_fill) const -> void {
+  auto& current_context = context();
+  AssertThrow(current_context.values_reinit_called,
+              dealii::ExcMessage("Error in FiniteElement function ValueAtQuadrature: no cell has been set"))
+  AssertThrow(static_cast<int>(to_fill.size()) == n_cell_quad_pts(),
+              dealii::ExcMessage("Error in FiniteElement function ValueAtQuadrature: buffer size does not match the "
+                                 "number of cell quadrature points"))
+  SumAtQuadrature(*current_context.values, current_context.cell, current_context, values_at_dofs, to_fill);
+}
+
+template<int dim>
+auto FiniteElement<dim>::ValueAtFaceQuadrature(const DealiiVector& values_at_dofs,
+                                               std::span<double> to_fill) const -> void {
+  auto& current_context = context();
+  AssertThrow(current_context.face_values_reinit_called,
+              dealii::ExcMessage("Error in FiniteElement function ValueAtFaceQuadrature: no face has been set"))
+  AssertThrow(static_cast<int>(to_fill.size()) == n_face_quad_pts(),
+              dealii::ExcMessage("Error in FiniteElement function ValueAtFaceQuadrature: buffer size does not match "
+                                 "the number of face quadrature points"))
+  SumAtQuadrature(*current_context.face_values, current_context.face_cell, current_context, values_at_dofs,
+                  to_fill);
+}
+
+template<int dim>
+auto FiniteElement<dim>::WeightedValueAtQuadrature(std::span<const double> weights,
+                                                   std::span<const DealiiVector* const> values_at_dofs,
+                                                   std::span<double> to_fill) const -> void {
+  auto& current_context = context();
+  AssertThrow(current_context.values_reinit_called,
+              dealii::ExcMessage("Error in FiniteElement function WeightedValueAtQuadrature: no cell has been set"))
+  AssertThrow(weights.size() == values_at_dofs.size(),
+              dealii::ExcMessage("Error in FiniteElement function WeightedValueAtQuadrature: number of weights does "
+                                 "not match the number of vectors"))
+  AssertThrow(static_cast<int>(to_fill.size()) == n_cell_quad_pts(),
+              dealii::ExcMessage("Error in FiniteElement function WeightedValueAtQuadrature: buffer size does not "
+                                 "match the number of cell quadrature points"))
+  auto& local_dof_indices = current_context.local_dof_indices;
+  auto& local_values = current_context.local_values;
+  current_context.cell->get_dof_indices(local_dof_indices);
+  std::fill(local_values.begin(), local_values.end(), 0.0);
+  for (std::size_t k = 0; k < weights.size(); ++k) {
+    if (weights[k] == 0.0)
+      continue;
+    const auto& vector = *values_at_dofs[k];
+    for (std::size_t i = 0; i < local_dof_indices.size(); ++i)
+      local_values[i] += weights[k] * vector(local_dof_indices[i]);
+  }
+  ProjectToQuadrature(*current_context.values, local_values, to_fill);
+}
+
+template<int dim>
+auto FiniteElement<dim>::SumAtQuadrature(const dealii::FEValuesBase<dim>& values, const domain::CellPtr<dim>& cell_ptr,
+                                         EvaluationContext& current_context, const DealiiVector& values_at_dofs,
+                                         std::span<double> to_fill) const -> void {
+  auto& local_dof_indices = current_context.local_dof_indices;
+  cell_ptr->get_dof_indices(local_dof_indices);
+  for (std::size_t i = 0; i < local_dof_indices.size(); ++i)
+    current_context.local_values[i] = values_at_dofs(local_dof_indices[i]);
+  ProjectToQuadrature(values, current_context.local_values, to_fill);
+}
+
+template<int dim>
+auto FiniteElement<dim>::ProjectToQuadrature(const dealii::FEValuesBase<dim>& values,
+                                             std::span<const double> local_values,
+                                             std::span<double> to_fill) const -> void {
+  // Summed in the same order as FEValuesBase::get_function_values
+  std::fill(to_fill.begin(), to_fill.end(), 0.0);
+  for (std::size_t i = 0; i < local_values.size(); ++i) {
+    const double value_at_dof{ local_values[i] };
+    if (value_at_dof == 0.0)
+      continue;
+    for (std::size_t q = 0; q < to_fill.size(); ++q)
+      to_fill[q] += value_at_dof * values.shape_value(i, q);
+  }
+}
+
+template<int dim>
+auto FiniteElement<dim>::context() const -> EvaluationContext& {
+  // Most calls come from a thread that used this object last, which skips the lookup in the thread local storage
+  thread_local std::uint64_t last_instance_id{ 0 };
+  thread_local EvaluationContext* last_context{ nullptr };
+  if (last_instance_id == instance_id_)
+    return *last_context;
+
+  auto& context_ptr = contexts_.get();
+  if (context_ptr == nullptr)
+    context_ptr = MakeContext();
+  last_instance_id = instance_id_;
+  last_context = context_ptr.get();
+  return *last_context;
+}
+
+template<int dim>
+auto FiniteElement<dim>::MakeContext() const -> std::unique_ptr<EvaluationContext> {
+  AssertThrow(values_ != nullptr && face_values_ != nullptr,
+              dealii::ExcMessage("Error in FiniteElement function MakeContext: values objects have not been set"))
+  auto new_context = std::make_unique<EvaluationContext>();
+  new_context->local_dof_indices.resize(finite_element_->dofs_per_cell);
+  new_context->local_values.resize(finite_element_->dofs_per_cell);
+  new_context->values = std::make_unique<dealii::FEValues<dim>>(
+      values_->get_mapping(), *finite_element_, values_->get_quadrature(), values_->get_update_flags());
+  new_context->face_values = std::make_unique<dealii::FEFaceValues<dim>>(
+      face_values_->get_mapping(), *finite_element_, face_values_->get_quadrature(), face_values_->get_update_flags());
+  if (neighbor_face_values_ != nullptr) {
+    new_context->neighbor_face_values = std::make_unique<dealii::FEFaceValues<dim>>(
+        neighbor_face_values_->get_mapping(), *finite_element_, neighbor_face_values_->get_quadrature(),
+        neighbor_face_values_->get_update_flags());
+  }
+  return new_context;
+}
+
+template<int dim>
+auto FiniteElement<dim>::NextInstanceId() -> std::uint64_t {
+  static std::atomic<std::uint64_t> next_instance_id{ 1 };
+  return next_instance_id++;
+}
+
+template<int dim>
+auto FiniteElement<dim>::set_cell_kernels(const CellKernels& to_set) -> FiniteElement<dim>& {
+  AssertThrow(to_set.Matches(dofs_per_cell(), n_cell_quad_pts(), n_face_quad_pts()),
+              dealii::ExcMessage("Error in FiniteElement::set_cell_kernels: kernels are specialized for a different "
+                                 "number of degrees of freedom or quadrature points"))
+  cell_kernels_ = &to_set;
+  return *this;
+}
+
 template class FiniteElement<1>;
 template class FiniteElement<2>;
 template class FiniteElement<3>;
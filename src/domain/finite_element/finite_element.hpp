@@ -1,7 +1,14 @@
 #ifndef BART_DOMAIN_FINITE_ELEMENT_HPP_
 #define BART_DOMAIN_FINITE_ELEMENT_HPP_
 
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
 #include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/thread_local_storage.h>
+#include <deal.II/base/types.h>
 #include <deal.II/fe/fe_values.h>
 
 #include "domain/finite_element/finite_element_i.hpp"
@@ -13,12 +20,21 @@ namespace bart::domain::finite_element {
  * This class is almost entirley a wrapper for various Dealii objects and many calls are just passed through to the
  * underlying classes.
  *
+ * Each thread that uses the finite element is given its own evaluation context, holding copies of the values objects
+ * and the cell and face they were last set to. These are built on first use from the values objects set by derived
+ * classes, which are never reinitialized themselves. Setting a cell or face and reading values on one thread therefore
+ * never changes the values seen by another, so objects sharing the finite element can be used from multiple threads.
+ *
  * @tparam dim spatial dimension
  */
 template<int dim>
 class FiniteElement : public FiniteElementI<dim> {
  public:
   using typename FiniteElementI<dim>::DealiiVector, typename FiniteElementI<dim>::Tensor;
+  FiniteElement() = default;
+  //! Copies would share the instance id used to find the evaluation context of each thread, so copying is disabled
+  FiniteElement(const FiniteElement&) = delete;
+  auto operator=(const FiniteElement&) -> FiniteElement& = delete;
   virtual ~FiniteElement() = default;
 
   // Basic Finite Element data
@@ -31,55 +47,104 @@ class FiniteElement : public FiniteElementI<dim> {
 
   [[nodiscard]] auto ShapeValue(const int cell_degree_of_freedom,
                                 const int cell_quadrature_point) const -> double override {
-    return values_->shape_value(cell_degree_of_freedom, cell_quadrature_point);
+    return context().values->shape_value(cell_degree_of_freedom, cell_quadrature_point);
   }
 
   [[nodiscard]] auto FaceShapeValue(const int cell_degree_of_freedom,
                                     const int face_quadrature_point) const -> double override {
-    return face_values_->shape_value(cell_degree_of_freedom, face_quadrature_point);
+    return context().face_values->shape_value(cell_degree_of_freedom, face_quadrature_point);
   }
 
   [[nodiscard]] auto ShapeGradient(const int cell_degree_of_freedom,
                                    const int cell_quadrature_point) const -> Tensor override {
-    return values_->shape_grad(cell_degree_of_freedom, cell_quadrature_point);
+    return context().values->shape_grad(cell_degree_of_freedom, cell_quadrature_point);
   }
 
   [[nodiscard]] auto Jacobian(const int cell_quadrature_point) const -> double override {
-    return values_->JxW(cell_quadrature_point);
+    return context().values->JxW(cell_quadrature_point);
   }
 
   [[nodiscard]] auto FaceJacobian(const int face_quadrature_point) const -> double override {
-    return face_values_->JxW(face_quadrature_point);
+    return context().face_values->JxW(face_quadrature_point);
   }
 
   [[nodiscard]] auto FaceNormal() const -> Tensor override {
-    return face_values_->normal_vector(0);
+    return context().face_values->normal_vector(0);
   }
 
   [[nodiscard]] auto ValueAtQuadrature(const DealiiVector& values_at_dofs) const -> std::vector<double> override;
   [[nodiscard]] auto ValueAtFaceQuadrature(const DealiiVector& values_at_dofs) const -> std::vector<double> override;
+  auto ValueAtQuadrature(const DealiiVector& values_at_dofs, std::span<double> to_fill) const -> void override;
+  auto ValueAtFaceQuadrature(const DealiiVector& values_at_dofs, std::span<double> to_fill) const -> void override;
+  auto WeightedValueAtQuadrature(std::span<const double> weights, std::span<const DealiiVector* const> values_at_dofs,
+                                 std::span<double> to_fill) const -> void override;
+
+  [[nodiscard]] auto cell_kernels() const -> const CellKernels& override { return *cell_kernels_; }
+  /*! \brief Sets the kernels used to integrate cell and face terms.
+   *
+   * Kernels specialized for a different number of degrees of freedom or quadrature points than this element will throw.
+   */
+  auto set_cell_kernels(const CellKernels& to_set) -> FiniteElement<dim>&;
 
   // Dependencies
   auto finite_element() -> dealii::FiniteElement<dim, dim>* override { return finite_element_.get(); };
-  auto values() -> dealii::FEValues<dim>* override { return values_.get(); };
-  auto face_values() -> dealii::FEFaceValues<dim>* override {return face_values_.get(); };
-  auto neighbor_face_values() -> dealii::FEFaceValues<dim>* override {return neighbor_face_values_.get(); };
+  //! Values object of the calling thread
+  auto values() -> dealii::FEValues<dim>* override { return context().values.get(); };
+  //! Face values object of the calling thread
+  auto face_values() -> dealii::FEFaceValues<dim>* override {return context().face_values.get(); };
+  //! Neighbor face values object of the calling thread
+  auto neighbor_face_values() -> dealii::FEFaceValues<dim>* override {
+    return context().neighbor_face_values.get(); };
   auto cell_quadrature() -> dealii::QGauss<dim>* { return cell_quadrature_.get(); };
   auto face_quadrature() -> dealii::QGauss<dim - 1>* { return face_quadrature_.get(); };
 
  protected:
   std::shared_ptr<dealii::FiniteElement<dim, dim>> finite_element_;
+  //! Values objects copied for each thread, set by derived classes
   std::shared_ptr<dealii::FEValues<dim>> values_;
   std::shared_ptr<dealii::FEFaceValues<dim>> face_values_;
   std::shared_ptr<dealii::FEFaceValues<dim>> neighbor_face_values_;
   std::shared_ptr<dealii::QGauss<dim>> cell_quadrature_;
   std::shared_ptr<dealii::QGauss<dim - 1>> face_quadrature_;
 
-  bool values_reinit_called_{ false };
-  bool face_values_reinit_called_{ false };
-  bool neighbor_face_values_reinit_called_{ false };
+  const CellKernels* cell_kernels_{ &GenericCellKernels() };
+
+  //! Values objects used by a single thread
+  struct EvaluationContext {
+    std::unique_ptr<dealii::FEValues<dim>> values{ nullptr };
+    std::unique_ptr<dealii::FEFaceValues<dim>> face_values{ nullptr };
+    std::unique_ptr<dealii::FEFaceValues<dim>> neighbor_face_values{ nullptr };
+    bool values_reinit_called{ false };
+    bool face_values_reinit_called{ false };
+    //! Cells the values and face values were last set to
+    domain::CellPtr<dim> cell{};
+    domain::CellPtr<dim> face_cell{};
+    //! Global degrees of freedom of a cell, reused to evaluate vectors at quadrature points
+    std::vector<dealii::types::global_dof_index> local_dof_indices{};
+    //! Values at the cell degrees of freedom, reused to evaluate weighted sums at quadrature points
+    std::vector<double> local_values{};
+  };
+  /*! \brief Returns the evaluation context of the calling thread, building it on first use. */
+  auto context() const -> EvaluationContext&;
+
   using FiniteElementI<dim>::values;
   using FiniteElementI<dim>::face_values;
+
+ private:
+  auto MakeContext() const -> std::unique_ptr<EvaluationContext>;
+  /*! \brief Sums the shape functions at each quadrature point of a values object, weighted by local_values. */
+  auto ProjectToQuadrature(const dealii::FEValuesBase<dim>& values, std::span<const double> local_values,
+                           std::span<double> to_fill) const -> void;
+  /*! \brief Sums the shape functions of a cell at each quadrature point of a values object, weighted by the value of
+   * a vector at the cell degrees of freedom. */
+  auto SumAtQuadrature(const dealii::FEValuesBase<dim>& values, const domain::CellPtr<dim>& cell_ptr,
+                       EvaluationContext& current_context, const DealiiVector& values_at_dofs,
+                       std::span<double> to_fill) const -> void;
+
+  //! Identifies this object in the per-thread lookup of the last used context
+  const std::uint64_t instance_id_{ NextInstanceId() };
+  static auto NextInstanceId() -> std::uint64_t;
+  mutable dealii::Threads::ThreadLocalStorage<std::unique_ptr<EvaluationContext>> contexts_{};
 };
 
 } // namespace bart::domain::finite_element
@@ -1,9 +1,14 @@
 #ifndef BART_SRC_DOMAIN_FINITE_ELEMENT_I_H
 #define BART_SRC_DOMAIN_FINITE_ELEMENT_I_H
 
+#include <algorithm>
+#include <span>
+#include <vector>
+
 #include <deal.II/fe/fe_values.h>
 
 #include "domain/domain_types.hpp"
+#include "domain/finite_element/cell_kernels.hpp"
 #include "utility/has_description.h"
 
 //! Classes that provide a finite-element basis
@@ -15,6 +20,10 @@ namespace bart::domain::finite_element {
  * function values at quadrature points, basis function values on faces, numbers
  * of quadrature points and dofs per cell.
  *
+ * The cell and face set using SetCell and SetFace apply to the calling thread
+ * only, so objects sharing a finite element may set cells and read values from
+ * multiple threads.
+ *
  */
 template <int dim>
 class FiniteElementI : public utility::HasDescription {
@@ -134,6 +143,70 @@ class FiniteElementI : public utility::HasDescription {
    */
    virtual auto ValueAtFaceQuadrature(const DealiiVector& values_at_dofs) const -> std::vector<double> = 0;
 
+  /*! \brief Get the value of a vector at the interior cell quadrature points, without allocating.
+   *
+   * The default implementation copies the values returned by ValueAtQuadrature, implementations should override it to
+   * write directly to the passed buffer.
+   *
+   * \param values_at_dofs vector value at dofs
+   * \param to_fill buffer to fill with the value at each cell quadrature point, must have n_cell_quad_pts() entries.
+   */
+  virtual auto ValueAtQuadrature(const DealiiVector& values_at_dofs, std::span<double> to_fill) const -> void {
+    const auto values_at_quadrature = ValueAtQuadrature(values_at_dofs);
+    AssertThrow(values_at_quadrature.size() == to_fill.size(),
+                dealii::ExcMessage("Error in FiniteElementI function ValueAtQuadrature: buffer size does not match "
+                                   "the number of cell quadrature points"))
+    std::copy(values_at_quadrature.begin(), values_at_quadrature.end(), to_fill.begin());
+  }
+
+  /*! \brief Get the value of a vector at the cell face quadrature points, without allocating.
+   *
+   * The default implementation copies the values returned by ValueAtFaceQuadrature, implementations should override
+   * it to write directly to the passed buffer.
+   *
+   * \param values_at_dofs vector value at dofs
+   * \param to_fill buffer to fill with the value at each face quadrature point, must have n_face_quad_pts() entries.
+   */
+  virtual auto ValueAtFaceQuadrature(const DealiiVector& values_at_dofs, std::span<double> to_fill) const -> void {
+    const auto values_at_quadrature = ValueAtFaceQuadrature(values_at_dofs);
+    AssertThrow(values_at_quadrature.size() == to_fill.size(),
+                dealii::ExcMessage("Error in FiniteElementI function ValueAtFaceQuadrature: buffer size does not "
+                                   "match the number of face quadrature points"))
+    std::copy(values_at_quadrature.begin(), values_at_quadrature.end(), to_fill.begin());
+  }
+
+  /*! \brief Get a weighted sum of vectors at the interior cell quadrature points, without allocating.
+   *
+   * Fills the buffer with \f$\sum_k w_k u_k(\vec{r}_q)\f$. The default implementation evaluates each vector at the
+   * quadrature points and sums the results, implementations should override it to form the weighted sum at the cell
+   * degrees of freedom and evaluate it at the quadrature points once.
+   *
+   * \param weights weight of each vector.
+   * \param values_at_dofs pointers to the vectors, with the same length as weights.
+   * \param to_fill buffer to fill with the sum at each cell quadrature point, must have n_cell_quad_pts() entries.
+   */
+  virtual auto WeightedValueAtQuadrature(std::span<const double> weights,
+                                         std::span<const DealiiVector* const> values_at_dofs,
+                                         std::span<double> to_fill) const -> void {
+    AssertThrow(weights.size() == values_at_dofs.size(),
+                dealii::ExcMessage("Error in FiniteElementI function WeightedValueAtQuadrature: number of weights "
+                                   "does not match the number of vectors"))
+    std::fill(to_fill.begin(), to_fill.end(), 0.0);
+    std::vector<double> values_at_quadrature(to_fill.size());
+    for (std::size_t k = 0; k < weights.size(); ++k) {
+      ValueAtQuadrature(*values_at_dofs[k], values_at_quadrature);
+      for (std::size_t q = 0; q < to_fill.size(); ++q)
+        to_fill[q] += weights[k] * values_at_quadrature[q];
+    }
+  }
+
+  /*! \brief Get the kernels used to integrate cell and face terms for this element.
+   *
+   * Implementations may provide kernels specialized for their number of degrees of freedom and quadrature points, the
+   * default returns kernels that work for any element.
+   */
+  virtual auto cell_kernels() const -> const CellKernels& { return GenericCellKernels(); }
+
   // DealII Finite element object access. These methods access the underlying
   // finite element objects.
   /*! \brief Gets pointer to the underlying finite element object */
@@ -0,0 +1,142 @@
+#include "domain/finite_element/cell_kernels.hpp"
+
+#include <cmath>
+#include <vector>
+
+#include "domain/finite_element/finite_element_gaussian.hpp"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_helper_functions.h"
+
+namespace {
+
+using namespace bart;
+
+/* Tests for the cell kernels used by formulations to integrate cell and face terms.
+ *
+ * Specialized kernels are verified against the generic kernels using random tables, for each supported polynomial
+ * degree.
+ */
+template <typename DimensionWrapper>
+class DomainFiniteElementCellKernelsTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  const std::vector<int> specialized_degrees_{1, 2, 3};
+
+  static auto IntegerPower(int base, int exponent) -> int {
+    int result{ 1 };
+    for (int i = 0; i < exponent; ++i)
+      result *= base;
+    return result;
+  }
+};
+
+TYPED_TEST_SUITE(DomainFiniteElementCellKernelsTest, bart::testing::AllDimensions);
+
+// Specialized kernels should be selected for supported degrees with the correct sizes
+TYPED_TEST(DomainFiniteElementCellKernelsTest, SelectCellKernels) {
+  constexpr int dim = this->dim;
+  for (const int degree : this->specialized_degrees_) {
+    const auto& kernels = domain::finite_element::SelectCellKernels<dim>(degree);
+    EXPECT_TRUE(kernels.is_specialized());
+    EXPECT_EQ(kernels.dofs_per_cell, this->IntegerPower(degree + 1, dim));
+    EXPECT_EQ(kernels.n_cell_quad_pts, this->IntegerPower(degree + 1, dim));
+    EXPECT_EQ(kernels.n_face_quad_pts, this->IntegerPower(degree + 1, dim - 1));
+    EXPECT_NE(kernels.cell_weighted_matrix_sum, domain::finite_element::GenericCellKernels().cell_weighted_matrix_sum);
+  }
+  const auto& fallback_kernels = domain::finite_element::SelectCellKernels<dim>(4);
+  EXPECT_FALSE(fallback_kernels.is_specialized());
+  EXPECT_EQ(&fallback_kernels, &domain::finite_element::GenericCellKernels());
+  EXPECT_TRUE(fallback_kernels.Matches(125, 125, 25));
+}
+
+// Specialized kernels should give the same results as the generic kernels
+TYPED_TEST(DomainFiniteElementCellKernelsTest, SpecializedMatchesGeneric) {
+  constexpr int dim = this->dim;
+  const auto& generic = domain::finite_element::GenericCellKernels();
+
+  for (const int degree : this->specialized_degrees_) {
+    const auto& specialized = domain::finite_element::SelectCellKernels<dim>(degree);
+    const int n_dofs{ specialized.dofs_per_cell };
+    const int n_cell_q{ specialized.n_cell_quad_pts };
+    const int n_face_q{ specialized.n_face_quad_pts };
+
+    const auto cell_weights = test_helpers::RandomVector(n_cell_q, 0, 10);
+    const auto face_weights = test_helpers::RandomVector(n_face_q, 0, 10);
+    const auto matrices = test_helpers::RandomVector(n_cell_q * n_dofs * n_dofs, -10, 10);
+    const auto cell_vectors = test_helpers::RandomVector(n_cell_q * n_dofs, -10, 10);
+    const auto face_vectors = test_helpers::RandomVector(n_face_q * n_dofs, -10, 10);
+    const auto initial_matrix = test_helpers::RandomVector(n_dofs * n_dofs, -10, 10);
+    const auto initial_vector = test_helpers::RandomVector(n_dofs, -10, 10);
+
+    auto expected_matrix{ initial_matrix }, result_matrix{ initial_matrix };
+    generic.cell_weighted_matrix_sum(expected_matrix.data(), cell_weights.data(), matrices.data(), n_dofs, n_cell_q);
+    specialized.cell_weighted_matrix_sum(result_matrix.data(), cell_weights.data(), matrices.data(), n_dofs, n_cell_q);
+    for (int k = 0; k < n_dofs * n_dofs; ++k)
+      EXPECT_NEAR(expected_matrix[k], result_matrix[k], 1e-10 * std::abs(expected_matrix[k]) + 1e-12);
+
+    auto expected_vector{ initial_vector }, result_vector{ initial_vector };
+    generic.cell_weighted_vector_sum(expected_vector.data(), cell_weights.data(), cell_vectors.data(), n_dofs,
+                                     n_cell_q);
+    specialized.cell_weighted_vector_sum(result_vector.data(), cell_weights.data(), cell_vectors.data(), n_dofs,
+                                         n_cell_q);
+    for (int i = 0; i < n_dofs; ++i)
+      EXPECT_NEAR(expected_vector[i], result_vector[i], 1e-10 * std::abs(expected_vector[i]) + 1e-12);
+
+    auto expected_outer{ initial_matrix }, result_outer{ initial_matrix };
+    generic.face_weighted_outer_product_sum(expected_outer.data(), face_weights.data(), face_vectors.data(), n_dofs,
+                                            n_face_q);
+    specialized.face_weighted_outer_product_sum(result_outer.data(), face_weights.data(), face_vectors.data(), n_dofs,
+                                                n_face_q);
+    for (int k = 0; k < n_dofs * n_dofs; ++k)
+      EXPECT_NEAR(expected_outer[k], result_outer[k], 1e-10 * std::abs(expected_outer[k]) + 1e-12);
+  }
+}
+
+// Each lane of the batched matrix sum should match the scalar matrix sum with that lane's weights
+TYPED_TEST(DomainFiniteElementCellKernelsTest, BatchedMatchesScalar) {
+  constexpr int dim = this->dim;
+  using VectorizedDouble = dealii::VectorizedArray<double>;
+  constexpr int n_lanes{ static_cast<int>(VectorizedDouble::size()) };
+  const auto& generic = domain::finite_element::GenericCellKernels();
+
+  for (const int degree : this->specialized_degrees_) {
+    const auto& specialized = domain::finite_element::SelectCellKernels<dim>(degree);
+    const int n_dofs{ specialized.dofs_per_cell };
+    const int n_cell_q{ specialized.n_cell_quad_pts };
+    const auto matrices = test_helpers::RandomVector(n_cell_q * n_dofs * n_dofs, -10, 10);
+
+    std::vector<VectorizedDouble> batched_weights(n_cell_q);
+    std::vector<std::vector<double>> lane_weights(n_lanes, std::vector<double>(n_cell_q));
+    for (int lane = 0; lane < n_lanes; ++lane) {
+      lane_weights[lane] = test_helpers::RandomVector(n_cell_q, 0, 10);
+      for (int q = 0; q < n_cell_q; ++q)
+        batched_weights[q][lane] = lane_weights[lane][q];
+    }
+
+    for (const auto* kernels : {&generic, &specialized}) {
+      std::vector<VectorizedDouble> batched_matrix(n_dofs * n_dofs, VectorizedDouble(0.0));
+      kernels->cell_batched_weighted_matrix_sum(batched_matrix.data(), batched_weights.data(), matrices.data(), n_dofs,
+                                                n_cell_q);
+      for (int lane = 0; lane < n_lanes; ++lane) {
+        std::vector<double> expected_matrix(n_dofs * n_dofs, 0);
+        generic.cell_weighted_matrix_sum(expected_matrix.data(), lane_weights[lane].data(), matrices.data(), n_dofs,
+                                         n_cell_q);
+        for (int k = 0; k < n_dofs * n_dofs; ++k)
+          EXPECT_NEAR(expected_matrix[k], batched_matrix[k][lane], 1e-10 * std::abs(expected_matrix[k]) + 1e-12);
+      }
+    }
+  }
+}
+
+// Setting kernels specialized for a different element should throw
+TYPED_TEST(DomainFiniteElementCellKernelsTest, SetCellKernelsMismatch) {
+  constexpr int dim = this->dim;
+  domain::finite_element::FiniteElementGaussian<dim> test_fe{problem::DiscretizationType::kContinuousFEM, 2};
+  EXPECT_FALSE(test_fe.cell_kernels().is_specialized());
+  EXPECT_ANY_THROW(test_fe.set_cell_kernels(domain::finite_element::SelectCellKernels<dim>(1)));
+  EXPECT_NO_THROW(test_fe.set_cell_kernels(domain::finite_element::SelectCellKernels<dim>(2)));
+  EXPECT_EQ(&test_fe.cell_kernels(), &domain::finite_element::SelectCellKernels<dim>(2));
+  EXPECT_NO_THROW(test_fe.set_cell_kernels(domain::finite_element::GenericCellKernels()));
+}
+
+} // namespace
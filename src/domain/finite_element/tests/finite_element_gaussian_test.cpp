@@ -1,5 +1,6 @@
 #include "domain/finite_element/finite_element_gaussian.hpp"
 
+#include <type_traits>
 #include <vector>
 
 #include <deal.II/grid/grid_generator.h>
@@ -181,4 +182,25 @@ TYPED_TEST(DomainFiniteElementGaussianBaseMethodsTest, BaseValueAtFaceQuadrature
   this->TestValueAtFaceQuadrature(&test_fe);
 }
 
+TYPED_TEST(DomainFiniteElementGaussianBaseMethodsTest, BaseWeightedValueAtQuadrature) {
+  bart::domain::finite_element::FiniteElementGaussian<this->dim> test_fe{
+      problem::DiscretizationType::kDiscontinuousFEM, 2};
+  this->TestWeightedValueAtQuadrature(&test_fe);
+}
+
+TYPED_TEST(DomainFiniteElementGaussianBaseMethodsTest, BaseThreadContexts) {
+  bart::domain::finite_element::FiniteElementGaussian<this->dim> test_fe{
+      problem::DiscretizationType::kDiscontinuousFEM, 2};
+  this->TestThreadContexts(&test_fe);
+}
+
+// Copies would share the per-thread evaluation contexts of the original, so finite elements must not be copyable
+TYPED_TEST(DomainFiniteElementGaussianBaseMethodsTest, BaseNotCopyable) {
+  using FiniteElement = bart::domain::finite_element::FiniteElementGaussian<this->dim>;
+  EXPECT_FALSE(std::is_copy_constructible_v<FiniteElement>);
+  EXPECT_FALSE(std::is_copy_assignable_v<FiniteElement>);
+  EXPECT_FALSE(std::is_move_constructible_v<FiniteElement>);
+  EXPECT_FALSE(std::is_move_assignable_v<FiniteElement>);
+}
+
 } // namespace
\ No newline at end of file
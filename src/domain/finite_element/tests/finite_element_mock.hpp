@@ -13,6 +13,9 @@ template <int dim>
 class FiniteElementMock : public FiniteElementI<dim> {
  public:
   using typename FiniteElementI<dim>::DealiiVector;
+  // Buffer overloads use the default implementation, which calls the mocked functions
+  using FiniteElementI<dim>::ValueAtQuadrature;
+  using FiniteElementI<dim>::ValueAtFaceQuadrature;
   MOCK_METHOD(int, polynomial_degree, (), (const, override));
   MOCK_METHOD(int, dofs_per_cell, (), (const, override));
   MOCK_METHOD(int, n_cell_quad_pts, (), (const, override));
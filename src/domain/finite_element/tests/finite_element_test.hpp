@@ -3,6 +3,8 @@
 
 #include "domain/finite_element/finite_element.hpp"
 
+#include <thread>
+
 #include "test_helpers/test_assertions.hpp"
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/dealii_test_domain.h"
@@ -22,6 +24,8 @@ class FiniteElementBaseClassTest : public ::testing::Test {
   void TestSetCellAndFace(domain::finite_element::FiniteElement<dim>* test_fe);
   void TestValueAtQuadrature(domain::finite_element::FiniteElement<dim>* test_fe);
   void TestValueAtFaceQuadrature(domain::finite_element::FiniteElement<dim>* test_fe);
+  void TestWeightedValueAtQuadrature(domain::finite_element::FiniteElement<dim>* test_fe);
+  void TestThreadContexts(domain::finite_element::FiniteElement<dim>* test_fe);
   void SetUp() override {
     dealii::GridGenerator::hyper_cube(triangulation_, -1, 1);
     triangulation_.refine_global(2);
@@ -118,6 +122,67 @@ void FiniteElementBaseClassTest<dim>::TestValueAtFaceQuadrature(FiniteElement<di
   EXPECT_TRUE(bart::test_helpers::AreEqual(expected_vector, result_vector));
 }
 
+template <int dim>
+void FiniteElementBaseClassTest<dim>::TestWeightedValueAtQuadrature(FiniteElement<dim> *test_fe) {
+
+  dof_handler_.distribute_dofs(*test_fe->finite_element());
+
+  auto cell = dof_handler_.begin_active();
+
+  EXPECT_NO_THROW(test_fe->SetCell(cell));
+
+  const int n_dofs = dof_handler_.n_dofs();
+  dealii::Vector<double> first_vector(n_dofs), second_vector(n_dofs), third_vector(n_dofs);
+  for (int i = 0; i < n_dofs; ++i) {
+    first_vector(i) = 0.5 + i;
+    second_vector(i) = 2.0 - 0.25 * i;
+  }
+  third_vector = 10.0;
+  const std::vector<double> weights{ 1.5, -2.0, 0.0 };
+  const std::vector<const dealii::Vector<double>*> vectors{ &first_vector, &second_vector, &third_vector };
+
+  const auto first_values = test_fe->ValueAtQuadrature(first_vector);
+  const auto second_values = test_fe->ValueAtQuadrature(second_vector);
+  std::vector<double> expected_vector(test_fe->n_cell_quad_pts());
+  for (int q = 0; q < test_fe->n_cell_quad_pts(); ++q)
+    expected_vector.at(q) = weights.at(0) * first_values.at(q) + weights.at(1) * second_values.at(q);
+
+  std::vector<double> result_vector(test_fe->n_cell_quad_pts());
+  test_fe->WeightedValueAtQuadrature(weights, vectors, result_vector);
+
+  EXPECT_TRUE(bart::test_helpers::AreEqual(expected_vector, result_vector));
+  // Mismatched weights and vectors should throw
+  EXPECT_ANY_THROW(test_fe->WeightedValueAtQuadrature(std::vector<double>{ 1.0 }, vectors, result_vector));
+}
+
+template <int dim>
+void FiniteElementBaseClassTest<dim>::TestThreadContexts(FiniteElement<dim> *test_fe) {
+  dof_handler_.distribute_dofs(*test_fe->finite_element());
+
+  auto cell = dof_handler_.begin_active();
+  auto next_cell = cell;
+  ++next_cell;
+
+  EXPECT_TRUE(test_fe->SetCell(cell));
+  EXPECT_TRUE(test_fe->SetFace(cell, domain::FaceIndex(0)));
+  const auto jacobian = test_fe->Jacobian(0);
+
+  // Another thread has its own values objects, so it must set the cell and does not change the values on this thread
+  std::thread other_thread([&]() {
+    EXPECT_TRUE(test_fe->SetCell(cell));
+    EXPECT_TRUE(test_fe->SetCell(next_cell));
+    EXPECT_TRUE(test_fe->SetFace(next_cell, domain::FaceIndex(1)));
+    EXPECT_EQ(next_cell->id(), test_fe->values()->get_cell()->id());
+  });
+  other_thread.join();
+
+  EXPECT_EQ(cell->id(), test_fe->values()->get_cell()->id());
+  EXPECT_EQ(cell->id(), test_fe->face_values()->get_cell()->id());
+  EXPECT_EQ(cell->face_index(0), test_fe->face_values()->get_face_index());
+  EXPECT_FALSE(test_fe->SetCell(cell));
+  EXPECT_DOUBLE_EQ(jacobian, test_fe->Jacobian(0));
+}
+
 } // namespace bart::domain::finite_element::testing
 
 #endif // BART_SRC_DOMAIN_TESTS_FINITE_ELEMENT_TEST_H_
\ No newline at end of file
@@ -23,6 +23,7 @@ class DomainMock : public DomainI<dim> {
   MOCK_METHOD(dealii::FullMatrix<double>, GetCellMatrix, (), (override, const));
   MOCK_METHOD(dealii::Vector<double>, GetCellVector, (), (override, const));
   MOCK_METHOD(std::shared_ptr<bart::system::MPISparseMatrix>, MakeSystemMatrix, (), (const, override));
+  MOCK_METHOD(std::shared_ptr<bart::system::MPISparseMatrix>, MakeBoundarySystemMatrix, (), (const, override));
   MOCK_METHOD(std::shared_ptr<bart::system::MPIVector>, MakeSystemVector, (), (const, override));
   MOCK_METHOD(typename DomainI<dim>::CellRange, Cells, (), (override, const));
   MOCK_METHOD(problem::DiscretizationType, discretization_type, (), (override, const));
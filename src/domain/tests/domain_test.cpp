@@ -52,7 +52,11 @@ TYPED_TEST(DomainTest, Constructor) {
     EXPECT_EQ(mesh_ptr, nullptr);
     EXPECT_EQ(this->fe_ptr.use_count(), 2);
     EXPECT_EQ(test_domain.discretization_type(), discretization);
+    EXPECT_FALSE(test_domain.build_multigrid_hierarchy());
   }
+  bart::domain::Domain<this->dim> multigrid_domain(std::make_unique<bart::domain::mesh::MeshMock<this->dim>>(),
+                                                   this->fe_ptr, Discretization::kContinuousFEM, true);
+  EXPECT_TRUE(multigrid_domain.build_multigrid_hierarchy());
 }
 
 TYPED_TEST(DomainTest, BadDependencyPointers) {
@@ -120,6 +124,8 @@ TYPED_TEST(DomainDOFTest, SetUpDOFTestMPI) {
   test_domain.SetUpDOF();
 
   EXPECT_EQ(test_domain.total_degrees_of_freedom(), test_domain.dof_handler().n_dofs());
+  // Level degrees of freedom are only distributed for domains that build the multigrid hierarchy
+  EXPECT_FALSE(test_domain.dof_handler().has_level_dofs());
 
   int total_cells = 0;
   for (auto cell = test_domain.dof_handler().begin_active();
@@ -140,6 +146,22 @@ TYPED_TEST(DomainDOFTest, SetUpDOFTestMPI) {
   EXPECT_EQ(vector.size(), 4);
 }
 
+TYPED_TEST(DomainDOFTest, SetUpDOFMultigridHierarchyMPI) {
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_)).WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element()).WillOnce(::testing::Return(&this->fe));
+
+  bart::domain::Domain<this->dim> test_domain(std::move(this->nice_mesh_ptr), this->fe_ptr,
+                                              problem::DiscretizationType::kContinuousFEM, true);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+
+  EXPECT_EQ(test_domain.total_degrees_of_freedom(), test_domain.dof_handler().n_dofs());
+  EXPECT_TRUE(test_domain.dof_handler().has_level_dofs());
+  EXPECT_EQ(test_domain.dof_handler().get_triangulation().n_global_levels(),
+            static_cast<unsigned int>(this->global_refinements_ + 1));
+}
+
 TYPED_TEST(DomainDOFTest, SystemMatrixMPI) {
   EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).WillOnce(::testing::Return(true));
   EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_)).WillOnce(::testing::Invoke(this->SetTriangulation));
@@ -154,6 +176,41 @@ TYPED_TEST(DomainDOFTest, SystemMatrixMPI) {
   ASSERT_NE(system_matrix_ptr, nullptr);
   EXPECT_EQ(system_matrix_ptr->n(), test_domain.locally_owned_dofs().size());
   EXPECT_EQ(system_matrix_ptr->m(), test_domain.locally_owned_dofs().size());
+
+  // All system matrices share one sparsity index structure
+  auto other_system_matrix_ptr = test_domain.MakeSystemMatrix();
+  auto shared_matrix_ptr = std::dynamic_pointer_cast<system::SharedSparsityMatrix>(system_matrix_ptr);
+  auto other_shared_matrix_ptr = std::dynamic_pointer_cast<system::SharedSparsityMatrix>(other_system_matrix_ptr);
+  ASSERT_NE(shared_matrix_ptr, nullptr);
+  ASSERT_NE(other_shared_matrix_ptr, nullptr);
+  EXPECT_NE(shared_matrix_ptr, other_shared_matrix_ptr);
+  EXPECT_TRUE(shared_matrix_ptr->SharesIndicesWith(*other_shared_matrix_ptr));
+}
+
+TYPED_TEST(DomainDOFTest, SystemMatrixBeforeSetUpDOF) {
+  bart::domain::Domain<this->dim> test_domain(std::move(this->nice_mesh_ptr), this->fe_ptr);
+  EXPECT_ANY_THROW({ [[maybe_unused]] auto system_matrix_ptr = test_domain.MakeSystemMatrix(); });
+  EXPECT_ANY_THROW({ [[maybe_unused]] auto boundary_matrix_ptr = test_domain.MakeBoundarySystemMatrix(); });
+}
+
+TYPED_TEST(DomainDOFTest, BoundarySystemMatrixMPI) {
+  EXPECT_CALL(*this->nice_mesh_ptr, has_material_mapping()).WillOnce(::testing::Return(true));
+  EXPECT_CALL(*this->nice_mesh_ptr, FillTriangulation(_)).WillOnce(::testing::Invoke(this->SetTriangulation));
+  EXPECT_CALL(*this->fe_ptr, finite_element()).WillOnce(::testing::Return(&this->fe));
+
+  bart::domain::Domain<this->dim> test_domain(std::move(this->nice_mesh_ptr), this->fe_ptr);
+  test_domain.SetUpMesh(this->global_refinements_);
+  test_domain.SetUpDOF();
+
+  auto system_matrix_ptr = test_domain.MakeSystemMatrix();
+  auto boundary_matrix_ptr = test_domain.MakeBoundarySystemMatrix();
+
+  ASSERT_NE(boundary_matrix_ptr, nullptr);
+  EXPECT_EQ(boundary_matrix_ptr->n(), test_domain.locally_owned_dofs().size());
+  EXPECT_EQ(boundary_matrix_ptr->m(), test_domain.locally_owned_dofs().size());
+  // Only couplings on boundary cells are stored
+  EXPECT_GT(boundary_matrix_ptr->n_nonzero_elements(), 0);
+  EXPECT_LE(boundary_matrix_ptr->n_nonzero_elements(), system_matrix_ptr->n_nonzero_elements());
 }
 
 TYPED_TEST(DomainDOFTest, SystemVectorMPI) {
@@ -0,0 +1,284 @@
+#include "formulation/angular/saaf_matrix_free_operator.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+
+namespace bart::formulation::angular {
+
+namespace  {
+//! Number of 1D quadrature points for FEEvaluation, 0 indicates a runtime polynomial degree
+constexpr auto QuadraturePoints1D(const int fe_degree) -> int { return fe_degree == -1 ? 0 : fe_degree + 1; }
+} // namespace
+
+template<int dim, int fe_degree>
+SAAFMatrixFreeOperator<dim, fe_degree>::SAAFMatrixFreeOperator(const Domain& domain,
+                                                               const std::shared_ptr<CrossSections>& cross_sections,
+                                                               const std::shared_ptr<QuadratureSet>& quadrature_set,
+                                                               const int polynomial_degree)
+    : total_groups_(cross_sections == nullptr || cross_sections->sigma_t().empty() ? 0 :
+                    static_cast<int>(cross_sections->sigma_t().begin()->second.size())),
+      n_dofs_(domain.total_degrees_of_freedom()),
+      n_locally_owned_dofs_(domain.locally_owned_dofs().n_elements()),
+      communicator_(domain.MakeSystemVector()->get_mpi_communicator()) {
+  std::string error_start{ "Error in constructor of SAAFMatrixFreeOperator: " };
+  AssertThrow(cross_sections != nullptr, dealii::ExcMessage(error_start + "cross-sections pointer is null"))
+  AssertThrow(quadrature_set != nullptr, dealii::ExcMessage(error_start + "quadrature set pointer is null"))
+  AssertThrow(total_groups_ > 0, dealii::ExcMessage(error_start + "cross-sections have no energy groups"))
+  AssertThrow(fe_degree == -1 || fe_degree == polynomial_degree,
+              dealii::ExcMessage(error_start + "polynomial degree does not match compile-time degree"))
+  AssertThrow(static_cast<int>(domain.dof_handler().get_fe().degree) == polynomial_degree,
+              dealii::ExcMessage(error_start + "polynomial degree does not match domain finite element"))
+
+  for (int angle = 0; angle < static_cast<int>(quadrature_set->size()); ++angle) {
+    omegas_.push_back(quadrature_set->GetQuadraturePoint(quadrature::QuadraturePointIndex(angle))
+                          ->cartesian_position_tensor());
+  }
+
+  constraints_.close();
+  typename MatrixFreeData::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme = MatrixFreeData::AdditionalData::none;
+  additional_data.mapping_update_flags = dealii::update_gradients | dealii::update_JxW_values;
+  additional_data.mapping_update_flags_boundary_faces =
+      dealii::update_values | dealii::update_normal_vectors | dealii::update_JxW_values;
+  matrix_free_data_.reinit(mapping_, domain.dof_handler(), constraints_, dealii::QGauss<1>(polynomial_degree + 1),
+                           additional_data);
+  matrix_free_data_.initialize_dof_vector(src_scratch_);
+  matrix_free_data_.initialize_dof_vector(dst_scratch_);
+
+  // Cross-sections are stored per cell batch, lanes of partially filled batches repeat the first cell
+  const auto& sigma_t = cross_sections->sigma_t();
+  const auto& inverse_sigma_t = cross_sections->inverse_sigma_t();
+  const unsigned int n_cell_batches{ matrix_free_data_.n_cell_batches() };
+  sigma_t_.assign(total_groups_, std::vector<VectorizedDouble>(n_cell_batches));
+  inverse_sigma_t_.assign(total_groups_, std::vector<VectorizedDouble>(n_cell_batches));
+
+  for (unsigned int batch = 0; batch < n_cell_batches; ++batch) {
+    const unsigned int n_filled_lanes{ matrix_free_data_.n_active_entries_per_cell_batch(batch) };
+    for (unsigned int lane = 0; lane < VectorizedDouble::size(); ++lane) {
+      const auto cell = matrix_free_data_.get_cell_iterator(batch, lane < n_filled_lanes ? lane : 0);
+      const int material_id = cell->material_id();
+      for (int group = 0; group < total_groups_; ++group) {
+        sigma_t_[group][batch][lane] = sigma_t.at(material_id).at(group);
+        inverse_sigma_t_[group][batch][lane] = inverse_sigma_t.at(material_id).at(group);
+      }
+    }
+  }
+}
+
+template<int dim, int fe_degree>
+auto SAAFMatrixFreeOperator<dim, fe_degree>::GetOperatorPtr(const system::Index index)
+-> dealii::PETScWrappers::MatrixBase* {
+  ValidateIndex(index, __FUNCTION__);
+  auto& shell_matrix_ptr = shell_matrices_[index];
+  if (shell_matrix_ptr == nullptr)
+    shell_matrix_ptr = std::make_unique<ShellMatrix>(*this, index, communicator_, n_dofs_, n_locally_owned_dofs_);
+  return shell_matrix_ptr.get();
+}
+
+template<int dim, int fe_degree>
+auto SAAFMatrixFreeOperator<dim, fe_degree>::Apply(const system::Index index,
+                                                   DistributedVector& dst,
+                                                   const DistributedVector& src) const -> void {
+  ValidateIndex(index, __FUNCTION__);
+  const int group{ index.first };
+  const auto& omega = omegas_.at(index.second);
+
+  using Operation = std::function<void(const MatrixFreeData&, DistributedVector&, const DistributedVector&,
+                                       const CellRange&)>;
+  const Operation cell_operation = [&](const MatrixFreeData& data, DistributedVector& cell_dst,
+                                       const DistributedVector& cell_src, const CellRange& cell_range) {
+    CellOperation(data, cell_dst, cell_src, cell_range, group, omega);
+  };
+  // The SAAF formulation has no interior face terms
+  const Operation inner_face_operation = [](const MatrixFreeData&, DistributedVector&, const DistributedVector&,
+                                            const CellRange&) {};
+  const Operation boundary_operation = [&](const MatrixFreeData& data, DistributedVector& face_dst,
+                                           const DistributedVector& face_src, const CellRange& face_range) {
+    BoundaryOperation(data, face_dst, face_src, face_range, omega);
+  };
+  matrix_free_data_.loop(cell_operation, inner_face_operation, boundary_operation, dst, src, true);
+}
+
+template<int dim, int fe_degree>
+auto SAAFMatrixFreeOperator<dim, fe_degree>::Apply(const system::Index index,
+                                                   PETScVector& dst,
+                                                   const PETScVector& src,
+                                                   const bool add_to_destination) const -> void {
+  std::string error_start{ "Error in SAAFMatrixFreeOperator function Apply: " };
+  AssertThrow(src.locally_owned_size() == n_locally_owned_dofs_ && dst.locally_owned_size() == n_locally_owned_dofs_,
+              dealii::ExcMessage(error_start + "vector sizes do not match the locally owned degrees of freedom"))
+
+  // Locally owned entries of both vector types are stored contiguously in the same order
+  const Vec& src_vector = src;
+  const PetscScalar* src_values{ nullptr };
+  PetscErrorCode error_code = VecGetArrayRead(src_vector, &src_values);
+  AssertThrow(error_code == 0, dealii::ExcMessage(error_start + "failed to access source vector"))
+  std::copy(src_values, src_values + n_locally_owned_dofs_, src_scratch_.begin());
+  error_code = VecRestoreArrayRead(src_vector, &src_values);
+  AssertThrow(error_code == 0, dealii::ExcMessage(error_start + "failed to restore source vector"))
+
+  Apply(index, dst_scratch_, src_scratch_);
+
+  const Vec& dst_vector = dst;
+  PetscScalar* dst_values{ nullptr };
+  error_code = VecGetArray(dst_vector, &dst_values);
+  AssertThrow(error_code == 0, dealii::ExcMessage(error_start + "failed to access destination vector"))
+  if (add_to_destination) {
+    std::transform(dst_scratch_.begin(), dst_scratch_.end(), dst_values, dst_values, std::plus<>());
+  } else {
+    std::copy(dst_scratch_.begin(), dst_scratch_.end(), dst_values);
+  }
+  error_code = VecRestoreArray(dst_vector, &dst_values);
+  AssertThrow(error_code == 0, dealii::ExcMessage(error_start + "failed to restore destination vector"))
+}
+
+template<int dim, int fe_degree>
+auto SAAFMatrixFreeOperator<dim, fe_degree>::CellOperation(const MatrixFreeData& data,
+                                                           DistributedVector& dst,
+                                                           const DistributedVector& src,
+                                                           const CellRange& cell_range,
+                                                           const int group,
+                                                           const dealii::Tensor<1, dim>& omega) const -> void {
+  using dealii::EvaluationFlags::values, dealii::EvaluationFlags::gradients;
+  dealii::FEEvaluation<dim, fe_degree, QuadraturePoints1D(fe_degree), 1, double> phi(data);
+  const auto& group_sigma_t = sigma_t_[group];
+  const auto& group_inverse_sigma_t = inverse_sigma_t_[group];
+
+  for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell) {
+    phi.reinit(cell);
+    phi.gather_evaluate(src, values | gradients);
+    for (unsigned int q = 0; q < phi.n_q_points; ++q) {
+      const auto gradient = phi.get_gradient(q);
+      VectorizedDouble omega_dot_gradient = omega[0] * gradient[0];
+      for (int d = 1; d < dim; ++d)
+        omega_dot_gradient += omega[d] * gradient[d];
+      omega_dot_gradient *= group_inverse_sigma_t[cell];
+
+      dealii::Tensor<1, dim, VectorizedDouble> streaming;
+      for (int d = 0; d < dim; ++d)
+        streaming[d] = omega[d] * omega_dot_gradient;
+      phi.submit_gradient(streaming, q);
+      phi.submit_value(group_sigma_t[cell] * phi.get_value(q), q);
+    }
+    phi.integrate_scatter(values | gradients, dst);
+  }
+}
+
+template<int dim, int fe_degree>
+auto SAAFMatrixFreeOperator<dim, fe_degree>::BoundaryOperation(const MatrixFreeData& data,
+                                                               DistributedVector& dst,
+                                                               const DistributedVector& src,
+                                                               const CellRange& face_range,
+                                                               const dealii::Tensor<1, dim>& omega) const -> void {
+  using dealii::EvaluationFlags::values;
+  dealii::FEFaceEvaluation<dim, fe_degree, QuadraturePoints1D(fe_degree), 1, double> phi(data, true);
+  const VectorizedDouble zero{ dealii::make_vectorized_array(0.0) };
+
+  for (unsigned int face = face_range.first; face < face_range.second; ++face) {
+    phi.reinit(face);
+    phi.gather_evaluate(src, values);
+    for (unsigned int q = 0; q < phi.n_q_points; ++q) {
+      const auto normal = phi.get_normal_vector(q);
+      VectorizedDouble normal_dot_omega = normal[0] * omega[0];
+      for (int d = 1; d < dim; ++d)
+        normal_dot_omega += normal[d] * omega[d];
+      // Only outgoing directions contribute, incoming flux is a source
+      phi.submit_value(std::max(normal_dot_omega, zero) * phi.get_value(q), q);
+    }
+    phi.integrate_scatter(values, dst);
+  }
+}
+
+template<int dim, int fe_degree>
+auto SAAFMatrixFreeOperator<dim, fe_degree>::ValidateIndex(const system::Index index,
+                                                           std::string called_function_name) const -> void {
+  const auto [group, angle] = index;
+  std::string error_start{ "Error in SAAFMatrixFreeOperator function " + called_function_name + ": " };
+  AssertThrow(group >= 0 && group < total_groups_,
+              dealii::ExcMessage(error_start + "group index is out of range"))
+  AssertThrow(angle >= 0 && angle < total_angles(),
+              dealii::ExcMessage(error_start + "angle index is out of range"))
+}
+
+// SHELL MATRIX ========================================================================================================
+
+template<int dim, int fe_degree>
+SAAFMatrixFreeOperator<dim, fe_degree>::ShellMatrix::ShellMatrix(const SAAFMatrixFreeOperator& parent,
+                                                                 const system::Index index,
+                                                                 const MPI_Comm& communicator,
+                                                                 const unsigned int n_dofs,
+                                                                 const unsigned int n_locally_owned_dofs)
+    : dealii::PETScWrappers::MatrixFree(communicator, n_dofs, n_dofs, n_locally_owned_dofs, n_locally_owned_dofs),
+      parent_(parent),
+      index_(index) {}
+
+template<int dim, int fe_degree>
+void SAAFMatrixFreeOperator<dim, fe_degree>::ShellMatrix::vmult(PETScVector& dst, const PETScVector& src) const {
+  parent_.Apply(index_, dst, src);
+}
+
+template<int dim, int fe_degree>
+void SAAFMatrixFreeOperator<dim, fe_degree>::ShellMatrix::Tvmult(PETScVector& dst, const PETScVector& src) const {
+  parent_.Apply(index_, dst, src);
+}
+
+template<int dim, int fe_degree>
+void SAAFMatrixFreeOperator<dim, fe_degree>::ShellMatrix::vmult_add(PETScVector& dst, const PETScVector& src) const {
+  parent_.Apply(index_, dst, src, true);
+}
+
+template<int dim, int fe_degree>
+void SAAFMatrixFreeOperator<dim, fe_degree>::ShellMatrix::Tvmult_add(PETScVector& dst, const PETScVector& src) const {
+  parent_.Apply(index_, dst, src, true);
+}
+
+// FACTORY =============================================================================================================
+
+template<int dim>
+auto MakeSAAFMatrixFreeOperator(const domain::DomainI<dim>& domain,
+                                const std::shared_ptr<data::cross_sections::CrossSectionsI>& cross_sections,
+                                const std::shared_ptr<quadrature::QuadratureSetI<dim>>& quadrature_set,
+                                const int polynomial_degree) -> std::shared_ptr<system::terms::BilinearOperatorI> {
+  switch (polynomial_degree) {
+    case 1:
+      return std::make_shared<SAAFMatrixFreeOperator<dim, 1>>(domain, cross_sections, quadrature_set, 1);
+    case 2:
+      return std::make_shared<SAAFMatrixFreeOperator<dim, 2>>(domain, cross_sections, quadrature_set, 2);
+    case 3:
+      return std::make_shared<SAAFMatrixFreeOperator<dim, 3>>(domain, cross_sections, quadrature_set, 3);
+    default:
+      return std::make_shared<SAAFMatrixFreeOperator<dim, -1>>(domain, cross_sections, quadrature_set,
+                                                               polynomial_degree);
+  }
+}
+
+template class SAAFMatrixFreeOperator<1, -1>;
+template class SAAFMatrixFreeOperator<1, 1>;
+template class SAAFMatrixFreeOperator<1, 2>;
+template class SAAFMatrixFreeOperator<1, 3>;
+template class SAAFMatrixFreeOperator<2, -1>;
+template class SAAFMatrixFreeOperator<2, 1>;
+template class SAAFMatrixFreeOperator<2, 2>;
+template class SAAFMatrixFreeOperator<2, 3>;
+template class SAAFMatrixFreeOperator<3, -1>;
+template class SAAFMatrixFreeOperator<3, 1>;
+template class SAAFMatrixFreeOperator<3, 2>;
+template class SAAFMatrixFreeOperator<3, 3>;
+
+template auto MakeSAAFMatrixFreeOperator<1>(const domain::DomainI<1>&,
+                                            const std::shared_ptr<data::cross_sections::CrossSectionsI>&,
+                                            const std::shared_ptr<quadrature::QuadratureSetI<1>>&,
+                                            int) -> std::shared_ptr<system::terms::BilinearOperatorI>;
+template auto MakeSAAFMatrixFreeOperator<2>(const domain::DomainI<2>&,
+                                            const std::shared_ptr<data::cross_sections::CrossSectionsI>&,
+                                            const std::shared_ptr<quadrature::QuadratureSetI<2>>&,
+                                            int) -> std::shared_ptr<system::terms::BilinearOperatorI>;
+template auto MakeSAAFMatrixFreeOperator<3>(const domain::DomainI<3>&,
+                                            const std::shared_ptr<data::cross_sections::CrossSectionsI>&,
+                                            const std::shared_ptr<quadrature::QuadratureSetI<3>>&,
+                                            int) -> std::shared_ptr<system::terms::BilinearOperatorI>;
+
+} // namespace bart::formulation::angular
@@ -0,0 +1,143 @@
+#ifndef BART_SRC_FORMULATION_ANGULAR_SAAF_MATRIX_FREE_OPERATOR_HPP_
+#define BART_SRC_FORMULATION_ANGULAR_SAAF_MATRIX_FREE_OPERATOR_HPP_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/fe/mapping_q1.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/petsc_matrix_free.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+#include "data/cross_sections/cross_sections_i.hpp"
+#include "domain/domain_i.hpp"
+#include "quadrature/quadrature_set_i.hpp"
+#include "system/terms/bilinear_operator_i.hpp"
+
+namespace bart::formulation::angular {
+
+/*! \brief Matrix-free self-adjoint angular flux (SAAF) left hand side operator.
+ *
+ * Applies the fixed SAAF bilinear form for a group \f$g\f$ and angle \f$\vec{\Omega}\f$,
+ * \f[
+ * (\vec{\Omega}\cdot\nabla\varphi_i, \frac{1}{\sigma_{t,g}}\vec{\Omega}\cdot\nabla\varphi_j)
+ * + (\varphi_i, \sigma_{t,g}\varphi_j)
+ * + \langle\varphi_i, \max(\hat{n}\cdot\vec{\Omega}, 0)\varphi_j\rangle_{\partial V},
+ * \f]
+ * to a vector without assembling a matrix. This is the same operator that SelfAdjointAngularFlux stamps into a
+ * matrix, evaluated using deal.II MatrixFree sum factorization over the Lagrange basis of FiniteElementGaussian, with a
+ * Gaussian quadrature of order degree + 1.
+ *
+ * Storage is the geometry held by MatrixFree and one vectorized \f$\sigma_t\f$ and \f$\sigma_t^{-1}\f$ per cell
+ * batch and group, so memory scales with the number of cells rather than with groups \f$\times\f$ angles
+ * \f$\times\f$ matrix non-zeros. Each (group, angle) is exposed as a PETSc shell matrix that can be passed to the
+ * linear solvers in place of an assembled matrix. The operator is symmetric, so the transpose product is the product.
+ *
+ * Hanging node constraints are not applied, matching the assembled formulation.
+ *
+ * \tparam dim spatial dimension.
+ * \tparam fe_degree polynomial degree of the finite element, -1 to use the degree set at runtime.
+ */
+template <int dim, int fe_degree = -1>
+class SAAFMatrixFreeOperator : public system::terms::BilinearOperatorI {
+ public:
+  using CrossSections = data::cross_sections::CrossSectionsI;
+  using Domain = domain::DomainI<dim>;
+  using DistributedVector = dealii::LinearAlgebra::distributed::Vector<double>;
+  using PETScVector = dealii::PETScWrappers::VectorBase;
+  using QuadratureSet = quadrature::QuadratureSetI<dim>;
+  using VectorizedDouble = dealii::VectorizedArray<double>;
+
+  /*! \brief Constructor.
+   *
+   * \param domain domain that has had its degrees of freedom set up.
+   * \param cross_sections cross-sections for all materials in the domain.
+   * \param quadrature_set angular quadrature providing the angles.
+   * \param polynomial_degree polynomial degree of the finite element, must match fe_degree if that is not -1.
+   */
+  SAAFMatrixFreeOperator(const Domain& domain,
+                         const std::shared_ptr<CrossSections>& cross_sections,
+                         const std::shared_ptr<QuadratureSet>& quadrature_set,
+                         int polynomial_degree);
+
+  auto GetOperatorPtr(system::Index index) -> dealii::PETScWrappers::MatrixBase* override;
+  /*! \brief No preconditioner is provided for the SAAF operator, returns nullptr. */
+  auto GetPreconditionerPtr(system::Index) -> dealii::PETScWrappers::PreconditionerBase* override { return nullptr; }
+
+  /*! \brief Applies the operator for a group and angle, \f$\text{dst} = A_{g,\Omega}\,\text{src}\f$. */
+  auto Apply(system::Index index, DistributedVector& dst, const DistributedVector& src) const -> void;
+  /*! \brief Applies the operator for a group and angle to PETSc vectors.
+   *
+   * If add_to_destination is true the product is added to dst, otherwise dst is overwritten.
+   */
+  auto Apply(system::Index index, PETScVector& dst, const PETScVector& src, bool add_to_destination = false) const
+  -> void;
+
+  auto total_groups() const -> int { return total_groups_; }
+  auto total_angles() const -> int { return static_cast<int>(omegas_.size()); }
+
+ private:
+  /*! \brief PETSc shell matrix for a single group and angle that forwards products to the parent operator. */
+  class ShellMatrix : public dealii::PETScWrappers::MatrixFree {
+   public:
+    ShellMatrix(const SAAFMatrixFreeOperator& parent, system::Index index, const MPI_Comm& communicator,
+                unsigned int n_dofs, unsigned int n_locally_owned_dofs);
+    using dealii::PETScWrappers::MatrixFree::vmult;
+    void vmult(PETScVector& dst, const PETScVector& src) const override;
+    void Tvmult(PETScVector& dst, const PETScVector& src) const override;
+    void vmult_add(PETScVector& dst, const PETScVector& src) const override;
+    void Tvmult_add(PETScVector& dst, const PETScVector& src) const override;
+   private:
+    const SAAFMatrixFreeOperator& parent_;
+    const system::Index index_;
+  };
+
+  using CellRange = std::pair<unsigned int, unsigned int>;
+  using MatrixFreeData = dealii::MatrixFree<dim, double>;
+
+  auto ValidateIndex(system::Index index, std::string called_function_name) const -> void;
+  auto CellOperation(const MatrixFreeData&, DistributedVector& dst, const DistributedVector& src,
+                     const CellRange& cell_range, int group, const dealii::Tensor<1, dim>& omega) const -> void;
+  auto BoundaryOperation(const MatrixFreeData&, DistributedVector& dst, const DistributedVector& src,
+                         const CellRange& face_range, const dealii::Tensor<1, dim>& omega) const -> void;
+
+  const dealii::MappingQ1<dim> mapping_{};
+  dealii::AffineConstraints<double> constraints_{};
+  MatrixFreeData matrix_free_data_{};
+  const int total_groups_{ 0 };
+  const unsigned int n_dofs_{ 0 };
+  const unsigned int n_locally_owned_dofs_{ 0 };
+  //! Communicator of the domain system vectors, used for the shell matrices
+  const MPI_Comm communicator_;
+  //! Direction of each angle in the quadrature set
+  std::vector<dealii::Tensor<1, dim>> omegas_{};
+  //! Total cross-section for each group and cell batch
+  std::vector<std::vector<VectorizedDouble>> sigma_t_{};
+  //! Inverse total cross-section for each group and cell batch
+  std::vector<std::vector<VectorizedDouble>> inverse_sigma_t_{};
+  //! Shell matrices, created the first time an index is requested
+  std::map<system::Index, std::unique_ptr<ShellMatrix>> shell_matrices_{};
+  //! Scratch vectors used to apply the operator to PETSc vectors
+  mutable DistributedVector src_scratch_{}, dst_scratch_{};
+};
+
+/*! \brief Builds a matrix-free SAAF operator for the given polynomial degree.
+ *
+ * Polynomial degrees 1 to 3 use compile-time degrees so that the sum factorization kernels are fully specialized,
+ * other degrees use the runtime degree implementation.
+ */
+template <int dim>
+auto MakeSAAFMatrixFreeOperator(const domain::DomainI<dim>& domain,
+                                const std::shared_ptr<data::cross_sections::CrossSectionsI>& cross_sections,
+                                const std::shared_ptr<quadrature::QuadratureSetI<dim>>& quadrature_set,
+                                int polynomial_degree) -> std::shared_ptr<system::terms::BilinearOperatorI>;
+
+} // namespace bart::formulation::angular
+
+#endif //BART_SRC_FORMULATION_ANGULAR_SAAF_MATRIX_FREE_OPERATOR_HPP_
@@ -1,8 +1,11 @@
 #include "formulation/angular/self_adjoint_angular_flux.h"
 
 #include <algorithm>
+#include <optional>
+#include <string_view>
 #include <sstream>
 #include <cstdlib>
+#include <utility>
 
 namespace bart {
 
@@ -20,7 +23,8 @@ SelfAdjointAngularFlux<dim>::SelfAdjointAngularFlux(
       quadrature_set_ptr_(quadrature_set_ptr),
       cell_degrees_of_freedom_(finite_element_ptr->dofs_per_cell()),
       cell_quadrature_points_(finite_element_ptr->n_cell_quad_pts()),
-      face_quadrature_points_(finite_element_ptr->n_face_quad_pts()) {}
+      face_quadrature_points_(finite_element_ptr->n_face_quad_pts()),
+      cell_kernels_(finite_element_ptr->cell_kernels()) {}
 
 template<int dim>
 void SelfAdjointAngularFlux<dim>::Initialize(const domain::CellPtr<dim> &cell_ptr) {
@@ -29,49 +33,55 @@ void SelfAdjointAngularFlux<dim>::Initialize(const domain::CellPtr<dim> &cell_pt
                                  "cell pointer is invalid."))
 
   finite_element_ptr_->SetCell(cell_ptr);
-  shape_squared_ = {};
-  omega_dot_gradient_ = {};
-
-  /* Precalculated values are held in maps that are indexed by the cell
-   * quadrature point where they are valid */
-  for (int cell_quad_index = 0; cell_quad_index < cell_quadrature_points_;
-       ++cell_quad_index) {
-    formulation::FullMatrix shape_squared(cell_degrees_of_freedom_,
-                                          cell_degrees_of_freedom_);
-    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
-      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-        shape_squared(i, j) =
+
+  const auto angle_indices = quadrature_set_ptr_->quadrature_point_indices();
+  n_angles_ = angle_indices.empty() ? 0 : *angle_indices.rbegin() + 1;
+  const int n_dofs = cell_degrees_of_freedom_;
+  const int n_q = cell_quadrature_points_;
+  shape_squared_.assign(n_q * n_dofs * n_dofs, 0);
+  omega_dot_gradient_.assign(n_angles_ * n_q * n_dofs, 0);
+  omega_dot_gradient_squared_.assign(n_angles_ * n_q * n_dofs * n_dofs, 0);
+
+  /* Precalculated values are held in flat tables, ordered by angle, then cell
+   * quadrature point, then degrees of freedom so that each (angle, q) block is
+   * contiguous. */
+  for (int cell_quad_index = 0; cell_quad_index < n_q; ++cell_quad_index) {
+    auto shape_squared = shape_squared_.begin() + cell_quad_index * n_dofs * n_dofs;
+    for (int i = 0; i < n_dofs; ++i) {
+      for (int j = 0; j < n_dofs; ++j) {
+        shape_squared[i * n_dofs + j] =
             finite_element_ptr_->ShapeValue(i, cell_quad_index) *
             finite_element_ptr_->ShapeValue(j, cell_quad_index);
       }
     }
-    shape_squared_.insert_or_assign(cell_quad_index, shape_squared);
 
-    /* Each cell quadrature point has a further mapping based on the angular
+    /* Each cell quadrature point has a further block for each angular
      * quadrature point. */
-    for (int angle_index : quadrature_set_ptr_->quadrature_point_indices()) {
+    for (int angle_index : angle_indices) {
       auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(
           quadrature::QuadraturePointIndex(angle_index));
+      const int block = angle_index * n_q + cell_quad_index;
 
-      dealii::Vector<double> omega_dot_gradient_vector(cell_degrees_of_freedom_);
-      for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
-        omega_dot_gradient_vector[i] =
+      auto omega_dot_gradient = omega_dot_gradient_.begin() + block * n_dofs;
+      for (int i = 0; i < n_dofs; ++i) {
+        omega_dot_gradient[i] =
             quadrature_point_ptr->cartesian_position_tensor() *
             finite_element_ptr_->ShapeGradient(i, cell_quad_index);
       }
 
-      omega_dot_gradient_.insert_or_assign({cell_quad_index, angle_index},
-                                           omega_dot_gradient_vector);
-
-      FullMatrix omega_dot_gradient_squared(cell_degrees_of_freedom_,
-                                            cell_degrees_of_freedom_);
-      omega_dot_gradient_squared.outer_product(omega_dot_gradient_vector,
-                                               omega_dot_gradient_vector);
-      omega_dot_gradient_squared_.insert_or_assign(
-          {cell_quad_index, angle_index},
-          omega_dot_gradient_squared);
+      auto omega_dot_gradient_squared =
+          omega_dot_gradient_squared_.begin() + block * n_dofs * n_dofs;
+      for (int i = 0; i < n_dofs; ++i) {
+        for (int j = 0; j < n_dofs; ++j) {
+          omega_dot_gradient_squared[i * n_dofs + j] =
+              omega_dot_gradient[i] * omega_dot_gradient[j];
+        }
+      }
     }
   }
+  precalculated_geometry_key_ = MakeCellGeometryKey<dim>(cell_ptr);
+  precalculated_cell_ptr_ = cell_ptr;
+  cell_batch_assembler_ = CellBatchAssembler<dim>();
   is_initialized_ = true;
 }
 
@@ -86,26 +96,12 @@ void SelfAdjointAngularFlux<dim>::FillBoundaryBilinearTerm(
   ValidateMatrixSize(to_fill, __FUNCTION__);
   AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
               dealii::ExcMessage("Bad cell given to FilLBoundaryBilinearTerm"))
-  finite_element_ptr_->SetFace(cell_ptr, face_number);
+  const auto face_values = GetBoundaryFaceValues(cell_ptr, face_number);
+  const double normal_dot_omega =
+      face_values->normal * quadrature_point->cartesian_position_tensor();
 
-  auto normal_vector = finite_element_ptr_->FaceNormal();
-  auto omega = quadrature_point->cartesian_position_tensor();
-
-  const double normal_dot_omega = normal_vector * omega;
-
-  if (normal_dot_omega > 0) {
-    for (int f_q = 0; f_q < face_quadrature_points_; ++f_q) {
-      const double jacobian = finite_element_ptr_->FaceJacobian(f_q);
-      for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
-        for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-          to_fill(i,j) += normal_dot_omega
-              * finite_element_ptr_->FaceShapeValue(i, f_q)
-              * finite_element_ptr_->FaceShapeValue(j, f_q)
-              * jacobian;
-        }
-      }
-    }
-  }
+  if (normal_dot_omega > 0)
+    to_fill.add(normal_dot_omega, face_values->mass_matrix);
 }
 
 template<int dim>
@@ -119,24 +115,27 @@ auto SelfAdjointAngularFlux<dim>::FillReflectiveBoundaryLinearTerm(
   ValidateVectorSize(to_fill, __FUNCTION__);
   AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
               dealii::ExcMessage("Bad cell given to FillReflectiveBoundaryLinearTerm"))
-  finite_element_ptr_->SetFace(cell_ptr, face_number);
-
-  auto normal_vector = finite_element_ptr_->FaceNormal();
-  auto omega = quadrature_point->cartesian_position_tensor();
+  const bool face_values_stored = FindBoundaryFaceValues(
+      {.geometry = MakeCellGeometryKey<dim>(cell_ptr), .face = face_number.get()}) != nullptr;
+  const auto face_values = GetBoundaryFaceValues(cell_ptr, face_number);
   double total_value_added{ 0 };
 
-  const double normal_dot_omega = normal_vector * omega;
+  const double normal_dot_omega =
+      face_values->normal * quadrature_point->cartesian_position_tensor();
 
   if (normal_dot_omega < 0) {
-    const auto incoming_angular_flux = finite_element_ptr_->ValueAtFaceQuadrature(
-        incoming_flux);
+    // The incoming flux is evaluated on the face, which is already set if the face values were just calculated
+    if (face_values_stored)
+      finite_element_ptr_->SetFace(cell_ptr, face_number);
+    const auto incoming_angular_flux = scratch_arena_.Get(kFaceFluxBuffer, face_quadrature_points_);
+    finite_element_ptr_->ValueAtFaceQuadrature(incoming_flux, incoming_angular_flux);
     for (int f_q = 0; f_q < face_quadrature_points_; ++f_q) {
-      const double jacobian = finite_element_ptr_->FaceJacobian(f_q);
+      const double* shape_projection =
+          face_values->shape_projections.data() + f_q * cell_degrees_of_freedom_;
       for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
         const double value_to_add = normal_dot_omega
-            * finite_element_ptr_->FaceShapeValue(i, f_q)
-            * incoming_angular_flux.at(f_q)
-            * jacobian;
+            * shape_projection[i]
+            * incoming_angular_flux[f_q];
         to_fill(i) -= value_to_add;
         total_value_added += std::abs(value_to_add);
       }
@@ -151,21 +150,29 @@ void SelfAdjointAngularFlux<dim>::FillCellCollisionTerm(
     const domain::CellPtr<dim> &cell_ptr,
     const system::EnergyGroup group_number) {
   VerifyInitialized(__FUNCTION__);
-  ValidateMatrixSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
+  ValidateCell(cell_ptr, __FUNCTION__);
+  ValidateMatrixSize(to_fill, __FUNCTION__);
 
   const int material_id = cell_ptr->material_id();
-  const double sigma_t =
-      cross_sections_ptr_->sigma_t().at(material_id).at(group_number.get());
 
-  for (int q = 0; q < cell_quadrature_points_; ++q) {
-    const double jacobian = finite_element_ptr_->Jacobian(q);
-    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
-      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-        to_fill(i, j) += sigma_t * finite_element_ptr_->ShapeValue(i, q) *
-            finite_element_ptr_->ShapeValue(j, q) * jacobian;
-      }
-    }
-  }
+  collision_matrix_cache_.AddTo(
+      to_fill,
+      {.material_id = material_id, .geometry = MakeCellGeometryKey<dim>(cell_ptr),
+       .group = group_number.get()},
+      [&](FullMatrix& local_matrix) {
+    finite_element_ptr_->SetCell(cell_ptr);
+    const double sigma_t =
+        cross_sections_ptr_->sigma_t().at(material_id).at(group_number.get());
+
+    const auto weights = scratch_arena_.Get(kCellWeightBuffer, cell_quadrature_points_);
+    for (int q = 0; q < cell_quadrature_points_; ++q)
+      weights[q] = sigma_t * finite_element_ptr_->Jacobian(q);
+
+    cell_kernels_.cell_weighted_matrix_sum(&local_matrix(0, 0), weights.data(),
+                                           shape_squared_.data(),
+                                           cell_degrees_of_freedom_,
+                                           cell_quadrature_points_);
+  });
 }
 
 template<int dim>
@@ -181,43 +188,12 @@ auto SelfAdjointAngularFlux<dim>::FillCellFissionSourceTerm(
   ValidateVectorSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
 
   const int material_id = cell_ptr->material_id();
-  const int group = group_number.get();
   double total_value_added{ 0 };
 
   if (cross_sections_ptr_->is_material_fissile().at(material_id)) {
-
-    /* The scattering source is determined as the common values in both of the
-     * scattering source terms in SAAF, specifically scalar flux times the
-     * scattering cross-section per steradian */
-
-    std::vector<double> fission_source(cell_quadrature_points_);
-
-    // Get the contribution from each group
-    for (const auto &moment_pair : group_moments) {
-      auto &[index, moment] = moment_pair;
-      const auto &[group_in, harmonic_l, harmonic_m] = index;
-
-      if ((harmonic_l == 0) && (harmonic_m == 0)) {
-        std::vector<double> scalar_flux(cell_quadrature_points_);
-
-        if (group_in == group) {
-          scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
-        } else {
-          scalar_flux = finite_element_ptr_->ValueAtQuadrature(moment);
-        }
-
-        const auto fission_xfer_per_ster =
-            cross_sections_ptr_->fiss_transfer_per_ster().at(material_id)(group_in,
-                                                                        group);
-
-        for (int q = 0; q < cell_quadrature_points_; ++q) {
-          fission_source.at(q) +=
-              fission_xfer_per_ster * scalar_flux.at(q) / k_eff;
-        }
-      }
-    }
-
-    total_value_added += std::abs(FillCellSourceTerm(to_fill, material_id, quadrature_point, group_number,
+    const auto fission_source = FissionSourceAtQuadrature(
+        material_id, group_number, k_eff, in_group_moment, group_moments);
+    total_value_added += std::abs(FillCellSourceTerm(to_fill, cell_ptr, quadrature_point, group_number,
                                                      fission_source));
   }
   return total_value_added;
@@ -240,10 +216,10 @@ void SelfAdjointAngularFlux<dim>::FillCellFixedSourceTerm(
     return;
   }
 
-  std::vector<double> fixed_source(cell_degrees_of_freedom_);
+  const auto fixed_source = scratch_arena_.Get(kSourceBuffer, cell_quadrature_points_);
   std::fill(fixed_source.begin(), fixed_source.end(), q_per_ster);
 
-  FillCellSourceTerm(to_fill, material_id, quadrature_point, group_number,
+  FillCellSourceTerm(to_fill, cell_ptr, quadrature_point, group_number,
                      fixed_source);
 }
 
@@ -259,38 +235,79 @@ auto SelfAdjointAngularFlux<dim>::FillCellScatteringSourceTerm(
   ValidateVectorSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
 
   const int material_id = cell_ptr->material_id();
-  const int group = group_number.get();
+  const auto scattering_source = ScatteringSourceAtQuadrature(
+      material_id, group_number, in_group_moment, group_moments);
 
-  /* The scattering source is determined as the common values in both of the
-   * scattering source terms in SAAF, specifically scalar flux times the
-   * scattering cross-section per steradian */
+  return std::abs(FillCellSourceTerm(to_fill, cell_ptr, quadrature_point, group_number, scattering_source));
+}
 
-  std::vector<double> scattering_source(cell_quadrature_points_);
+template<int dim>
+auto SelfAdjointAngularFlux<dim>::FillCellFissionSourceComponent(
+    Vector &to_fill,
+    const domain::CellPtr<dim> &cell_ptr,
+    const int component,
+    const system::EnergyGroup group_number,
+    const double k_eff,
+    const system::moments::MomentVector &in_group_moment,
+    const system::moments::MomentsMap &group_moments) -> double {
+  VerifyInitialized(__FUNCTION__);
+  ValidateSourceComponent(component, __FUNCTION__);
+  ValidateVectorSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
 
-  // Get the contribution from each group
-  for (const auto& moment_pair : group_moments) {
-    auto &[index, moment] = moment_pair;
-    const auto &[group_in, harmonic_l, harmonic_m] = index;
+  const int material_id = cell_ptr->material_id();
+  double total_value_added{ 0 };
 
-    if ((harmonic_l == 0) && (harmonic_m == 0)) {
-      std::vector<double> scalar_flux(cell_quadrature_points_);
+  if (cross_sections_ptr_->is_material_fissile().at(material_id)) {
+    const auto fission_source = FissionSourceAtQuadrature(
+        material_id, group_number, k_eff, in_group_moment, group_moments);
+    total_value_added += FillCellSourceComponent(to_fill, material_id, component,
+                                                 group_number, fission_source);
+  }
+  return total_value_added;
+}
 
-      if (group_in == group) {
-        scalar_flux = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
-      } else {
-        scalar_flux = finite_element_ptr_->ValueAtQuadrature(moment);
-      }
+template<int dim>
+void SelfAdjointAngularFlux<dim>::FillCellFixedSourceComponent(
+    Vector &to_fill,
+    const domain::CellPtr<dim> &cell_ptr,
+    const int component,
+    const system::EnergyGroup group_number) {
+  VerifyInitialized(__FUNCTION__);
+  ValidateSourceComponent(component, __FUNCTION__);
+  ValidateVectorSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
+  double q_per_ster = 0;
+  const int material_id = cell_ptr->material_id();
+  try {
+    q_per_ster =
+        cross_sections_ptr_->q_per_ster().at(material_id).at(group_number.get());
+  } catch (std::out_of_range&) {
+    return;
+  }
 
-      const auto sigma_s_per_ster =
-          cross_sections_ptr_->sigma_s_per_ster().at(material_id)(group, group_in);
+  const auto fixed_source = scratch_arena_.Get(kSourceBuffer, cell_quadrature_points_);
+  std::fill(fixed_source.begin(), fixed_source.end(), q_per_ster);
+  FillCellSourceComponent(to_fill, material_id, component, group_number,
+                          fixed_source);
+}
 
-      for (int q = 0; q < cell_quadrature_points_; ++q){
-        scattering_source.at(q) += sigma_s_per_ster * scalar_flux.at(q);
-      }
-    }
-  }
+template<int dim>
+auto SelfAdjointAngularFlux<dim>::FillCellScatteringSourceComponent(
+    Vector &to_fill,
+    const domain::CellPtr<dim> &cell_ptr,
+    const int component,
+    const system::EnergyGroup group_number,
+    const system::moments::MomentVector &in_group_moment,
+    const system::moments::MomentsMap &group_moments) -> double {
+  VerifyInitialized(__FUNCTION__);
+  ValidateSourceComponent(component, __FUNCTION__);
+  ValidateVectorSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
 
-  return std::abs(FillCellSourceTerm(to_fill, material_id, quadrature_point, group_number, scattering_source));
+  const int material_id = cell_ptr->material_id();
+  const auto scattering_source = ScatteringSourceAtQuadrature(
+      material_id, group_number, in_group_moment, group_moments);
+
+  return FillCellSourceComponent(to_fill, material_id, component, group_number,
+                                 scattering_source);
 }
 
 template<int dim>
@@ -300,58 +317,272 @@ void SelfAdjointAngularFlux<dim>::FillCellStreamingTerm(
     const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
     const system::EnergyGroup group_number) {
   VerifyInitialized(__FUNCTION__);
+  ValidateCell(cell_ptr, __FUNCTION__);
+  ValidateMatrixSize(to_fill, __FUNCTION__);
+
+  const int material_id = cell_ptr->material_id();
+  const int angle_index = quadrature_set_ptr_->GetQuadraturePointIndex(
+      quadrature_point);
+  const auto geometry_key = MakeCellGeometryKey<dim>(cell_ptr);
+
+  streaming_matrix_cache_.AddTo(
+      to_fill,
+      {.material_id = material_id, .geometry = geometry_key,
+       .group = group_number.get(), .angle = angle_index},
+      [&](FullMatrix& local_matrix) {
+    finite_element_ptr_->SetCell(cell_ptr);
+    const double inverse_sigma_t =
+        cross_sections_ptr_->inverse_sigma_t().at(material_id).at(group_number.get());
+
+    const auto weights = scratch_arena_.Get(kCellWeightBuffer, cell_quadrature_points_);
+    for (int q = 0; q < cell_quadrature_points_; ++q)
+      weights[q] = inverse_sigma_t * finite_element_ptr_->Jacobian(q);
+
+    if (geometry_key == precalculated_geometry_key_) {
+      // The blocks for all cell quadrature points of one angle are contiguous
+      const auto omega_dot_gradient_squared = OmegaDotGradientSquared(
+          0, quadrature::QuadraturePointIndex(angle_index));
+      cell_kernels_.cell_weighted_matrix_sum(&local_matrix(0, 0), weights.data(),
+                                             omega_dot_gradient_squared.data(),
+                                             cell_degrees_of_freedom_,
+                                             cell_quadrature_points_);
+    } else {
+      // Gradients differ from the precalculated cell, build the products for this cell
+      const int n_dofs = cell_degrees_of_freedom_;
+      const auto omega_dot_gradient = CalculateOmegaDotGradient(
+          quadrature_point->cartesian_position_tensor());
+      const auto omega_dot_gradient_squared = scratch_arena_.Get(
+          kGradientProductBuffer, cell_quadrature_points_ * n_dofs * n_dofs);
+      for (int q = 0; q < cell_quadrature_points_; ++q) {
+        for (int i = 0; i < n_dofs; ++i) {
+          for (int j = 0; j < n_dofs; ++j) {
+            omega_dot_gradient_squared[(q * n_dofs + i) * n_dofs + j] =
+                omega_dot_gradient[q * n_dofs + i] * omega_dot_gradient[q * n_dofs + j];
+          }
+        }
+      }
+      cell_kernels_.cell_weighted_matrix_sum(&local_matrix(0, 0), weights.data(),
+                                             omega_dot_gradient_squared.data(),
+                                             cell_degrees_of_freedom_,
+                                             cell_quadrature_points_);
+    }
+  });
+}
+
+template<int dim>
+void SelfAdjointAngularFlux<dim>::FillCellCollisionTermBatch(
+    std::span<FullMatrix> to_fill,
+    std::span<const domain::CellPtr<dim>> cell_ptrs,
+    const system::EnergyGroup group_number) {
+  VerifyInitialized(__FUNCTION__);
+  ValidateBatch(to_fill, cell_ptrs, __FUNCTION__);
+  InitializeCellBatchAssembler();
+  const auto& sigma_t = cross_sections_ptr_->sigma_t();
+
+  cell_batch_assembler_.FillBatch(
+      to_fill, cell_ptrs, collision_matrix_cache_,
+      [&](const domain::CellPtr<dim>& cell_ptr) -> LocalMatrixKey {
+        return {.material_id = cell_ptr->material_id(),
+                .geometry = MakeCellGeometryKey<dim>(cell_ptr),
+                .group = group_number.get()};
+      },
+      [&](const domain::CellPtr<dim>& cell_ptr) {
+        return sigma_t.at(cell_ptr->material_id()).at(group_number.get());
+      },
+      [&](auto& batch) { cell_batch_assembler_.AddShapeSquared(batch); },
+      [&](FullMatrix& cell_matrix, const domain::CellPtr<dim>& cell_ptr) {
+        FillCellCollisionTerm(cell_matrix, cell_ptr, group_number);
+      });
+}
+
+template<int dim>
+void SelfAdjointAngularFlux<dim>::FillCellStreamingTermBatch(
+    std::span<FullMatrix> to_fill,
+    std::span<const domain::CellPtr<dim>> cell_ptrs,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+    const system::EnergyGroup group_number) {
+  VerifyInitialized(__FUNCTION__);
+  ValidateBatch(to_fill, cell_ptrs, __FUNCTION__);
+  InitializeCellBatchAssembler();
+
+  const int angle_index = quadrature_set_ptr_->GetQuadraturePointIndex(
+      quadrature_point);
+  const auto omega = quadrature_point->cartesian_position_tensor();
+  const auto& inverse_sigma_t = cross_sections_ptr_->inverse_sigma_t();
+
+  /* The streaming term is summed from the directional gradient products,
+   * (Omega . grad phi_i)(Omega . grad phi_j) = sum_{a <= b} Omega_a Omega_b
+   * B^{ab}_{ij}, as for FillCellStreamingBasisTerm. */
+  cell_batch_assembler_.FillBatch(
+      to_fill, cell_ptrs, streaming_matrix_cache_,
+      [&](const domain::CellPtr<dim>& cell_ptr) -> LocalMatrixKey {
+        return {.material_id = cell_ptr->material_id(),
+                .geometry = MakeCellGeometryKey<dim>(cell_ptr),
+                .group = group_number.get(), .angle = angle_index};
+      },
+      [&](const domain::CellPtr<dim>& cell_ptr) {
+        return inverse_sigma_t.at(cell_ptr->material_id()).at(group_number.get());
+      },
+      [&](auto& batch) {
+        for (int direction_a = 0; direction_a < dim; ++direction_a) {
+          for (int direction_b = direction_a; direction_b < dim; ++direction_b) {
+            cell_batch_assembler_.AddGradientProducts(
+                batch, direction_a, direction_b,
+                omega[direction_a] * omega[direction_b]);
+          }
+        }
+      },
+      [&](FullMatrix& cell_matrix, const domain::CellPtr<dim>& cell_ptr) {
+        FillCellStreamingTerm(cell_matrix, cell_ptr, quadrature_point, group_number);
+      });
+}
+
+template<int dim>
+void SelfAdjointAngularFlux<dim>::FillCellStreamingBasisTerm(
+    FullMatrix &to_fill,
+    const domain::CellPtr<dim> &cell_ptr,
+    const int direction_a,
+    const int direction_b,
+    const system::EnergyGroup group_number) {
+  VerifyInitialized(__FUNCTION__);
+  AssertThrow((direction_a >= 0) && (direction_a <= direction_b) && (direction_b < dim),
+              dealii::ExcMessage("Error in SelfAdjointAngularFlux function "
+                                 "FillCellStreamingBasisTerm: directions must "
+                                 "satisfy 0 <= a <= b < dim"))
   ValidateMatrixSizeAndSetCell(cell_ptr, to_fill, __FUNCTION__);
 
   const int material_id = cell_ptr->material_id();
   const double inverse_sigma_t =
       cross_sections_ptr_->inverse_sigma_t().at(material_id).at(group_number.get());
-  const int angle_index = quadrature_set_ptr_->GetQuadraturePointIndex(
-      quadrature_point);
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     const double jacobian = finite_element_ptr_->Jacobian(q);
-    const FullMatrix omega_dot_gradient_squared = OmegaDotGradientSquared(
-        q, quadrature::QuadraturePointIndex(angle_index));
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      const auto gradient_i = finite_element_ptr_->ShapeGradient(i, q);
       for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-        to_fill(i, j) +=
-            inverse_sigma_t * omega_dot_gradient_squared(i,j) * jacobian;
+        const auto gradient_j = finite_element_ptr_->ShapeGradient(j, q);
+        double basis_value = gradient_i[direction_a] * gradient_j[direction_b];
+        if (direction_a != direction_b)
+          basis_value += gradient_i[direction_b] * gradient_j[direction_a];
+        to_fill(i, j) += inverse_sigma_t * basis_value * jacobian;
       }
     }
   }
 }
 
 template <int dim>
-std::vector<double> SelfAdjointAngularFlux<dim>::OmegaDotGradient(
+auto SelfAdjointAngularFlux<dim>::ShapeSquared(
+    int cell_quadrature_point) const -> std::span<const double> {
+  ValidateTableIndices(cell_quadrature_point, std::nullopt, __FUNCTION__);
+  const int block_size = cell_degrees_of_freedom_ * cell_degrees_of_freedom_;
+  return std::span<const double>(shape_squared_).subspan(
+      cell_quadrature_point * block_size, block_size);
+}
+
+template <int dim>
+auto SelfAdjointAngularFlux<dim>::OmegaDotGradient(
     int cell_quadrature_point,
-    quadrature::QuadraturePointIndex angular_index) const {
-  std::vector<double> return_vector(cell_degrees_of_freedom_);
-  std::pair<int, int> index{cell_quadrature_point, angular_index.get()};
-  for (int i = 0; i < cell_degrees_of_freedom_; ++i)
-    return_vector.at(i) = omega_dot_gradient_.at(index)[i];
-  return return_vector;
+    quadrature::QuadraturePointIndex angular_index) const -> std::span<const double> {
+  ValidateTableIndices(cell_quadrature_point, angular_index.get(), __FUNCTION__);
+  const int block = angular_index.get() * cell_quadrature_points_ + cell_quadrature_point;
+  return std::span<const double>(omega_dot_gradient_).subspan(
+      block * cell_degrees_of_freedom_, cell_degrees_of_freedom_);
 }
 
 template <int dim>
-FullMatrix SelfAdjointAngularFlux<dim>::OmegaDotGradientSquared(
+auto SelfAdjointAngularFlux<dim>::OmegaDotGradientSquared(
     int cell_quadrature_point,
-    quadrature::QuadraturePointIndex angular_index) const {
-  return omega_dot_gradient_squared_.at(
-      {cell_quadrature_point, angular_index.get()});
+    quadrature::QuadraturePointIndex angular_index) const -> std::span<const double> {
+  ValidateTableIndices(cell_quadrature_point, angular_index.get(), __FUNCTION__);
+  const int block = angular_index.get() * cell_quadrature_points_ + cell_quadrature_point;
+  const int block_size = cell_degrees_of_freedom_ * cell_degrees_of_freedom_;
+  return std::span<const double>(omega_dot_gradient_squared_).subspan(
+      block * block_size, block_size);
 }
 
 // PRIVATE FUNCTIONS ===========================================================
 template <int dim>
-void SelfAdjointAngularFlux<dim>::ValidateAndSetCell(
+void SelfAdjointAngularFlux<dim>::ValidateCell(
     const bart::domain::CellPtr<dim> &cell_ptr,
     std::string function_name) {
   std::string error{"Error in SelfAdjointAngularFlux function " +
       function_name + ": passed cell pointer is invalid"};
   AssertThrow(cell_ptr.state() == dealii::IteratorState::valid,
               dealii::ExcMessage(error))
+}
+
+template <int dim>
+void SelfAdjointAngularFlux<dim>::ValidateAndSetCell(
+    const bart::domain::CellPtr<dim> &cell_ptr,
+    std::string function_name) {
+  ValidateCell(cell_ptr, function_name);
   finite_element_ptr_->SetCell(cell_ptr);
 }
 
+template <int dim>
+void SelfAdjointAngularFlux<dim>::ValidateBatch(
+    std::span<FullMatrix> to_fill,
+    std::span<const domain::CellPtr<dim>> cell_ptrs,
+    std::string called_function_name) {
+  for (const auto& matrix : to_fill)
+    ValidateMatrixSize(matrix, called_function_name);
+  for (const auto& cell_ptr : cell_ptrs)
+    ValidateCell(cell_ptr, called_function_name);
+}
+
+template <int dim>
+auto SelfAdjointAngularFlux<dim>::GetBoundaryFaceValues(
+    const domain::CellPtr<dim>& cell_ptr,
+    const domain::FaceIndex face_number) -> BoundaryFaceValuesPtr {
+  const LocalMatrixKey key{.geometry = MakeCellGeometryKey<dim>(cell_ptr),
+                           .face = face_number.get()};
+  if (auto stored_face_values = FindBoundaryFaceValues(key);
+      stored_face_values != nullptr)
+    return stored_face_values;
+
+  finite_element_ptr_->SetFace(cell_ptr, face_number);
+  const int n_dofs = cell_degrees_of_freedom_;
+  auto face_values = std::make_shared<BoundaryFaceValues>(BoundaryFaceValues{
+      .normal = finite_element_ptr_->FaceNormal(),
+      .mass_matrix = FullMatrix(n_dofs, n_dofs),
+      .shape_projections = std::vector<double>(face_quadrature_points_ * n_dofs)});
+
+  std::vector<double> jacobians(face_quadrature_points_), shape_values(face_quadrature_points_ * n_dofs);
+  for (int f_q = 0; f_q < face_quadrature_points_; ++f_q) {
+    jacobians[f_q] = finite_element_ptr_->FaceJacobian(f_q);
+    for (int i = 0; i < n_dofs; ++i) {
+      shape_values[f_q * n_dofs + i] = finite_element_ptr_->FaceShapeValue(i, f_q);
+      face_values->shape_projections[f_q * n_dofs + i] =
+          shape_values[f_q * n_dofs + i] * jacobians[f_q];
+    }
+  }
+  cell_kernels_.face_weighted_outer_product_sum(&face_values->mass_matrix(0, 0),
+                                                jacobians.data(),
+                                                shape_values.data(), n_dofs,
+                                                face_quadrature_points_);
+
+  // Values calculated by another thread in the meantime are kept, both are identical
+  std::unique_lock lock(boundary_face_values_mutex_);
+  if (boundary_face_values_.size() < kMaxBoundaryFaceValues)
+    return boundary_face_values_.try_emplace(key, std::move(face_values)).first->second;
+  return face_values;
+}
+
+template <int dim>
+auto SelfAdjointAngularFlux<dim>::FindBoundaryFaceValues(
+    const LocalMatrixKey& key) const -> BoundaryFaceValuesPtr {
+  std::shared_lock lock(boundary_face_values_mutex_);
+  const auto it = boundary_face_values_.find(key);
+  return it == boundary_face_values_.end() ? nullptr : it->second;
+}
+
+template <int dim>
+void SelfAdjointAngularFlux<dim>::InitializeCellBatchAssembler() {
+  std::scoped_lock lock(cell_batch_assembler_mutex_);
+  if (!cell_batch_assembler_.is_initialized())
+    cell_batch_assembler_.Initialize(*finite_element_ptr_, precalculated_cell_ptr_);
+}
+
 template <int dim>
 void SelfAdjointAngularFlux<dim>::ValidateMatrixSize(
     const bart::formulation::FullMatrix& to_validate,
@@ -393,24 +624,32 @@ void SelfAdjointAngularFlux<dim>::ValidateVectorSize(
 template <int dim>
 auto SelfAdjointAngularFlux<dim>::FillCellSourceTerm(
     bart::formulation::Vector &to_fill,
-    const int material_id,
+    const domain::CellPtr<dim>& cell_ptr,
     const std::shared_ptr<bart::quadrature::QuadraturePointI<dim>> quadrature_point,
     const bart::system::EnergyGroup group_number,
-    std::vector<double> source) -> double {
+    std::span<const double> source) -> double {
   double total_value_added{ 0 };
+  const int material_id = cell_ptr->material_id();
+  const bool cell_has_precalculated_geometry{ MakeCellGeometryKey<dim>(cell_ptr) == precalculated_geometry_key_ };
   const double inverse_sigma_t =
       cross_sections_ptr_->inverse_sigma_t().at(material_id).at(group_number.get());
   const int angle_index = quadrature_set_ptr_->GetQuadraturePointIndex(
       quadrature_point);
+  std::vector<double> cell_omega_dot_gradient;
+  if (!cell_has_precalculated_geometry)
+    cell_omega_dot_gradient = CalculateOmegaDotGradient(
+        quadrature_point->cartesian_position_tensor());
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     const double jacobian = finite_element_ptr_->Jacobian(q);
-    const auto omega_dot_gradient = OmegaDotGradient(
-        q, quadrature::QuadraturePointIndex(angle_index));
+    const auto omega_dot_gradient = cell_has_precalculated_geometry ?
+        OmegaDotGradient(q, quadrature::QuadraturePointIndex(angle_index)) :
+        std::span<const double>(cell_omega_dot_gradient).subspan(
+            q * cell_degrees_of_freedom_, cell_degrees_of_freedom_);
 
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
-      const double value_to_add{ jacobian * source.at(q) * (finite_element_ptr_->ShapeValue(i, q) +
-          omega_dot_gradient.at(i) * inverse_sigma_t)};
+      const double value_to_add{ jacobian * source[q] * (finite_element_ptr_->ShapeValue(i, q) +
+          omega_dot_gradient[i] * inverse_sigma_t)};
       to_fill(i) += value_to_add;
       total_value_added += std::abs(value_to_add);
     }
@@ -418,6 +657,146 @@ auto SelfAdjointAngularFlux<dim>::FillCellSourceTerm(
   return total_value_added;
 }
 
+template <int dim>
+auto SelfAdjointAngularFlux<dim>::FillCellSourceComponent(
+    Vector &to_fill,
+    const int material_id,
+    const int component,
+    const system::EnergyGroup group_number,
+    std::span<const double> source) -> double {
+  double total_value_added{ 0 };
+  const double inverse_sigma_t =
+      cross_sections_ptr_->inverse_sigma_t().at(material_id).at(group_number.get());
+
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    const double jacobian = finite_element_ptr_->Jacobian(q);
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      const double basis_value = (component == 0) ?
+          finite_element_ptr_->ShapeValue(i, q) :
+          finite_element_ptr_->ShapeGradient(i, q)[component - 1] * inverse_sigma_t;
+      const double value_to_add{ jacobian * source[q] * basis_value };
+      to_fill(i) += value_to_add;
+      total_value_added += std::abs(value_to_add);
+    }
+  }
+  return total_value_added;
+}
+
+template <int dim>
+auto SelfAdjointAngularFlux<dim>::FissionSourceAtQuadrature(
+    const int material_id,
+    const system::EnergyGroup group_number,
+    const double k_eff,
+    const system::moments::MomentVector& in_group_moment,
+    const system::moments::MomentsMap& group_moments) -> std::span<const double> {
+  const int group = group_number.get();
+  const auto fission_source = scratch_arena_.Get(kSourceBuffer, cell_quadrature_points_);
+  const auto scalar_flux = scratch_arena_.Get(kScalarFluxBuffer, cell_quadrature_points_);
+
+  // Get the contribution from each group
+  for (const auto &moment_pair : group_moments) {
+    auto &[index, moment] = moment_pair;
+    const auto &[group_in, harmonic_l, harmonic_m] = index;
+
+    if ((harmonic_l == 0) && (harmonic_m == 0)) {
+      finite_element_ptr_->ValueAtQuadrature(
+          group_in == group ? in_group_moment : moment, scalar_flux);
+
+      const auto fission_xfer_per_ster =
+          cross_sections_ptr_->fiss_transfer_per_ster().at(material_id)(group_in,
+                                                                      group);
+
+      for (int q = 0; q < cell_quadrature_points_; ++q) {
+        fission_source[q] += fission_xfer_per_ster * scalar_flux[q] / k_eff;
+      }
+    }
+  }
+  return fission_source;
+}
+
+template <int dim>
+auto SelfAdjointAngularFlux<dim>::ScatteringSourceAtQuadrature(
+    const int material_id,
+    const system::EnergyGroup group_number,
+    const system::moments::MomentVector& in_group_moment,
+    const system::moments::MomentsMap& group_moments) -> std::span<const double> {
+  const int group = group_number.get();
+
+  /* The scattering source is determined as the common values in both of the
+   * scattering source terms in SAAF, specifically scalar flux times the
+   * scattering cross-section per steradian */
+
+  const auto scattering_source = scratch_arena_.Get(kSourceBuffer, cell_quadrature_points_);
+  const auto weights = scratch_arena_.Get(kWeightBuffer, group_moments.size());
+  const auto moments = moment_arena_.Get(0, group_moments.size());
+  const auto& sigma_s_per_ster = cross_sections_ptr_->sigma_s_per_ster().at(material_id);
+
+  // The contribution from each group is summed at the degrees of freedom and
+  // evaluated at the quadrature points once
+  std::size_t n_moments{ 0 };
+  for (const auto& moment_pair : group_moments) {
+    auto &[index, moment] = moment_pair;
+    const auto &[group_in, harmonic_l, harmonic_m] = index;
+
+    if ((harmonic_l == 0) && (harmonic_m == 0)) {
+      weights[n_moments] = sigma_s_per_ster(group, group_in);
+      moments[n_moments] = (group_in == group) ? &in_group_moment : &moment;
+      ++n_moments;
+    }
+  }
+  finite_element_ptr_->WeightedValueAtQuadrature(
+      weights.first(n_moments), moments.first(n_moments), scattering_source);
+  return scattering_source;
+}
+
+template<int dim>
+void SelfAdjointAngularFlux<dim>::ValidateTableIndices(
+    int cell_quadrature_point,
+    std::optional<int> angle_index,
+    std::string_view called_function_name) const {
+  const bool is_valid = is_initialized_ &&
+      (cell_quadrature_point >= 0) &&
+      (cell_quadrature_point < cell_quadrature_points_) &&
+      (!angle_index.has_value() ||
+          ((angle_index.value() >= 0) && (angle_index.value() < n_angles_)));
+  if (!is_valid) {
+    std::ostringstream error_string;
+    error_string << "Error in SelfAdjointAngularFlux function "
+                 << called_function_name
+                 << ": requested precalculated value is out of range, cell "
+                 << "quadrature point: " << cell_quadrature_point
+                 << ", angle index: " << angle_index.value_or(-1);
+    AssertThrow(false, dealii::ExcMessage(error_string.str()))
+  }
+}
+
+template <int dim>
+auto SelfAdjointAngularFlux<dim>::CalculateOmegaDotGradient(
+    const dealii::Tensor<1, dim>& omega) -> std::vector<double> {
+  std::vector<double> omega_dot_gradient(
+      cell_quadrature_points_ * cell_degrees_of_freedom_);
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      omega_dot_gradient[q * cell_degrees_of_freedom_ + i] =
+          omega * finite_element_ptr_->ShapeGradient(i, q);
+    }
+  }
+  return omega_dot_gradient;
+}
+
+template<int dim>
+void SelfAdjointAngularFlux<dim>::ValidateSourceComponent(
+    const int component,
+    std::string called_function_name) {
+  std::ostringstream error_string;
+  error_string << "Error in SelfAdjointAngularFlux function "
+               << called_function_name
+               << ": source component must be in the range [0, " << dim
+               << "], actual component: " << component;
+  AssertThrow((component >= 0) && (component <= dim),
+              dealii::ExcMessage(error_string.str()))
+}
+
 template<int dim>
 void SelfAdjointAngularFlux<dim>::VerifyInitialized(
     std::string called_function_name) {
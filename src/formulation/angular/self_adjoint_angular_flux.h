@@ -4,9 +4,19 @@
 #include "data/cross_sections/material_cross_sections.hpp"
 #include "domain/finite_element/finite_element_i.hpp"
 #include "formulation/angular/self_adjoint_angular_flux_i.h"
+#include "formulation/cell_batch_assembler.hpp"
+#include "formulation/local_matrix_cache.hpp"
 #include "quadrature/quadrature_set_i.hpp"
+#include "utility/scratch_arena.hpp"
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <span>
+#include <string_view>
+#include <vector>
 
 namespace bart {
 
@@ -75,12 +85,60 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
       const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
       const system::EnergyGroup group_number) override;
 
+  void FillCellCollisionTermBatch(
+      std::span<FullMatrix> to_fill,
+      std::span<const domain::CellPtr<dim>> cell_ptrs,
+      const system::EnergyGroup group_number) override;
+
+  void FillCellStreamingTermBatch(
+      std::span<FullMatrix> to_fill,
+      std::span<const domain::CellPtr<dim>> cell_ptrs,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const system::EnergyGroup group_number) override;
+
+  void FillCellStreamingBasisTerm(
+      FullMatrix &to_fill,
+      const domain::CellPtr<dim> &cell_ptr,
+      const int direction_a,
+      const int direction_b,
+      const system::EnergyGroup group_number) override;
+
+  auto FillCellFissionSourceComponent(
+      Vector &to_fill,
+      const domain::CellPtr<dim> &cell_ptr,
+      const int component,
+      const system::EnergyGroup group_number,
+      const double k_eff,
+      const system::moments::MomentVector &in_group_moment,
+      const system::moments::MomentsMap &group_moments) -> double override;
+
+  void FillCellFixedSourceComponent(
+      Vector &to_fill,
+      const domain::CellPtr<dim> &cell_ptr,
+      const int component,
+      const system::EnergyGroup group_number) override;
 
-  // Getters for pre-calculated values
-  std::vector<double> OmegaDotGradient(int cell_quadrature_point,
-                                       quadrature::QuadraturePointIndex) const;
-  FullMatrix OmegaDotGradientSquared(int cell_quadrature_point,
-                                     quadrature::QuadraturePointIndex) const;
+  auto FillCellScatteringSourceComponent(
+      Vector &to_fill,
+      const domain::CellPtr<dim> &cell_ptr,
+      const int component,
+      const system::EnergyGroup group_number,
+      const system::moments::MomentVector &in_group_moment,
+      const system::moments::MomentsMap &group_moments) -> double override;
+
+  // Getters for pre-calculated values, these are views into contiguous tables
+  /*! \brief Shape function products \f$\varphi_i\varphi_j\f$ at a cell
+   * quadrature point, stored row-major by \f$(i, j)\f$. */
+  auto ShapeSquared(int cell_quadrature_point) const -> std::span<const double>;
+  /*! \brief Values of \f$\vec{\Omega}\cdot\nabla\varphi_i\f$ at a cell
+   * quadrature point for one angle, indexed by \f$i\f$. */
+  auto OmegaDotGradient(int cell_quadrature_point,
+                        quadrature::QuadraturePointIndex) const -> std::span<const double>;
+  /*! \brief Products \f$(\vec{\Omega}\cdot\nabla\varphi_i)
+   * (\vec{\Omega}\cdot\nabla\varphi_j)\f$ at a cell quadrature point for
+   * one angle, stored row-major by \f$(i, j)\f$. */
+  auto OmegaDotGradientSquared(int cell_quadrature_point,
+                               quadrature::QuadraturePointIndex) const -> std::span<const double>;
   // Dependency getters
   domain::finite_element::FiniteElementI<dim>* finite_element_ptr() const {
     return finite_element_ptr_.get(); }
@@ -89,9 +147,6 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
   quadrature::QuadratureSetI<dim>* quadrature_set_ptr() const {
     return quadrature_set_ptr_.get(); }
 
-  std::map<int, FullMatrix> shape_squared() const {
-    return shape_squared_; }
-
   bool is_initialized() const { return is_initialized_; }
 
  protected:
@@ -110,17 +165,51 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
   }
   void ValidateAndSetCell(const domain::CellPtr<dim>& cell_ptr,
                           std::string function_name);
+  void ValidateCell(const domain::CellPtr<dim>& cell_ptr,
+                    std::string function_name);
   void ValidateMatrixSize(const FullMatrix&, std::string called_function_name);
   void ValidateVectorSize(const Vector&, std::string called_function_name);
   void VerifyInitialized(std::string called_function_name);
 
   // Combined implementation functions
+  /*! Fills the source term for a cell that must already be set in the finite element. Whether the cell can use the
+   * precalculated gradient values is determined for each call, as cells may be filled by multiple threads. */
   auto FillCellSourceTerm(
       Vector& to_fill,
-      const int material_id,
+      const domain::CellPtr<dim>& cell_ptr,
       const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
       const system::EnergyGroup group_number,
-      std::vector<double> source) -> double;
+      std::span<const double> source) -> double;
+  auto FillCellSourceComponent(
+      Vector& to_fill,
+      const int material_id,
+      const int component,
+      const system::EnergyGroup group_number,
+      std::span<const double> source) -> double;
+  void ValidateSourceComponent(const int component, std::string called_function_name);
+  /*! \brief Fission source per steradian at each cell quadrature point,
+   * valid until the source buffer is next used */
+  auto FissionSourceAtQuadrature(
+      const int material_id,
+      const system::EnergyGroup group_number,
+      const double k_eff,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) -> std::span<const double>;
+  /*! \brief Scattering source per steradian at each cell quadrature point,
+   * valid until the source buffer is next used */
+  auto ScatteringSourceAtQuadrature(
+      const int material_id,
+      const system::EnergyGroup group_number,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) -> std::span<const double>;
+  //! Buffers for values at quadrature points, so that filling source and
+  //! boundary terms and local matrices does not allocate
+  utility::ScratchArena scratch_arena_{};
+  enum ScratchBuffer : std::size_t {
+    kSourceBuffer = 0, kScalarFluxBuffer = 1, kFaceFluxBuffer = 2, kWeightBuffer = 3,
+    kCellWeightBuffer = 4, kGradientProductBuffer = 5 };
+  //! Buffer for the moments summed by the group-summed scattering source
+  utility::BasicScratchArena<const system::moments::MomentVector*> moment_arena_{};
 
   // Dependencies
   std::shared_ptr<domain::finite_element::FiniteElementI<dim>> finite_element_ptr_;
@@ -130,15 +219,68 @@ class SelfAdjointAngularFlux : public SelfAdjointAngularFluxI<dim> {
   const int cell_degrees_of_freedom_ = 0; //!< Degrees of freedom per cell
   const int cell_quadrature_points_ = 0; //!< Quadrature points per cell
   const int face_quadrature_points_ = 0; //!< Quadrature points per face
-  // Precalculated matrices and vectors
-  using CellQuadratureIndex = int;
-  using AngleIndex = int;
-  std::map<std::pair<CellQuadratureIndex, AngleIndex>,
-           dealii::Vector<double>> omega_dot_gradient_;
-  std::map<std::pair<CellQuadratureIndex, AngleIndex>,
-           FullMatrix> omega_dot_gradient_squared_;
-  std::map<CellQuadratureIndex, FullMatrix> shape_squared_ = {};
+  //! Kernels used to integrate cell terms, provided by the finite element
+  const domain::finite_element::CellKernels& cell_kernels_;
+  // Precalculated matrices and vectors, stored in contiguous tables indexed
+  // [angle][cell quadrature point][i][j]
+  void ValidateTableIndices(int cell_quadrature_point,
+                            std::optional<int> angle_index,
+                            std::string_view called_function_name) const;
+  int n_angles_ = 0; //!< Number of angles in the precalculated tables
+  std::vector<double> omega_dot_gradient_ = {};
+  std::vector<double> omega_dot_gradient_squared_ = {};
+  std::vector<double> shape_squared_ = {};
   bool is_initialized_ = false;
+  /* Gradient dependent precalculated values are only valid for cells
+   * congruent to the cell passed to Initialize, other cells calculate them
+   * as needed. */
+  CellGeometryKey precalculated_geometry_key_ = {};
+  //! Cell passed to Initialize, used as the reference cell for batched assembly
+  domain::CellPtr<dim> precalculated_cell_ptr_{};
+  /*! \brief Values of \f$\vec{\Omega}\cdot\nabla\varphi_i\f$ for the cell
+   * currently set in the finite element, indexed [cell quadrature point][i]. */
+  auto CalculateOmegaDotGradient(const dealii::Tensor<1, dim>& omega) -> std::vector<double>;
+
+  // Local matrices reused on congruent cells
+  LocalMatrixCache collision_matrix_cache_{};
+  LocalMatrixCache streaming_matrix_cache_{};
+
+  /*! \brief Angle independent values on a boundary face.
+   *
+   * Boundary terms only depend on the angle through \f$\hat{n}\cdot\vec{\Omega}\f$,
+   * so the face integrals are calculated once for each face and scaled for
+   * every angle. */
+  struct BoundaryFaceValues {
+    dealii::Tensor<1, dim> normal{};
+    //! Face mass matrix, \f$\int_f \varphi_i\varphi_j dS\f$
+    FullMatrix mass_matrix{};
+    //! Face shape values multiplied by the face Jacobian, indexed [face quadrature point][i]
+    std::vector<double> shape_projections{};
+  };
+  using BoundaryFaceValuesPtr = std::shared_ptr<const BoundaryFaceValues>;
+  /*! \brief Returns the face values for a boundary face, calculating them if
+   * needed. If they are calculated the face is set in the finite element. */
+  auto GetBoundaryFaceValues(const domain::CellPtr<dim>& cell_ptr,
+                             domain::FaceIndex face_number) -> BoundaryFaceValuesPtr;
+  /*! \brief Returns the stored face values for a key, or nullptr if none are
+   * stored. */
+  auto FindBoundaryFaceValues(const LocalMatrixKey& key) const -> BoundaryFaceValuesPtr;
+  //! Face values for congruent cells, keyed by cell geometry and face index
+  std::map<LocalMatrixKey, BoundaryFaceValuesPtr> boundary_face_values_{};
+  //! Guards boundary_face_values_, which may be filled by multiple threads
+  mutable std::shared_mutex boundary_face_values_mutex_{};
+  //! Maximum number of stored boundary faces
+  static constexpr std::size_t kMaxBoundaryFaceValues{ std::size_t{ 1 } << 16 };
+  //! Integrates streaming and collision matrices for batches of axis-aligned
+  //! cells, initialized on first use
+  CellBatchAssembler<dim> cell_batch_assembler_{};
+  //! Guards initialization of the batch assembler by the first of multiple
+  //! threads filling batches
+  std::mutex cell_batch_assembler_mutex_{};
+  void InitializeCellBatchAssembler();
+  void ValidateBatch(std::span<FullMatrix> to_fill,
+                     std::span<const domain::CellPtr<dim>> cell_ptrs,
+                     std::string called_function_name);
 };
 
 } // namespace angular
@@ -1,6 +1,8 @@
 #ifndef BART_SRC_FORMULATION_ANGULAR_SELF_ADJOINT_ANGULAR_FLUX_I_H_
 #define BART_SRC_FORMULATION_ANGULAR_SELF_ADJOINT_ANGULAR_FLUX_I_H_
 
+#include <span>
+
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/dofs/dof_accessor.h>
 
@@ -204,10 +206,118 @@ class SelfAdjointAngularFluxI {
       const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
       const system::EnergyGroup group_number) = 0;
 
+  /*! \brief Integrates the bilinear collision term over a batch of cells.
+   *
+   * Equivalent to calling FillCellCollisionTerm for each cell, but allows
+   * implementations to integrate several cells at once.
+   *
+   * @param to_fill cell matrices to fill, one for each cell.
+   * @param cell_ptrs pointers to the cells.
+   * @param group_number energy group to fill
+   */
+  virtual void FillCellCollisionTermBatch(
+      std::span<FullMatrix> to_fill,
+      std::span<const domain::CellPtr<dim>> cell_ptrs,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates the bilinear streaming term over a batch of cells.
+   *
+   * Equivalent to calling FillCellStreamingTerm for each cell, see
+   * FillCellCollisionTermBatch.
+   */
+  virtual void FillCellStreamingTermBatch(
+      std::span<FullMatrix> to_fill,
+      std::span<const domain::CellPtr<dim>> cell_ptrs,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>> quadrature_point,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates one directional component of the bilinear streaming term.
+   *
+   * The streaming term is a quadratic form in \f$\vec{\Omega}\f$, so it can be
+   * decomposed into angle-independent basis matrices:
+   * \f[
+   * \int_{K}\left(\vec{\Omega}\cdot\nabla\varphi_i\right)
+   * \frac{1}{\sigma_{t,g}}\left(\vec{\Omega}\cdot\nabla\varphi_j\right) dV
+   * = \sum_{a \leq b}\Omega_a\Omega_b\mathbf{B}^{ab}_{K,g}(i,j)
+   * \f]
+   * This function adds the basis matrix for directions \f$a \leq b\f$ to the
+   * provided local cell matrix:
+   * \f[
+   * \mathbf{B}^{ab}_{K,g}(i,j) = \int_{K}\frac{1}{\sigma_{t,g}(\vec{r})}
+   * \left(\partial_a\varphi_i\partial_b\varphi_j +
+   * \partial_b\varphi_i\partial_a\varphi_j\right) dV, \quad a \neq b
+   * \f]
+   * with the symmetric term counted once when \f$a = b\f$.
+   *
+   * @param to_fill cell matrix to fill.
+   * @param cell_ptr pointer to the cell
+   * @param direction_a first cartesian direction, \f$a\f$
+   * @param direction_b second cartesian direction, \f$b \geq a\f$
+   * @param group_number energy group to fill
+   */
+  virtual void FillCellStreamingBasisTerm(
+      FullMatrix& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const int direction_a,
+      const int direction_b,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates one angle-separable component of the fission source.
+   *
+   * The SAAF linear source terms are an isotropic part plus a part that is
+   * linear in \f$\vec{\Omega}\f$, so for an isotropic source \f$q_g\f$ the cell
+   * right-hand side for any angle is
+   * \f$\vec{b}_{K,g} = \vec{v}^0_{K,g} + \sum_a\Omega_a\vec{v}^{a+1}_{K,g}\f$,
+   * with
+   * \f[
+   * \vec{v}^0_{K,g}(i) = \int_{K}q_g(\vec{r})\varphi_i(\vec{r})dV, \quad
+   * \vec{v}^{a+1}_{K,g}(i) = \int_{K}\frac{q_g(\vec{r})}{\sigma_{t,g}(\vec{r})}
+   * \partial_a\varphi_i(\vec{r})dV
+   * \f]
+   *
+   * The source components functions fill \f$\vec{v}^c_{K,g}\f$ for component
+   * \f$c \in [0, \text{dim}]\f$; the fission source \f$q_g\f$ is as described
+   * for FillCellFissionSourceTerm.
+   *
+   * @return sum of the absolute values added to the cell vector.
+   */
+  virtual auto FillCellFissionSourceComponent(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const int component,
+      const system::EnergyGroup group_number,
+      const double k_eff,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) -> double = 0;
+
+  /*! \brief Integrates one angle-separable component of the fixed source.
+   *
+   * See FillCellFissionSourceComponent for the definition of the components.
+   */
+  virtual void FillCellFixedSourceComponent(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const int component,
+      const system::EnergyGroup group_number) = 0;
+
+  /*! \brief Integrates one angle-separable component of the scattering source.
+   *
+   * See FillCellFissionSourceComponent for the definition of the components.
+   *
+   * @return sum of the absolute values added to the cell vector.
+   */
+  virtual auto FillCellScatteringSourceComponent(
+      Vector& to_fill,
+      const domain::CellPtr<dim>& cell_ptr,
+      const int component,
+      const system::EnergyGroup group_number,
+      const system::moments::MomentVector& in_group_moment,
+      const system::moments::MomentsMap& group_moments) -> double = 0;
 
   /*! \brief Initialize the formulation.
    * In general, this will pre-calculate matrix terms. The cell pointer is only
-   * used to initialize the finite element object.
+   * used to initialize the finite element object, cells that are not
+   * congruent to it calculate gradient dependent terms when filled.
    * @param cell_ptr cell pointer for initialization.
    */
   virtual void Initialize(const domain::CellPtr<dim>&) = 0;
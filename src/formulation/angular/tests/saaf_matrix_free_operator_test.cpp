@@ -0,0 +1,202 @@
+#include "formulation/angular/saaf_matrix_free_operator.hpp"
+
+#include <array>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <deal.II/base/tensor.h>
+
+#include "data/cross_sections/material_cross_sections.hpp"
+#include "data/material/tests/material_mock.hpp"
+#include "domain/domain.hpp"
+#include "domain/finite_element/finite_element_gaussian.hpp"
+#include "domain/mesh/mesh_cartesian.hpp"
+#include "formulation/angular/self_adjoint_angular_flux.h"
+#include "formulation/stamper.hpp"
+#include "formulation/updater/saaf_updater.h"
+#include "problem/parameter_types.hpp"
+#include "quadrature/tests/quadrature_point_mock.hpp"
+#include "quadrature/tests/quadrature_set_mock.hpp"
+#include "system/system.hpp"
+#include "system/terms/term.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_helper_functions.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return;
+
+/* Tests for the matrix-free SAAF operator. The operator applied through its PETSc shell matrix is compared to the
+ * fixed matrix assembled by SAAFUpdater::UpdateFixedTerms, using a real domain with two materials, real
+ * cross-sections and formulation, and three mock angles.
+ */
+template <typename DimensionWrapper>
+class FormulationAngularSAAFMatrixFreeOperatorTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using Boundary = problem::Boundary;
+  using Domain = domain::Domain<dim>;
+  using FiniteElement = domain::finite_element::FiniteElementGaussian<dim>;
+  using QuadraturePointType = NiceMock<quadrature::QuadraturePointMock<dim>>;
+  using QuadratureSetType = NiceMock<quadrature::QuadratureSetMock<dim>>;
+  using Updater = formulation::updater::SAAFUpdater<dim>;
+
+  // Test parameters
+  static constexpr int polynomial_degree_{ 2 };
+  static constexpr int total_groups_{ 2 };
+  const std::vector<std::array<double, 3>> directions_{{0.6, -0.8, 0.0}, {-0.3, 0.5, 0.81}, {0.9, 0.2, -0.39}};
+  const std::unordered_map<int, std::vector<double>> sigma_t_{{0, {1.0, 5.0}}, {1, {0.5, 20.0}}};
+  const std::unordered_map<int, std::vector<double>> inverse_sigma_t_{{0, {1.0, 0.2}}, {1, {2.0, 0.05}}};
+
+  // Test objects
+  std::shared_ptr<Domain> domain_ptr_;
+  std::shared_ptr<FiniteElement> finite_element_ptr_;
+  std::shared_ptr<data::cross_sections::CrossSectionsI> cross_sections_ptr_;
+  std::shared_ptr<QuadratureSetType> quadrature_set_ptr_;
+  NiceMock<data::material::MaterialMock> mock_material_;
+  system::System test_system_;
+
+  void SetUp() override;
+  auto MakeUpdater(const std::unordered_set<Boundary>& reflective_boundaries) -> std::unique_ptr<Updater>;
+  auto ExpectOperatorMatchesFixedTerms(Updater& updater) -> void;
+  // Material mapping with both materials on each boundary
+  static auto MaterialMapping() -> std::string;
+};
+
+template <typename DimensionWrapper>
+auto FormulationAngularSAAFMatrixFreeOperatorTest<DimensionWrapper>::MaterialMapping() -> std::string {
+  if (dim == 1)
+    return "0 1";
+  if (dim == 2)
+    return "0 1\n1 0";
+  return "0 1\n1 0\n\n1 0\n0 1";
+}
+
+template <typename DimensionWrapper>
+void FormulationAngularSAAFMatrixFreeOperatorTest<DimensionWrapper>::SetUp() {
+  finite_element_ptr_ = std::make_shared<FiniteElement>(problem::DiscretizationType::kContinuousFEM,
+                                                        polynomial_degree_);
+  auto mesh_ptr = std::make_unique<domain::mesh::MeshCartesian<dim>>(std::vector<double>(dim, 2.0),
+                                                                     std::vector<int>(dim, 4),
+                                                                     MaterialMapping());
+  domain_ptr_ = std::make_shared<Domain>(std::move(mesh_ptr), finite_element_ptr_);
+  domain_ptr_->SetUpMesh().SetUpDOF();
+
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t_));
+  ON_CALL(mock_material_, GetInvSigT()).WillByDefault(Return(inverse_sigma_t_));
+  cross_sections_ptr_ = std::make_shared<data::cross_sections::MaterialCrossSections>(mock_material_);
+
+  quadrature_set_ptr_ = std::make_shared<QuadratureSetType>();
+  std::set<int> quadrature_point_indices;
+  for (int angle = 0; angle < static_cast<int>(directions_.size()); ++angle) {
+    auto quadrature_point_ptr = std::make_shared<QuadraturePointType>();
+    dealii::Tensor<1, dim> omega;
+    for (int i = 0; i < dim; ++i)
+      omega[i] = directions_.at(angle).at(i);
+    ON_CALL(*quadrature_point_ptr, cartesian_position_tensor()).WillByDefault(Return(omega));
+    ON_CALL(*quadrature_set_ptr_, GetQuadraturePoint(quadrature::QuadraturePointIndex(angle)))
+        .WillByDefault(Return(quadrature_point_ptr));
+    quadrature_point_indices.insert(angle);
+  }
+  ON_CALL(*quadrature_set_ptr_, size()).WillByDefault(Return(directions_.size()));
+  ON_CALL(*quadrature_set_ptr_, quadrature_point_indices()).WillByDefault(Return(quadrature_point_indices));
+
+  auto left_hand_side_ptr = std::make_unique<system::terms::MPIBilinearTerm>();
+  auto right_hand_side_ptr = std::make_unique<system::terms::MPILinearTerm>();
+  for (int group = 0; group < total_groups_; ++group) {
+    for (int angle = 0; angle < static_cast<int>(directions_.size()); ++angle) {
+      left_hand_side_ptr->SetFixedTermPtr({group, angle}, domain_ptr_->MakeSystemMatrix());
+      right_hand_side_ptr->SetFixedTermPtr({group, angle}, domain_ptr_->MakeSystemVector());
+    }
+  }
+  test_system_.left_hand_side_ptr_ = std::move(left_hand_side_ptr);
+  test_system_.right_hand_side_ptr_ = std::move(right_hand_side_ptr);
+  test_system_.total_groups = total_groups_;
+  test_system_.total_angles = static_cast<int>(directions_.size());
+}
+
+template <typename DimensionWrapper>
+auto FormulationAngularSAAFMatrixFreeOperatorTest<DimensionWrapper>::MakeUpdater(
+    const std::unordered_set<Boundary>& reflective_boundaries) -> std::unique_ptr<Updater> {
+  auto formulation_ptr = std::make_unique<formulation::angular::SelfAdjointAngularFlux<dim>>(
+      finite_element_ptr_, cross_sections_ptr_, quadrature_set_ptr_);
+  formulation_ptr->Initialize(domain_ptr_->Cells().at(0));
+  auto stamper_ptr = std::make_unique<formulation::Stamper<dim>>(domain_ptr_);
+  if (reflective_boundaries.empty())
+    return std::make_unique<Updater>(std::move(formulation_ptr), std::move(stamper_ptr), quadrature_set_ptr_);
+  return std::make_unique<Updater>(std::move(formulation_ptr), std::move(stamper_ptr), quadrature_set_ptr_,
+                                   system::solution::EnergyGroupToAngularSolutionPtrMap{}, reflective_boundaries);
+}
+
+template <typename DimensionWrapper>
+auto FormulationAngularSAAFMatrixFreeOperatorTest<DimensionWrapper>::ExpectOperatorMatchesFixedTerms(
+    Updater& updater) -> void {
+  auto operator_ptr = formulation::angular::MakeSAAFMatrixFreeOperator<dim>(*domain_ptr_, cross_sections_ptr_,
+                                                                            quadrature_set_ptr_, polynomial_degree_);
+  auto source_ptr = domain_ptr_->MakeSystemVector();
+  auto expected_ptr = domain_ptr_->MakeSystemVector();
+  auto result_ptr = domain_ptr_->MakeSystemVector();
+  for (const auto dof : domain_ptr_->locally_owned_dofs())
+    (*source_ptr)(dof) = test_helpers::RandomDouble(-1, 1);
+  source_ptr->compress(dealii::VectorOperation::insert);
+
+  for (int group = 0; group < total_groups_; ++group) {
+    for (int angle = 0; angle < static_cast<int>(directions_.size()); ++angle) {
+      updater.UpdateFixedTerms(test_system_, system::EnergyGroup(group), quadrature::QuadraturePointIndex(angle));
+      test_system_.left_hand_side_ptr_->GetFixedTermPtr({group, angle})->vmult(*expected_ptr, *source_ptr);
+      operator_ptr->GetOperatorPtr({group, angle})->vmult(*result_ptr, *source_ptr);
+      for (const auto dof : domain_ptr_->locally_owned_dofs()) {
+        EXPECT_NEAR((*result_ptr)(dof), (*expected_ptr)(dof), 1e-10)
+            << "group " << group << ", angle " << angle << ", degree of freedom " << dof;
+      }
+    }
+  }
+}
+
+TYPED_TEST_SUITE(FormulationAngularSAAFMatrixFreeOperatorTest, bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationAngularSAAFMatrixFreeOperatorTest, Constructor) {
+  constexpr int dim = this->dim;
+  formulation::angular::SAAFMatrixFreeOperator<dim> test_operator(*this->domain_ptr_, this->cross_sections_ptr_,
+                                                                  this->quadrature_set_ptr_,
+                                                                  this->polynomial_degree_);
+  EXPECT_EQ(test_operator.total_groups(), this->total_groups_);
+  EXPECT_EQ(test_operator.total_angles(), static_cast<int>(this->directions_.size()));
+  EXPECT_EQ(test_operator.GetPreconditionerPtr({0, 0}), nullptr);
+  EXPECT_ANY_THROW({
+    formulation::angular::SAAFMatrixFreeOperator<dim> bad_operator(*this->domain_ptr_, this->cross_sections_ptr_,
+                                                                   this->quadrature_set_ptr_,
+                                                                   this->polynomial_degree_ + 1);
+  });
+}
+
+TYPED_TEST(FormulationAngularSAAFMatrixFreeOperatorTest, MatchesFixedTermsVacuumBoundaries) {
+  auto updater_ptr = this->MakeUpdater({});
+  this->ExpectOperatorMatchesFixedTerms(*updater_ptr);
+}
+
+TYPED_TEST(FormulationAngularSAAFMatrixFreeOperatorTest, MatchesFixedTermsReflectiveBoundaries) {
+  using Boundary = problem::Boundary;
+  // Outgoing boundary terms are the same on reflective and vacuum faces, the assembled matrix must still match
+  auto updater_ptr = this->MakeUpdater({Boundary::kXMin});
+  updater_ptr->set_use_angular_decomposition(true);
+  this->ExpectOperatorMatchesFixedTerms(*updater_ptr);
+}
+
+TYPED_TEST(FormulationAngularSAAFMatrixFreeOperatorTest, ShellMatrixCommunicator) {
+  auto operator_ptr = formulation::angular::MakeSAAFMatrixFreeOperator<this->dim>(
+      *this->domain_ptr_, this->cross_sections_ptr_, this->quadrature_set_ptr_, this->polynomial_degree_);
+  const auto system_vector_ptr = this->domain_ptr_->MakeSystemVector();
+  int comparison{ MPI_UNEQUAL };
+  MPI_Comm_compare(operator_ptr->GetOperatorPtr({0, 0})->get_mpi_communicator(),
+                   system_vector_ptr->get_mpi_communicator(), &comparison);
+  EXPECT_TRUE(comparison == MPI_IDENT || comparison == MPI_CONGRUENT);
+}
+
+} // namespace
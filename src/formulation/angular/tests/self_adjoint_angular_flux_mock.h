@@ -47,6 +47,28 @@ class SelfAdjointAngularFluxMock :
       const domain::CellPtr<dim>&,
       const std::shared_ptr<quadrature::QuadraturePointI<dim>>,
       const system::EnergyGroup), (override));
+  MOCK_METHOD(void, FillCellCollisionTermBatch, (std::span<FullMatrix>,
+      std::span<const domain::CellPtr<dim>>,
+      const system::EnergyGroup), (override));
+  MOCK_METHOD(void, FillCellStreamingTermBatch, (std::span<FullMatrix>,
+      std::span<const domain::CellPtr<dim>>,
+      const std::shared_ptr<quadrature::QuadraturePointI<dim>>,
+      const system::EnergyGroup), (override));
+  MOCK_METHOD(void, FillCellStreamingBasisTerm, (FullMatrix&,
+      const domain::CellPtr<dim>&, const int, const int,
+      const system::EnergyGroup), (override));
+  MOCK_METHOD(double, FillCellFissionSourceComponent, (Vector&,
+      const domain::CellPtr<dim>&, const int,
+      const system::EnergyGroup, const double,
+      const system::moments::MomentVector&,
+      const system::moments::MomentsMap&), (override));
+  MOCK_METHOD(void, FillCellFixedSourceComponent, (Vector&,
+      const domain::CellPtr<dim>&, const int,
+      const system::EnergyGroup), (override));
+  MOCK_METHOD(double, FillCellScatteringSourceComponent, (Vector&,
+      const domain::CellPtr<dim>&, const int,
+      const system::EnergyGroup, const system::moments::MomentVector&,
+      const system::moments::MomentsMap&), (override));
   MOCK_METHOD(void, Initialize,
       (const domain::CellPtr<dim>&), (override));
 };
@@ -1,5 +1,7 @@
 #include "formulation/angular/self_adjoint_angular_flux.h"
 
+#include <functional>
+
 #include <deal.II/base/tensor.h>
 
 #include "data/cross_sections/material_cross_sections.hpp"
@@ -238,11 +240,14 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, InitializeValuesShapeSq
   EXPECT_CALL(*this->mock_finite_element_ptr_, ShapeValue(_,_)).Times(16).WillRepeatedly(DoDefault());
 
   EXPECT_NO_THROW(test_saaf.Initialize(this->cell_ptr_));
-  auto shape_squared = test_saaf.shape_squared();
-
-  ASSERT_EQ(shape_squared.size(), 2);
-  EXPECT_TRUE(AreEqual(expected_shape_squared_q_0, shape_squared.at(0)));
-  EXPECT_TRUE(AreEqual(expected_shape_squared_q_1, shape_squared.at(1)));
+  auto shape_squared_q_0 = test_saaf.ShapeSquared(0);
+  auto shape_squared_q_1 = test_saaf.ShapeSquared(1);
+
+  ASSERT_EQ(shape_squared_q_0.size(), 4);
+  ASSERT_EQ(shape_squared_q_1.size(), 4);
+  EXPECT_TRUE(AreEqual(expected_shape_squared_q_0, formulation::FullMatrix(2, 2, shape_squared_q_0.data())));
+  EXPECT_TRUE(AreEqual(expected_shape_squared_q_1, formulation::FullMatrix(2, 2, shape_squared_q_1.data())));
+  EXPECT_ANY_THROW({ [[maybe_unused]] auto bad_view = test_saaf.ShapeSquared(2); });
   EXPECT_TRUE(test_saaf.is_initialized());
 }
 
@@ -297,8 +302,10 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, InitializeOmegaDotGradi
   for (int cell_quad_point = 0; cell_quad_point < 2; ++cell_quad_point) {
     for (int angle_index : this->quadrature_point_indices_) {
       std::vector<double> result;
-      EXPECT_NO_THROW(result = test_saaf.OmegaDotGradient(cell_quad_point,
-                                                           quadrature::QuadraturePointIndex(angle_index)));
+      EXPECT_NO_THROW({
+        auto view = test_saaf.OmegaDotGradient(cell_quad_point, quadrature::QuadraturePointIndex(angle_index));
+        result.assign(view.begin(), view.end());
+      });
       EXPECT_THAT(result, ::testing::ContainerEq(omega_dot_gradient.at(cell_quad_point).at(angle_index)));
     }
   }
@@ -334,11 +341,19 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,InitializeOmegaDotGradie
   for (int cell_quad_point = 0; cell_quad_point < 2; ++cell_quad_point) {
     for (int angle_index : this->quadrature_point_indices_) {
       formulation::FullMatrix result;
-      ASSERT_NO_THROW(result = test_saaf.OmegaDotGradientSquared(cell_quad_point,
-                                                                 quadrature::QuadraturePointIndex(angle_index)));
+      ASSERT_NO_THROW({
+        auto view = test_saaf.OmegaDotGradientSquared(cell_quad_point,
+                                                      quadrature::QuadraturePointIndex(angle_index));
+        ASSERT_EQ(view.size(), 4);
+        result = formulation::FullMatrix(2, 2, view.data());
+      });
       EXPECT_TRUE(AreEqual(omega_dot_gradient_squared.at(cell_quad_point).at(angle_index), result));
     }
   }
+  EXPECT_ANY_THROW({
+    [[maybe_unused]] auto bad_view = test_saaf.OmegaDotGradientSquared(0, quadrature::QuadraturePointIndex(2)); });
+  EXPECT_ANY_THROW({
+    [[maybe_unused]] auto bad_view = test_saaf.OmegaDotGradientSquared(2, quadrature::QuadraturePointIndex(0)); });
   EXPECT_TRUE(test_saaf.is_initialized());
 }
 
@@ -460,7 +475,7 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellBoundaryTermTes
   auto mock_angle_ptr = dynamic_cast<quadrature::QuadraturePointMock<dim>*>(angle_ptr.get());
   EXPECT_CALL(*mock_angle_ptr, cartesian_position_tensor()).WillOnce(DoDefault());
   EXPECT_CALL(*this->mock_finite_element_ptr_, FaceJacobian(_)).Times(2).WillRepeatedly(DoDefault());
-  EXPECT_CALL(*this->mock_finite_element_ptr_, FaceShapeValue(_, _)).Times(16).WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->mock_finite_element_ptr_, FaceShapeValue(_, _)).Times(4).WillRepeatedly(DoDefault());
 
   test_saaf.FillBoundaryBilinearTerm(cell_matrix, this->cell_ptr_, domain::FaceIndex(0), angle_ptr,
                                      system::EnergyGroup(0));
@@ -468,6 +483,37 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellBoundaryTermTes
   EXPECT_TRUE(AreEqual(expected_results, cell_matrix));
 }
 
+/* Face values are calculated once for each face and scaled by n.Omega for
+ * each angle, without setting the face again. */
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellBoundaryTermCachedTest) {
+  constexpr int dim = this->dim;
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(this->mock_finite_element_ptr_,
+                                                              this->cross_section_ptr_,
+                                                              this->mock_quadrature_set_ptr_);
+  test_saaf.Initialize(this->cell_ptr_);
+
+  dealii::Tensor<1, dim> normal;
+  for (int i = 0; i < dim; ++i)
+    normal[i] = 3;
+
+  EXPECT_CALL(*this->mock_finite_element_ptr_, SetFace(this->cell_ptr_, domain::FaceIndex(0))).Times(1);
+  EXPECT_CALL(*this->mock_finite_element_ptr_, FaceNormal()).WillOnce(Return(normal));
+  EXPECT_CALL(*this->mock_finite_element_ptr_, FaceJacobian(_)).Times(2).WillRepeatedly(DoDefault());
+
+  const formulation::FullMatrix face_mass_matrix(2, 2, std::array<double, 4>{1227, 2277, 2277, 4227}.begin());
+  int angle = 0;
+  for (const auto& angle_ptr : this->quadrature_set_) {
+    // Angles have all components equal to angle + 1
+    formulation::FullMatrix cell_matrix(2, 2), expected_result(face_mass_matrix);
+    expected_result *= 3 * dim * (angle + 1);
+    test_saaf.FillBoundaryBilinearTerm(cell_matrix, this->cell_ptr_, domain::FaceIndex(0), angle_ptr,
+                                       system::EnergyGroup(0));
+    EXPECT_TRUE(AreEqual(expected_result, cell_matrix)) << "Failed: angle " << angle;
+    ++angle;
+  }
+}
+
 TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellBoundaryTermTestNotInitialized) {
   constexpr int dim = this->dim;
 
@@ -707,6 +753,56 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellStreamingTermTe
                    });
 }
 
+/* The streaming basis matrices weighted by the products of the direction
+ * components should recover the full streaming term for each angle. */
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellStreamingBasisTermTest) {
+  constexpr int dim = this->dim;
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(this->mock_finite_element_ptr_,
+                                                              this->cross_section_ptr_,
+                                                              this->mock_quadrature_set_ptr_);
+  test_saaf.Initialize(this->cell_ptr_);
+
+  for (int group = 0; group < 2; ++group) {
+    for (const auto& angle_ptr : this->quadrature_set_) {
+      const auto omega = angle_ptr->cartesian_position_tensor();
+      formulation::FullMatrix streaming_matrix(2, 2), combined_matrix(2, 2);
+      test_saaf.FillCellStreamingTerm(streaming_matrix, this->cell_ptr_, angle_ptr,
+                                      system::EnergyGroup(group));
+
+      for (int a = 0; a < dim; ++a) {
+        for (int b = a; b < dim; ++b) {
+          formulation::FullMatrix basis_matrix(2, 2);
+          EXPECT_NO_THROW({
+            test_saaf.FillCellStreamingBasisTerm(basis_matrix, this->cell_ptr_, a, b,
+                                                 system::EnergyGroup(group));
+          });
+          combined_matrix.add(omega[a] * omega[b], basis_matrix);
+        }
+      }
+      EXPECT_TRUE(AreEqual(streaming_matrix, combined_matrix)) << "Failed: group: " << group;
+    }
+  }
+}
+
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellStreamingBasisTermBadDirections) {
+  constexpr int dim = this->dim;
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(this->mock_finite_element_ptr_,
+                                                              this->cross_section_ptr_,
+                                                              this->mock_quadrature_set_ptr_);
+  formulation::FullMatrix cell_matrix(2,2);
+  test_saaf.Initialize(this->cell_ptr_);
+  EXPECT_ANY_THROW(test_saaf.FillCellStreamingBasisTerm(cell_matrix, this->cell_ptr_, 0, dim,
+                                                        system::EnergyGroup(0)));
+  EXPECT_ANY_THROW(test_saaf.FillCellStreamingBasisTerm(cell_matrix, this->cell_ptr_, -1, 0,
+                                                        system::EnergyGroup(0)));
+  if (dim > 1) {
+    EXPECT_ANY_THROW(test_saaf.FillCellStreamingBasisTerm(cell_matrix, this->cell_ptr_, 1, 0,
+                                                          system::EnergyGroup(0)));
+  }
+}
+
 // FillCollisionTerm ===========================================================
 
 TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellCollisionTermTestBadCellPtr) {
@@ -755,7 +851,8 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellCollisionTermTe
   for (int group = 0; group < 2; ++group) {
     EXPECT_CALL(*this->mock_finite_element_ptr_, SetCell(this->cell_ptr_));
     EXPECT_CALL(*this->mock_finite_element_ptr_, Jacobian(_)).Times(2).WillRepeatedly(DoDefault());
-    EXPECT_CALL(*this->mock_finite_element_ptr_, ShapeValue(_,_)).Times(16).WillRepeatedly(DoDefault());
+    // Shape function products are precalculated in Initialize
+    EXPECT_CALL(*this->mock_finite_element_ptr_, ShapeValue(_,_)).Times(0);
 
     formulation::FullMatrix cell_matrix(2,2), expected_result(2,2,
                                                               std::array<double, 4>{1227, 2277, 2277, 4227}.begin());
@@ -766,6 +863,67 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellCollisionTermTe
   }
 }
 
+/* Local matrices are cached by material, cell geometry and group. Congruent
+ * cells should reuse the cached matrix without setting the cell. */
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellCollisionTermCachedTest) {
+  formulation::angular::SelfAdjointAngularFlux<this->dim> test_saaf(this->mock_finite_element_ptr_,
+                                                                    this->cross_section_ptr_,
+                                                                    this->mock_quadrature_set_ptr_);
+
+  test_saaf.Initialize(this->cell_ptr_);
+  // All cells in the test domain are congruent
+  auto congruent_cell_ptr = this->cells_.back();
+  congruent_cell_ptr->set_material_id(this->material_id_);
+
+  EXPECT_CALL(*this->mock_finite_element_ptr_, SetCell(_)).Times(1);
+  EXPECT_CALL(*this->mock_finite_element_ptr_, Jacobian(_)).Times(2).WillRepeatedly(DoDefault());
+
+  formulation::FullMatrix cell_matrix(2,2), congruent_cell_matrix(2,2),
+      expected_result(2,2, std::array<double, 4>{1227, 2277, 2277, 4227}.begin());
+
+  test_saaf.FillCellCollisionTerm(cell_matrix, this->cell_ptr_, system::EnergyGroup(0));
+  test_saaf.FillCellCollisionTerm(congruent_cell_matrix, congruent_cell_ptr, system::EnergyGroup(0));
+  EXPECT_TRUE(AreEqual(expected_result, cell_matrix));
+  EXPECT_TRUE(AreEqual(expected_result, congruent_cell_matrix));
+}
+
+/* Batched fills should match the per-cell fills for each cell in the batch.
+ * All cells in the test domain are congruent and axis-aligned, so they are
+ * integrated from the reference tables without setting each cell. */
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellTermBatchTest) {
+  constexpr int dim = this->dim;
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(this->mock_finite_element_ptr_,
+                                                              this->cross_section_ptr_,
+                                                              this->mock_quadrature_set_ptr_);
+  test_saaf.Initialize(this->cell_ptr_);
+  for (auto& cell_ptr : this->cells_)
+    cell_ptr->set_material_id(this->material_id_);
+
+  const std::vector<domain::CellPtr<dim>> cell_ptrs{this->cells_.begin(), this->cells_.end()};
+  std::vector<formulation::FullMatrix> collision_matrices(cell_ptrs.size(), formulation::FullMatrix(2, 2));
+  std::vector<formulation::FullMatrix> streaming_matrices(collision_matrices);
+  const auto angle_ptr = *this->quadrature_set_.begin();
+  const system::EnergyGroup group(0);
+
+  formulation::FullMatrix expected_collision(2, 2, std::array<double, 4>{1227, 2277, 2277, 4227}.begin());
+  formulation::FullMatrix expected_streaming(expected_collision);
+  expected_collision *= this->sigma_t_.at(this->material_id_).at(0);
+  expected_streaming *= dim*dim;
+
+  EXPECT_CALL(*this->mock_quadrature_set_ptr_, GetQuadraturePointIndex(_)).WillOnce(DoDefault());
+  EXPECT_NO_THROW({
+    test_saaf.FillCellCollisionTermBatch(collision_matrices, cell_ptrs, group);
+    test_saaf.FillCellStreamingTermBatch(streaming_matrices, cell_ptrs, angle_ptr, group);
+  });
+  for (std::size_t cell = 0; cell < cell_ptrs.size(); ++cell) {
+    EXPECT_TRUE(AreEqual(expected_collision, collision_matrices.at(cell))) << "Failed: cell " << cell;
+    EXPECT_TRUE(AreEqual(expected_streaming, streaming_matrices.at(cell))) << "Failed: cell " << cell;
+  }
+
+  std::vector<formulation::FullMatrix> bad_size_matrices(cell_ptrs.size() + 1, formulation::FullMatrix(2, 2));
+  EXPECT_ANY_THROW(test_saaf.FillCellCollisionTermBatch(bad_size_matrices, cell_ptrs, group));
+}
+
 // FillCellFixedSourceTerm =====================================================
 
 TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellFixedSourceTermBadCell) {
@@ -1232,4 +1390,84 @@ TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest,
   }
 }
 
-} // namespace
\ No newline at end of file
+// Angle-separable source components ===========================================
+
+/* The source components combined as v0 + sum_a Omega_a v_(a+1) should recover
+ * the full source term for each angle. */
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellSourceComponentsTest) {
+  constexpr int dim = this->dim;
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(this->mock_finite_element_ptr_,
+                                                              this->cross_section_ptr_,
+                                                              this->mock_quadrature_set_ptr_);
+  test_saaf.Initialize(this->cell_ptr_);
+  auto& in_group_moment = this->group_0_moment_;
+  using FillComponentFunction = std::function<void(formulation::Vector&, int)>;
+  using FillTermFunction = std::function<void(formulation::Vector&,
+                                              std::shared_ptr<quadrature::QuadraturePointI<dim>>)>;
+
+  auto check_components = [&](FillComponentFunction fill_component, FillTermFunction fill_term) {
+    std::vector<formulation::Vector> components(dim + 1, formulation::Vector(2));
+    for (int component = 0; component <= dim; ++component)
+      EXPECT_NO_THROW(fill_component(components.at(component), component));
+    for (const auto& angle_ptr : this->quadrature_set_) {
+      const auto omega = angle_ptr->cartesian_position_tensor();
+      formulation::Vector expected(2), combined(components.at(0));
+      fill_term(expected, angle_ptr);
+      for (int a = 0; a < dim; ++a)
+        combined.add(omega[a], components.at(a + 1));
+      combined -= expected;
+      EXPECT_LT(combined.l2_norm(), 1e-10);
+    }
+  };
+
+  for (int group = 0; group < 2; ++group) {
+    const system::EnergyGroup group_number(group);
+    this->cell_ptr_->set_material_id(this->material_id_);
+    check_components(
+        [&](formulation::Vector& to_fill, int component) {
+          test_saaf.FillCellScatteringSourceComponent(to_fill, this->cell_ptr_, component, group_number,
+                                                      in_group_moment, this->out_group_moments_); },
+        [&](formulation::Vector& to_fill, auto angle_ptr) {
+          test_saaf.FillCellScatteringSourceTerm(to_fill, this->cell_ptr_, angle_ptr, group_number,
+                                                 in_group_moment, this->out_group_moments_); });
+    check_components(
+        [&](formulation::Vector& to_fill, int component) {
+          test_saaf.FillCellFissionSourceComponent(to_fill, this->cell_ptr_, component, group_number,
+                                                   this->k_effective_, in_group_moment,
+                                                   this->out_group_moments_); },
+        [&](formulation::Vector& to_fill, auto angle_ptr) {
+          test_saaf.FillCellFissionSourceTerm(to_fill, this->cell_ptr_, angle_ptr, group_number,
+                                              this->k_effective_, in_group_moment,
+                                              this->out_group_moments_); });
+    this->cell_ptr_->set_material_id(this->non_fissile_material_id_);
+    check_components(
+        [&](formulation::Vector& to_fill, int component) {
+          test_saaf.FillCellFixedSourceComponent(to_fill, this->cell_ptr_, component, group_number); },
+        [&](formulation::Vector& to_fill, auto angle_ptr) {
+          test_saaf.FillCellFixedSourceTerm(to_fill, this->cell_ptr_, angle_ptr, group_number); });
+  }
+}
+
+TYPED_TEST(FormulationAngularSelfAdjointAngularFluxTest, FillCellSourceComponentsBadComponent) {
+  constexpr int dim = this->dim;
+
+  formulation::angular::SelfAdjointAngularFlux<dim> test_saaf(this->mock_finite_element_ptr_,
+                                                              this->cross_section_ptr_,
+                                                              this->mock_quadrature_set_ptr_);
+  formulation::Vector cell_vector(2);
+  test_saaf.Initialize(this->cell_ptr_);
+
+  for (const int bad_component : {-1, dim + 1}) {
+    EXPECT_ANY_THROW(test_saaf.FillCellScatteringSourceComponent(cell_vector, this->cell_ptr_, bad_component,
+                                                                 system::EnergyGroup(0), this->group_0_moment_,
+                                                                 this->out_group_moments_));
+    EXPECT_ANY_THROW(test_saaf.FillCellFissionSourceComponent(cell_vector, this->cell_ptr_, bad_component,
+                                                              system::EnergyGroup(0), this->k_effective_,
+                                                              this->group_0_moment_, this->out_group_moments_));
+    EXPECT_ANY_THROW(test_saaf.FillCellFixedSourceComponent(cell_vector, this->cell_ptr_, bad_component,
+                                                            system::EnergyGroup(0)));
+  }
+}
+
+} // namespace
@@ -0,0 +1,195 @@
+#include "formulation/cell_batch_assembler.hpp"
+
+#include <cmath>
+
+#include <deal.II/base/exceptions.h>
+
+namespace bart::formulation {
+
+template <int dim>
+auto AxisAlignedCellExtents(const domain::CellPtr<dim>& cell_ptr) -> std::optional<std::array<double, dim>> {
+  const auto& origin = cell_ptr->vertex(0);
+  std::array<double, dim> extents{};
+  // In the standard orientation, vertex 2^d is the neighbour of the first vertex in direction d
+  for (int direction = 0; direction < dim; ++direction) {
+    extents[direction] = cell_ptr->vertex(1U << direction)[direction] - origin[direction];
+    if (extents[direction] <= CellGeometryKey::kCellGeometryTolerance)
+      return std::nullopt;
+  }
+  for (unsigned int vertex = 1; vertex < cell_ptr->n_vertices(); ++vertex) {
+    const auto offset = cell_ptr->vertex(vertex) - origin;
+    for (int direction = 0; direction < dim; ++direction) {
+      const double expected_offset{ ((vertex >> direction) & 1U) ? extents[direction] : 0.0 };
+      if (std::abs(offset[direction] - expected_offset) > CellGeometryKey::kCellGeometryTolerance)
+        return std::nullopt;
+    }
+  }
+  return extents;
+}
+
+template <int dim>
+auto CellBatchAssembler<dim>::Initialize(FiniteElement& finite_element, const CellPtr& reference_cell_ptr) -> void {
+  cell_kernels_ = &finite_element.cell_kernels();
+  cell_degrees_of_freedom_ = finite_element.dofs_per_cell();
+  cell_quadrature_points_ = finite_element.n_cell_quad_pts();
+  is_initialized_ = true;
+
+  const auto reference_extents = AxisAlignedCellExtents<dim>(reference_cell_ptr);
+  is_batched_ = reference_extents.has_value();
+  if (!is_batched_)
+    return;
+  reference_extents_ = reference_extents.value();
+
+  finite_element.SetCell(reference_cell_ptr);
+  const int n_dofs{ cell_degrees_of_freedom_ }, n_q{ cell_quadrature_points_ };
+  const int block_size{ n_dofs * n_dofs };
+  const int n_direction_pairs{ dim * (dim + 1) / 2 };
+  reference_jacobians_.assign(n_q, 0);
+  shape_squared_.assign(n_q * block_size, 0);
+  gradient_products_.assign(n_direction_pairs * n_q * block_size, 0);
+
+  for (int q = 0; q < n_q; ++q) {
+    reference_jacobians_[q] = finite_element.Jacobian(q);
+    std::vector<double> shape_values(n_dofs);
+    std::vector<dealii::Tensor<1, dim>> shape_gradients(n_dofs);
+    for (int i = 0; i < n_dofs; ++i) {
+      shape_values[i] = finite_element.ShapeValue(i, q);
+      shape_gradients[i] = finite_element.ShapeGradient(i, q);
+    }
+
+    auto shape_squared = shape_squared_.begin() + q * block_size;
+    for (int i = 0; i < n_dofs; ++i)
+      for (int j = 0; j < n_dofs; ++j)
+        shape_squared[i * n_dofs + j] = shape_values[i] * shape_values[j];
+
+    for (int direction_a = 0; direction_a < dim; ++direction_a) {
+      for (int direction_b = direction_a; direction_b < dim; ++direction_b) {
+        const int pair{ DirectionPairIndex(direction_a, direction_b) };
+        auto gradient_products = gradient_products_.begin() + (pair * n_q + q) * block_size;
+        for (int i = 0; i < n_dofs; ++i) {
+          for (int j = 0; j < n_dofs; ++j) {
+            double product{ shape_gradients[i][direction_a] * shape_gradients[j][direction_b] };
+            if (direction_a != direction_b)
+              product += shape_gradients[i][direction_b] * shape_gradients[j][direction_a];
+            gradient_products[i * n_dofs + j] = product;
+          }
+        }
+      }
+    }
+  }
+}
+
+template <int dim>
+auto CellBatchAssembler<dim>::FillBatch(std::span<FullMatrix> to_fill, std::span<const CellPtr> cell_ptrs,
+                                        LocalMatrixCache& cache, const KeyFunction& key_function,
+                                        const CoefficientFunction& coefficient_function,
+                                        const IntegrateFunction& integrate_function,
+                                        const CellFillFunction& cell_fill_function) const -> void {
+  AssertThrow(to_fill.size() == cell_ptrs.size(),
+              dealii::ExcMessage("Error in CellBatchAssembler function FillBatch: number of matrices to fill does not "
+                                 "match the number of cells"))
+  AssertThrow(is_initialized_,
+              dealii::ExcMessage("Error in CellBatchAssembler function FillBatch: assembler has not been initialized"))
+
+  std::array<LocalMatrixKey, kCellBatchSize> lane_keys;
+  std::array<std::size_t, kCellBatchSize> lane_cells{};
+  int n_lanes{ 0 };
+  CellBatch batch{ .quadrature_weights = std::vector<VectorizedDouble>(cell_quadrature_points_) };
+  FullMatrix local_matrix(cell_degrees_of_freedom_, cell_degrees_of_freedom_);
+
+  // Integrates the cells in the current lanes and scatters each lane to its matrix and the cache
+  auto integrate_lanes = [&]() {
+    batch.matrix.assign(cell_degrees_of_freedom_ * cell_degrees_of_freedom_, VectorizedDouble(0.0));
+    integrate_function(batch);
+    for (int lane = 0; lane < n_lanes; ++lane) {
+      for (int i = 0; i < cell_degrees_of_freedom_; ++i)
+        for (int j = 0; j < cell_degrees_of_freedom_; ++j)
+          local_matrix(i, j) = batch.matrix[i * cell_degrees_of_freedom_ + j][lane];
+      to_fill[lane_cells[lane]].add(1.0, local_matrix);
+      cache.Insert(lane_keys[lane], local_matrix);
+    }
+    n_lanes = 0;
+    ResetLanes(batch);
+  };
+
+  ResetLanes(batch);
+  for (std::size_t cell = 0; cell < cell_ptrs.size(); ++cell) {
+    const auto& cell_ptr = cell_ptrs[cell];
+    const auto key = key_function(cell_ptr);
+    if (const auto cached_matrix = cache.Find(key); cached_matrix != nullptr) {
+      to_fill[cell].add(1.0, *cached_matrix);
+      continue;
+    }
+
+    const auto extents = is_batched_ ? AxisAlignedCellExtents<dim>(cell_ptr) : std::nullopt;
+    if (!extents.has_value()) {
+      cell_fill_function(to_fill[cell], cell_ptr);
+      continue;
+    }
+
+    double volume_ratio{ 1.0 };
+    for (int direction = 0; direction < dim; ++direction) {
+      volume_ratio *= extents.value()[direction] / reference_extents_[direction];
+      batch.lane_gradient_scales[direction][n_lanes] = reference_extents_[direction] / extents.value()[direction];
+    }
+    batch.lane_weights[n_lanes] = coefficient_function(cell_ptr) * volume_ratio;
+    lane_keys[n_lanes] = key;
+    lane_cells[n_lanes] = cell;
+    if (++n_lanes == kCellBatchSize)
+      integrate_lanes();
+  }
+  if (n_lanes > 0)
+    integrate_lanes();
+}
+
+template <int dim>
+auto CellBatchAssembler<dim>::AddShapeSquared(CellBatch& to_fill) const -> void {
+  for (int q = 0; q < cell_quadrature_points_; ++q)
+    to_fill.quadrature_weights[q] = to_fill.lane_weights * reference_jacobians_[q];
+  cell_kernels_->cell_batched_weighted_matrix_sum(to_fill.matrix.data(), to_fill.quadrature_weights.data(),
+                                                  shape_squared_.data(), cell_degrees_of_freedom_,
+                                                  cell_quadrature_points_);
+}
+
+template <int dim>
+auto CellBatchAssembler<dim>::AddGradientProducts(CellBatch& to_fill, const int direction_a, const int direction_b,
+                                                  const double scale) const -> void {
+  AssertThrow((direction_a >= 0) && (direction_a <= direction_b) && (direction_b < dim),
+              dealii::ExcMessage("Error in CellBatchAssembler function AddGradientProducts: directions must satisfy "
+                                 "0 <= a <= b < dim"))
+  const VectorizedDouble lane_scale{
+      to_fill.lane_weights * to_fill.lane_gradient_scales[direction_a] * to_fill.lane_gradient_scales[direction_b] *
+      scale };
+  for (int q = 0; q < cell_quadrature_points_; ++q)
+    to_fill.quadrature_weights[q] = lane_scale * reference_jacobians_[q];
+
+  const int block_size{ cell_degrees_of_freedom_ * cell_degrees_of_freedom_ };
+  const double* gradient_products{
+      gradient_products_.data() + DirectionPairIndex(direction_a, direction_b) * cell_quadrature_points_ * block_size };
+  cell_kernels_->cell_batched_weighted_matrix_sum(to_fill.matrix.data(), to_fill.quadrature_weights.data(),
+                                                  gradient_products, cell_degrees_of_freedom_,
+                                                  cell_quadrature_points_);
+}
+
+template <int dim>
+auto CellBatchAssembler<dim>::DirectionPairIndex(const int direction_a, const int direction_b) const -> int {
+  // Pairs a <= b are numbered in order (0, 0), (0, 1), ..., (1, 1), ...
+  return direction_a * dim - direction_a * (direction_a - 1) / 2 + (direction_b - direction_a);
+}
+
+template <int dim>
+auto CellBatchAssembler<dim>::ResetLanes(CellBatch& batch) const -> void {
+  batch.lane_weights = 0.0;
+  for (auto& gradient_scale : batch.lane_gradient_scales)
+    gradient_scale = 1.0;
+}
+
+template auto AxisAlignedCellExtents<1>(const domain::CellPtr<1>&) -> std::optional<std::array<double, 1>>;
+template auto AxisAlignedCellExtents<2>(const domain::CellPtr<2>&) -> std::optional<std::array<double, 2>>;
+template auto AxisAlignedCellExtents<3>(const domain::CellPtr<3>&) -> std::optional<std::array<double, 3>>;
+
+template class CellBatchAssembler<1>;
+template class CellBatchAssembler<2>;
+template class CellBatchAssembler<3>;
+
+} // namespace bart::formulation
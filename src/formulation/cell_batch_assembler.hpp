@@ -0,0 +1,130 @@
+#ifndef BART_SRC_FORMULATION_CELL_BATCH_ASSEMBLER_HPP_
+#define BART_SRC_FORMULATION_CELL_BATCH_ASSEMBLER_HPP_
+
+#include <array>
+#include <functional>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include <deal.II/base/vectorization.h>
+
+#include "domain/domain_types.hpp"
+#include "domain/finite_element/finite_element_i.hpp"
+#include "formulation/formulation_types.hpp"
+#include "formulation/local_matrix_cache.hpp"
+
+namespace bart::formulation {
+
+using VectorizedDouble = dealii::VectorizedArray<double>;
+//! Number of cells integrated together, one in each SIMD lane
+inline constexpr int kCellBatchSize{ static_cast<int>(VectorizedDouble::size()) };
+
+/*! \brief Returns the extent of a cell in each direction if its edges are parallel to the coordinate axes.
+ *
+ * Returns std::nullopt for distorted or rotated cells, and for cells whose vertices are not numbered in the standard
+ * orientation.
+ */
+template <int dim>
+auto AxisAlignedCellExtents(const domain::CellPtr<dim>& cell_ptr) -> std::optional<std::array<double, dim>>;
+
+/*! \brief Integrates local matrices for batches of axis-aligned cells using SIMD lanes.
+ *
+ * On an axis-aligned cell with extents \f$h_d\f$ the Jacobian at each quadrature point is that of a reference cell with
+ * extents \f$h^0_d\f$ scaled by \f$\prod_d h_d/h^0_d\f$, shape function values are unchanged, and derivatives in
+ * direction \f$d\f$ are scaled by \f$h^0_d/h_d\f$. Local matrices for any axis-aligned cell can therefore be integrated
+ * from tables calculated once on the reference cell, with every cell-dependent value folded into the quadrature
+ * weights. The weights for up to kCellBatchSize cells are held in the lanes of a VectorizedArray and the tables are
+ * summed for all of them at once, without setting each cell in the finite element.
+ *
+ * Cells are filled using FillBatch, which adds cached matrices directly, integrates the remaining axis-aligned cells
+ * together, and falls back to a per-cell fill function for cells that cannot be batched. Values for the cells being
+ * integrated are held in a CellBatch local to each call, so once initialized FillBatch may be called from multiple
+ * threads.
+ *
+ * \tparam dim spatial dimension.
+ */
+template <int dim>
+class CellBatchAssembler {
+ public:
+  using CellPtr = domain::CellPtr<dim>;
+  using FiniteElement = domain::finite_element::FiniteElementI<dim>;
+  //! Row-major local matrix with one cell in each lane
+  using BatchMatrix = std::vector<VectorizedDouble>;
+  //! Local matrices and cell values for the cells in a batch, one cell in each lane
+  struct CellBatch {
+    BatchMatrix matrix{};
+    //! Coefficient multiplied by the volume ratio to the reference cell, unused lanes have a zero weight
+    VectorizedDouble lane_weights{};
+    //! Ratio of the reference cell extent to the cell extent in each direction
+    std::array<VectorizedDouble, dim> lane_gradient_scales{};
+    std::vector<VectorizedDouble> quadrature_weights{};
+  };
+  //! Returns the cache key for the local matrix of a cell
+  using KeyFunction = std::function<LocalMatrixKey(const CellPtr&)>;
+  //! Returns the material coefficient that multiplies the local matrix of a cell
+  using CoefficientFunction = std::function<double(const CellPtr&)>;
+  //! Adds the local matrices of the current batch using AddShapeSquared and AddGradientProducts
+  using IntegrateFunction = std::function<void(CellBatch&)>;
+  //! Adds the local matrix of a single cell that cannot be batched
+  using CellFillFunction = std::function<void(FullMatrix&, const CellPtr&)>;
+
+  /*! \brief Calculates the reference tables.
+   *
+   * Sets the reference cell in the finite element. If the reference cell is not axis-aligned no tables are calculated
+   * and every cell is filled using the per-cell fill function.
+   *
+   * \param finite_element finite element used to calculate shape function values, gradients and Jacobians.
+   * \param reference_cell_ptr cell to calculate the tables on.
+   */
+  auto Initialize(FiniteElement& finite_element, const CellPtr& reference_cell_ptr) -> void;
+
+  /*! \brief Adds the local matrix of each cell to the matching matrix.
+   *
+   * \param to_fill matrices to add to, one for each cell.
+   * \param cell_ptrs cells to fill.
+   * \param cache cache to look up and store local matrices.
+   * \param key_function returns the cache key for a cell.
+   * \param coefficient_function returns the coefficient for a cell.
+   * \param integrate_function adds the local matrices of a batch.
+   * \param cell_fill_function adds the local matrix of a cell that cannot be batched.
+   */
+  auto FillBatch(std::span<FullMatrix> to_fill, std::span<const CellPtr> cell_ptrs, LocalMatrixCache& cache,
+                 const KeyFunction& key_function, const CoefficientFunction& coefficient_function,
+                 const IntegrateFunction& integrate_function, const CellFillFunction& cell_fill_function) const -> void;
+
+  /*! \brief Adds \f$c_K\int_K\varphi_i\varphi_j dV\f$ for each cell in the current batch. */
+  auto AddShapeSquared(CellBatch& to_fill) const -> void;
+  /*! \brief Adds \f$s\,c_K\int_K\partial_a\varphi_i\partial_b\varphi_j + \partial_b\varphi_i\partial_a\varphi_j dV\f$
+   * for each cell in the current batch, with the symmetric term counted once when \f$a = b\f$.
+   *
+   * \param direction_a first cartesian direction, \f$a\f$.
+   * \param direction_b second cartesian direction, \f$b \geq a\f$.
+   * \param scale factor \f$s\f$ shared by all cells.
+   */
+  auto AddGradientProducts(CellBatch& to_fill, int direction_a, int direction_b, double scale) const -> void;
+
+  auto is_initialized() const -> bool { return is_initialized_; }
+  /*! \brief Returns true if cells can be batched, which requires an axis-aligned reference cell. */
+  auto is_batched() const -> bool { return is_batched_; }
+ private:
+  auto DirectionPairIndex(int direction_a, int direction_b) const -> int;
+  auto ResetLanes(CellBatch& batch) const -> void;
+
+  const domain::finite_element::CellKernels* cell_kernels_{ nullptr };
+  int cell_degrees_of_freedom_{ 0 };
+  int cell_quadrature_points_{ 0 };
+  bool is_initialized_{ false };
+  bool is_batched_{ false };
+
+  // Reference tables, stored row-major for each cell quadrature point as for the formulations
+  std::array<double, dim> reference_extents_{};
+  std::vector<double> reference_jacobians_{};
+  std::vector<double> shape_squared_{};
+  //! Gradient products for each pair of directions a <= b, stored [pair][q][i][j]
+  std::vector<double> gradient_products_{};
+};
+
+} // namespace bart::formulation
+
+#endif //BART_SRC_FORMULATION_CELL_BATCH_ASSEMBLER_HPP_
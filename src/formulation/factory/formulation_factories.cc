@@ -1,5 +1,6 @@
 #include "formulation/factory/formulation_factories.h"
 
+#include "formulation/parallel_stamper.hpp"
 #include "formulation/stamper.hpp"
 #include "formulation/angular/self_adjoint_angular_flux.h"
 #include "formulation/scalar/diffusion.hpp"
@@ -82,6 +83,9 @@ std::unique_ptr<formulation::StamperI<dim>> MakeStamperPtr(
   if (implementation == formulation::StamperImpl::kDefault) {
     return_ptr = std::move(
         std::make_unique<Stamper<dim>>(definition_ptr));
+  } else if (implementation == formulation::StamperImpl::kParallel) {
+    return_ptr = std::move(
+        std::make_unique<ParallelStamper<dim>>(definition_ptr));
   }
 
   return return_ptr;
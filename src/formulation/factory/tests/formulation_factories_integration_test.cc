@@ -3,6 +3,7 @@
 #include "test_helpers/gmock_wrapper.h"
 
 // Built by factory
+#include "formulation/parallel_stamper.hpp"
 #include "formulation/stamper.hpp"
 #include "formulation/angular/self_adjoint_angular_flux.h"
 #include "formulation/scalar/diffusion.hpp"
@@ -123,6 +124,20 @@ TYPED_TEST(FormulationFactoryTests, MakeStamperPtr) {
   ASSERT_NE(nullptr, dynamic_cast<ExpectedType*>(returned_ptr.get()));
 }
 
+TYPED_TEST(FormulationFactoryTests, MakeParallelStamperPtr) {
+  constexpr int dim = this->dim;
+  using BaseType = formulation::StamperI<dim>;
+  using ExpectedType = formulation::ParallelStamper<dim>;
+
+  std::unique_ptr<BaseType> returned_ptr = nullptr;
+  EXPECT_NO_THROW({
+    returned_ptr = std::move(formulation::factory::MakeStamperPtr<dim>(
+        this->definition_ptr_, formulation::StamperImpl::kParallel));
+  });
+  ASSERT_NE(returned_ptr, nullptr);
+  ASSERT_NE(nullptr, dynamic_cast<ExpectedType*>(returned_ptr.get()));
+}
+
 TYPED_TEST(FormulationFactoryTests, MakeSAAFUpdater) {
   constexpr int dim = this->dim;
   using ExpectedType = formulation::updater::SAAFUpdater<dim>;
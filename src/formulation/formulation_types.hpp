@@ -26,6 +26,7 @@ enum class SAAFFormulationImpl {
 
 enum class StamperImpl {
   kDefault = 0,
+  kParallel = 1, //!< Evaluates cells on multiple threads, see formulation::ParallelStamper
 };
 
 } // bart::formulation
@@ -0,0 +1,56 @@
+#include "formulation/local_matrix_cache.hpp"
+
+#include <cmath>
+
+namespace bart::formulation {
+
+template <int dim>
+auto MakeCellGeometryKey(const domain::CellPtr<dim>& cell_ptr) -> CellGeometryKey {
+  CellGeometryKey key{ .level = cell_ptr->level() };
+  const auto& origin = cell_ptr->vertex(0);
+  int offset_index{ 0 };
+  for (unsigned int vertex = 1; vertex < cell_ptr->n_vertices(); ++vertex) {
+    const auto offset = cell_ptr->vertex(vertex) - origin;
+    for (int direction = 0; direction < dim; ++direction)
+      key.vertex_offsets[offset_index++] = std::llround(offset[direction] / CellGeometryKey::kCellGeometryTolerance);
+  }
+  return key;
+}
+
+auto LocalMatrixCache::AddTo(FullMatrix& to_fill, const LocalMatrixKey& key,
+                             const FillFunction& fill_function) -> void {
+  if (const auto cached_matrix = Find(key); cached_matrix != nullptr) {
+    to_fill.add(1.0, *cached_matrix);
+    return;
+  }
+
+  FullMatrix local_matrix(to_fill.m(), to_fill.n());
+  fill_function(local_matrix);
+  to_fill.add(1.0, local_matrix);
+  Insert(key, local_matrix);
+}
+
+auto LocalMatrixCache::Find(const LocalMatrixKey& key) const -> const FullMatrix* {
+  std::shared_lock lock(cache_mutex_);
+  const auto cached_matrix = cache_.find(key);
+  return cached_matrix == cache_.end() ? nullptr : &cached_matrix->second;
+}
+
+auto LocalMatrixCache::Insert(const LocalMatrixKey& key, const FullMatrix& local_matrix) -> void {
+  const std::size_t n_values{ local_matrix.m() * local_matrix.n() };
+  std::unique_lock lock(cache_mutex_);
+  if (stored_values_ + n_values <= max_stored_values_ && cache_.try_emplace(key, local_matrix).second)
+    stored_values_ += n_values;
+}
+
+auto LocalMatrixCache::Clear() -> void {
+  std::unique_lock lock(cache_mutex_);
+  cache_.clear();
+  stored_values_ = 0;
+}
+
+template auto MakeCellGeometryKey<1>(const domain::CellPtr<1>&) -> CellGeometryKey;
+template auto MakeCellGeometryKey<2>(const domain::CellPtr<2>&) -> CellGeometryKey;
+template auto MakeCellGeometryKey<3>(const domain::CellPtr<3>&) -> CellGeometryKey;
+
+} // namespace bart::formulation
@@ -0,0 +1,107 @@
+#ifndef BART_SRC_FORMULATION_LOCAL_MATRIX_CACHE_HPP_
+#define BART_SRC_FORMULATION_LOCAL_MATRIX_CACHE_HPP_
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
+#include "domain/domain_types.hpp"
+#include "formulation/formulation_types.hpp"
+
+namespace bart::formulation {
+
+/*! \brief Signature identifying congruent cells.
+ *
+ * Cell Jacobians and shape function gradients depend only on the position of the cell vertices relative to each
+ * other, so two cells with the same signature have identical local matrices for the same material, group and angle.
+ * The signature holds the refinement level and the offsets of each vertex from the first vertex, rounded to
+ * kCellGeometryTolerance. Unused entries are zero.
+ */
+struct CellGeometryKey {
+  //! Absolute tolerance used to round vertex offsets
+  static constexpr double kCellGeometryTolerance{ 1e-10 };
+  //! Number of vertex offsets needed to describe a hexahedron
+  static constexpr int kMaxVertexOffsets{ (8 - 1) * 3 };
+
+  int level{ 0 };
+  std::array<std::int64_t, kMaxVertexOffsets> vertex_offsets{};
+
+  auto operator<=>(const CellGeometryKey&) const = default;
+};
+
+/*! \brief Returns the geometry signature of a cell. */
+template <int dim>
+auto MakeCellGeometryKey(const domain::CellPtr<dim>& cell_ptr) -> CellGeometryKey;
+
+/*! \brief Key identifying a local cell or face matrix.
+ *
+ * Fields that a term does not depend on should be left at their default values.
+ */
+struct LocalMatrixKey {
+  int material_id{ 0 };
+  CellGeometryKey geometry{};
+  int group{ 0 };
+  int angle{ 0 };
+  int face{ -1 };
+
+  auto operator<=>(const LocalMatrixKey&) const = default;
+};
+
+/*! \brief Memoizes local matrices for cells that share a material, geometry, group and angle.
+ *
+ * On structured meshes almost every cell is congruent, so each distinct local matrix only needs to be integrated
+ * once and can be added to every following cell with the same key. To bound memory use on unstructured meshes, new
+ * matrices are no longer stored once the cache holds a maximum number of values; they are still calculated and
+ * added.
+ *
+ * Finding, inserting and adding matrices are safe to call from multiple threads. Stored matrices are never moved, so
+ * pointers returned by Find remain valid until Clear is called, which must not run concurrently with other calls.
+ */
+class LocalMatrixCache {
+ public:
+  //! Function that adds the local matrix to a zeroed matrix of the correct size
+  using FillFunction = std::function<void(FullMatrix&)>;
+  //! Default maximum number of stored matrix entries (32 MB of doubles)
+  static constexpr std::size_t kDefaultMaxStoredValues{ std::size_t{ 1 } << 22 };
+
+  explicit LocalMatrixCache(std::size_t max_stored_values = kDefaultMaxStoredValues)
+      : max_stored_values_(max_stored_values) {}
+
+  /*! \brief Adds the local matrix for a key to a matrix.
+   *
+   * If no matrix is cached for the key, it is calculated using the provided fill function and stored if there is
+   * space.
+   *
+   * \param to_fill matrix to add the local matrix to.
+   * \param key key identifying the local matrix.
+   * \param fill_function function to calculate the local matrix if it is not cached.
+   */
+  auto AddTo(FullMatrix& to_fill, const LocalMatrixKey& key, const FillFunction& fill_function) -> void;
+  /*! \brief Returns the cached matrix for a key, or nullptr if none is stored. */
+  auto Find(const LocalMatrixKey& key) const -> const FullMatrix*;
+  /*! \brief Stores a calculated matrix for a key if there is space and no matrix is stored for it yet. */
+  auto Insert(const LocalMatrixKey& key, const FullMatrix& local_matrix) -> void;
+  /*! \brief Removes all stored matrices. */
+  auto Clear() -> void;
+
+  /*! \brief Number of stored matrices. */
+  auto size() const -> std::size_t {
+    std::shared_lock lock(cache_mutex_);
+    return cache_.size();
+  }
+  auto max_stored_values() const -> std::size_t { return max_stored_values_; }
+ private:
+  mutable std::shared_mutex cache_mutex_{};
+  std::map<LocalMatrixKey, FullMatrix> cache_{};
+  std::size_t stored_values_{ 0 };
+  const std::size_t max_stored_values_;
+};
+
+} // namespace bart::formulation
+
+#endif //BART_SRC_FORMULATION_LOCAL_MATRIX_CACHE_HPP_
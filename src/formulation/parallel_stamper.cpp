@@ -0,0 +1,165 @@
+#include "formulation/parallel_stamper.hpp"
+
+#include <algorithm>
+#include <numeric>
+
+#include <deal.II/base/work_stream.h>
+
+#include "formulation/cell_batch_assembler.hpp"
+
+namespace bart::formulation {
+
+template<int dim>
+ParallelStamper<dim>::ParallelStamper(std::shared_ptr<domain::DomainI<dim>> domain_ptr)
+    : domain_ptr_(domain_ptr) {
+  this->template AssertPointerNotNull(domain_ptr_.get(), "domain", "ParallelStamper::ParallelStamper constructor");
+  this->set_description("threaded system matrix stamper", utility::DefaultImplementation(false));
+}
+
+template<int dim>
+auto ParallelStamper<dim>::StampMatrix(system::MPISparseMatrix& to_stamp,
+                                       CellMatrixStampFunction stamp_function) -> void {
+  const auto cells = domain_ptr_->Cells();
+  StampMatrixItems(to_stamp, cells.size(), 1,
+                   [&](const std::size_t cell, ScratchData&, MatrixCopyData& copy_data) {
+    auto& cell_matrix = copy_data.cell_matrices.front();
+    cell_matrix = 0;
+    cells[cell]->get_dof_indices(copy_data.local_dof_indices.front());
+    stamp_function(cell_matrix, cells[cell]);
+    copy_data.n_cells = 1;
+  });
+}
+
+template<int dim>
+auto ParallelStamper<dim>::StampMatrixBatch(system::MPISparseMatrix& to_stamp,
+                                            CellBatchMatrixStampFunction stamp_function) -> void {
+  const auto cells = domain_ptr_->Cells();
+  const std::span<const domain::CellPtr<dim>> all_cells{ cells };
+  const std::size_t n_batches{ (cells.size() + kCellBatchSize - 1) / kCellBatchSize };
+
+  StampMatrixItems(to_stamp, n_batches, kCellBatchSize,
+                   [&](const std::size_t batch, ScratchData&, MatrixCopyData& copy_data) {
+    const std::size_t batch_start{ batch * kCellBatchSize };
+    const std::size_t batch_size{ std::min<std::size_t>(kCellBatchSize, cells.size() - batch_start) };
+    const auto batch_matrices = std::span<FullMatrix>(copy_data.cell_matrices).first(batch_size);
+    for (auto& cell_matrix : batch_matrices)
+      cell_matrix = 0;
+    stamp_function(batch_matrices, all_cells.subspan(batch_start, batch_size));
+    for (std::size_t i = 0; i < batch_size; ++i)
+      cells[batch_start + i]->get_dof_indices(copy_data.local_dof_indices[i]);
+    copy_data.n_cells = batch_size;
+  });
+}
+
+template<int dim>
+auto ParallelStamper<dim>::StampVector(system::MPIVector& to_stamp, CellVectorStampFunction stamp_function) -> void {
+  const auto cells = domain_ptr_->Cells();
+  StampVectorItems(to_stamp, cells.size(), [&](const std::size_t cell, ScratchData&, VectorCopyData& copy_data) {
+    copy_data.cell_vector = 0;
+    cells[cell]->get_dof_indices(copy_data.local_dof_indices);
+    stamp_function(copy_data.cell_vector, cells[cell]);
+    copy_data.is_filled = true;
+  });
+}
+
+template<int dim>
+auto ParallelStamper<dim>::StampBoundaryMatrix(system::MPISparseMatrix &to_stamp,
+                                               FaceMatrixStampFunction stamp_function) -> void {
+  const auto cells = domain_ptr_->Cells();
+  // Every boundary face of a cell is stamped at the same degrees of freedom, so the face matrices are summed
+  StampMatrixItems(to_stamp, cells.size(), 1,
+                   [&](const std::size_t cell, ScratchData& scratch_data, MatrixCopyData& copy_data) {
+    const auto& cell_ptr = cells[cell];
+    copy_data.n_cells = 0;
+    if (!cell_ptr->at_boundary())
+      return;
+    auto& cell_matrix = copy_data.cell_matrices.front();
+    cell_matrix = 0;
+    for (int face = 0; face < static_cast<int>(dealii::GeometryInfo<dim>::faces_per_cell); ++face) {
+      if (cell_ptr->face(face)->at_boundary()) {
+        scratch_data.face_matrix = 0;
+        stamp_function(scratch_data.face_matrix, domain::FaceIndex(face), cell_ptr);
+        cell_matrix.add(1.0, scratch_data.face_matrix);
+      }
+    }
+    cell_ptr->get_dof_indices(copy_data.local_dof_indices.front());
+    copy_data.n_cells = 1;
+  });
+}
+
+template<int dim>
+auto ParallelStamper<dim>::StampBoundaryVector(system::MPIVector &to_stamp,
+                                               FaceVectorStampFunction stamp_function) -> void {
+  const auto cells = domain_ptr_->Cells();
+  StampVectorItems(to_stamp, cells.size(),
+                   [&](const std::size_t cell, ScratchData& scratch_data, VectorCopyData& copy_data) {
+    const auto& cell_ptr = cells[cell];
+    copy_data.is_filled = false;
+    if (!cell_ptr->at_boundary())
+      return;
+    copy_data.cell_vector = 0;
+    for (int face = 0; face < static_cast<int>(dealii::GeometryInfo<dim>::faces_per_cell); ++face) {
+      if (cell_ptr->face(face)->at_boundary()) {
+        scratch_data.face_vector = 0;
+        stamp_function(scratch_data.face_vector, domain::FaceIndex(face), cell_ptr);
+        copy_data.cell_vector += scratch_data.face_vector;
+      }
+    }
+    cell_ptr->get_dof_indices(copy_data.local_dof_indices);
+    copy_data.is_filled = true;
+  });
+}
+
+template<int dim>
+auto ParallelStamper<dim>::StampMatrixItems(system::MPISparseMatrix& to_stamp, const std::size_t n_items,
+                                            const std::size_t max_cells, const MatrixWorker& worker) const -> void {
+  const auto cell_matrix = domain_ptr_->GetCellMatrix();
+  std::vector<std::size_t> items(n_items);
+  std::iota(items.begin(), items.end(), 0);
+
+  MatrixCopyData sample_copy_data{
+      .cell_matrices = std::vector<FullMatrix>(max_cells, cell_matrix),
+      .local_dof_indices = std::vector<DofIndices>(max_cells, DofIndices(cell_matrix.n_cols()))};
+
+  dealii::WorkStream::run(
+      items.cbegin(), items.cend(),
+      [&worker](const std::vector<std::size_t>::const_iterator& item, ScratchData& scratch_data,
+                MatrixCopyData& copy_data) { worker(*item, scratch_data, copy_data); },
+      [&to_stamp](const MatrixCopyData& copy_data) {
+        for (std::size_t i = 0; i < copy_data.n_cells; ++i)
+          to_stamp.add(copy_data.local_dof_indices[i], copy_data.local_dof_indices[i], copy_data.cell_matrices[i]);
+      },
+      MakeScratchData(), sample_copy_data);
+  to_stamp.compress(dealii::VectorOperation::add);
+}
+
+template<int dim>
+auto ParallelStamper<dim>::StampVectorItems(system::MPIVector& to_stamp, const std::size_t n_items,
+                                            const VectorWorker& worker) const -> void {
+  const auto cell_vector = domain_ptr_->GetCellVector();
+  std::vector<std::size_t> items(n_items);
+  std::iota(items.begin(), items.end(), 0);
+
+  dealii::WorkStream::run(
+      items.cbegin(), items.cend(),
+      [&worker](const std::vector<std::size_t>::const_iterator& item, ScratchData& scratch_data,
+                VectorCopyData& copy_data) { worker(*item, scratch_data, copy_data); },
+      [&to_stamp](const VectorCopyData& copy_data) {
+        if (copy_data.is_filled)
+          to_stamp.add(copy_data.local_dof_indices, copy_data.cell_vector);
+      },
+      MakeScratchData(),
+      VectorCopyData{ .cell_vector = cell_vector, .local_dof_indices = DofIndices(cell_vector.size()) });
+  to_stamp.compress(dealii::VectorOperation::add);
+}
+
+template<int dim>
+auto ParallelStamper<dim>::MakeScratchData() const -> ScratchData {
+  return { .face_matrix = domain_ptr_->GetCellMatrix(), .face_vector = domain_ptr_->GetCellVector() };
+}
+
+template class ParallelStamper<1>;
+template class ParallelStamper<2>;
+template class ParallelStamper<3>;
+
+} // namespace bart::formulation
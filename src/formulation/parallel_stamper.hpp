@@ -0,0 +1,89 @@
+#ifndef BART_SRC_FORMULATION_PARALLEL_STAMPER_HPP_
+#define BART_SRC_FORMULATION_PARALLEL_STAMPER_HPP_
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <deal.II/base/types.h>
+
+#include "domain/domain_i.hpp"
+#include "formulation/stamper_i.hpp"
+#include "utility/has_dependencies.h"
+
+namespace bart::formulation {
+
+/*! \brief Domain stamper that evaluates stamp functions on cells using multiple threads.
+ *
+ * Cells are distributed to threads using dealii::WorkStream. Each thread fills local matrices and vectors held in its
+ * own copy data, and the results are added to the global matrix or vector in a copier stage that WorkStream runs on
+ * one thread at a time, so writes to the system matrix and vector (which are not thread-safe for PETSc objects) never
+ * race. The number of threads is set by dealii::MultithreadInfo.
+ *
+ * Stamp functions are called concurrently on different cells, so they must be safe to call from multiple threads.
+ *
+ * \tparam dim spatial dimension of the cells in the mesh
+ */
+template <int dim>
+class ParallelStamper : public StamperI<dim>, public utility::HasDependencies {
+ public:
+  using typename StamperI<dim>::CellMatrixStampFunction;
+  using typename StamperI<dim>::CellBatchMatrixStampFunction;
+  using typename StamperI<dim>::CellVectorStampFunction;
+  using typename StamperI<dim>::FaceMatrixStampFunction;
+  using typename StamperI<dim>::FaceVectorStampFunction;
+  using Domain = typename domain::DomainI<dim>;
+  /*! \brief Constructor.
+   * Takes a domain definition dependency that provides the domain of cells to iterate over. The matrices and vectors
+   * passed in this classes functions should be seperately initialized using this domain. */
+  explicit ParallelStamper(std::shared_ptr<Domain>);
+  virtual ~ParallelStamper() = default;
+
+  auto StampMatrix(system::MPISparseMatrix& to_stamp, CellMatrixStampFunction stamp_function) -> void override;
+  auto StampMatrixBatch(system::MPISparseMatrix& to_stamp, CellBatchMatrixStampFunction stamp_function)
+  -> void override;
+  auto StampVector(system::MPIVector& to_stamp, CellVectorStampFunction stamp_function) -> void override;
+  auto StampBoundaryMatrix(system::MPISparseMatrix &to_stamp, FaceMatrixStampFunction stamp_function) -> void override;
+  auto StampBoundaryVector(system::MPIVector &to_stamp, FaceVectorStampFunction stamp_function) -> void override;
+
+  /*! \brief Access domain definition dependency */
+  auto domain_ptr() const { return domain_ptr_.get(); }
+ private:
+  using DofIndices = std::vector<dealii::types::global_dof_index>;
+  //! Per-thread storage for face contributions, which are summed into the cell values
+  struct ScratchData {
+    FullMatrix face_matrix;
+    Vector face_vector;
+  };
+  //! Local matrices filled by a worker, with the global indices to add each one at
+  struct MatrixCopyData {
+    std::vector<FullMatrix> cell_matrices;
+    std::vector<DofIndices> local_dof_indices;
+    std::size_t n_cells{ 0 };
+  };
+  //! Local vector filled by a worker, with the global indices to add it at
+  struct VectorCopyData {
+    Vector cell_vector;
+    DofIndices local_dof_indices;
+    bool is_filled{ false };
+  };
+  using MatrixWorker = std::function<void(std::size_t, ScratchData&, MatrixCopyData&)>;
+  using VectorWorker = std::function<void(std::size_t, ScratchData&, VectorCopyData&)>;
+
+  /*! \brief Runs a worker for each work item, adding the filled local matrices to the global matrix.
+   *
+   * \param n_items number of work items, each item is passed to the worker by index.
+   * \param max_cells maximum number of local matrices filled by one work item.
+   */
+  auto StampMatrixItems(system::MPISparseMatrix& to_stamp, std::size_t n_items, std::size_t max_cells,
+                        const MatrixWorker& worker) const -> void;
+  /*! \brief Runs a worker for each cell, adding the filled local vectors to the global vector. */
+  auto StampVectorItems(system::MPIVector& to_stamp, std::size_t n_items, const VectorWorker& worker) const -> void;
+  auto MakeScratchData() const -> ScratchData;
+
+  std::shared_ptr<Domain> domain_ptr_;
+};
+
+} // namespace bart::formulation
+
+#endif //BART_SRC_FORMULATION_PARALLEL_STAMPER_HPP_
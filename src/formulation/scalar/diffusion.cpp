@@ -9,7 +9,8 @@ Diffusion<dim>::Diffusion(std::shared_ptr<FiniteElement> finite_element_ptr,
       cross_sections_ptr_(cross_sections_ptr),
       cell_degrees_of_freedom_(finite_element_ptr_->dofs_per_cell()),
       cell_quadrature_points_(finite_element_ptr_->n_cell_quad_pts()),
-      face_quadrature_points_(finite_element_ptr_->n_face_quad_pts()) {
+      face_quadrature_points_(finite_element_ptr_->n_face_quad_pts()),
+      cell_kernels_(finite_element_ptr_->cell_kernels()) {
   this->set_description("Diffusion Formulation", utility::DefaultImplementation(true));
   this->AssertPointerNotNull(finite_element_ptr_.get(), "finite element", "diffusion formulation constructor");
   this->AssertPointerNotNull(cross_sections_ptr_.get(), "cross sections", "diffusion formulation constructor");
@@ -19,22 +20,22 @@ template <int dim>
 auto Diffusion<dim>::Precalculate(const CellPtr& cell_ptr) -> void {
 
   finite_element_ptr_->SetCell(cell_ptr);
+  const int block_size{ cell_degrees_of_freedom_ * cell_degrees_of_freedom_ };
+  shape_squared_.assign(cell_quadrature_points_ * block_size, 0);
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
-    Matrix gradient_squared(cell_degrees_of_freedom_, cell_degrees_of_freedom_);
-    Matrix shape_squared(cell_degrees_of_freedom_, cell_degrees_of_freedom_);
+    auto shape_squared = shape_squared_.begin() + q * block_size;
 
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
       const double shape_value_at_i{ finite_element_ptr_->ShapeValue(i, q) };
-      const auto gradient_at_i{ finite_element_ptr_->ShapeGradient(i, q) };
-      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-        shape_squared(i, j) = shape_value_at_i * finite_element_ptr_->ShapeValue(j, q);
-        gradient_squared(i, j) =  gradient_at_i * finite_element_ptr_->ShapeGradient(j, q);
-      }
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j)
+        shape_squared[i * cell_degrees_of_freedom_ + j] = shape_value_at_i * finite_element_ptr_->ShapeValue(j, q);
     }
-    shape_squared_.push_back(shape_squared);
-    gradient_squared_.push_back(gradient_squared);
   }
+  gradient_squared_ = CalculateGradientSquared();
+  precalculated_geometry_key_ = MakeCellGeometryKey<dim>(cell_ptr);
+  precalculated_cell_ptr_ = cell_ptr;
+  cell_batch_assembler_ = CellBatchAssembler<dim>();
   is_initialized_ = true;
 }
 
@@ -43,10 +44,11 @@ void Diffusion<dim>::FillCellConstantTerm(Vector &to_fill,
                                           const CellPtr &cell_ptr,
                                           const Vector &constant_vector) const {
   finite_element_ptr_->SetCell(cell_ptr);
-  const auto constant_vector_at_quadrature{ this->finite_element_ptr_->ValueAtQuadrature(constant_vector) };
+  const auto constant_vector_at_quadrature = scratch_arena_.Get(kValueBuffer, cell_quadrature_points_);
+  finite_element_ptr_->ValueAtQuadrature(constant_vector, constant_vector_at_quadrature);
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
-    const double constant{ finite_element_ptr_->Jacobian(q) * constant_vector_at_quadrature.at(q) };
+    const double constant{ finite_element_ptr_->Jacobian(q) * constant_vector_at_quadrature[q] };
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
       to_fill(i) +=  constant * finite_element_ptr_->ShapeValue(i, q);
     }
@@ -57,40 +59,87 @@ template <int dim>
 auto Diffusion<dim>::FillCellStreamingTerm(Matrix& to_fill, const CellPtr& cell_ptr,
                                            const GroupNumber group) const -> void {
   VerifyInitialized(__FUNCTION__);
-  finite_element_ptr_->SetCell(cell_ptr);
+  VerifyMatrixSize(to_fill, __FUNCTION__);
   const int material_id = cell_ptr->material_id();
+  const auto geometry_key{ MakeCellGeometryKey<dim>(cell_ptr) };
 
-  const double diffusion_coef{ cross_sections_ptr_->diffusion_coef().at(material_id)[group] };
-
-  for (int q = 0; q < cell_quadrature_points_; ++q) {
-    const double constant{ diffusion_coef * finite_element_ptr_->Jacobian(q) };
-    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
-      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-        to_fill(i, j) += constant * gradient_squared_[q](i, j);
-      }
+  streaming_matrix_cache_.AddTo(to_fill, {.material_id = material_id, .geometry = geometry_key, .group = group},
+                                [&](Matrix& local_matrix) {
+    finite_element_ptr_->SetCell(cell_ptr);
+    const double diffusion_coef{ cross_sections_ptr_->diffusion_coef().at(material_id)[group] };
+
+    const auto weights = scratch_arena_.Get(kCellWeightBuffer, cell_quadrature_points_);
+    for (int q = 0; q < cell_quadrature_points_; ++q)
+      weights[q] = diffusion_coef * finite_element_ptr_->Jacobian(q);
+
+    // Gradient products depend on the cell geometry, recalculate them if this cell is not congruent
+    std::vector<double> cell_gradient_squared;
+    const double* gradient_squared{ gradient_squared_.data() };
+    if (geometry_key != precalculated_geometry_key_) {
+      cell_gradient_squared = CalculateGradientSquared();
+      gradient_squared = cell_gradient_squared.data();
     }
-  }
+
+    cell_kernels_.cell_weighted_matrix_sum(&local_matrix(0, 0), weights.data(), gradient_squared,
+                                           cell_degrees_of_freedom_, cell_quadrature_points_);
+  });
 }
 
 template <int dim>
 auto Diffusion<dim>::FillCellCollisionTerm(Matrix& to_fill, const CellPtr& cell_ptr,
                                            const GroupNumber group) const -> void {
   VerifyInitialized(__FUNCTION__);
-  finite_element_ptr_->SetCell(cell_ptr);
+  VerifyMatrixSize(to_fill, __FUNCTION__);
   const int material_id = cell_ptr->material_id();
 
-  const double sigma_t{ cross_sections_ptr_->sigma_t().at(material_id)[group] };
-  const double sigma_s{ cross_sections_ptr_->sigma_s().at(material_id)(group, group) };
-  const double sigma_r{ sigma_t - sigma_s };
+  collision_matrix_cache_.AddTo(to_fill, CollisionMatrixKey(cell_ptr, group), [&](Matrix& local_matrix) {
+    finite_element_ptr_->SetCell(cell_ptr);
+    const double sigma_r{ CollisionCrossSection(material_id, group) };
 
-  for (int q = 0; q < cell_quadrature_points_; ++q) {
-    const double constant{ sigma_r * finite_element_ptr_->Jacobian(q) };
-    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
-      for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-        to_fill(i, j) += constant * shape_squared_[q](i, j);
-      }
-    }
-  }
+    const auto weights = scratch_arena_.Get(kCellWeightBuffer, cell_quadrature_points_);
+    for (int q = 0; q < cell_quadrature_points_; ++q)
+      weights[q] = sigma_r * finite_element_ptr_->Jacobian(q);
+
+    cell_kernels_.cell_weighted_matrix_sum(&local_matrix(0, 0), weights.data(), shape_squared_.data(),
+                                           cell_degrees_of_freedom_, cell_quadrature_points_);
+  });
+}
+
+template <int dim>
+auto Diffusion<dim>::FillCellStreamingTermBatch(std::span<Matrix> to_fill, std::span<const CellPtr> cell_ptrs,
+                                                const GroupNumber group) const -> void {
+  VerifyInitialized(__FUNCTION__);
+  for (const auto& matrix : to_fill)
+    VerifyMatrixSize(matrix, __FUNCTION__);
+  InitializeCellBatchAssembler();
+  const auto& diffusion_coef = cross_sections_ptr_->diffusion_coef();
+
+  cell_batch_assembler_.FillBatch(
+      to_fill, cell_ptrs, streaming_matrix_cache_,
+      [&](const CellPtr& cell_ptr) -> LocalMatrixKey {
+        return {.material_id = cell_ptr->material_id(), .geometry = MakeCellGeometryKey<dim>(cell_ptr),
+                .group = group}; },
+      [&](const CellPtr& cell_ptr) { return diffusion_coef.at(cell_ptr->material_id())[group]; },
+      [&](auto& batch) {
+        for (int direction = 0; direction < dim; ++direction)
+          cell_batch_assembler_.AddGradientProducts(batch, direction, direction, 1.0); },
+      [&](Matrix& cell_matrix, const CellPtr& cell_ptr) { FillCellStreamingTerm(cell_matrix, cell_ptr, group); });
+}
+
+template <int dim>
+auto Diffusion<dim>::FillCellCollisionTermBatch(std::span<Matrix> to_fill, std::span<const CellPtr> cell_ptrs,
+                                                const GroupNumber group) const -> void {
+  VerifyInitialized(__FUNCTION__);
+  for (const auto& matrix : to_fill)
+    VerifyMatrixSize(matrix, __FUNCTION__);
+  InitializeCellBatchAssembler();
+
+  cell_batch_assembler_.FillBatch(
+      to_fill, cell_ptrs, collision_matrix_cache_,
+      [&](const CellPtr& cell_ptr) { return CollisionMatrixKey(cell_ptr, group); },
+      [&](const CellPtr& cell_ptr) { return CollisionCrossSection(cell_ptr->material_id(), group); },
+      [&](auto& batch) { cell_batch_assembler_.AddShapeSquared(batch); },
+      [&](Matrix& cell_matrix, const CellPtr& cell_ptr) { FillCellCollisionTerm(cell_matrix, cell_ptr, group); });
 }
 
 template <int dim>
@@ -98,17 +147,23 @@ auto Diffusion<dim>::FillBoundaryTerm(Matrix& to_fill, const CellPtr& cell_ptr,
                                       const BoundaryType boundary_type) const -> void {
   VerifyInitialized(__FUNCTION__);
   if (boundary_type == BoundaryType::kVacuum) {
-    finite_element_ptr_->SetFace(cell_ptr, domain::FaceIndex(face_number));
-
-    for (int q = 0; q < face_quadrature_points_; ++q) {
-      const double constant{ 0.5 * finite_element_ptr_->FaceJacobian(q) };
-      for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
-        const double face_shape_at_i{ finite_element_ptr_->FaceShapeValue(i, q) };
-        for (int j = 0; j < cell_degrees_of_freedom_; ++j) {
-          to_fill(i, j) += constant * face_shape_at_i * finite_element_ptr_->FaceShapeValue(j, q);
-        }
+    VerifyMatrixSize(to_fill, __FUNCTION__);
+
+    boundary_matrix_cache_.AddTo(to_fill, {.geometry = MakeCellGeometryKey<dim>(cell_ptr), .face = face_number},
+                                 [&](Matrix& local_matrix) {
+      finite_element_ptr_->SetFace(cell_ptr, domain::FaceIndex(face_number));
+
+      std::vector<double> weights(face_quadrature_points_);
+      std::vector<double> face_shape_values(face_quadrature_points_ * cell_degrees_of_freedom_);
+      for (int q = 0; q < face_quadrature_points_; ++q) {
+        weights[q] = 0.5 * finite_element_ptr_->FaceJacobian(q);
+        for (int i = 0; i < cell_degrees_of_freedom_; ++i)
+          face_shape_values[q * cell_degrees_of_freedom_ + i] = finite_element_ptr_->FaceShapeValue(i, q);
       }
-    }
+
+      cell_kernels_.face_weighted_outer_product_sum(&local_matrix(0, 0), weights.data(), face_shape_values.data(),
+                                                    cell_degrees_of_freedom_, face_quadrature_points_);
+    });
   }
 }
 
@@ -143,19 +198,15 @@ auto Diffusion<dim>::FillCellFissionSource(Vector& to_fill, const CellPtr& cell_
   if (cross_sections_ptr_->is_material_fissile().at(material_id)) {
     finite_element_ptr_->SetCell(cell_ptr);
 
-    std::vector<double> fission_source_at_quad_points(cell_quadrature_points_);
+    const auto fission_source_at_quad_points = scratch_arena_.Get(kSourceBuffer, cell_quadrature_points_);
+    const auto scalar_flux_at_quad_points = scratch_arena_.Get(kValueBuffer, cell_quadrature_points_);
 
     // Get fission source contribution from each group at each quadrature point
     for (const auto& [index, moment] : group_moments) {
       const auto &[group_in, harmonic_l, harmonic_m] = index;
       if (harmonic_l == 0 && harmonic_m == 0) {
-        std::vector<double> scalar_flux_at_quad_points(cell_quadrature_points_);
-
-        if (group_in == group) {
-          scalar_flux_at_quad_points = finite_element_ptr_->ValueAtQuadrature(in_group_moment);
-        } else {
-          scalar_flux_at_quad_points = finite_element_ptr_->ValueAtQuadrature(moment);
-        }
+        finite_element_ptr_->ValueAtQuadrature(group_in == group ? in_group_moment : moment,
+                                               scalar_flux_at_quad_points);
 
         const auto fission_transfer{ cross_sections_ptr_->fiss_transfer().at(material_id)(group_in, group) };
 
@@ -179,27 +230,27 @@ auto Diffusion<dim>::FillCellScatteringSource(Vector& to_fill, const CellPtr& ce
   finite_element_ptr_->SetCell(cell_ptr);
   const int material_id = cell_ptr->material_id();
 
-  std::vector<double> scattering_source_at_quad_points(cell_quadrature_points_);
+  const auto scattering_source_at_quad_points = scratch_arena_.Get(kSourceBuffer, cell_quadrature_points_);
+  const auto weights = scratch_arena_.Get(kWeightBuffer, group_moments.size());
+  const auto moments = moment_arena_.Get(0, group_moments.size());
+  const auto& sigma_s = cross_sections_ptr_->sigma_s().at(material_id);
 
-  // Get fission source contribution from each group at each quadrature point
+  // Scattering from each out-group is summed at the degrees of freedom and evaluated at the quadrature points once
+  std::size_t n_moments{ 0 };
   for (const auto& [index, moment] : group_moments) {
     const auto &[group_in, harmonic_l, harmonic_m] = index;
-
-    // Check if scalar flux for an out-group
     if ((group_in != group) && (harmonic_l == 0) && (harmonic_m == 0)) {
-      //std::vector<double> scalar_flux_at_quad_points(cell_quadrature_points_);
-
-      const auto scalar_flux_at_quad_points{ finite_element_ptr_->ValueAtQuadrature(moment) };
-      const double sigma_s{ cross_sections_ptr_->sigma_s().at(material_id)(group, group_in) };
-
-      for (int q = 0; q < cell_quadrature_points_; ++q)
-        scattering_source_at_quad_points[q] += sigma_s * scalar_flux_at_quad_points[q];
+      weights[n_moments] = sigma_s(group, group_in);
+      moments[n_moments] = &moment;
+      ++n_moments;
     }
   }
+  finite_element_ptr_->WeightedValueAtQuadrature(weights.first(n_moments), moments.first(n_moments),
+                                                 scattering_source_at_quad_points);
 
   // Integrate for each degree of freedom
   for (int q = 0; q < cell_quadrature_points_; ++q) {
-    const double constant{ finite_element_ptr_->Jacobian(q) * scattering_source_at_quad_points.at(q) };
+    const double constant{ finite_element_ptr_->Jacobian(q) * scattering_source_at_quad_points[q] };
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
       to_fill(i) += finite_element_ptr_->ShapeValue(i, q) * constant;
     }
@@ -217,6 +268,63 @@ auto Diffusion<dim>::VerifyInitialized(const std::string& called_function_name)
   }
 }
 
+template<int dim>
+auto Diffusion<dim>::VerifyMatrixSize(const Matrix& to_verify, const std::string& called_function_name) const -> void {
+  if ((static_cast<int>(to_verify.m()) != cell_degrees_of_freedom_) ||
+      (static_cast<int>(to_verify.n()) != cell_degrees_of_freedom_)) {
+    std::ostringstream error_string;
+    error_string << "Error in Diffusion function " << called_function_name << ": passed matrix size is invalid, "
+                 << "expected size (" << cell_degrees_of_freedom_ << ", " << cell_degrees_of_freedom_
+                 << "), actual size: (" << to_verify.m() << ", " << to_verify.n() << ")";
+
+    AssertThrow(false, dealii::ExcMessage(error_string.str()))
+  }
+}
+
+template<int dim>
+auto Diffusion<dim>::TableToMatrices(const std::vector<double>& table) const -> std::vector<Matrix> {
+  const int block_size{ cell_degrees_of_freedom_ * cell_degrees_of_freedom_ };
+  std::vector<Matrix> return_vector;
+  for (auto block = table.begin(); block != table.end(); block += block_size)
+    return_vector.emplace_back(cell_degrees_of_freedom_, cell_degrees_of_freedom_, &(*block));
+  return return_vector;
+}
+
+template<int dim>
+auto Diffusion<dim>::CalculateGradientSquared() const -> std::vector<double> {
+  const int block_size{ cell_degrees_of_freedom_ * cell_degrees_of_freedom_ };
+  std::vector<double> gradient_squared(cell_quadrature_points_ * block_size, 0);
+
+  for (int q = 0; q < cell_quadrature_points_; ++q) {
+    auto gradient_squared_at_q = gradient_squared.begin() + q * block_size;
+    for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
+      const auto gradient_at_i{ finite_element_ptr_->ShapeGradient(i, q) };
+      for (int j = 0; j < cell_degrees_of_freedom_; ++j)
+        gradient_squared_at_q[i * cell_degrees_of_freedom_ + j] = gradient_at_i * finite_element_ptr_->ShapeGradient(j, q);
+    }
+  }
+  return gradient_squared;
+}
+
+template<int dim>
+auto Diffusion<dim>::InitializeCellBatchAssembler() const -> void {
+  std::scoped_lock lock(cell_batch_assembler_mutex_);
+  if (!cell_batch_assembler_.is_initialized())
+    cell_batch_assembler_.Initialize(*finite_element_ptr_, precalculated_cell_ptr_);
+}
+
+template<int dim>
+auto Diffusion<dim>::CollisionMatrixKey(const CellPtr& cell_ptr, const GroupNumber group) const -> LocalMatrixKey {
+  return {.material_id = cell_ptr->material_id(), .geometry = MakeCellGeometryKey<dim>(cell_ptr), .group = group};
+}
+
+template<int dim>
+auto Diffusion<dim>::CollisionCrossSection(const int material_id, const GroupNumber group) const -> double {
+  const double sigma_t{ cross_sections_ptr_->sigma_t().at(material_id)[group] };
+  const double sigma_s{ cross_sections_ptr_->sigma_s().at(material_id)(group, group) };
+  return sigma_t - sigma_s;
+}
+
 template class Diffusion<1>;
 template class Diffusion<2>;
 template class Diffusion<3>;
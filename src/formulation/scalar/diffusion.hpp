@@ -2,14 +2,18 @@
 #define BART_SRC_FORMULATION_SCALAR_DIFFUSION_HPP_
 
 #include <memory>
+#include <mutex>
 
 #include <deal.II/lac/full_matrix.h>
 
 #include "data/cross_sections/cross_sections_i.hpp"
 #include "domain/finite_element/finite_element_i.hpp"
+#include "formulation/cell_batch_assembler.hpp"
+#include "formulation/local_matrix_cache.hpp"
 #include "formulation/scalar/diffusion_i.hpp"
 #include "system/moments/spherical_harmonic_types.h"
 #include "utility/has_dependencies.h"
+#include "utility/scratch_arena.hpp"
 
 namespace bart::formulation::scalar {
 
@@ -41,6 +45,12 @@ class Diffusion : public DiffusionI<dim>, public utility::HasDependencies {
 
   auto FillCellCollisionTerm(Matrix& to_fill, const CellPtr&, GroupNumber) const -> void override;
 
+  auto FillCellStreamingTermBatch(std::span<Matrix> to_fill, std::span<const CellPtr> cell_ptrs,
+                                  GroupNumber) const -> void override;
+
+  auto FillCellCollisionTermBatch(std::span<Matrix> to_fill, std::span<const CellPtr> cell_ptrs,
+                                  GroupNumber) const -> void override;
+
   auto FillBoundaryTerm(Matrix& to_fill, const CellPtr&, FaceNumber, BoundaryType) const -> void override;
 
   auto FillCellFixedSource(Vector& to_fill, const CellPtr&, GroupNumber) const -> void override;
@@ -59,14 +69,14 @@ class Diffusion : public DiffusionI<dim>, public utility::HasDependencies {
    *
    * \return Vector containing matrices corresponding to each quadrature point.
    */
-  auto GetShapeSquared() const -> std::vector<Matrix> { return shape_squared_; }
+  auto GetShapeSquared() const -> std::vector<Matrix> { return TableToMatrices(shape_squared_); }
 
   /*! \brief Get precalculated matrices for the square of the gradient
    * of the shape function.
    *
    * \return Vector containing matrices corresponding to each quadrature point.
    */
-  auto GetGradientSquared() const -> std::vector<Matrix> { return gradient_squared_; }
+  auto GetGradientSquared() const -> std::vector<Matrix> { return TableToMatrices(gradient_squared_); }
 
   auto finite_element_ptr() const { return finite_element_ptr_.get(); }
   auto cross_sections_ptr() const { return cross_sections_ptr_.get(); }
@@ -77,14 +87,47 @@ class Diffusion : public DiffusionI<dim>, public utility::HasDependencies {
   //! Cross-sections object for cross-section data
   std::shared_ptr<CrossSections> cross_sections_ptr_{ nullptr };
 
-  std::vector<Matrix> shape_squared_;
-  std::vector<Matrix> gradient_squared_;
+  //! Shape function products, stored row-major for each cell quadrature point in one contiguous table
+  std::vector<double> shape_squared_;
+  //! Shape function gradient products, stored as for shape_squared_
+  std::vector<double> gradient_squared_;
   const int cell_degrees_of_freedom_; //!< Number of degrees of freedom per cell
   const int cell_quadrature_points_; //!< Number of quadrature points per cell
   const int face_quadrature_points_; //!< Number of quadrature points per face
+  //! Kernels used to integrate cell and face terms, provided by the finite element
+  const domain::finite_element::CellKernels& cell_kernels_;
+  //! Geometry of the cell passed to Precalculate, gradient products are only valid for congruent cells
+  CellGeometryKey precalculated_geometry_key_{};
+  //! Cell passed to Precalculate, used as the reference cell for batched assembly
+  CellPtr precalculated_cell_ptr_{};
   bool is_initialized_{ false };
 
+  //! Local matrices reused on congruent cells, keyed by material, geometry and group
+  mutable LocalMatrixCache streaming_matrix_cache_{};
+  mutable LocalMatrixCache collision_matrix_cache_{};
+  //! Vacuum boundary matrices reused on congruent cells, keyed by geometry and face
+  mutable LocalMatrixCache boundary_matrix_cache_{};
+  //! Integrates streaming and collision matrices for batches of axis-aligned cells, initialized on first use
+  mutable CellBatchAssembler<dim> cell_batch_assembler_{};
+  //! Guards initialization of the batch assembler by the first of multiple threads filling batches
+  mutable std::mutex cell_batch_assembler_mutex_{};
+  //! Buffers for values at cell quadrature points, so that filling source terms and local matrices does not allocate
+  mutable utility::ScratchArena scratch_arena_{};
+  enum ScratchBuffer : std::size_t { kSourceBuffer = 0, kValueBuffer = 1, kWeightBuffer = 2, kCellWeightBuffer = 3 };
+  //! Buffer for the moments summed by the group-summed scattering source
+  mutable utility::BasicScratchArena<const MomentVector*> moment_arena_{};
+
   auto VerifyInitialized(const std::string& called_function_name) const -> void;
+  auto VerifyMatrixSize(const Matrix& to_verify, const std::string& called_function_name) const -> void;
+  auto TableToMatrices(const std::vector<double>& table) const -> std::vector<Matrix>;
+  /*! \brief Shape function gradient products for the cell currently set in the finite element, stored as for
+   * gradient_squared_. */
+  auto CalculateGradientSquared() const -> std::vector<double>;
+  auto InitializeCellBatchAssembler() const -> void;
+  /*! \brief Cache key for the collision matrix of a cell. */
+  virtual auto CollisionMatrixKey(const CellPtr&, GroupNumber) const -> LocalMatrixKey;
+  /*! \brief Cross-section multiplying the collision matrix, \f$\Sigma_{t,g} - \Sigma_{s, g \to g}\f$. */
+  virtual auto CollisionCrossSection(int material_id, GroupNumber) const -> double;
 };
 
 } // namespace bart::formulation::scalar
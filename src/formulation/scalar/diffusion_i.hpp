@@ -1,6 +1,8 @@
 #ifndef BART_SRC_FORMULATION_SCALAR_DIFFUSION_I_HPP_
 #define BART_SRC_FORMULATION_SCALAR_DIFFUSION_I_HPP_
 
+#include <span>
+
 #include <deal.II/lac/full_matrix.h>
 #include <deal.II/dofs/dof_accessor.h>
 
@@ -63,7 +65,8 @@ class DiffusionI : public common::RHSConstantI<dim>, public utility::HasDescript
    *
    * The bilinear terms require the shape-funtion or gradient of the shape function squared. This function precalculates
    * those, reducing the number of times the underlying finite element object needs to be called. The shape functions
-   * for each cell are identical, and the jacobian is used to translate from the base cell.
+   * for each cell are identical, and the jacobian is used to translate from the base cell. Gradients depend on the cell
+   * geometry, so cells that are not congruent to the given cell recalculate them when filled.
    *
    * @param cell_ptr an arbitrary cell to use, often just the beginning of active cells.
    */
@@ -97,6 +100,22 @@ class DiffusionI : public common::RHSConstantI<dim>, public utility::HasDescript
    * @param to_fill
    */
   virtual auto FillCellCollisionTerm(Matrix& to_fill, const CellPtr&, GroupNumber) const -> void = 0;
+  /*! \brief Integrates the bilinear streaming term over a batch of cells.
+   *
+   * Equivalent to calling FillCellStreamingTerm for each cell, but allows implementations to integrate several cells at
+   * once.
+   *
+   * @param to_fill cell matrices to fill, one for each cell.
+   * @param cell_ptrs cells to integrate over.
+   */
+  virtual auto FillCellStreamingTermBatch(std::span<Matrix> to_fill, std::span<const CellPtr> cell_ptrs,
+                                          GroupNumber) const -> void = 0;
+  /*! \brief Integrates the bilinear collision term over a batch of cells.
+   *
+   * Equivalent to calling FillCellCollisionTerm for each cell, see FillCellStreamingTermBatch.
+   */
+  virtual auto FillCellCollisionTermBatch(std::span<Matrix> to_fill, std::span<const CellPtr> cell_ptrs,
+                                          GroupNumber) const -> void = 0;
 /*! \brief Integrates the bilinear boundary term over a cell and fills a given matrix.
    *
    * For a given cell and face in the triangulation, \f$\partial K \in \partial T_K\f$, with basis functions
@@ -0,0 +1,498 @@
+#include "formulation/scalar/diffusion_matrix_free_operator.hpp"
+
+#include <algorithm>
+#include <functional>
+
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+
+namespace bart::formulation::scalar {
+
+namespace  {
+//! Number of 1D quadrature points for FEEvaluation, 0 indicates a runtime polynomial degree
+constexpr auto QuadraturePoints1D(const int fe_degree) -> int { return fe_degree == -1 ? 0 : fe_degree + 1; }
+} // namespace
+
+// LEVEL OPERATOR ======================================================================================================
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeLevelOperator<dim, fe_degree>::SetCoefficients(
+    const MaterialCoefficients& diffusion_coefficient,
+    const MaterialCoefficients& removal_cross_section,
+    const std::set<dealii::types::boundary_id>& reflective_boundary_ids) -> void {
+  AssertThrow(this->data != nullptr, dealii::ExcMessage("Error in DiffusionMatrixFreeLevelOperator function "
+                                                        "SetCoefficients: operator has not been initialized"))
+  const auto& data = *this->data;
+
+  // Coefficients are stored per cell batch, lanes of partially filled batches repeat the first cell
+  const unsigned int n_cell_batches{ data.n_cell_batches() };
+  diffusion_coefficient_.assign(n_cell_batches, VectorizedDouble());
+  removal_cross_section_.assign(n_cell_batches, VectorizedDouble());
+  for (unsigned int batch = 0; batch < n_cell_batches; ++batch) {
+    const unsigned int n_filled_lanes{ data.n_active_entries_per_cell_batch(batch) };
+    for (unsigned int lane = 0; lane < VectorizedDouble::size(); ++lane) {
+      const int material_id = data.get_cell_iterator(batch, lane < n_filled_lanes ? lane : 0)->material_id();
+      diffusion_coefficient_[batch][lane] = diffusion_coefficient.at(material_id);
+      removal_cross_section_[batch][lane] = removal_cross_section.at(material_id);
+    }
+  }
+
+  // Boundary face batches only contain faces with the same boundary id
+  const unsigned int n_inner_face_batches{ data.n_inner_face_batches() };
+  is_vacuum_face_batch_.assign(data.n_boundary_face_batches(), true);
+  for (unsigned int face = 0; face < data.n_boundary_face_batches(); ++face) {
+    const auto boundary_id = data.get_boundary_id(n_inner_face_batches + face);
+    is_vacuum_face_batch_[face] = !reflective_boundary_ids.contains(boundary_id);
+  }
+}
+
+template<int dim, int fe_degree>
+void DiffusionMatrixFreeLevelOperator<dim, fe_degree>::compute_diagonal() {
+  this->inverse_diagonal_entries = std::make_shared<dealii::DiagonalMatrix<DistributedVector>>();
+  auto& inverse_diagonal = this->inverse_diagonal_entries->get_vector();
+  this->data->initialize_dof_vector(inverse_diagonal);
+  const unsigned int dummy{ 0 };
+  this->data->loop(&DiffusionMatrixFreeLevelOperator::CellDiagonal,
+                   &DiffusionMatrixFreeLevelOperator::InnerFaceDiagonal,
+                   &DiffusionMatrixFreeLevelOperator::BoundaryDiagonal,
+                   this, inverse_diagonal, dummy);
+  this->set_constrained_entries_to_one(inverse_diagonal);
+
+  for (unsigned int i = 0; i < inverse_diagonal.locally_owned_size(); ++i) {
+    AssertThrow(inverse_diagonal.local_element(i) > 0.0,
+                dealii::ExcMessage("Error in DiffusionMatrixFreeLevelOperator function compute_diagonal: diagonal "
+                                   "entry is not positive"))
+    inverse_diagonal.local_element(i) = 1.0 / inverse_diagonal.local_element(i);
+  }
+}
+
+template<int dim, int fe_degree>
+void DiffusionMatrixFreeLevelOperator<dim, fe_degree>::apply_add(DistributedVector& dst,
+                                                                 const DistributedVector& src) const {
+  this->data->loop(&DiffusionMatrixFreeLevelOperator::CellOperation,
+                   &DiffusionMatrixFreeLevelOperator::InnerFaceOperation,
+                   &DiffusionMatrixFreeLevelOperator::BoundaryOperation,
+                   this, dst, src);
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeLevelOperator<dim, fe_degree>::CellOperation(const MatrixFreeData& data,
+                                                                     DistributedVector& dst,
+                                                                     const DistributedVector& src,
+                                                                     const CellRange& cell_range) const -> void {
+  using dealii::EvaluationFlags::values, dealii::EvaluationFlags::gradients;
+  dealii::FEEvaluation<dim, fe_degree, QuadraturePoints1D(fe_degree), 1, double> phi(data);
+
+  for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell) {
+    phi.reinit(cell);
+    phi.gather_evaluate(src, values | gradients);
+    for (unsigned int q = 0; q < phi.n_q_points; ++q) {
+      phi.submit_gradient(diffusion_coefficient_[cell] * phi.get_gradient(q), q);
+      phi.submit_value(removal_cross_section_[cell] * phi.get_value(q), q);
+    }
+    phi.integrate_scatter(values | gradients, dst);
+  }
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeLevelOperator<dim, fe_degree>::BoundaryOperation(const MatrixFreeData& data,
+                                                                         DistributedVector& dst,
+                                                                         const DistributedVector& src,
+                                                                         const CellRange& face_range) const -> void {
+  using dealii::EvaluationFlags::values;
+  dealii::FEFaceEvaluation<dim, fe_degree, QuadraturePoints1D(fe_degree), 1, double> phi(data, true);
+
+  for (unsigned int face = face_range.first; face < face_range.second; ++face) {
+    // Reflective boundaries add nothing to the operator
+    if (!IsVacuumFaceBatch(face))
+      continue;
+    phi.reinit(face);
+    phi.gather_evaluate(src, values);
+    for (unsigned int q = 0; q < phi.n_q_points; ++q)
+      phi.submit_value(0.5 * phi.get_value(q), q);
+    phi.integrate_scatter(values, dst);
+  }
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeLevelOperator<dim, fe_degree>::CellDiagonal(const MatrixFreeData& data,
+                                                                    DistributedVector& dst,
+                                                                    const unsigned int&,
+                                                                    const CellRange& cell_range) const -> void {
+  using dealii::EvaluationFlags::values, dealii::EvaluationFlags::gradients;
+  dealii::FEEvaluation<dim, fe_degree, QuadraturePoints1D(fe_degree), 1, double> phi(data);
+  dealii::AlignedVector<VectorizedDouble> diagonal(phi.dofs_per_cell);
+
+  // Applies the cell operator to each unit vector and keeps the matching entry
+  for (unsigned int cell = cell_range.first; cell < cell_range.second; ++cell) {
+    phi.reinit(cell);
+    for (unsigned int i = 0; i < phi.dofs_per_cell; ++i) {
+      for (unsigned int j = 0; j < phi.dofs_per_cell; ++j)
+        phi.begin_dof_values()[j] = VectorizedDouble();
+      phi.begin_dof_values()[i] = dealii::make_vectorized_array(1.0);
+      phi.evaluate(values | gradients);
+      for (unsigned int q = 0; q < phi.n_q_points; ++q) {
+        phi.submit_gradient(diffusion_coefficient_[cell] * phi.get_gradient(q), q);
+        phi.submit_value(removal_cross_section_[cell] * phi.get_value(q), q);
+      }
+      phi.integrate(values | gradients);
+      diagonal[i] = phi.begin_dof_values()[i];
+    }
+    std::copy(diagonal.begin(), diagonal.end(), phi.begin_dof_values());
+    phi.distribute_local_to_global(dst);
+  }
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeLevelOperator<dim, fe_degree>::BoundaryDiagonal(const MatrixFreeData& data,
+                                                                        DistributedVector& dst,
+                                                                        const unsigned int&,
+                                                                        const CellRange& face_range) const -> void {
+  using dealii::EvaluationFlags::values;
+  dealii::FEFaceEvaluation<dim, fe_degree, QuadraturePoints1D(fe_degree), 1, double> phi(data, true);
+  dealii::AlignedVector<VectorizedDouble> diagonal(phi.dofs_per_cell);
+
+  for (unsigned int face = face_range.first; face < face_range.second; ++face) {
+    if (!IsVacuumFaceBatch(face))
+      continue;
+    phi.reinit(face);
+    for (unsigned int i = 0; i < phi.dofs_per_cell; ++i) {
+      for (unsigned int j = 0; j < phi.dofs_per_cell; ++j)
+        phi.begin_dof_values()[j] = VectorizedDouble();
+      phi.begin_dof_values()[i] = dealii::make_vectorized_array(1.0);
+      phi.evaluate(values);
+      for (unsigned int q = 0; q < phi.n_q_points; ++q)
+        phi.submit_value(0.5 * phi.get_value(q), q);
+      phi.integrate(values);
+      diagonal[i] = phi.begin_dof_values()[i];
+    }
+    std::copy(diagonal.begin(), diagonal.end(), phi.begin_dof_values());
+    phi.distribute_local_to_global(dst);
+  }
+}
+
+// OPERATOR ============================================================================================================
+
+template<int dim, int fe_degree>
+DiffusionMatrixFreeOperator<dim, fe_degree>::DiffusionMatrixFreeOperator(
+    const Domain& domain,
+    const std::shared_ptr<CrossSections>& cross_sections,
+    const std::set<problem::Boundary>& reflective_boundaries,
+    const int polynomial_degree,
+    const std::shared_ptr<OneGroupCrossSections>& one_group_cross_sections)
+    : dof_handler_(domain.dof_handler()),
+      total_groups_(cross_sections == nullptr || cross_sections->diffusion_coef().empty() ? 0 :
+                    static_cast<int>(cross_sections->diffusion_coef().begin()->second.size())),
+      n_dofs_(domain.total_degrees_of_freedom()),
+      n_locally_owned_dofs_(domain.locally_owned_dofs().n_elements()),
+      communicator_(domain.MakeSystemVector()->get_mpi_communicator()) {
+  std::string error_start{ "Error in constructor of DiffusionMatrixFreeOperator: " };
+  AssertThrow(cross_sections != nullptr, dealii::ExcMessage(error_start + "cross-sections pointer is null"))
+  AssertThrow(total_groups_ > 0, dealii::ExcMessage(error_start + "cross-sections have no energy groups"))
+  AssertThrow(fe_degree == -1 || fe_degree == polynomial_degree,
+              dealii::ExcMessage(error_start + "polynomial degree does not match compile-time degree"))
+  AssertThrow(static_cast<int>(dof_handler_.get_fe().degree) == polynomial_degree,
+              dealii::ExcMessage(error_start + "polynomial degree does not match domain finite element"))
+  AssertThrow(dof_handler_.has_level_dofs(),
+              dealii::ExcMessage(error_start + "domain does not have level degrees of freedom, it must be built with "
+                                 "a multigrid hierarchy"))
+
+  for (const auto boundary : reflective_boundaries)
+    reflective_boundary_ids_.insert(static_cast<dealii::types::boundary_id>(boundary));
+
+  // Coefficients for each group and material, matching Diffusion and TwoGridDiffusion
+  diffusion_coefficient_.resize(total_groups_);
+  removal_cross_section_.resize(total_groups_);
+  const auto& sigma_t = cross_sections->sigma_t();
+  const auto& sigma_s = cross_sections->sigma_s();
+  for (const auto& [material_id, material_diffusion_coefficient] : cross_sections->diffusion_coef()) {
+    for (int group = 0; group < total_groups_; ++group) {
+      diffusion_coefficient_[group][material_id] = material_diffusion_coefficient.at(group);
+      if (one_group_cross_sections != nullptr) {
+        removal_cross_section_[group][material_id] = one_group_cross_sections->SigmaAbsorption(material_id);
+      } else {
+        removal_cross_section_[group][material_id] = sigma_t.at(material_id).at(group)
+            - sigma_s.at(material_id)(group, group);
+      }
+    }
+  }
+
+  using AdditionalData = typename MatrixFreeData::AdditionalData;
+  AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme = AdditionalData::none;
+  additional_data.mapping_update_flags = dealii::update_gradients | dealii::update_JxW_values;
+  additional_data.mapping_update_flags_boundary_faces = dealii::update_values | dealii::update_JxW_values;
+  const dealii::QGauss<1> quadrature(polynomial_degree + 1);
+
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+  matrix_free_data_ptr_ = std::make_shared<MatrixFreeData>();
+  matrix_free_data_ptr_->reinit(mapping_, dof_handler_, constraints, quadrature, additional_data);
+  matrix_free_data_ptr_->initialize_dof_vector(src_scratch_);
+  matrix_free_data_ptr_->initialize_dof_vector(dst_scratch_);
+
+  operators_ = std::vector<LevelOperator>(total_groups_);
+  for (int group = 0; group < total_groups_; ++group) {
+    operators_[group].initialize(matrix_free_data_ptr_);
+    operators_[group].SetCoefficients(diffusion_coefficient_[group], removal_cross_section_[group],
+                                      reflective_boundary_ids_);
+  }
+
+  // Level data is shared by the multigrid hierarchy of each group
+  n_levels_ = dof_handler_.get_triangulation().n_global_levels();
+  mg_constrained_dofs_.initialize(dof_handler_);
+  level_matrix_free_data_.resize(0, n_levels_ - 1);
+  for (unsigned int level = 0; level < n_levels_; ++level) {
+    AdditionalData level_additional_data{ additional_data };
+    level_additional_data.mg_level = level;
+    level_matrix_free_data_[level] = std::make_shared<MatrixFreeData>();
+    level_matrix_free_data_[level]->reinit(mapping_, dof_handler_, constraints, quadrature, level_additional_data);
+  }
+  mg_transfer_.initialize_constraints(mg_constrained_dofs_);
+  mg_transfer_.build(dof_handler_);
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeOperator<dim, fe_degree>::GetOperatorPtr(const system::Index index)
+-> dealii::PETScWrappers::MatrixBase* {
+  ValidateIndex(index, __FUNCTION__);
+  auto& shell_matrix_ptr = shell_matrices_[index];
+  if (shell_matrix_ptr == nullptr)
+    shell_matrix_ptr = std::make_unique<ShellMatrix>(*this, index, communicator_, n_dofs_, n_locally_owned_dofs_);
+  return shell_matrix_ptr.get();
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeOperator<dim, fe_degree>::GetPreconditionerPtr(const system::Index index)
+-> dealii::PETScWrappers::PreconditionerBase* {
+  ValidateIndex(index, __FUNCTION__);
+  return BuildGroupMultigrid(index).petsc_preconditioner_ptr.get();
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeOperator<dim, fe_degree>::Apply(const system::Index index,
+                                                        DistributedVector& dst,
+                                                        const DistributedVector& src) const -> void {
+  ValidateIndex(index, __FUNCTION__);
+  operators_[index.first].vmult(dst, src);
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeOperator<dim, fe_degree>::Apply(const system::Index index,
+                                                        PETScVector& dst,
+                                                        const PETScVector& src,
+                                                        const bool add_to_destination) const -> void {
+  CopyToScratch(src, __FUNCTION__);
+  Apply(index, dst_scratch_, src_scratch_);
+  CopyFromScratch(dst, add_to_destination, __FUNCTION__);
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeOperator<dim, fe_degree>::ApplyPreconditioner(const system::Index index,
+                                                                      PETScVector& dst,
+                                                                      const PETScVector& src) -> void {
+  auto& group_multigrid = BuildGroupMultigrid(index);
+  CopyToScratch(src, __FUNCTION__);
+  group_multigrid.preconditioner_ptr->vmult(dst_scratch_, src_scratch_);
+  CopyFromScratch(dst, false, __FUNCTION__);
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeOperator<dim, fe_degree>::BuildGroupMultigrid(const system::Index index) -> GroupMultigrid& {
+  ValidateIndex(index, __FUNCTION__);
+  const int group{ index.first };
+  auto& group_multigrid_ptr = group_multigrids_[group];
+  if (group_multigrid_ptr != nullptr)
+    return *group_multigrid_ptr;
+
+  group_multigrid_ptr = std::make_unique<GroupMultigrid>();
+  auto& group_multigrid = *group_multigrid_ptr;
+  auto& level_operators = group_multigrid.level_operators;
+
+  level_operators.resize(0, n_levels_ - 1);
+  dealii::MGLevelObject<typename Smoother::AdditionalData> smoother_data(0, n_levels_ - 1);
+  for (unsigned int level = 0; level < n_levels_; ++level) {
+    level_operators[level].initialize(level_matrix_free_data_[level], mg_constrained_dofs_, level);
+    level_operators[level].SetCoefficients(diffusion_coefficient_[group], removal_cross_section_[group],
+                                           reflective_boundary_ids_);
+    level_operators[level].compute_diagonal();
+
+    // The coarsest level is solved by the Chebyshev iteration itself
+    if (level > 0) {
+      smoother_data[level].smoothing_range = 15.0;
+      smoother_data[level].degree = 5;
+      smoother_data[level].eig_cg_n_iterations = 10;
+    } else {
+      smoother_data[level].smoothing_range = 1e-3;
+      smoother_data[level].degree = dealii::numbers::invalid_unsigned_int;
+      smoother_data[level].eig_cg_n_iterations = level_operators[level].m();
+    }
+    smoother_data[level].preconditioner = level_operators[level].get_matrix_diagonal_inverse();
+  }
+
+  group_multigrid.level_matrices.initialize(level_operators);
+  group_multigrid.smoother.initialize(level_operators, smoother_data);
+  group_multigrid.coarse_grid_solver.initialize(group_multigrid.smoother);
+  group_multigrid.multigrid_ptr = std::make_unique<dealii::Multigrid<DistributedVector>>(
+      group_multigrid.level_matrices, group_multigrid.coarse_grid_solver, mg_transfer_, group_multigrid.smoother,
+      group_multigrid.smoother);
+  group_multigrid.preconditioner_ptr = std::make_unique<dealii::PreconditionMG<dim, DistributedVector, Transfer>>(
+      dof_handler_, *group_multigrid.multigrid_ptr, mg_transfer_);
+  group_multigrid.shell_preconditioner_ptr = std::make_unique<ShellPreconditioner>(*this, system::Index{group, 0});
+  group_multigrid.petsc_preconditioner_ptr = std::make_unique<dealii::PETScWrappers::PreconditionShell>(
+      communicator_, *group_multigrid.shell_preconditioner_ptr);
+  return group_multigrid;
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeOperator<dim, fe_degree>::CopyToScratch(const PETScVector& src,
+                                                                std::string called_function_name) const -> void {
+  std::string error_start{ "Error in DiffusionMatrixFreeOperator function " + called_function_name + ": " };
+  AssertThrow(src.locally_owned_size() == n_locally_owned_dofs_,
+              dealii::ExcMessage(error_start + "vector size does not match the locally owned degrees of freedom"))
+
+  // Locally owned entries of both vector types are stored contiguously in the same order
+  const Vec& src_vector = src;
+  const PetscScalar* src_values{ nullptr };
+  PetscErrorCode error_code = VecGetArrayRead(src_vector, &src_values);
+  AssertThrow(error_code == 0, dealii::ExcMessage(error_start + "failed to access source vector"))
+  std::copy(src_values, src_values + n_locally_owned_dofs_, src_scratch_.begin());
+  error_code = VecRestoreArrayRead(src_vector, &src_values);
+  AssertThrow(error_code == 0, dealii::ExcMessage(error_start + "failed to restore source vector"))
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeOperator<dim, fe_degree>::CopyFromScratch(PETScVector& dst,
+                                                                  const bool add_to_destination,
+                                                                  std::string called_function_name) const -> void {
+  std::string error_start{ "Error in DiffusionMatrixFreeOperator function " + called_function_name + ": " };
+  AssertThrow(dst.locally_owned_size() == n_locally_owned_dofs_,
+              dealii::ExcMessage(error_start + "vector size does not match the locally owned degrees of freedom"))
+
+  const Vec& dst_vector = dst;
+  PetscScalar* dst_values{ nullptr };
+  PetscErrorCode error_code = VecGetArray(dst_vector, &dst_values);
+  AssertThrow(error_code == 0, dealii::ExcMessage(error_start + "failed to access destination vector"))
+  if (add_to_destination) {
+    std::transform(dst_scratch_.begin(), dst_scratch_.end(), dst_values, dst_values, std::plus<>());
+  } else {
+    std::copy(dst_scratch_.begin(), dst_scratch_.end(), dst_values);
+  }
+  error_code = VecRestoreArray(dst_vector, &dst_values);
+  AssertThrow(error_code == 0, dealii::ExcMessage(error_start + "failed to restore destination vector"))
+}
+
+template<int dim, int fe_degree>
+auto DiffusionMatrixFreeOperator<dim, fe_degree>::ValidateIndex(const system::Index index,
+                                                                std::string called_function_name) const -> void {
+  const auto [group, angle] = index;
+  std::string error_start{ "Error in DiffusionMatrixFreeOperator function " + called_function_name + ": " };
+  AssertThrow(group >= 0 && group < total_groups_,
+              dealii::ExcMessage(error_start + "group index is out of range"))
+  AssertThrow(angle == 0, dealii::ExcMessage(error_start + "angle index must be 0 for a scalar formulation"))
+}
+
+// SHELL MATRIX ========================================================================================================
+
+template<int dim, int fe_degree>
+DiffusionMatrixFreeOperator<dim, fe_degree>::ShellMatrix::ShellMatrix(const DiffusionMatrixFreeOperator& parent,
+                                                                      const system::Index index,
+                                                                      const MPI_Comm& communicator,
+                                                                      const unsigned int n_dofs,
+                                                                      const unsigned int n_locally_owned_dofs)
+    : dealii::PETScWrappers::MatrixFree(communicator, n_dofs, n_dofs, n_locally_owned_dofs, n_locally_owned_dofs),
+      parent_(parent),
+      index_(index) {}
+
+template<int dim, int fe_degree>
+void DiffusionMatrixFreeOperator<dim, fe_degree>::ShellMatrix::vmult(PETScVector& dst,
+                                                                     const PETScVector& src) const {
+  parent_.Apply(index_, dst, src);
+}
+
+template<int dim, int fe_degree>
+void DiffusionMatrixFreeOperator<dim, fe_degree>::ShellMatrix::Tvmult(PETScVector& dst,
+                                                                      const PETScVector& src) const {
+  parent_.Apply(index_, dst, src);
+}
+
+template<int dim, int fe_degree>
+void DiffusionMatrixFreeOperator<dim, fe_degree>::ShellMatrix::vmult_add(PETScVector& dst,
+                                                                         const PETScVector& src) const {
+  parent_.Apply(index_, dst, src, true);
+}
+
+template<int dim, int fe_degree>
+void DiffusionMatrixFreeOperator<dim, fe_degree>::ShellMatrix::Tvmult_add(PETScVector& dst,
+                                                                          const PETScVector& src) const {
+  parent_.Apply(index_, dst, src, true);
+}
+
+// FACTORY =============================================================================================================
+
+template<int dim>
+auto MakeDiffusionMatrixFreeOperator(
+    const domain::DomainI<dim>& domain,
+    const std::shared_ptr<data::cross_sections::CrossSectionsI>& cross_sections,
+    const std::set<problem::Boundary>& reflective_boundaries,
+    const int polynomial_degree,
+    const std::shared_ptr<data::cross_sections::OneGroupCrossSectionsI>& one_group_cross_sections)
+-> std::shared_ptr<system::terms::BilinearOperatorI> {
+  switch (polynomial_degree) {
+    case 1:
+      return std::make_shared<DiffusionMatrixFreeOperator<dim, 1>>(domain, cross_sections, reflective_boundaries, 1,
+                                                                   one_group_cross_sections);
+    case 2:
+      return std::make_shared<DiffusionMatrixFreeOperator<dim, 2>>(domain, cross_sections, reflective_boundaries, 2,
+                                                                   one_group_cross_sections);
+    case 3:
+      return std::make_shared<DiffusionMatrixFreeOperator<dim, 3>>(domain, cross_sections, reflective_boundaries, 3,
+                                                                   one_group_cross_sections);
+    default:
+      return std::make_shared<DiffusionMatrixFreeOperator<dim, -1>>(domain, cross_sections, reflective_boundaries,
+                                                                    polynomial_degree, one_group_cross_sections);
+  }
+}
+
+template class DiffusionMatrixFreeLevelOperator<1, -1>;
+template class DiffusionMatrixFreeLevelOperator<1, 1>;
+template class DiffusionMatrixFreeLevelOperator<1, 2>;
+template class DiffusionMatrixFreeLevelOperator<1, 3>;
+template class DiffusionMatrixFreeLevelOperator<2, -1>;
+template class DiffusionMatrixFreeLevelOperator<2, 1>;
+template class DiffusionMatrixFreeLevelOperator<2, 2>;
+template class DiffusionMatrixFreeLevelOperator<2, 3>;
+template class DiffusionMatrixFreeLevelOperator<3, -1>;
+template class DiffusionMatrixFreeLevelOperator<3, 1>;
+template class DiffusionMatrixFreeLevelOperator<3, 2>;
+template class DiffusionMatrixFreeLevelOperator<3, 3>;
+
+template class DiffusionMatrixFreeOperator<1, -1>;
+template class DiffusionMatrixFreeOperator<1, 1>;
+template class DiffusionMatrixFreeOperator<1, 2>;
+template class DiffusionMatrixFreeOperator<1, 3>;
+template class DiffusionMatrixFreeOperator<2, -1>;
+template class DiffusionMatrixFreeOperator<2, 1>;
+template class DiffusionMatrixFreeOperator<2, 2>;
+template class DiffusionMatrixFreeOperator<2, 3>;
+template class DiffusionMatrixFreeOperator<3, -1>;
+template class DiffusionMatrixFreeOperator<3, 1>;
+template class DiffusionMatrixFreeOperator<3, 2>;
+template class DiffusionMatrixFreeOperator<3, 3>;
+
+template auto MakeDiffusionMatrixFreeOperator<1>(
+    const domain::DomainI<1>&, const std::shared_ptr<data::cross_sections::CrossSectionsI>&,
+    const std::set<problem::Boundary>&, int, const std::shared_ptr<data::cross_sections::OneGroupCrossSectionsI>&)
+-> std::shared_ptr<system::terms::BilinearOperatorI>;
+template auto MakeDiffusionMatrixFreeOperator<2>(
+    const domain::DomainI<2>&, const std::shared_ptr<data::cross_sections::CrossSectionsI>&,
+    const std::set<problem::Boundary>&, int, const std::shared_ptr<data::cross_sections::OneGroupCrossSectionsI>&)
+-> std::shared_ptr<system::terms::BilinearOperatorI>;
+template auto MakeDiffusionMatrixFreeOperator<3>(
+    const domain::DomainI<3>&, const std::shared_ptr<data::cross_sections::CrossSectionsI>&,
+    const std::set<problem::Boundary>&, int, const std::shared_ptr<data::cross_sections::OneGroupCrossSectionsI>&)
+-> std::shared_ptr<system::terms::BilinearOperatorI>;
+
+} // namespace bart::formulation::scalar
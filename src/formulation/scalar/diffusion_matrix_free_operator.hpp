@@ -0,0 +1,255 @@
+#ifndef BART_SRC_FORMULATION_SCALAR_DIFFUSION_MATRIX_FREE_OPERATOR_HPP_
+#define BART_SRC_FORMULATION_SCALAR_DIFFUSION_MATRIX_FREE_OPERATOR_HPP_
+
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <deal.II/base/vectorization.h>
+#include <deal.II/fe/mapping_q1.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/petsc_matrix_free.h>
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/operators.h>
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_constrained_dofs.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/mg_transfer_matrix_free.h>
+#include <deal.II/multigrid/multigrid.h>
+
+#include "data/cross_sections/cross_sections_i.hpp"
+#include "data/cross_sections/one_group_cross_sections_i.hpp"
+#include "domain/domain_i.hpp"
+#include "problem/parameter_types.hpp"
+#include "system/terms/bilinear_operator_i.hpp"
+
+namespace bart::formulation::scalar {
+
+/*! \brief Matrix-free diffusion operator on a single multigrid level for a single group.
+ *
+ * Applies
+ * \f[
+ * (\nabla\varphi_i, D_g\nabla\varphi_j) + (\varphi_i, \Sigma_{r,g}\varphi_j)
+ * + \frac{1}{2}\langle\varphi_i, \varphi_j\rangle_{\partial V, \text{vacuum}}
+ * \f]
+ * using the MatrixFree data it is initialized with, either for the active mesh or for a level of the multigrid
+ * hierarchy. The diagonal of the operator is computed for use by the Chebyshev smoothers.
+ *
+ * \tparam dim spatial dimension.
+ * \tparam fe_degree polynomial degree of the finite element, -1 to use the degree set at runtime.
+ */
+template <int dim, int fe_degree = -1>
+class DiffusionMatrixFreeLevelOperator
+    : public dealii::MatrixFreeOperators::Base<dim, dealii::LinearAlgebra::distributed::Vector<double>> {
+ public:
+  using DistributedVector = dealii::LinearAlgebra::distributed::Vector<double>;
+  using MaterialCoefficients = std::unordered_map<int, double>;
+  using MatrixFreeData = dealii::MatrixFree<dim, double>;
+  using VectorizedDouble = dealii::VectorizedArray<double>;
+
+  /*! \brief Sets the coefficients of the operator, must be called after initialize.
+   *
+   * \param diffusion_coefficient diffusion coefficient for each material.
+   * \param removal_cross_section removal cross-section for each material.
+   * \param reflective_boundary_ids boundaries with reflective conditions, all others are vacuum.
+   */
+  auto SetCoefficients(const MaterialCoefficients& diffusion_coefficient,
+                       const MaterialCoefficients& removal_cross_section,
+                       const std::set<dealii::types::boundary_id>& reflective_boundary_ids) -> void;
+
+  void compute_diagonal() override;
+
+ private:
+  using CellRange = std::pair<unsigned int, unsigned int>;
+
+  void apply_add(DistributedVector& dst, const DistributedVector& src) const override;
+
+  auto CellOperation(const MatrixFreeData&, DistributedVector& dst, const DistributedVector& src,
+                     const CellRange& cell_range) const -> void;
+  auto InnerFaceOperation(const MatrixFreeData&, DistributedVector&, const DistributedVector&,
+                          const CellRange&) const -> void {}
+  auto BoundaryOperation(const MatrixFreeData&, DistributedVector& dst, const DistributedVector& src,
+                         const CellRange& face_range) const -> void;
+  auto CellDiagonal(const MatrixFreeData&, DistributedVector& dst, const unsigned int&,
+                    const CellRange& cell_range) const -> void;
+  auto InnerFaceDiagonal(const MatrixFreeData&, DistributedVector&, const unsigned int&,
+                         const CellRange&) const -> void {}
+  auto BoundaryDiagonal(const MatrixFreeData&, DistributedVector& dst, const unsigned int&,
+                        const CellRange& face_range) const -> void;
+  auto IsVacuumFaceBatch(unsigned int face) const -> bool {
+    return is_vacuum_face_batch_[face - this->data->n_inner_face_batches()]; }
+
+  //! Diffusion coefficient for each cell batch
+  std::vector<VectorizedDouble> diffusion_coefficient_{};
+  //! Removal cross-section for each cell batch
+  std::vector<VectorizedDouble> removal_cross_section_{};
+  //! Indicates if each boundary face batch has a vacuum boundary condition
+  std::vector<bool> is_vacuum_face_batch_{};
+};
+
+/*! \brief Matrix-free diffusion left hand side operator with a geometric multigrid preconditioner.
+ *
+ * Applies the same bilinear form that Diffusion (or TwoGridDiffusion, if one-group cross-sections are provided)
+ * stamps into a matrix, for each group, using deal.II MatrixFree sum factorization. The collision term uses the
+ * removal cross-section \f$\Sigma_{t,g} - \Sigma_{s,g\to g}\f$, or the one-group absorption cross-section for two-grid
+ * acceleration.
+ *
+ * Each group is preconditioned by a geometric multigrid V-cycle over the levels created by the global refinement of
+ * the domain, with Chebyshev smoothing on each level and a Chebyshev solve on the coarsest level. The level operators
+ * are also matrix-free, so a preconditioned solve is close to linear in the number of degrees of freedom. The
+ * multigrid hierarchy for a group is built the first time its preconditioner is requested. The operator is
+ * symmetric, so the transpose product is the product.
+ *
+ * The domain must be built with a multigrid hierarchy, so that it has level degrees of freedom. Hanging node
+ * constraints are not applied, matching the assembled formulation.
+ *
+ * \tparam dim spatial dimension.
+ * \tparam fe_degree polynomial degree of the finite element, -1 to use the degree set at runtime.
+ */
+template <int dim, int fe_degree = -1>
+class DiffusionMatrixFreeOperator : public system::terms::BilinearOperatorI {
+ public:
+  using CrossSections = data::cross_sections::CrossSectionsI;
+  using DistributedVector = dealii::LinearAlgebra::distributed::Vector<double>;
+  using Domain = domain::DomainI<dim>;
+  using LevelOperator = DiffusionMatrixFreeLevelOperator<dim, fe_degree>;
+  using OneGroupCrossSections = data::cross_sections::OneGroupCrossSectionsI;
+  using PETScVector = dealii::PETScWrappers::VectorBase;
+
+  /*! \brief Constructor.
+   *
+   * \param domain domain built with a multigrid hierarchy, that has had its degrees of freedom set up.
+   * \param cross_sections cross-sections for all materials in the domain.
+   * \param reflective_boundaries boundaries with reflective conditions, all others are vacuum.
+   * \param polynomial_degree polynomial degree of the finite element, must match fe_degree if that is not -1.
+   * \param one_group_cross_sections if provided, the absorption cross-section is used for the collision term as in
+   *        TwoGridDiffusion.
+   */
+  DiffusionMatrixFreeOperator(const Domain& domain,
+                              const std::shared_ptr<CrossSections>& cross_sections,
+                              const std::set<problem::Boundary>& reflective_boundaries,
+                              int polynomial_degree,
+                              const std::shared_ptr<OneGroupCrossSections>& one_group_cross_sections = nullptr);
+
+  auto GetOperatorPtr(system::Index index) -> dealii::PETScWrappers::MatrixBase* override;
+  auto GetPreconditionerPtr(system::Index index) -> dealii::PETScWrappers::PreconditionerBase* override;
+
+  /*! \brief Applies the operator for a group, \f$\text{dst} = A_g\,\text{src}\f$. */
+  auto Apply(system::Index index, DistributedVector& dst, const DistributedVector& src) const -> void;
+  /*! \brief Applies the operator for a group to PETSc vectors.
+   *
+   * If add_to_destination is true the product is added to dst, otherwise dst is overwritten.
+   */
+  auto Apply(system::Index index, PETScVector& dst, const PETScVector& src, bool add_to_destination = false) const
+  -> void;
+  /*! \brief Applies one multigrid V-cycle for a group to PETSc vectors, building the hierarchy if required. */
+  auto ApplyPreconditioner(system::Index index, PETScVector& dst, const PETScVector& src) -> void;
+
+  auto total_groups() const -> int { return total_groups_; }
+  auto n_levels() const -> unsigned int { return n_levels_; }
+
+ private:
+  /*! \brief PETSc shell matrix for a single group that forwards products to the parent operator. */
+  class ShellMatrix : public dealii::PETScWrappers::MatrixFree {
+   public:
+    ShellMatrix(const DiffusionMatrixFreeOperator& parent, system::Index index, const MPI_Comm& communicator,
+                unsigned int n_dofs, unsigned int n_locally_owned_dofs);
+    using dealii::PETScWrappers::MatrixFree::vmult;
+    void vmult(PETScVector& dst, const PETScVector& src) const override;
+    void Tvmult(PETScVector& dst, const PETScVector& src) const override;
+    void vmult_add(PETScVector& dst, const PETScVector& src) const override;
+    void Tvmult_add(PETScVector& dst, const PETScVector& src) const override;
+   private:
+    const DiffusionMatrixFreeOperator& parent_;
+    const system::Index index_;
+  };
+
+  /*! \brief Forwards a PETSc preconditioner application to the multigrid V-cycle of a group. */
+  class ShellPreconditioner {
+   public:
+    ShellPreconditioner(DiffusionMatrixFreeOperator& parent, system::Index index)
+        : parent_(parent), index_(index) {}
+    void vmult(PETScVector& dst, const PETScVector& src) const { parent_.ApplyPreconditioner(index_, dst, src); }
+    void Tvmult(PETScVector& dst, const PETScVector& src) const { parent_.ApplyPreconditioner(index_, dst, src); }
+   private:
+    DiffusionMatrixFreeOperator& parent_;
+    const system::Index index_;
+  };
+
+  using MatrixFreeData = dealii::MatrixFree<dim, double>;
+  using MaterialCoefficients = typename LevelOperator::MaterialCoefficients;
+  using Smoother = dealii::PreconditionChebyshev<LevelOperator, DistributedVector>;
+  using Transfer = dealii::MGTransferMatrixFree<dim, double>;
+
+  /*! \brief Multigrid hierarchy for a single group, members refer to each other so this is never moved. */
+  struct GroupMultigrid {
+    dealii::MGLevelObject<LevelOperator> level_operators;
+    dealii::mg::Matrix<DistributedVector> level_matrices;
+    dealii::MGSmootherPrecondition<LevelOperator, Smoother, DistributedVector> smoother;
+    dealii::MGCoarseGridApplySmoother<DistributedVector> coarse_grid_solver;
+    std::unique_ptr<dealii::Multigrid<DistributedVector>> multigrid_ptr;
+    std::unique_ptr<dealii::PreconditionMG<dim, DistributedVector, Transfer>> preconditioner_ptr;
+    std::unique_ptr<ShellPreconditioner> shell_preconditioner_ptr;
+    std::unique_ptr<dealii::PETScWrappers::PreconditionShell> petsc_preconditioner_ptr;
+  };
+
+  auto ValidateIndex(system::Index index, std::string called_function_name) const -> void;
+  auto BuildGroupMultigrid(system::Index index) -> GroupMultigrid&;
+  auto CopyToScratch(const PETScVector& src, std::string called_function_name) const -> void;
+  auto CopyFromScratch(PETScVector& dst, bool add_to_destination, std::string called_function_name) const -> void;
+
+  const dealii::MappingQ1<dim> mapping_{};
+  const dealii::DoFHandler<dim>& dof_handler_;
+  const int total_groups_{ 0 };
+  const unsigned int n_dofs_{ 0 };
+  const unsigned int n_locally_owned_dofs_{ 0 };
+  //! Communicator of the domain system vectors, used for the shell matrices and preconditioners
+  const MPI_Comm communicator_;
+  unsigned int n_levels_{ 0 };
+  //! Diffusion coefficient for each group and material
+  std::vector<MaterialCoefficients> diffusion_coefficient_{};
+  //! Removal cross-section for each group and material
+  std::vector<MaterialCoefficients> removal_cross_section_{};
+  std::set<dealii::types::boundary_id> reflective_boundary_ids_{};
+
+  //! MatrixFree data on the active mesh
+  std::shared_ptr<MatrixFreeData> matrix_free_data_ptr_{ nullptr };
+  //! MatrixFree data on each level, shared by all groups
+  dealii::MGLevelObject<std::shared_ptr<MatrixFreeData>> level_matrix_free_data_{};
+  dealii::MGConstrainedDoFs mg_constrained_dofs_{};
+  Transfer mg_transfer_{};
+
+  //! Operator on the active mesh for each group
+  std::vector<LevelOperator> operators_{};
+  //! Multigrid hierarchies, created the first time a group preconditioner is requested
+  std::map<int, std::unique_ptr<GroupMultigrid>> group_multigrids_{};
+  //! Shell matrices, created the first time an index is requested
+  std::map<system::Index, std::unique_ptr<ShellMatrix>> shell_matrices_{};
+  //! Scratch vectors used to apply the operator and preconditioner to PETSc vectors
+  mutable DistributedVector src_scratch_{}, dst_scratch_{};
+};
+
+/*! \brief Builds a matrix-free diffusion operator for the given polynomial degree.
+ *
+ * Polynomial degrees 1 to 3 use compile-time degrees so that the sum factorization kernels are fully specialized,
+ * other degrees use the runtime degree implementation.
+ */
+template <int dim>
+auto MakeDiffusionMatrixFreeOperator(
+    const domain::DomainI<dim>& domain,
+    const std::shared_ptr<data::cross_sections::CrossSectionsI>& cross_sections,
+    const std::set<problem::Boundary>& reflective_boundaries,
+    int polynomial_degree,
+    const std::shared_ptr<data::cross_sections::OneGroupCrossSectionsI>& one_group_cross_sections = nullptr)
+-> std::shared_ptr<system::terms::BilinearOperatorI>;
+
+} // namespace bart::formulation::scalar
+
+#endif //BART_SRC_FORMULATION_SCALAR_DIFFUSION_MATRIX_FREE_OPERATOR_HPP_
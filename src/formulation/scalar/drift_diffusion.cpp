@@ -20,6 +20,7 @@ DriftDiffusion<dim>::DriftDiffusion(std::shared_ptr<FiniteElement> finite_elemen
   cell_quadrature_points_ = finite_element_ptr_->n_cell_quad_pts();
   cell_degrees_of_freedom_ = finite_element_ptr_->dofs_per_cell();
   face_quadrature_points_ = finite_element_ptr_->n_face_quad_pts();
+  cell_kernels_ = &finite_element_ptr_->cell_kernels();
 }
 
 template <int dim>
@@ -44,8 +45,8 @@ auto DriftDiffusion<dim>::FillCellBoundaryTerm(Matrix& to_fill,
                                                const BoundaryType boundary_type,
                                                const VectorMap& group_angular_flux) const -> void {
   std::string error_prefix{"Error in DriftDiffusion<dim>::FillCellBoundaryTerm: matrix to fill has wrong "};
-  AssertThrow(static_cast<int>(to_fill.m()) == cell_quadrature_points_, dealii::ExcMessage(error_prefix + "m()"))
-  AssertThrow(static_cast<int>(to_fill.n()) == cell_quadrature_points_, dealii::ExcMessage(error_prefix + "n()"))
+  AssertThrow(static_cast<int>(to_fill.m()) == cell_degrees_of_freedom_, dealii::ExcMessage(error_prefix + "m()"))
+  AssertThrow(static_cast<int>(to_fill.n()) == cell_degrees_of_freedom_, dealii::ExcMessage(error_prefix + "n()"))
 
   if (boundary_type == BoundaryType::kVacuum) {
     finite_element_ptr_->SetFace(cell_ptr, face_index);
@@ -67,18 +68,20 @@ auto DriftDiffusion<dim>::FillCellBoundaryTerm(Matrix& to_fill,
       }
     }
 
-    auto boundary_factor_at_q{finite_element_ptr_->ValueAtFaceQuadrature(boundary_factor_at_global_dofs)};
+    const auto weights = scratch_arena_.Get(kWeightBuffer, face_quadrature_points_);
+    finite_element_ptr_->ValueAtFaceQuadrature(boundary_factor_at_global_dofs, weights);
 
+    const auto face_shape_values = scratch_arena_.Get(kShapeValueBuffer,
+                                                      face_quadrature_points_ * cell_degrees_of_freedom_);
     for (int face_q = 0; face_q < face_quadrature_points_; ++face_q) {
-      const double jacobian{finite_element_ptr_->FaceJacobian(face_q)};
-      for (int dof_i = 0; dof_i < cell_degrees_of_freedom_; ++dof_i) {
-        auto shape_value_i{finite_element_ptr_->FaceShapeValue(dof_i, face_q)};
-        for (int dof_j = 0; dof_j < cell_degrees_of_freedom_; ++dof_j) {
-          to_fill(dof_i, dof_j) += shape_value_i * finite_element_ptr_->FaceShapeValue(dof_j, face_q)
-              * boundary_factor_at_q.at(face_q) * jacobian;
-        }
-      }
+      weights[face_q] *= finite_element_ptr_->FaceJacobian(face_q);
+      for (int dof_i = 0; dof_i < cell_degrees_of_freedom_; ++dof_i)
+        face_shape_values[face_q * cell_degrees_of_freedom_ + dof_i] =
+            finite_element_ptr_->FaceShapeValue(dof_i, face_q);
     }
+
+    cell_kernels_->face_weighted_outer_product_sum(&to_fill(0, 0), weights.data(), face_shape_values.data(),
+                                                   cell_degrees_of_freedom_, face_quadrature_points_);
   }
 }
 
@@ -89,27 +92,29 @@ auto DriftDiffusion<dim>::FillCellDriftDiffusionTerm(Matrix &to_fill,
                                                      const Vector &group_scalar_flux,
                                                      const std::array<Vector, dim> &current) const -> void {
   std::string error_prefix{"Error in DriftDiffusion<dim>::FillCellDriftDiffusionTerm: matrix to fill has wrong "};
-  AssertThrow(static_cast<int>(to_fill.m()) == cell_quadrature_points_, dealii::ExcMessage(error_prefix + "m()"))
-  AssertThrow(static_cast<int>(to_fill.n()) == cell_quadrature_points_, dealii::ExcMessage(error_prefix + "n()"))
+  AssertThrow(static_cast<int>(to_fill.m()) == cell_degrees_of_freedom_, dealii::ExcMessage(error_prefix + "m()"))
+  AssertThrow(static_cast<int>(to_fill.n()) == cell_degrees_of_freedom_, dealii::ExcMessage(error_prefix + "n()"))
 
   finite_element_ptr_->SetCell(cell_ptr);
   const auto material_id{ cell_ptr->material_id() };
   const double diffusion_coeff{ cross_sections_ptr_->diffusion_coef().at(material_id).at(group.get()) };
-  const auto scalar_flux_at_q{ finite_element_ptr_->ValueAtQuadrature(group_scalar_flux) };
+  const auto scalar_flux_at_q = scratch_arena_.Get(kScalarFluxBuffer, cell_quadrature_points_);
+  finite_element_ptr_->ValueAtQuadrature(group_scalar_flux, scalar_flux_at_q);
 
-  std::array<std::vector<double>, dim> current_components_at_q;
+  std::array<std::span<double>, dim> current_components_at_q;
   for (int i = 0; i < dim; ++i) {
-    current_components_at_q.at(i) = finite_element_ptr_->ValueAtQuadrature(current.at(i));
+    current_components_at_q.at(i) = scratch_arena_.Get(kCurrentBuffer + i, cell_quadrature_points_);
+    finite_element_ptr_->ValueAtQuadrature(current.at(i), current_components_at_q.at(i));
   }
 
   for (int q = 0; q < cell_quadrature_points_; ++q) {
     const double jacobian{ finite_element_ptr_->Jacobian(q) };
     dealii::Tensor<1, dim> current_vector_at_quadrature_point;
     for (int dir = 0; dir < dim; ++dir)
-      current_vector_at_quadrature_point[dir] = current_components_at_q.at(dir).at(q);
+      current_vector_at_quadrature_point[dir] = current_components_at_q.at(dir)[q];
     for (int i = 0; i < cell_degrees_of_freedom_; ++i) {
       const auto drift_diffusion{drift_diffusion_calculator_ptr_->DriftDiffusionVector(
-          scalar_flux_at_q.at(q),
+          scalar_flux_at_q[q],
           current_vector_at_quadrature_point,
           finite_element_ptr_->ShapeGradient(i, q),
           diffusion_coeff)};
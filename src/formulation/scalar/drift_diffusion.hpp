@@ -10,6 +10,7 @@
 #include "data/cross_sections/material_cross_sections.hpp"
 #include "domain/finite_element/finite_element_i.hpp"
 #include "utility/has_dependencies.h"
+#include "utility/scratch_arena.hpp"
 
 namespace bart::formulation::scalar {
 
@@ -58,6 +59,13 @@ class DriftDiffusion : public DriftDiffusionI<dim>, public utility::HasDependenc
   int cell_quadrature_points_{ 0 };
   int cell_degrees_of_freedom_{ 0 };
   int face_quadrature_points_{ 0 };
+  //! Kernels used to integrate face terms, provided by the finite element
+  const domain::finite_element::CellKernels* cell_kernels_{ nullptr };
+  //! Buffers for values at quadrature points, so that filling terms does not allocate
+  mutable utility::ScratchArena scratch_arena_{};
+  //! Scratch buffer indices, the current uses buffers kCurrentBuffer to kCurrentBuffer + dim - 1
+  enum ScratchBuffer : std::size_t { kScalarFluxBuffer = 0, kWeightBuffer = 1, kShapeValueBuffer = 2,
+                                     kCurrentBuffer = 3 };
  private:
   static bool is_registered_;
 };
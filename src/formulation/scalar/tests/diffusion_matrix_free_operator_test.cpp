@@ -0,0 +1,220 @@
+#include "formulation/scalar/diffusion_matrix_free_operator.hpp"
+
+#include <array>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/petsc_solver.h>
+#include <deal.II/lac/solver_control.h>
+
+#include "data/cross_sections/material_cross_sections.hpp"
+#include "data/material/tests/material_mock.hpp"
+#include "domain/domain.hpp"
+#include "domain/finite_element/finite_element_gaussian.hpp"
+#include "domain/mesh/mesh_cartesian.hpp"
+#include "formulation/scalar/diffusion.hpp"
+#include "formulation/stamper.hpp"
+#include "formulation/updater/diffusion_updater.hpp"
+#include "problem/parameter_types.hpp"
+#include "system/system.hpp"
+#include "system/terms/term.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_helper_functions.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::NiceMock, ::testing::Return;
+
+/* Tests for the matrix-free diffusion operator. The operator applied through its PETSc shell matrix is compared to the
+ * fixed matrix assembled by DiffusionUpdater::UpdateFixedTerms, using a real domain with two materials and real
+ * cross-sections and formulation. The multigrid preconditioner is checked by the number of conjugate gradient
+ * iterations it saves.
+ */
+template <typename DimensionWrapper>
+class FormulationScalarDiffusionMatrixFreeOperatorTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using Boundary = problem::Boundary;
+  using Domain = domain::Domain<dim>;
+  using FiniteElement = domain::finite_element::FiniteElementGaussian<dim>;
+  using Matrix = dealii::FullMatrix<double>;
+  using Updater = formulation::updater::DiffusionUpdater<dim>;
+
+  // Test parameters
+  static constexpr int total_groups_{ 2 };
+  const std::unordered_map<int, std::vector<double>> diffusion_coef_{{0, {1.0, 0.5}}, {1, {2.0, 0.25}}};
+  const std::unordered_map<int, std::vector<double>> sigma_t_{{0, {1.0, 2.0}}, {1, {0.5, 4.0}}};
+  const std::unordered_map<int, Matrix> sigma_s_{
+      {0, Matrix(2, 2, std::array<double, 4>{0.5, 0.0, 0.2, 1.0}.begin())},
+      {1, Matrix(2, 2, std::array<double, 4>{0.1, 0.0, 0.3, 3.0}.begin())}};
+
+  // Test objects
+  std::shared_ptr<Domain> domain_ptr_;
+  std::shared_ptr<FiniteElement> finite_element_ptr_;
+  std::shared_ptr<data::cross_sections::CrossSectionsI> cross_sections_ptr_;
+  NiceMock<data::material::MaterialMock> mock_material_;
+
+  void SetUp() override;
+  // Builds and sets up a domain with a multigrid hierarchy, n_cells per direction are globally refined
+  auto SetUpDomain(int polynomial_degree, double spatial_max, int n_cells, int global_refinements) -> void;
+  auto ExpectOperatorMatchesFixedTerms(const std::unordered_set<Boundary>& reflective_boundaries) -> void;
+  // Material mapping with both materials on each boundary
+  static auto MaterialMapping() -> std::string;
+};
+
+template <typename DimensionWrapper>
+auto FormulationScalarDiffusionMatrixFreeOperatorTest<DimensionWrapper>::MaterialMapping() -> std::string {
+  if (dim == 1)
+    return "0 1";
+  if (dim == 2)
+    return "0 1\n1 0";
+  return "0 1\n1 0\n\n1 0\n0 1";
+}
+
+template <typename DimensionWrapper>
+void FormulationScalarDiffusionMatrixFreeOperatorTest<DimensionWrapper>::SetUp() {
+  ON_CALL(mock_material_, GetDiffusionCoef()).WillByDefault(Return(diffusion_coef_));
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t_));
+  ON_CALL(mock_material_, GetSigS()).WillByDefault(Return(sigma_s_));
+  cross_sections_ptr_ = std::make_shared<data::cross_sections::MaterialCrossSections>(mock_material_);
+}
+
+template <typename DimensionWrapper>
+auto FormulationScalarDiffusionMatrixFreeOperatorTest<DimensionWrapper>::SetUpDomain(
+    const int polynomial_degree, const double spatial_max, const int n_cells, const int global_refinements) -> void {
+  finite_element_ptr_ = std::make_shared<FiniteElement>(problem::DiscretizationType::kContinuousFEM,
+                                                        polynomial_degree);
+  auto mesh_ptr = std::make_unique<domain::mesh::MeshCartesian<dim>>(std::vector<double>(dim, spatial_max),
+                                                                     std::vector<int>(dim, n_cells),
+                                                                     MaterialMapping());
+  domain_ptr_ = std::make_shared<Domain>(std::move(mesh_ptr), finite_element_ptr_,
+                                         problem::DiscretizationType::kContinuousFEM, true);
+  domain_ptr_->SetUpMesh(global_refinements).SetUpDOF();
+}
+
+template <typename DimensionWrapper>
+auto FormulationScalarDiffusionMatrixFreeOperatorTest<DimensionWrapper>::ExpectOperatorMatchesFixedTerms(
+    const std::unordered_set<Boundary>& reflective_boundaries) -> void {
+  const int polynomial_degree{ 2 };
+  SetUpDomain(polynomial_degree, 2.0, 4, 1);
+
+  system::System test_system;
+  auto left_hand_side_ptr = std::make_unique<system::terms::MPIBilinearTerm>();
+  auto right_hand_side_ptr = std::make_unique<system::terms::MPILinearTerm>();
+  for (int group = 0; group < total_groups_; ++group) {
+    left_hand_side_ptr->SetFixedTermPtr({group, 0}, domain_ptr_->MakeSystemMatrix());
+    right_hand_side_ptr->SetFixedTermPtr({group, 0}, domain_ptr_->MakeSystemVector());
+  }
+  test_system.left_hand_side_ptr_ = std::move(left_hand_side_ptr);
+  test_system.right_hand_side_ptr_ = std::move(right_hand_side_ptr);
+  test_system.total_groups = total_groups_;
+  test_system.total_angles = 1;
+
+  auto formulation_ptr = std::make_unique<formulation::scalar::Diffusion<dim>>(finite_element_ptr_,
+                                                                               cross_sections_ptr_);
+  formulation_ptr->Precalculate(domain_ptr_->Cells().at(0));
+  Updater updater(std::move(formulation_ptr), std::make_shared<formulation::Stamper<dim>>(domain_ptr_),
+                  reflective_boundaries);
+
+  const std::set<Boundary> operator_reflective_boundaries(reflective_boundaries.cbegin(),
+                                                          reflective_boundaries.cend());
+  auto operator_ptr = formulation::scalar::MakeDiffusionMatrixFreeOperator<dim>(
+      *domain_ptr_, cross_sections_ptr_, operator_reflective_boundaries, polynomial_degree);
+
+  auto source_ptr = domain_ptr_->MakeSystemVector();
+  auto expected_ptr = domain_ptr_->MakeSystemVector();
+  auto result_ptr = domain_ptr_->MakeSystemVector();
+  for (const auto dof : domain_ptr_->locally_owned_dofs())
+    (*source_ptr)(dof) = test_helpers::RandomDouble(-1, 1);
+  source_ptr->compress(dealii::VectorOperation::insert);
+
+  for (int group = 0; group < total_groups_; ++group) {
+    updater.UpdateFixedTerms(test_system, system::EnergyGroup(group), quadrature::QuadraturePointIndex(0));
+    test_system.left_hand_side_ptr_->GetFixedTermPtr({group, 0})->vmult(*expected_ptr, *source_ptr);
+    operator_ptr->GetOperatorPtr({group, 0})->vmult(*result_ptr, *source_ptr);
+    for (const auto dof : domain_ptr_->locally_owned_dofs()) {
+      EXPECT_NEAR((*result_ptr)(dof), (*expected_ptr)(dof), 1e-10) << "group " << group << ", degree of freedom "
+                                                                   << dof;
+    }
+  }
+}
+
+TYPED_TEST_SUITE(FormulationScalarDiffusionMatrixFreeOperatorTest, bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationScalarDiffusionMatrixFreeOperatorTest, Constructor) {
+  constexpr int dim = this->dim;
+  this->SetUpDomain(1, 2.0, 4, 2);
+  formulation::scalar::DiffusionMatrixFreeOperator<dim> test_operator(*this->domain_ptr_, this->cross_sections_ptr_,
+                                                                      {}, 1);
+  EXPECT_EQ(test_operator.total_groups(), this->total_groups_);
+  EXPECT_EQ(test_operator.n_levels(), 3u);
+  EXPECT_ANY_THROW({
+    formulation::scalar::DiffusionMatrixFreeOperator<dim> bad_operator(*this->domain_ptr_, this->cross_sections_ptr_,
+                                                                       {}, 2);
+  });
+}
+
+TYPED_TEST(FormulationScalarDiffusionMatrixFreeOperatorTest, ConstructorNoMultigridHierarchy) {
+  constexpr int dim = this->dim;
+  auto finite_element_ptr = std::make_shared<typename TestFixture::FiniteElement>(
+      problem::DiscretizationType::kContinuousFEM, 1);
+  auto mesh_ptr = std::make_unique<domain::mesh::MeshCartesian<dim>>(std::vector<double>(dim, 2.0),
+                                                                     std::vector<int>(dim, 4),
+                                                                     this->MaterialMapping());
+  domain::Domain<dim> test_domain(std::move(mesh_ptr), finite_element_ptr);
+  test_domain.SetUpMesh(1).SetUpDOF();
+  EXPECT_ANY_THROW({
+    formulation::scalar::DiffusionMatrixFreeOperator<dim> bad_operator(test_domain, this->cross_sections_ptr_, {}, 1);
+  });
+}
+
+TYPED_TEST(FormulationScalarDiffusionMatrixFreeOperatorTest, MatchesFixedTermsVacuumBoundaries) {
+  this->ExpectOperatorMatchesFixedTerms({});
+}
+
+TYPED_TEST(FormulationScalarDiffusionMatrixFreeOperatorTest, MatchesFixedTermsReflectiveBoundaries) {
+  using Boundary = problem::Boundary;
+  this->ExpectOperatorMatchesFixedTerms({Boundary::kXMin, Boundary::kYMax});
+}
+
+TYPED_TEST(FormulationScalarDiffusionMatrixFreeOperatorTest, MultigridReducesIterations) {
+  constexpr int dim = this->dim;
+  // Fine cells compared to the diffusion length, so that the unpreconditioned iterations grow with the number of cells
+  const std::array<int, 3> global_refinements{ 6, 4, 3 };
+  this->SetUpDomain(1, 2.0, 2, global_refinements.at(dim - 1));
+  auto operator_ptr = formulation::scalar::MakeDiffusionMatrixFreeOperator<dim>(
+      *this->domain_ptr_, this->cross_sections_ptr_, {problem::Boundary::kXMin}, 1);
+
+  for (int group = 0; group < this->total_groups_; ++group) {
+    auto& system_matrix = *operator_ptr->GetOperatorPtr({group, 0});
+    auto right_hand_side_ptr = this->domain_ptr_->MakeSystemVector();
+    *right_hand_side_ptr = 1.0;
+    const double tolerance{ 1e-10 * right_hand_side_ptr->l2_norm() };
+
+    auto solution_ptr = this->domain_ptr_->MakeSystemVector();
+    dealii::SolverControl no_preconditioner_control(10000, tolerance);
+    dealii::PETScWrappers::SolverCG no_preconditioner_solver(no_preconditioner_control);
+    dealii::PETScWrappers::PreconditionNone no_preconditioner(system_matrix);
+    no_preconditioner_solver.solve(system_matrix, *solution_ptr, *right_hand_side_ptr, no_preconditioner);
+
+    auto multigrid_solution_ptr = this->domain_ptr_->MakeSystemVector();
+    dealii::SolverControl multigrid_control(10000, tolerance);
+    dealii::PETScWrappers::SolverCG multigrid_solver(multigrid_control);
+    multigrid_solver.solve(system_matrix, *multigrid_solution_ptr, *right_hand_side_ptr,
+                           *operator_ptr->GetPreconditionerPtr({group, 0}));
+
+    EXPECT_LT(2 * multigrid_control.last_step(), no_preconditioner_control.last_step()) << "group " << group;
+    *multigrid_solution_ptr -= *solution_ptr;
+    EXPECT_LT(multigrid_solution_ptr->linfty_norm(), 1e-6 * solution_ptr->linfty_norm()) << "group " << group;
+  }
+}
+
+} // namespace
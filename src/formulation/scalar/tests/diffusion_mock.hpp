@@ -23,6 +23,10 @@ class DiffusionMock : public DiffusionI<dim> {
   MOCK_METHOD(void, Precalculate, (const CellPtr& cell_ptr), (override));
   MOCK_METHOD(void, FillCellStreamingTerm, (Matrix&, const CellPtr&, GroupNumber), (const, override));
   MOCK_METHOD(void, FillCellCollisionTerm, (Matrix&, const CellPtr&, GroupNumber), (const, override));
+  MOCK_METHOD(void, FillCellStreamingTermBatch, (std::span<Matrix>, std::span<const CellPtr>, GroupNumber),
+              (const, override));
+  MOCK_METHOD(void, FillCellCollisionTermBatch, (std::span<Matrix>, std::span<const CellPtr>, GroupNumber),
+              (const, override));
   MOCK_METHOD(void, FillBoundaryTerm, (Matrix&, const CellPtr&, const FaceNumber, BoundaryType), (const, override));
   MOCK_METHOD(void, FillCellFixedSource, (Vector& to_fill, const CellPtr&, GroupNumber), (const, override));
   MOCK_METHOD(void, FillCellFissionSource, (Vector&, const CellPtr&, GroupNumber, double,
@@ -207,6 +207,26 @@ TEST_F(FormulationCFEMDiffusionTest, FillCellStreamingTermTest) {
   EXPECT_TRUE(AreEqual(expected_matrix, test_matrix));
 }
 
+// Filling the same cell again should reuse the cached local matrix without setting the cell
+TEST_F(FormulationCFEMDiffusionTest, FillCellStreamingTermCachedTest) {
+  dealii::FullMatrix<double> test_matrix(2,2);
+
+  std::array<double, 4> expected_values{12, 12,
+                                        12, 30};
+  dealii::FullMatrix<double> expected_matrix(2, 2, expected_values.begin());
+
+  formulation::scalar::Diffusion<2> test_diffusion(fe_mock_ptr, cross_sections_ptr);
+
+  EXPECT_CALL(*fe_mock_ptr, Jacobian(_)).Times(2).WillRepeatedly(DoDefault());
+  EXPECT_CALL(*fe_mock_ptr, SetCell(cell_ptr_)).Times(2);
+
+  test_diffusion.Precalculate(cell_ptr_);
+  test_diffusion.FillCellStreamingTerm(test_matrix, cell_ptr_, 0);
+  test_diffusion.FillCellStreamingTerm(test_matrix, cell_ptr_, 0);
+
+  EXPECT_TRUE(AreEqual(expected_matrix, test_matrix));
+}
+
 TEST_F(FormulationCFEMDiffusionTest, FillCellCollisionTermTest) {
   dealii::FullMatrix<double> test_matrix(2,2);
 
@@ -230,6 +250,34 @@ TEST_F(FormulationCFEMDiffusionTest, FillCellCollisionTermTest) {
   EXPECT_TRUE(AreEqual(expected_matrix, test_matrix));
 }
 
+// Batched fills should match the per-cell fills, reusing the reference tables instead of setting each cell
+TEST_F(FormulationCFEMDiffusionTest, FillCellTermBatchTest) {
+  std::array<double, 4> expected_streaming_values{6, 6,
+                                                  6, 15};
+  std::array<double, 4> expected_collision_values{4.5, 9.0,
+                                                  9.0, 20.25};
+  dealii::FullMatrix<double> expected_streaming(2, 2, expected_streaming_values.begin());
+  dealii::FullMatrix<double> expected_collision(2, 2, expected_collision_values.begin());
+  std::vector<Matrix> streaming_matrices(1, Matrix(2, 2)), collision_matrices(1, Matrix(2, 2));
+  const std::vector<domain::CellPtr<2>> cell_ptrs{ cell_ptr_ };
+
+  formulation::scalar::Diffusion<2> test_diffusion(fe_mock_ptr, cross_sections_ptr);
+
+  EXPECT_ANY_THROW({
+    test_diffusion.FillCellStreamingTermBatch(streaming_matrices, cell_ptrs, 0);
+  });
+  EXPECT_CALL(*fe_mock_ptr, SetCell(cell_ptr_)).Times(2);
+
+  test_diffusion.Precalculate(cell_ptr_);
+  EXPECT_NO_THROW({
+    test_diffusion.FillCellStreamingTermBatch(streaming_matrices, cell_ptrs, 0);
+    test_diffusion.FillCellCollisionTermBatch(collision_matrices, cell_ptrs, 0);
+  });
+
+  EXPECT_TRUE(AreEqual(expected_streaming, streaming_matrices.front()));
+  EXPECT_TRUE(AreEqual(expected_collision, collision_matrices.front()));
+}
+
 TEST_F(FormulationCFEMDiffusionTest, FillBoundaryTermTestReflective) {
   dealii::FullMatrix<double> test_matrix(2,2);
   dealii::FullMatrix<double> expected_matrix(2,2);
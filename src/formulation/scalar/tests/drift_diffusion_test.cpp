@@ -307,7 +307,7 @@ TYPED_TEST(DriftDiffusionFormulationTest, FillCellBoundaryTerm) {
   for (int q = 0; q < this->cell_quadrature_points_; ++q) {
     EXPECT_CALL(finite_element_mock, FaceJacobian(q)).Times(AtLeast(1)).WillRepeatedly(DoDefault());
     for (int i = 0; i < this->dofs_per_cell_; ++i) {
-      EXPECT_CALL(finite_element_mock, FaceShapeValue(i, q)).Times(AtLeast(2)).WillRepeatedly(DoDefault());
+      EXPECT_CALL(finite_element_mock, FaceShapeValue(i, q)).Times(1).WillRepeatedly(DoDefault());
     }
   }
   dealii::FullMatrix<double> cell_matrix(this->dofs_per_cell_, this->dofs_per_cell_);
@@ -14,21 +14,13 @@ TwoGridDiffusion<dim>::TwoGridDiffusion(std::shared_ptr<FiniteElement> finite_el
 }
 
 template<int dim>
-auto TwoGridDiffusion<dim>::FillCellCollisionTerm(Matrix& to_fill,
-                                                  const CellPtr& cell_ptr,
-                                                  GroupNumber) const -> void {
-  this->VerifyInitialized(__FUNCTION__);
-  this->finite_element_ptr_->SetCell(cell_ptr);
+auto TwoGridDiffusion<dim>::CollisionMatrixKey(const CellPtr& cell_ptr, GroupNumber) const -> LocalMatrixKey {
+  return {.material_id = cell_ptr->material_id(), .geometry = MakeCellGeometryKey<dim>(cell_ptr)};
+}
 
-  const double sigma_absorption{ one_group_cross_sections_ptr_->SigmaAbsorption(cell_ptr->material_id()) };
-  for (int q = 0; q < this->cell_quadrature_points_; ++q) {
-    const double constant{ sigma_absorption * this->finite_element_ptr_->Jacobian(q) };
-    for (int i = 0; i < this->cell_degrees_of_freedom_; ++i) {
-      for (int j = 0; j < this->cell_degrees_of_freedom_; ++j) {
-        to_fill(i, j) += constant * this->shape_squared_.at(q)(i, j);
-      }
-    }
-  }
+template<int dim>
+auto TwoGridDiffusion<dim>::CollisionCrossSection(const int material_id, GroupNumber) const -> double {
+  return one_group_cross_sections_ptr_->SigmaAbsorption(material_id);
 }
 
 template class TwoGridDiffusion<1>;
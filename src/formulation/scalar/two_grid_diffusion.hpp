@@ -21,13 +21,17 @@ class TwoGridDiffusion : public Diffusion<dim> {
                    std::shared_ptr<OneGroupCrossSections>);
   ~TwoGridDiffusion() = default;
 
-  auto FillCellCollisionTerm(Matrix& to_fill, const CellPtr&, GroupNumber) const -> void override;
   auto FillCellFissionSource(Vector&, const CellPtr&, GroupNumber, double, const MomentVector&,
                              const MomentsMap&) const -> void override {};
   auto FillCellFixedSource(Vector&, const CellPtr&, GroupNumber) const -> void override {};
   auto FillCellScatteringSource(Vector&, const CellPtr&, GroupNumber, const MomentsMap&) const -> void override {};
 
   auto one_group_cross_sections_ptr() const { return one_group_cross_sections_ptr_.get(); }
+ protected:
+  /*! \brief The one-group absorption cross-section is the same for all groups, so collision matrices are keyed by
+   * material and geometry only. */
+  auto CollisionMatrixKey(const CellPtr&, GroupNumber) const -> LocalMatrixKey override;
+  auto CollisionCrossSection(int material_id, GroupNumber) const -> double override;
  private:
   std::shared_ptr<OneGroupCrossSections> one_group_cross_sections_ptr_{ nullptr };
 };
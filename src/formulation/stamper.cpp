@@ -1,5 +1,9 @@
 #include "formulation/stamper.hpp"
 
+#include <algorithm>
+
+#include "formulation/cell_batch_assembler.hpp"
+
 namespace bart::formulation {
 
 template<int dim>
@@ -23,6 +27,30 @@ auto Stamper<dim>::StampMatrix(system::MPISparseMatrix& to_stamp, CellMatrixStam
   }
   to_stamp.compress(dealii::VectorOperation::add);
 }
+
+template<int dim>
+auto Stamper<dim>::StampMatrixBatch(system::MPISparseMatrix& to_stamp,
+                                    CellBatchMatrixStampFunction stamp_function) -> void {
+  std::vector<FullMatrix> cell_matrices(kCellBatchSize, domain_ptr_->GetCellMatrix());
+  const auto cells = domain_ptr_->Cells();
+  std::vector<dealii::types::global_dof_index> local_dof_indices(cell_matrices.front().n_cols());
+  const std::span<const domain::CellPtr<dim>> all_cells{ cells };
+
+  for (std::size_t batch_start = 0; batch_start < cells.size(); batch_start += kCellBatchSize) {
+    const std::size_t batch_size{ std::min<std::size_t>(kCellBatchSize, cells.size() - batch_start) };
+    const auto batch_matrices = std::span<FullMatrix>(cell_matrices).first(batch_size);
+    for (auto& cell_matrix : batch_matrices)
+      cell_matrix = 0;
+    stamp_function(batch_matrices, all_cells.subspan(batch_start, batch_size));
+
+    for (std::size_t i = 0; i < batch_size; ++i) {
+      cells[batch_start + i]->get_dof_indices(local_dof_indices);
+      to_stamp.add(local_dof_indices, local_dof_indices, batch_matrices[i]);
+    }
+  }
+  to_stamp.compress(dealii::VectorOperation::add);
+}
+
 template<int dim>
 auto Stamper<dim>::StampVector(system::MPIVector& to_stamp, CellVectorStampFunction stamp_function) -> void {
   auto cell_vector = domain_ptr_->GetCellVector();
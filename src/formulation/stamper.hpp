@@ -18,6 +18,7 @@ template <int dim>
  class Stamper : public StamperI<dim>, public utility::HasDependencies {
  public:
   using typename StamperI<dim>::CellMatrixStampFunction;
+  using typename StamperI<dim>::CellBatchMatrixStampFunction;
   using typename StamperI<dim>::CellVectorStampFunction;
   using typename StamperI<dim>::FaceMatrixStampFunction;
   using typename StamperI<dim>::FaceVectorStampFunction;
@@ -29,6 +30,8 @@ template <int dim>
   virtual ~Stamper() = default;
 
   auto StampMatrix(system::MPISparseMatrix& to_stamp, CellMatrixStampFunction stamp_function) -> void override;
+  auto StampMatrixBatch(system::MPISparseMatrix& to_stamp, CellBatchMatrixStampFunction stamp_function)
+  -> void override;
   auto StampVector(system::MPIVector& to_stamp, CellVectorStampFunction stamp_function) -> void override;
   auto StampBoundaryMatrix(system::MPISparseMatrix &to_stamp, FaceMatrixStampFunction stamp_function) -> void override;
   auto StampBoundaryVector(system::MPIVector &to_stamp, FaceVectorStampFunction stamp_function) -> void override;
@@ -2,6 +2,7 @@
 #define BART_SRC_FORMULATION_STAMPER_I_HPP_
 
 #include <functional>
+#include <span>
 
 #include "domain/domain_types.hpp"
 #include "formulation/formulation_types.hpp"
@@ -27,6 +28,9 @@ class StamperI : public utility::HasDescription {
  public:
   //! A function that takes a matrix and a cell and fills the provided matrix with the cell values.
   using CellMatrixStampFunction = std::function<void(formulation::FullMatrix&, const domain::CellPtr<dim>&)>;
+  //! A function that takes a batch of matrices and cells and fills each provided matrix with the matching cell values.
+  using CellBatchMatrixStampFunction = std::function<void(std::span<formulation::FullMatrix>,
+                                                          std::span<const domain::CellPtr<dim>>)>;
   //! A function that takes a vector and a cell and fills the provided vector with the cell values.
   using CellVectorStampFunction = std::function<void(formulation::Vector&, const domain::CellPtr<dim>&)>;
   //! A function that takes a matrix, a cell, and a face and fills the provided matrix with the cell face values.
@@ -44,6 +48,15 @@ class StamperI : public utility::HasDescription {
    * @param function function to evaluate on all cells
    */
   virtual auto StampMatrix(system::MPISparseMatrix& to_stamp, CellMatrixStampFunction function) -> void = 0;
+  /*! \brief Stamp a system matrix with all cell values, evaluated for batches of cells.
+   *
+   * As StampMatrix, but the function is evaluated for a batch of cells at a time so that implementations can integrate
+   * several cells together. Each batch holds at most formulation::kCellBatchSize cells.
+   *
+   * @param to_stamp sparse system matrix to stamp
+   * @param function function to evaluate on all batches of cells
+   */
+  virtual auto StampMatrixBatch(system::MPISparseMatrix& to_stamp, CellBatchMatrixStampFunction function) -> void = 0;
   /*! \brief Stamp a system vector with all cell values.
    *
    * Iterates over all cells in the triangulation, evaluates a function on that cell and the stamps the system vector
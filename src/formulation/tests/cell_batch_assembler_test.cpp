@@ -0,0 +1,284 @@
+#include "formulation/cell_batch_assembler.hpp"
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <deal.II/base/point.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/full_matrix.h>
+
+#include "data/cross_sections/material_cross_sections.hpp"
+#include "data/material/tests/material_mock.hpp"
+#include "domain/domain.hpp"
+#include "domain/finite_element/finite_element_gaussian.hpp"
+#include "domain/mesh/mesh_cartesian.hpp"
+#include "formulation/local_matrix_cache.hpp"
+#include "formulation/scalar/diffusion.hpp"
+#include "formulation/stamper.hpp"
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::MockFunction, ::testing::NiceMock, ::testing::Return, ::testing::_;
+
+/* Tests for formulation::CellBatchAssembler. Batched local matrices are compared to matrices integrated one cell at a
+ * time with the finite element, on axis-aligned cells of different sizes and materials. The number of cells is not a
+ * multiple of the batch size, so the final batch only fills some of the SIMD lanes.
+ */
+template <typename DimensionWrapper>
+class FormulationCellBatchAssemblerTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using Assembler = formulation::CellBatchAssembler<dim>;
+  using CellPtr = domain::CellPtr<dim>;
+  using FiniteElement = domain::finite_element::FiniteElementGaussian<dim>;
+  using FullMatrix = formulation::FullMatrix;
+
+  FormulationCellBatchAssemblerTest() : dof_handler_(triangulation_) {}
+
+  // Cell extents in each direction, three cells of different sizes
+  const std::vector<double> step_sizes_{ 0.5, 1.0, 0.25 };
+  const std::array<double, 2> material_coefficients_{ 1.5, 0.75 };
+  // Scale of the mixed gradient products added in more than one dimension
+  static constexpr double mixed_gradient_scale_{ 0.5 };
+
+  dealii::Triangulation<dim> triangulation_;
+  dealii::DoFHandler<dim> dof_handler_;
+  std::shared_ptr<FiniteElement> finite_element_ptr_;
+  std::vector<CellPtr> cell_ptrs_;
+
+  void SetUp() override;
+  auto Coefficient(const CellPtr& cell_ptr) const -> double {
+    return material_coefficients_.at(cell_ptr->material_id());
+  }
+  // Adds the mass and gradient product tables for each cell in a batch
+  auto Integrate(const Assembler& assembler, typename Assembler::CellBatch& batch) const -> void;
+  // Returns the matrix Integrate adds for one cell, calculated by setting the cell in the finite element
+  auto ExpectedMatrix(const CellPtr& cell_ptr) -> FullMatrix;
+};
+
+template <typename DimensionWrapper>
+void FormulationCellBatchAssemblerTest<DimensionWrapper>::SetUp() {
+  finite_element_ptr_ = std::make_shared<FiniteElement>(problem::DiscretizationType::kContinuousFEM, 2);
+  dealii::Point<dim> origin, diagonal;
+  for (int direction = 0; direction < dim; ++direction)
+    diagonal[direction] = 1.75;
+  dealii::GridGenerator::subdivided_hyper_rectangle(triangulation_, std::vector<std::vector<double>>(dim, step_sizes_),
+                                                    origin, diagonal);
+  dof_handler_.distribute_dofs(*finite_element_ptr_->finite_element());
+  int cell_index{ 0 };
+  for (auto cell = dof_handler_.begin_active(); cell != dof_handler_.end(); ++cell) {
+    cell->set_material_id(cell_index++ % 2);
+    cell_ptrs_.push_back(cell);
+  }
+}
+
+template <typename DimensionWrapper>
+auto FormulationCellBatchAssemblerTest<DimensionWrapper>::Integrate(const Assembler& assembler,
+                                                                   typename Assembler::CellBatch& batch) const
+-> void {
+  assembler.AddShapeSquared(batch);
+  assembler.AddGradientProducts(batch, 0, 0, 1.0);
+  if (dim > 1)
+    assembler.AddGradientProducts(batch, 0, 1, mixed_gradient_scale_);
+}
+
+template <typename DimensionWrapper>
+auto FormulationCellBatchAssemblerTest<DimensionWrapper>::ExpectedMatrix(const CellPtr& cell_ptr) -> FullMatrix {
+  const int n_dofs{ finite_element_ptr_->dofs_per_cell() };
+  FullMatrix expected_matrix(n_dofs, n_dofs);
+  finite_element_ptr_->SetCell(cell_ptr);
+  for (int q = 0; q < finite_element_ptr_->n_cell_quad_pts(); ++q) {
+    const double weight{ Coefficient(cell_ptr) * finite_element_ptr_->Jacobian(q) };
+    for (int i = 0; i < n_dofs; ++i) {
+      const auto gradient_i = finite_element_ptr_->ShapeGradient(i, q);
+      for (int j = 0; j < n_dofs; ++j) {
+        const auto gradient_j = finite_element_ptr_->ShapeGradient(j, q);
+        double value{ finite_element_ptr_->ShapeValue(i, q) * finite_element_ptr_->ShapeValue(j, q)
+                          + gradient_i[0] * gradient_j[0] };
+        if (dim > 1)
+          value += mixed_gradient_scale_ * (gradient_i[0] * gradient_j[1] + gradient_i[1] * gradient_j[0]);
+        expected_matrix(i, j) += weight * value;
+      }
+    }
+  }
+  return expected_matrix;
+}
+
+TYPED_TEST_SUITE(FormulationCellBatchAssemblerTest, bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationCellBatchAssemblerTest, AxisAlignedCellExtents) {
+  constexpr int dim = this->dim;
+  for (const auto& cell_ptr : this->cell_ptrs_) {
+    const auto extents = formulation::AxisAlignedCellExtents<dim>(cell_ptr);
+    ASSERT_TRUE(extents.has_value());
+    for (int direction = 0; direction < dim; ++direction)
+      EXPECT_NEAR(extents.value()[direction], cell_ptr->extent_in_direction(direction), 1e-12);
+  }
+}
+
+// Each cell should get the matrix integrated for it alone, including the cells in the partially filled final batch
+TYPED_TEST(FormulationCellBatchAssemblerTest, FillBatchMatchesPerCellIntegration) {
+  constexpr int dim = this->dim;
+  using FullMatrix = typename TestFixture::FullMatrix;
+  if constexpr (formulation::kCellBatchSize > 1) {
+    ASSERT_NE(this->cell_ptrs_.size() % formulation::kCellBatchSize, 0U);
+  }
+
+  formulation::CellBatchAssembler<dim> test_assembler;
+  EXPECT_FALSE(test_assembler.is_initialized());
+  test_assembler.Initialize(*this->finite_element_ptr_, this->cell_ptrs_.front());
+  ASSERT_TRUE(test_assembler.is_initialized());
+  ASSERT_TRUE(test_assembler.is_batched());
+
+  const int n_dofs{ this->finite_element_ptr_->dofs_per_cell() };
+  std::vector<FullMatrix> to_fill(this->cell_ptrs_.size(), FullMatrix(n_dofs, n_dofs));
+  formulation::LocalMatrixCache cache;
+  MockFunction<void(FullMatrix&, const domain::CellPtr<dim>&)> cell_fill_function;
+  EXPECT_CALL(cell_fill_function, Call(_, _)).Times(0);
+
+  // A distinct key for each cell so that every cell is integrated
+  test_assembler.FillBatch(
+      to_fill, this->cell_ptrs_, cache,
+      [](const domain::CellPtr<dim>& cell_ptr) {
+        return formulation::LocalMatrixKey{ .material_id = static_cast<int>(cell_ptr->active_cell_index()) }; },
+      [this](const domain::CellPtr<dim>& cell_ptr) { return this->Coefficient(cell_ptr); },
+      [&](typename formulation::CellBatchAssembler<dim>::CellBatch& batch) {
+        this->Integrate(test_assembler, batch); },
+      cell_fill_function.AsStdFunction());
+
+  EXPECT_EQ(cache.size(), this->cell_ptrs_.size());
+  for (std::size_t cell = 0; cell < this->cell_ptrs_.size(); ++cell) {
+    const auto expected_matrix = this->ExpectedMatrix(this->cell_ptrs_.at(cell));
+    for (int i = 0; i < n_dofs; ++i) {
+      for (int j = 0; j < n_dofs; ++j) {
+        EXPECT_NEAR(to_fill.at(cell)(i, j), expected_matrix(i, j), 1e-12 * (1 + std::abs(expected_matrix(i, j))))
+            << "cell " << cell << ", entry (" << i << ", " << j << ")";
+      }
+    }
+  }
+}
+
+// Cells with a cached key should get the cached matrix without being integrated
+TYPED_TEST(FormulationCellBatchAssemblerTest, FillBatchUsesCache) {
+  constexpr int dim = this->dim;
+  using FullMatrix = typename TestFixture::FullMatrix;
+  formulation::CellBatchAssembler<dim> test_assembler;
+  test_assembler.Initialize(*this->finite_element_ptr_, this->cell_ptrs_.front());
+
+  const int n_dofs{ this->finite_element_ptr_->dofs_per_cell() };
+  FullMatrix cached_matrix(n_dofs, n_dofs);
+  cached_matrix = 2.0;
+  formulation::LocalMatrixCache cache;
+  cache.Insert({}, cached_matrix);
+
+  std::vector<FullMatrix> to_fill(this->cell_ptrs_.size(), FullMatrix(n_dofs, n_dofs));
+  MockFunction<void(typename formulation::CellBatchAssembler<dim>::CellBatch&)> integrate_function;
+  EXPECT_CALL(integrate_function, Call(_)).Times(0);
+  test_assembler.FillBatch(
+      to_fill, this->cell_ptrs_, cache, [](const domain::CellPtr<dim>&) { return formulation::LocalMatrixKey{}; },
+      [](const domain::CellPtr<dim>&) { return 1.0; }, integrate_function.AsStdFunction(),
+      [](FullMatrix&, const domain::CellPtr<dim>&) { FAIL() << "cell fill function should not be called"; });
+  for (const auto& matrix : to_fill)
+    EXPECT_EQ(matrix(0, 0), 2.0);
+
+  std::vector<FullMatrix> wrong_size(1, FullMatrix(n_dofs, n_dofs));
+  EXPECT_ANY_THROW({
+    test_assembler.FillBatch(
+        wrong_size, this->cell_ptrs_, cache, [](const domain::CellPtr<dim>&) { return formulation::LocalMatrixKey{}; },
+        [](const domain::CellPtr<dim>&) { return 1.0; }, integrate_function.AsStdFunction(),
+        [](FullMatrix&, const domain::CellPtr<dim>&) {});
+  });
+}
+
+/* Stamping the diffusion streaming and collision terms in batches should give the same system matrix as stamping the
+ * per-cell fills, using a real domain whose number of cells is not a multiple of the batch size.
+ */
+template <typename DimensionWrapper>
+class FormulationCellBatchStampTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using FullMatrix = formulation::FullMatrix;
+
+  const std::unordered_map<int, std::vector<double>> diffusion_coef_{{0, {1.0, 0.5}}, {1, {2.0, 0.25}}};
+  const std::unordered_map<int, std::vector<double>> sigma_t_{{0, {1.0, 2.0}}, {1, {0.5, 4.0}}};
+  const std::unordered_map<int, FullMatrix> sigma_s_{
+      {0, FullMatrix(2, 2, std::array<double, 4>{0.5, 0.0, 0.2, 1.0}.begin())},
+      {1, FullMatrix(2, 2, std::array<double, 4>{0.1, 0.0, 0.3, 3.0}.begin())}};
+
+  std::shared_ptr<domain::Domain<dim>> domain_ptr_;
+  std::shared_ptr<domain::finite_element::FiniteElementGaussian<dim>> finite_element_ptr_;
+  std::shared_ptr<data::cross_sections::CrossSectionsI> cross_sections_ptr_;
+  NiceMock<data::material::MaterialMock> mock_material_;
+
+  void SetUp() override;
+  static auto MaterialMapping() -> std::string;
+};
+
+template <typename DimensionWrapper>
+auto FormulationCellBatchStampTest<DimensionWrapper>::MaterialMapping() -> std::string {
+  if (dim == 1)
+    return "0 1 0";
+  if (dim == 2)
+    return "0 1 0\n1 0 1\n0 0 1";
+  return "0 1 0\n1 0 1\n0 0 1\n\n1 0 1\n0 1 0\n1 1 0\n\n0 0 1\n1 1 0\n0 1 0";
+}
+
+template <typename DimensionWrapper>
+void FormulationCellBatchStampTest<DimensionWrapper>::SetUp() {
+  ON_CALL(mock_material_, GetDiffusionCoef()).WillByDefault(Return(diffusion_coef_));
+  ON_CALL(mock_material_, GetSigT()).WillByDefault(Return(sigma_t_));
+  ON_CALL(mock_material_, GetSigS()).WillByDefault(Return(sigma_s_));
+  cross_sections_ptr_ = std::make_shared<data::cross_sections::MaterialCrossSections>(mock_material_);
+
+  finite_element_ptr_ = std::make_shared<domain::finite_element::FiniteElementGaussian<dim>>(
+      problem::DiscretizationType::kContinuousFEM, 1);
+  auto mesh_ptr = std::make_unique<domain::mesh::MeshCartesian<dim>>(std::vector<double>(dim, 3.0),
+                                                                     std::vector<int>(dim, 3), MaterialMapping());
+  domain_ptr_ = std::make_shared<domain::Domain<dim>>(std::move(mesh_ptr), finite_element_ptr_);
+  domain_ptr_->SetUpMesh().SetUpDOF();
+}
+
+TYPED_TEST_SUITE(FormulationCellBatchStampTest, bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationCellBatchStampTest, StampMatrixBatchMatchesPerCellStamp) {
+  constexpr int dim = this->dim;
+  using FullMatrix = typename TestFixture::FullMatrix;
+  if constexpr (formulation::kCellBatchSize > 1) {
+    ASSERT_NE(this->domain_ptr_->Cells().size() % formulation::kCellBatchSize, 0U);
+  }
+  formulation::scalar::Diffusion<dim> per_cell_diffusion(this->finite_element_ptr_, this->cross_sections_ptr_);
+  formulation::scalar::Diffusion<dim> batch_diffusion(this->finite_element_ptr_, this->cross_sections_ptr_);
+  per_cell_diffusion.Precalculate(this->domain_ptr_->Cells().front());
+  batch_diffusion.Precalculate(this->domain_ptr_->Cells().front());
+  formulation::Stamper<dim> test_stamper(this->domain_ptr_);
+
+  for (int group = 0; group < 2; ++group) {
+    auto expected_matrix_ptr = this->domain_ptr_->MakeSystemMatrix();
+    auto batch_matrix_ptr = this->domain_ptr_->MakeSystemMatrix();
+    test_stamper.StampMatrix(*expected_matrix_ptr, [&](FullMatrix& cell_matrix, const domain::CellPtr<dim>& cell_ptr) {
+      per_cell_diffusion.FillCellStreamingTerm(cell_matrix, cell_ptr, group);
+      per_cell_diffusion.FillCellCollisionTerm(cell_matrix, cell_ptr, group);
+    });
+    test_stamper.StampMatrixBatch(*batch_matrix_ptr, [&](std::span<FullMatrix> cell_matrices,
+                                                         std::span<const domain::CellPtr<dim>> cell_ptrs) {
+      batch_diffusion.FillCellStreamingTermBatch(cell_matrices, cell_ptrs, group);
+      batch_diffusion.FillCellCollisionTermBatch(cell_matrices, cell_ptrs, group);
+    });
+
+    const double expected_norm{ expected_matrix_ptr->frobenius_norm() };
+    ASSERT_GT(expected_norm, 0.0);
+    batch_matrix_ptr->add(-1.0, *expected_matrix_ptr);
+    EXPECT_LT(batch_matrix_ptr->frobenius_norm(), 1e-12 * expected_norm) << "group " << group;
+  }
+}
+
+} // namespace
@@ -0,0 +1,146 @@
+#include "formulation/local_matrix_cache.hpp"
+
+#include <thread>
+#include <vector>
+
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_assertions.hpp"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::MockFunction, ::testing::_;
+
+/* ===== CACHE TESTS ===========================================================
+ * These tests verify memoization of local matrices by formulation::LocalMatrixCache. */
+class FormulationLocalMatrixCacheTest : public ::testing::Test {
+ public:
+  using FullMatrix = formulation::FullMatrix;
+  static auto FillWith(const double value) {
+    return [value](FullMatrix& local_matrix) {
+      for (unsigned int i = 0; i < local_matrix.m(); ++i)
+        for (unsigned int j = 0; j < local_matrix.n(); ++j)
+          local_matrix(i, j) += value;
+    };
+  }
+};
+
+// Adding the same key twice should only call the fill function once
+TEST_F(FormulationLocalMatrixCacheTest, AddToSameKey) {
+  formulation::LocalMatrixCache test_cache;
+  MockFunction<void(FullMatrix&)> fill_function;
+  FullMatrix to_fill(2, 2), expected_matrix(2, 2);
+  to_fill = 1;
+  expected_matrix = 7;
+
+  EXPECT_CALL(fill_function, Call(_)).WillOnce(FillWith(3));
+
+  test_cache.AddTo(to_fill, {.material_id = 1, .group = 2}, fill_function.AsStdFunction());
+  test_cache.AddTo(to_fill, {.material_id = 1, .group = 2}, fill_function.AsStdFunction());
+
+  EXPECT_TRUE(test_helpers::AreEqual(expected_matrix, to_fill));
+  EXPECT_EQ(test_cache.size(), 1U);
+}
+
+// Each distinct key should be filled separately
+TEST_F(FormulationLocalMatrixCacheTest, AddToDifferentKeys) {
+  formulation::LocalMatrixCache test_cache;
+  FullMatrix group_0_matrix(2, 2), group_1_matrix(2, 2), angle_1_matrix(2, 2);
+
+  test_cache.AddTo(group_0_matrix, {.group = 0}, FillWith(1));
+  test_cache.AddTo(group_1_matrix, {.group = 1}, FillWith(2));
+  test_cache.AddTo(angle_1_matrix, {.group = 0, .angle = 1}, FillWith(3));
+
+  EXPECT_EQ(test_cache.size(), 3U);
+  EXPECT_EQ(group_0_matrix(0, 0), 1);
+  EXPECT_EQ(group_1_matrix(0, 0), 2);
+  EXPECT_EQ(angle_1_matrix(0, 0), 3);
+}
+
+// Once the maximum number of values is stored, matrices should be calculated but not stored
+TEST_F(FormulationLocalMatrixCacheTest, AddToFullCache) {
+  formulation::LocalMatrixCache test_cache(4);
+  MockFunction<void(FullMatrix&)> fill_function;
+  FullMatrix to_fill(2, 2), expected_matrix(2, 2);
+  expected_matrix = 4;
+
+  EXPECT_CALL(fill_function, Call(_)).Times(4).WillRepeatedly(FillWith(1));
+
+  test_cache.AddTo(to_fill, {.group = 0}, fill_function.AsStdFunction());
+  test_cache.AddTo(to_fill, {.group = 0}, fill_function.AsStdFunction());
+  test_cache.AddTo(to_fill, {.group = 1}, fill_function.AsStdFunction());
+  test_cache.AddTo(to_fill, {.group = 1}, fill_function.AsStdFunction());
+  EXPECT_EQ(test_cache.size(), 1U);
+  EXPECT_TRUE(test_helpers::AreEqual(expected_matrix, to_fill));
+
+  test_cache.Clear();
+  EXPECT_EQ(test_cache.size(), 0U);
+  test_cache.AddTo(to_fill, {.group = 1}, fill_function.AsStdFunction());
+  EXPECT_EQ(test_cache.size(), 1U);
+}
+
+// Adding from multiple threads should give every thread the matrix for its key and store each key once
+TEST_F(FormulationLocalMatrixCacheTest, AddToMultipleThreads) {
+  formulation::LocalMatrixCache test_cache;
+  constexpr int n_threads{ 4 }, n_groups{ 8 };
+  std::vector<std::vector<FullMatrix>> filled_matrices(n_threads, std::vector<FullMatrix>(n_groups, FullMatrix(2, 2)));
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < n_threads; ++thread) {
+    threads.emplace_back([&, thread]() {
+      for (int group = 0; group < n_groups; ++group)
+        test_cache.AddTo(filled_matrices[thread][group], {.group = group}, FillWith(group + 1));
+    });
+  }
+  for (auto& thread : threads)
+    thread.join();
+
+  EXPECT_EQ(test_cache.size(), static_cast<std::size_t>(n_groups));
+  for (const auto& thread_matrices : filled_matrices) {
+    for (int group = 0; group < n_groups; ++group) {
+      FullMatrix expected_matrix(2, 2);
+      expected_matrix = group + 1;
+      EXPECT_TRUE(test_helpers::AreEqual(expected_matrix, thread_matrices[group]));
+    }
+  }
+}
+
+/* ===== GEOMETRY TESTS ========================================================
+ * These tests verify cell geometry signatures on a real dealii domain. */
+template <typename DimensionWrapper>
+class FormulationCellGeometryKeyTest : public ::testing::Test,
+                                       public bart::testing::DealiiTestDomain<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  bart::testing::DealiiTestDomain<dim> coarse_domain_{ 1.0, 1 };
+  void SetUp() override {
+    this->SetUpDealii();
+    coarse_domain_.SetUpDealii();
+  }
+};
+
+TYPED_TEST_SUITE(FormulationCellGeometryKeyTest, bart::testing::AllDimensions);
+
+// All cells of a uniformly refined cube are congruent
+TYPED_TEST(FormulationCellGeometryKeyTest, CongruentCells) {
+  constexpr int dim = this->dim;
+  ASSERT_FALSE(this->cells_.empty());
+  const auto expected_key = formulation::MakeCellGeometryKey<dim>(this->cells_.front());
+  for (const auto& cell : this->cells_)
+    EXPECT_TRUE(formulation::MakeCellGeometryKey<dim>(cell) == expected_key);
+}
+
+// Cells of different sizes should have different signatures
+TYPED_TEST(FormulationCellGeometryKeyTest, DifferentCells) {
+  constexpr int dim = this->dim;
+  ASSERT_FALSE(this->cells_.empty());
+  ASSERT_FALSE(this->coarse_domain_.cells_.empty());
+  const auto fine_key = formulation::MakeCellGeometryKey<dim>(this->cells_.front());
+  const auto coarse_key = formulation::MakeCellGeometryKey<dim>(this->coarse_domain_.cells_.front());
+  EXPECT_FALSE(fine_key == coarse_key);
+  EXPECT_NE(fine_key.level, coarse_key.level);
+}
+
+} // namespace
@@ -0,0 +1,216 @@
+#include "formulation/parallel_stamper.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+#include "domain/tests/domain_mock.hpp"
+#include "formulation/cell_batch_assembler.hpp"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_assertions.hpp"
+
+namespace {
+
+using namespace bart;
+
+using ::testing::Return, ::testing::DoDefault, ::testing::AtLeast;
+
+/* ===== BASIC TESTS ===========================================================
+ * These tests verify basic functionality of formulation::ParallelStamper. */
+template <typename DimensionWrapper>
+class FormulationParallelStamperTest : public ::testing::Test {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using DomainDefinitionType = domain::DomainMock<dim>;
+
+  std::shared_ptr<DomainDefinitionType> domain_ptr_;
+
+  void SetUp() override;
+};
+
+template <typename DimensionWrapper>
+void FormulationParallelStamperTest<DimensionWrapper>::SetUp() {
+  domain_ptr_ = std::make_shared<DomainDefinitionType>();
+}
+
+TYPED_TEST_SUITE(FormulationParallelStamperTest, bart::testing::AllDimensions);
+
+// Constructor should set dependency correct, getter should return correct value
+TYPED_TEST(FormulationParallelStamperTest, Constructor) {
+  using StamperType = formulation::ParallelStamper<this->dim>;
+  std::shared_ptr<StamperType> stamper_ptr;
+  EXPECT_NO_THROW({ stamper_ptr = std::make_shared<StamperType>(this->domain_ptr_); });
+  ASSERT_NE(stamper_ptr->domain_ptr(), nullptr);
+  EXPECT_EQ(stamper_ptr->domain_ptr(), this->domain_ptr_.get());
+}
+// Constructor should throw if a nullptr dependency is passed
+TYPED_TEST(FormulationParallelStamperTest, BadDependency) {
+  using StamperType = formulation::ParallelStamper<this->dim>;
+  std::shared_ptr<StamperType> stamper_ptr;
+  EXPECT_ANY_THROW({ stamper_ptr = std::make_shared<StamperType>(nullptr); });
+}
+
+/* ===== DEAL.II DOMAIN TESTS ==================================================
+ * These tests verify that the parallel stamper gives the same results as the serial stamper on a real dealii domain
+ * in both serial and MPI. Local matrices and vectors are copied for each thread, so the domain may be asked for them
+ * more than once. */
+template <typename DimensionWrapper>
+class FormulationParallelStamperTestDealiiDomain : public ::testing::Test,
+                                                   public bart::testing::DealiiTestDomain<DimensionWrapper::value> {
+ public:
+  static constexpr int dim = DimensionWrapper::value;
+  using DomainDefinitionType = domain::DomainMock<dim>;
+  using StamperType = formulation::ParallelStamper<dim>;
+
+  // Test object
+  std::unique_ptr<StamperType> test_stamper_ptr_;
+
+  // Depdendency
+  std::shared_ptr<DomainDefinitionType> domain_ptr_;
+
+  // Test parameters
+  system::MPISparseMatrix& system_matrix = this->matrix_1;
+  system::MPISparseMatrix& expected_matrix = this->matrix_2;
+  system::MPISparseMatrix& boundary_expected_matrix = this->matrix_3;
+  system::MPIVector& system_vector = this->vector_1;
+  system::MPIVector& expected_vector = this->vector_2;
+  system::MPIVector& boundary_expected_vector = this->vector_3;
+  std::function<void(formulation::FullMatrix&, const domain::CellPtr<dim>&)> matrix_stamp_function;
+  std::function<void(formulation::Vector&, const domain::CellPtr<dim>&)> vector_stamp_function;
+  std::function<void(formulation::FullMatrix&, const domain::FaceIndex,
+                     const domain::CellPtr<dim>&)> matrix_boundary_stamp_function;
+  std::function<void(formulation::Vector&, const domain::FaceIndex,
+                     const domain::CellPtr<dim>&)> vector_boundary_stamp_function;
+
+  void SetUp() override;
+};
+
+void SetMatrixToOne(formulation::FullMatrix& to_stamp) {
+  for (int i = 0; i < static_cast<int>(to_stamp.n_rows()); ++i) {
+    for (int j = 0; j < static_cast<int>(to_stamp.n_cols()); ++j) {
+      to_stamp(i,j) = 1;
+    }
+  }
+}
+
+void SetVectorToOne(formulation::Vector& to_set) {
+  for (int i = 0; i < static_cast<int>(to_set.size()); ++i) {
+    to_set(i) = 1;
+  }
+}
+
+template <typename DimensionWrapper>
+void FormulationParallelStamperTestDealiiDomain<DimensionWrapper>::SetUp() {
+  this->SetUpDealii();
+  domain_ptr_ = std::make_shared<DomainDefinitionType>();
+  test_stamper_ptr_ = std::make_unique<StamperType>(domain_ptr_);
+
+  int cell_dofs = this->fe_.dofs_per_cell;
+  formulation::FullMatrix ones_matrix(cell_dofs, cell_dofs);
+  SetMatrixToOne(ones_matrix);
+  formulation::Vector ones_vector(cell_dofs);
+  SetVectorToOne(ones_vector);
+
+  for (const auto& cell : this->cells_) {
+    std::vector<dealii::types::global_dof_index> local_dof_indices(cell_dofs);
+    cell->get_dof_indices(local_dof_indices);
+    expected_matrix.add(local_dof_indices, local_dof_indices, ones_matrix);
+    expected_vector.add(local_dof_indices, ones_vector);
+    if (cell->at_boundary()) {
+      int faces_per_cell = dealii::GeometryInfo<this->dim>::faces_per_cell;
+      for (int face = 0; face < faces_per_cell; ++face) {
+        if (cell->face(face)->at_boundary()) {
+          boundary_expected_vector.add(local_dof_indices, ones_vector);
+          boundary_expected_matrix.add(local_dof_indices, local_dof_indices, ones_matrix);
+        }
+      }
+    }
+  }
+  expected_matrix.compress(dealii::VectorOperation::add);
+  expected_vector.compress(dealii::VectorOperation::add);
+  boundary_expected_matrix.compress(dealii::VectorOperation::add);
+  boundary_expected_vector.compress(dealii::VectorOperation::add);
+
+  matrix_stamp_function = [](formulation::FullMatrix& to_stamp, const domain::CellPtr<dim>&) -> void {
+    SetMatrixToOne(to_stamp);
+  };
+  vector_stamp_function = [](formulation::Vector& to_stamp, const domain::CellPtr<dim>&) -> void {
+    SetVectorToOne(to_stamp);
+  };
+  vector_boundary_stamp_function = [](formulation::Vector& to_stamp, const domain::FaceIndex,
+                                      const domain::CellPtr<dim>&) -> void {
+    SetVectorToOne(to_stamp);
+  };
+  matrix_boundary_stamp_function = [](formulation::FullMatrix& to_stamp, const domain::FaceIndex,
+                                      const domain::CellPtr<dim>&) -> void {
+    SetMatrixToOne(to_stamp);
+  };
+
+  ON_CALL(*domain_ptr_, Cells()).WillByDefault(Return(this->cells_));
+  ON_CALL(*domain_ptr_, GetCellMatrix()).WillByDefault(Return(dealii::FullMatrix<double>(cell_dofs, cell_dofs)));
+  ON_CALL(*domain_ptr_, GetCellVector()).WillByDefault(Return(dealii::Vector<double>(cell_dofs)));
+  EXPECT_CALL(*domain_ptr_, GetCellMatrix()).Times(AtLeast(1));
+  EXPECT_CALL(*domain_ptr_, GetCellVector()).Times(AtLeast(1));
+}
+
+TYPED_TEST_SUITE(FormulationParallelStamperTestDealiiDomain, bart::testing::AllDimensions);
+
+TYPED_TEST(FormulationParallelStamperTestDealiiDomain, StampMatrixMPI) {
+  EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+  EXPECT_NO_THROW({
+    this->test_stamper_ptr_->StampMatrix(this->system_matrix, this->matrix_stamp_function);
+  });
+  EXPECT_TRUE(test_helpers::AreEqual(this->system_matrix, this->expected_matrix));
+}
+
+// Batches should cover every cell exactly once, in any order, and hold at most kCellBatchSize cells
+TYPED_TEST(FormulationParallelStamperTestDealiiDomain, StampMatrixBatchMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+
+  std::mutex stamped_cells_mutex;
+  std::vector<domain::CellPtr<dim>> stamped_cells;
+  auto batch_stamp_function = [&](std::span<formulation::FullMatrix> to_stamp,
+                                  std::span<const domain::CellPtr<dim>> cell_ptrs) -> void {
+    EXPECT_EQ(to_stamp.size(), cell_ptrs.size());
+    EXPECT_LE(cell_ptrs.size(), static_cast<std::size_t>(formulation::kCellBatchSize));
+    for (auto& cell_matrix : to_stamp)
+      SetMatrixToOne(cell_matrix);
+    std::lock_guard<std::mutex> lock(stamped_cells_mutex);
+    stamped_cells.insert(stamped_cells.end(), cell_ptrs.begin(), cell_ptrs.end());
+  };
+  EXPECT_NO_THROW({
+    this->test_stamper_ptr_->StampMatrixBatch(this->system_matrix, batch_stamp_function);
+  });
+  auto expected_cells = this->cells_;
+  std::sort(stamped_cells.begin(), stamped_cells.end());
+  std::sort(expected_cells.begin(), expected_cells.end());
+  EXPECT_EQ(stamped_cells, expected_cells);
+  EXPECT_TRUE(test_helpers::AreEqual(this->system_matrix, this->expected_matrix));
+}
+
+TYPED_TEST(FormulationParallelStamperTestDealiiDomain, StampVectorMPI) {
+  EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+  EXPECT_NO_THROW({
+    this->test_stamper_ptr_->StampVector(this->system_vector, this->vector_stamp_function);
+  });
+  EXPECT_TRUE(test_helpers::AreEqual(this->system_vector, this->expected_vector));
+}
+
+TYPED_TEST(FormulationParallelStamperTestDealiiDomain, StampMatrixBoundaryMPI) {
+  EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+  EXPECT_NO_THROW({
+    this->test_stamper_ptr_->StampBoundaryMatrix(this->system_matrix, this->matrix_boundary_stamp_function);
+  });
+  EXPECT_TRUE(test_helpers::AreEqual(this->system_matrix, this->boundary_expected_matrix));
+}
+
+TYPED_TEST(FormulationParallelStamperTestDealiiDomain, StampVectorBoundaryMPI) {
+  EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+  EXPECT_NO_THROW({
+    this->test_stamper_ptr_->StampBoundaryVector(this->system_vector, this->vector_boundary_stamp_function);
+  });
+  EXPECT_TRUE(test_helpers::AreEqual(this->system_vector, this->boundary_expected_vector));
+}
+
+} // namespace
@@ -10,11 +10,13 @@ template <int dim>
 class StamperMock : public StamperI<dim> {
  public:
   using typename StamperI<dim>::CellMatrixStampFunction;
+  using typename StamperI<dim>::CellBatchMatrixStampFunction;
   using typename StamperI<dim>::CellVectorStampFunction;
   using typename StamperI<dim>::FaceMatrixStampFunction;
   using typename StamperI<dim>::FaceVectorStampFunction;
 
   MOCK_METHOD(void, StampMatrix, (system::MPISparseMatrix&, CellMatrixStampFunction), (override));
+  MOCK_METHOD(void, StampMatrixBatch, (system::MPISparseMatrix&, CellBatchMatrixStampFunction), (override));
   MOCK_METHOD(void, StampVector, (system::MPIVector& to_stamp, CellVectorStampFunction), (override));
   MOCK_METHOD(void, StampBoundaryMatrix, (system::MPISparseMatrix& to_stamp, FaceMatrixStampFunction), (override));
   MOCK_METHOD(void, StampBoundaryVector, (system::MPIVector& to_stamp, FaceVectorStampFunction), (override));
@@ -1,6 +1,7 @@
 #include "formulation/stamper.hpp"
 
 #include "domain/tests/domain_mock.hpp"
+#include "formulation/cell_batch_assembler.hpp"
 #include "test_helpers/dealii_test_domain.h"
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/test_assertions.hpp"
@@ -162,6 +163,29 @@ TYPED_TEST(FormulationStamperTestDealiiDomain, StampMatrixMPI) {
   EXPECT_TRUE(test_helpers::AreEqual(this->system_matrix, this->expected_matrix));
 }
 
+// Batches should cover every cell once and hold at most kCellBatchSize cells
+TYPED_TEST(FormulationStamperTestDealiiDomain, StampMatrixBatchMPI) {
+  constexpr int dim = this->dim;
+  EXPECT_CALL(*this->domain_ptr_, GetCellMatrix()).WillOnce(DoDefault());
+  EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
+
+  std::vector<domain::CellPtr<dim>> stamped_cells;
+  auto batch_stamp_function = [&](std::span<formulation::FullMatrix> to_stamp,
+                                  std::span<const domain::CellPtr<dim>> cell_ptrs) -> void {
+    EXPECT_EQ(to_stamp.size(), cell_ptrs.size());
+    EXPECT_LE(cell_ptrs.size(), static_cast<std::size_t>(formulation::kCellBatchSize));
+    for (std::size_t i = 0; i < to_stamp.size(); ++i) {
+      SetMatrixToOne(to_stamp[i]);
+      stamped_cells.push_back(cell_ptrs[i]);
+    }
+  };
+  EXPECT_NO_THROW({
+    this->test_stamper_ptr_->StampMatrixBatch(this->system_matrix, batch_stamp_function);
+  });
+  EXPECT_EQ(stamped_cells, this->cells_);
+  EXPECT_TRUE(test_helpers::AreEqual(this->system_matrix, this->expected_matrix));
+}
+
 TYPED_TEST(FormulationStamperTestDealiiDomain, StampVectorMPI) {
   EXPECT_CALL(*this->domain_ptr_, GetCellVector()).WillOnce(DoDefault());
   EXPECT_CALL(*this->domain_ptr_, Cells()).WillOnce(DoDefault());
@@ -35,16 +35,19 @@ auto DiffusionUpdater<dim>::SetUpFixedFunctions(system::System& /*to_update*/,
                                                 system::EnergyGroup group,
                                                 quadrature::QuadraturePointIndex /*index*/) -> void {
   this->fixed_matrix_functions_ = {};
+  this->fixed_matrix_batch_functions_ = {};
   this->fixed_vector_functions_ = {};
   this->fixed_matrix_boundary_functions_ = {};
   this->fixed_vector_boundary_functions_ = {};
 
-  const auto streaming_term_function = [&, group](formulation::FullMatrix& cell_matrix, const CellPtr& cell_ptr) -> void {
-    formulation_ptr_->FillCellStreamingTerm(cell_matrix, cell_ptr, group.get()); };
-  const auto collision_term_function = [&, group](formulation::FullMatrix& cell_matrix, const CellPtr& cell_ptr) -> void {
-    formulation_ptr_->FillCellCollisionTerm(cell_matrix, cell_ptr, group.get()); };
-  this->fixed_matrix_functions_.push_back(streaming_term_function);
-  this->fixed_matrix_functions_.push_back(collision_term_function);
+  const auto streaming_term_function = [&, group](std::span<formulation::FullMatrix> cell_matrices,
+                                                  std::span<const CellPtr> cell_ptrs) -> void {
+    formulation_ptr_->FillCellStreamingTermBatch(cell_matrices, cell_ptrs, group.get()); };
+  const auto collision_term_function = [&, group](std::span<formulation::FullMatrix> cell_matrices,
+                                                  std::span<const CellPtr> cell_ptrs) -> void {
+    formulation_ptr_->FillCellCollisionTermBatch(cell_matrices, cell_ptrs, group.get()); };
+  this->fixed_matrix_batch_functions_.push_back(streaming_term_function);
+  this->fixed_matrix_batch_functions_.push_back(collision_term_function);
 
   auto fixed_term_function = [&, group](formulation::Vector& cell_vector, const CellPtr& cell_ptr) -> void {
     formulation_ptr_->FillCellFixedSource(cell_vector, cell_ptr, group.get()); };
@@ -78,12 +81,27 @@ void DiffusionUpdater<dim>::UpdateScatteringSource(system::System &to_update, co
   using CellPtr = typename domain::CellPtr<dim>;
   const int group = energy_group.get();
   auto scattering_source_ptr = to_update.right_hand_side_ptr_->GetVariableTermPtr({group, 0}, VariableLinearTerms::kScatteringSource);
+  to_update.right_hand_side_ptr_->MarkModified({group, 0});
+  // The diffusion scattering source only includes other groups, so it is fixed during the inner iterations on a group
+  const bool is_inner_iteration_group{ inner_iteration_group_ == energy_group };
+  if (is_inner_iteration_group && out_group_scattering_source_ptr_ != nullptr) {
+    *scattering_source_ptr = *out_group_scattering_source_ptr_;
+    return;
+  }
   *scattering_source_ptr = 0;
   const auto& current_moments = to_update.current_moments->moments();
   auto scattering_source_function = [&](formulation::Vector& cell_vector, const CellPtr& cell_ptr) -> void {
         formulation_ptr_->FillCellScatteringSource(cell_vector, cell_ptr, group, current_moments);
   };
   stamper_ptr_->StampVector(*scattering_source_ptr, scattering_source_function);
+  if (is_inner_iteration_group)
+    out_group_scattering_source_ptr_ = std::make_shared<system::MPIVector>(*scattering_source_ptr);
+}
+
+template<int dim>
+void DiffusionUpdater<dim>::SetInnerIterationGroup(std::optional<system::EnergyGroup> group) {
+  inner_iteration_group_ = group;
+  out_group_scattering_source_ptr_ = nullptr;
 }
 template<int dim>
 void DiffusionUpdater<dim>::UpdateFissionSource(system::System &to_update,system::EnergyGroup energy_group,
@@ -92,6 +110,7 @@ void DiffusionUpdater<dim>::UpdateFissionSource(system::System &to_update,system
   using CellPtr = typename domain::CellPtr<dim>;
   const int group = energy_group.get();
   auto fission_source_ptr = to_update.right_hand_side_ptr_->GetVariableTermPtr({group, 0}, VariableLinearTerms::kFissionSource);
+  to_update.right_hand_side_ptr_->MarkModified({group, 0});
   *fission_source_ptr = 0;
   const auto& current_moments = to_update.current_moments->moments();
   const auto& in_group_moment = current_moments.at({group, 0, 0});
@@ -109,6 +128,7 @@ void DiffusionUpdater<dim>::UpdateFixedSource(
   int group = energy_group.get();
   auto fixed_source_ptr =
       to_update.right_hand_side_ptr_->GetFixedTermPtr({group, 0});
+  to_update.right_hand_side_ptr_->MarkModified({group, 0});
   *fixed_source_ptr = 0;
   auto fixed_source_function =
       [&](formulation::Vector& cell_vector,
@@ -2,6 +2,7 @@
 #define BART_SRC_FORMULATION_UPDATER_DIFFUSION_UPDATER_H_
 
 #include <memory>
+#include <optional>
 #include <unordered_set>
 
 #include "formulation/scalar/diffusion_i.hpp"
@@ -29,6 +30,7 @@ class DiffusionUpdater
  public:
   using typename FixedUpdater<dim>::CellPtr;
   using typename FixedUpdater<dim>::MatrixFunction;
+  using typename FixedUpdater<dim>::MatrixBatchFunction;
   using typename FixedUpdater<dim>::VectorFunction;
   using typename FixedUpdater<dim>::MatrixBoundaryFunction;
   using typename FixedUpdater<dim>::VectorBoundaryFunction;
@@ -44,6 +46,13 @@ class DiffusionUpdater
       system::System &,
       system::EnergyGroup,
       quadrature::QuadraturePointIndex) override;
+  /*! \brief Sets the group being solved by inner iterations.
+   *
+   * The diffusion scattering source only depends on the other groups, so while
+   * a group is set its scattering source is stamped once and copied on later
+   * updates.
+   */
+  void SetInnerIterationGroup(std::optional<system::EnergyGroup> group) override;
 
   void UpdateFissionSource(
       system::System &,
@@ -65,6 +74,9 @@ class DiffusionUpdater
   std::unique_ptr<DiffusionFormulationType> formulation_ptr_;
   std::shared_ptr<StamperType> stamper_ptr_;
   std::unordered_set<problem::Boundary> reflective_boundaries_;
+  // Scattering source of the group solved by inner iterations, stamped on the first update
+  std::optional<system::EnergyGroup> inner_iteration_group_{ std::nullopt };
+  std::shared_ptr<system::MPIVector> out_group_scattering_source_ptr_{ nullptr };
 };
 
 } // namespace updater
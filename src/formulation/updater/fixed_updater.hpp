@@ -14,6 +14,7 @@ class FixedUpdater : public FixedUpdaterI {
   using CellPtr = domain::CellPtr<dim>;
   using FaceIndex = domain::FaceIndex;
   using MatrixFunction = std::function<void(Matrix&, const CellPtr&)>;
+  using MatrixBatchFunction = std::function<void(std::span<Matrix>, std::span<const CellPtr>)>;
   using VectorFunction = std::function<void(Vector&, const CellPtr&)>;
   using MatrixBoundaryFunction = std::function<void(Matrix&, const FaceIndex, const CellPtr&)>;
   using VectorBoundaryFunction = std::function<void(Vector&, const FaceIndex, const CellPtr&)>;
@@ -27,15 +28,22 @@ class FixedUpdater : public FixedUpdaterI {
     const int energy_group{ group.get() };
     auto fixed_matrix_ptr = to_update.left_hand_side_ptr_->GetFixedTermPtr({energy_group, 0});
     auto fixed_vector_ptr = to_update.right_hand_side_ptr_->GetFixedTermPtr({energy_group, 0});
-    *fixed_matrix_ptr = 0;
+    to_update.right_hand_side_ptr_->MarkModified({energy_group, 0});
     *fixed_vector_ptr = 0;
 
-    for (auto& matrix_function : fixed_matrix_functions_)
-      stamper_ptr_->StampMatrix(*fixed_matrix_ptr, matrix_function);
+    // Systems using a matrix-free left hand side operator have no fixed matrix to assemble
+    if (fixed_matrix_ptr != nullptr) {
+      to_update.left_hand_side_ptr_->MarkModified({energy_group, 0});
+      *fixed_matrix_ptr = 0;
+      for (auto& matrix_function : fixed_matrix_functions_)
+        stamper_ptr_->StampMatrix(*fixed_matrix_ptr, matrix_function);
+      for (auto& matrix_batch_function : fixed_matrix_batch_functions_)
+        stamper_ptr_->StampMatrixBatch(*fixed_matrix_ptr, matrix_batch_function);
+      for (auto& matrix_boundary_function : fixed_matrix_boundary_functions_)
+        stamper_ptr_->StampBoundaryMatrix(*fixed_matrix_ptr, matrix_boundary_function);
+    }
     for (auto& vector_function : fixed_vector_functions_)
       stamper_ptr_->StampVector(*fixed_vector_ptr, vector_function);
-    for (auto& matrix_boundary_function : fixed_matrix_boundary_functions_)
-      stamper_ptr_->StampBoundaryMatrix(*fixed_matrix_ptr, matrix_boundary_function);
     // LCOV_EXCL_START
     // Excluded from coverage because no current formulations utilize this.
     for (auto& vector_boundary_function : fixed_vector_boundary_functions_)
@@ -48,6 +56,8 @@ class FixedUpdater : public FixedUpdaterI {
  protected:
   virtual auto SetUpFixedFunctions(system::System&, system::EnergyGroup, quadrature::QuadraturePointIndex) -> void = 0;
   std::vector<MatrixFunction> fixed_matrix_functions_{};
+  //! Matrix functions evaluated for batches of cells
+  std::vector<MatrixBatchFunction> fixed_matrix_batch_functions_{};
   std::vector<VectorFunction> fixed_vector_functions_{};
   std::vector<MatrixBoundaryFunction> fixed_matrix_boundary_functions_{};
   std::vector<VectorBoundaryFunction> fixed_vector_boundary_functions_{};
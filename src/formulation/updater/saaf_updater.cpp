@@ -1,5 +1,7 @@
 #include "formulation/updater/saaf_updater.h"
 
+#include "system/shared_sparsity_matrix_store.hpp"
+
 namespace bart {
 
 namespace formulation {
@@ -52,6 +54,7 @@ void SAAFUpdater<dim>::UpdateBoundaryConditions(
   auto boundary_vector_ptr = to_update.right_hand_side_ptr_->GetVariableTermPtr(
           {group.get(), index.get()},
           VariableLinearTerms::kReflectiveBoundaryCondition);
+  to_update.right_hand_side_ptr_->MarkModified({group.get(), index.get()});
   const auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
 
   auto reflective_boundary_term_function =
@@ -84,40 +87,176 @@ void SAAFUpdater<dim>::UpdateFixedTerms(
     system::System &to_update,
     system::EnergyGroup group,
     quadrature::QuadraturePointIndex index) {
-  auto fixed_matrix_ptr =
-      to_update.left_hand_side_ptr_->GetFixedTermPtr({group.get(), index.get()});
   auto fixed_vector_ptr =
       to_update.right_hand_side_ptr_->GetFixedTermPtr({group.get(), index.get()});
+  to_update.right_hand_side_ptr_->MarkModified({group.get(), index.get()});
   auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
-  auto streaming_term_function =
-      [&](formulation::FullMatrix& cell_matrix,
-          const domain::CellPtr<dim>& cell_ptr) -> void {
-        formulation_ptr_->FillCellStreamingTerm(cell_matrix, cell_ptr,
-                                                quadrature_point_ptr, group);
-      };
-  auto collision_term_function =
-      [&](formulation::FullMatrix& cell_matrix,
-          const domain::CellPtr<dim>& cell_ptr) -> void {
-        formulation_ptr_->FillCellCollisionTerm(cell_matrix, cell_ptr, group);
-      };
-  auto boundary_bilinear_term_function =
-      [&](formulation::FullMatrix& cell_matrix,
-          const domain::FaceIndex face_index,
-          const domain::CellPtr<dim>& cell_ptr) -> void {
-    formulation_ptr_->FillBoundaryBilinearTerm(cell_matrix, cell_ptr, face_index, quadrature_point_ptr, group);
-  };
   auto fixed_source_term_function =
       [&](formulation::Vector& cell_vector,
           const domain::CellPtr<dim>& cell_ptr) -> void {
         formulation_ptr_->FillCellFixedSourceTerm(cell_vector, cell_ptr, quadrature_point_ptr, group);
   };
+  auto paired_direction_operator_ptr = dynamic_cast<system::terms::PairedDirectionOperator*>(
+      to_update.left_hand_side_operator_ptr_.get());
+
   *fixed_vector_ptr = 0;
-  *fixed_matrix_ptr = 0;
-  stamper_ptr_->StampMatrix(*fixed_matrix_ptr, streaming_term_function);
-  stamper_ptr_->StampMatrix(*fixed_matrix_ptr, collision_term_function);
-  stamper_ptr_->StampBoundaryMatrix(*fixed_matrix_ptr,
-                                    boundary_bilinear_term_function);
-  stamper_ptr_->StampVector(*fixed_vector_ptr, fixed_source_term_function);
+  /* Systems using a paired direction operator assemble its shared matrices instead, and systems using a matrix-free
+   * left hand side operator have no fixed matrix to assemble */
+  if (paired_direction_operator_ptr != nullptr) {
+    UpdatePairedDirectionTerms(*paired_direction_operator_ptr, group, index, quadrature_point_ptr);
+  } else if (auto fixed_matrix_ptr = to_update.left_hand_side_ptr_->GetFixedTermPtr({group.get(), index.get()});
+      fixed_matrix_ptr != nullptr) {
+    to_update.left_hand_side_ptr_->MarkModified({group.get(), index.get()});
+    AssembleInteriorMatrix(*fixed_matrix_ptr, group, quadrature_point_ptr);
+    stamper_ptr_->StampBoundaryMatrix(
+        *fixed_matrix_ptr,
+        [&](formulation::FullMatrix& cell_matrix, const domain::FaceIndex face_index,
+            const domain::CellPtr<dim>& cell_ptr) -> void {
+          formulation_ptr_->FillBoundaryBilinearTerm(cell_matrix, cell_ptr, face_index, quadrature_point_ptr, group);
+        });
+  }
+  if (use_angle_separable_sources_) {
+    if (fixed_source_components_group_ != group.get()) {
+      AssembleSourceComponents(
+          fixed_source_components_, *fixed_vector_ptr,
+          [&](formulation::Vector& cell_vector,
+              const domain::CellPtr<dim>& cell_ptr,
+              const int component) -> void {
+            formulation_ptr_->FillCellFixedSourceComponent(cell_vector, cell_ptr,
+                                                           component, group);
+          });
+      fixed_source_components_group_ = group.get();
+    }
+    CombineSourceComponents(*fixed_vector_ptr, fixed_source_components_,
+                            quadrature_point_ptr->cartesian_position_tensor());
+  } else {
+    stamper_ptr_->StampVector(*fixed_vector_ptr, fixed_source_term_function);
+  }
+}
+
+template<int dim>
+void SAAFUpdater<dim>::UpdatePairedDirectionTerms(
+    system::terms::PairedDirectionOperator& paired_direction_operator,
+    system::EnergyGroup group,
+    quadrature::QuadraturePointIndex index,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>>& quadrature_point_ptr) {
+  const system::Index system_index{group.get(), index.get()};
+  // Both directions of a pair share their matrices, which are assembled with the pair index
+  if (!paired_direction_operator.IsPairIndex(system_index))
+    return;
+
+  auto interior_matrix_ptr = paired_direction_operator.GetInteriorTermPtr(system_index);
+  AssertThrow(interior_matrix_ptr != nullptr,
+              dealii::ExcMessage("Error in SAAFUpdater function UpdateFixedTerms: paired direction operator has no "
+                                 "interior matrix for index"))
+  AssembleInteriorMatrix(*interior_matrix_ptr, group, quadrature_point_ptr);
+
+  if (!paired_direction_operator.HasOppositeAngle(index.get())) {
+    stamper_ptr_->StampBoundaryMatrix(
+        *interior_matrix_ptr,
+        [&](formulation::FullMatrix& cell_matrix, const domain::FaceIndex face_index,
+            const domain::CellPtr<dim>& cell_ptr) -> void {
+          formulation_ptr_->FillBoundaryBilinearTerm(cell_matrix, cell_ptr, face_index, quadrature_point_ptr, group);
+        });
+    return;
+  }
+
+  /* The boundary terms of the two directions are split into the average, which is shared and added to the interior
+   * matrix, and half of the difference, which is added for this direction and subtracted for the opposite one. */
+  auto boundary_correction_ptr = paired_direction_operator.GetBoundaryCorrectionPtr(system_index);
+  auto opposite_quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(
+      quadrature::QuadraturePointIndex(paired_direction_operator.opposite_angle(index.get())));
+  auto paired_boundary_term_function = [&](const double opposite_direction_sign) {
+    return [&, opposite_direction_sign](formulation::FullMatrix& cell_matrix, const domain::FaceIndex face_index,
+                                        const domain::CellPtr<dim>& cell_ptr) -> void {
+      formulation::FullMatrix opposite_cell_matrix(cell_matrix.m(), cell_matrix.n());
+      formulation_ptr_->FillBoundaryBilinearTerm(cell_matrix, cell_ptr, face_index, quadrature_point_ptr, group);
+      formulation_ptr_->FillBoundaryBilinearTerm(opposite_cell_matrix, cell_ptr, face_index,
+                                                 opposite_quadrature_point_ptr, group);
+      cell_matrix.add(opposite_direction_sign, opposite_cell_matrix);
+      cell_matrix *= 0.5;
+    };
+  };
+  stamper_ptr_->StampBoundaryMatrix(*interior_matrix_ptr, paired_boundary_term_function(1.0));
+  *boundary_correction_ptr = 0;
+  stamper_ptr_->StampBoundaryMatrix(*boundary_correction_ptr, paired_boundary_term_function(-1.0));
+}
+
+template<int dim>
+void SAAFUpdater<dim>::AssembleInteriorMatrix(
+    system::MPISparseMatrix& to_assemble,
+    system::EnergyGroup group,
+    const std::shared_ptr<quadrature::QuadraturePointI<dim>>& quadrature_point_ptr) {
+  to_assemble = 0;
+  // The collision term does not depend on the angle, it is assembled once for the group and added to each angle
+  AssembleCollisionMatrix(to_assemble, group);
+  if (use_angular_decomposition_) {
+    AssembleAngularDecomposition(to_assemble, group);
+    const auto omega = quadrature_point_ptr->cartesian_position_tensor();
+    for (const auto& [directions, basis_matrix_ptr] : streaming_basis_ptrs_) {
+      const auto& [direction_a, direction_b] = directions;
+      system::AddSamePattern(to_assemble, omega[direction_a] * omega[direction_b], *basis_matrix_ptr);
+    }
+  } else {
+    stamper_ptr_->StampMatrixBatch(
+        to_assemble,
+        [&](std::span<formulation::FullMatrix> cell_matrices,
+            std::span<const domain::CellPtr<dim>> cell_ptrs) -> void {
+          formulation_ptr_->FillCellStreamingTermBatch(cell_matrices, cell_ptrs, quadrature_point_ptr, group);
+        });
+  }
+  system::AddSamePattern(to_assemble, 1.0, *collision_matrix_ptr_);
+  to_assemble.compress(dealii::VectorOperation::add);
+}
+
+template<int dim>
+void SAAFUpdater<dim>::AssembleCollisionMatrix(
+    const system::MPISparseMatrix& sparsity_template,
+    system::EnergyGroup group) {
+  if (collision_matrix_group_ == group.get())
+    return;
+
+  MakeZeroMatrix(collision_matrix_ptr_, sparsity_template);
+  stamper_ptr_->StampMatrixBatch(
+      *collision_matrix_ptr_,
+      [&](std::span<formulation::FullMatrix> cell_matrices,
+          std::span<const domain::CellPtr<dim>> cell_ptrs) -> void {
+        formulation_ptr_->FillCellCollisionTermBatch(cell_matrices, cell_ptrs, group);
+      });
+  collision_matrix_group_ = group.get();
+}
+
+template<int dim>
+void SAAFUpdater<dim>::AssembleAngularDecomposition(
+    const system::MPISparseMatrix& sparsity_template,
+    system::EnergyGroup group) {
+  if (decomposition_group_ == group.get())
+    return;
+
+  for (int direction_a = 0; direction_a < dim; ++direction_a) {
+    for (int direction_b = direction_a; direction_b < dim; ++direction_b) {
+      auto& basis_matrix_ptr = streaming_basis_ptrs_[{direction_a, direction_b}];
+      MakeZeroMatrix(basis_matrix_ptr, sparsity_template);
+      stamper_ptr_->StampMatrix(
+          *basis_matrix_ptr,
+          [&](formulation::FullMatrix& cell_matrix,
+              const domain::CellPtr<dim>& cell_ptr) -> void {
+            formulation_ptr_->FillCellStreamingBasisTerm(cell_matrix, cell_ptr,
+                                                         direction_a, direction_b,
+                                                         group);
+          });
+    }
+  }
+  decomposition_group_ = group.get();
+}
+
+template<int dim>
+void SAAFUpdater<dim>::MakeZeroMatrix(
+    std::shared_ptr<system::MPISparseMatrix>& matrix_ptr,
+    const system::MPISparseMatrix& sparsity_template) {
+  if (matrix_ptr == nullptr)
+    matrix_ptr = system::MakeMatrixWithPatternOf(sparsity_template);
+  *matrix_ptr = 0;
 }
 
 template<int dim>
@@ -127,6 +266,7 @@ void SAAFUpdater<dim>::UpdateFissionSource(system::System &to_update,
   auto fission_source_ptr =
       to_update.right_hand_side_ptr_->GetVariableTermPtr({group.get(), index.get()},
                                                          system::terms::VariableLinearTerms::kFissionSource);
+  to_update.right_hand_side_ptr_->MarkModified({group.get(), index.get()});
   auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
   const auto& current_moments = to_update.current_moments->moments();
   const auto& in_group_moment = current_moments.at({group.get(), 0, 0});
@@ -141,6 +281,26 @@ void SAAFUpdater<dim>::UpdateFissionSource(system::System &to_update,
                                                                                in_group_moment,
                                                                                current_moments));
       };
+  if (use_angle_separable_sources_) {
+    if (!IsCurrent(fission_source_state_, group, to_update.k_effective, to_update.current_moments_version)) {
+      AssembleSourceComponents(
+          fission_source_components_, *fission_source_ptr,
+          [&](formulation::Vector& cell_vector,
+              const domain::CellPtr<dim>& cell_ptr,
+              const int component) -> void {
+            formulation_ptr_->FillCellFissionSourceComponent(cell_vector, cell_ptr, component,
+                                                             group,
+                                                             to_update.k_effective.value(),
+                                                             in_group_moment,
+                                                             current_moments);
+          });
+      fission_source_state_ = {group.get(), to_update.k_effective, to_update.current_moments_version};
+    }
+    CombineSourceComponents(*fission_source_ptr, fission_source_components_,
+                            quadrature_point_ptr->cartesian_position_tensor());
+    FissionSourceUpdaterI::Add(fission_source_ptr->l1_norm());
+    return;
+  }
   *fission_source_ptr = 0;
   stamper_ptr_->StampVector(*fission_source_ptr, fission_source_function);
 }
@@ -153,21 +313,146 @@ void SAAFUpdater<dim>::UpdateScatteringSource(
   auto scattering_source_ptr =
       to_update.right_hand_side_ptr_->GetVariableTermPtr({group.get(), index.get()},
                                                          system::terms::VariableLinearTerms::kScatteringSource);
-  *scattering_source_ptr = 0;
-  auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
+  to_update.right_hand_side_ptr_->MarkModified({group.get(), index.get()});
   const auto& current_moments = to_update.current_moments->moments();
   const auto& in_group_moment = current_moments.at({group.get(), 0, 0});
+
+  if (inner_iteration_group_ != group) {
+    AssembleScatteringSource(*scattering_source_ptr, group, index, in_group_moment,
+                             current_moments, to_update.current_moments_version, true);
+    return;
+  }
+
+  /* Moments of the other groups are fixed during the inner iterations, their
+   * contribution is stamped once as angle-separable components and only the
+   * in-group contribution is stamped for each update */
+  if (!is_out_group_scattering_source_stored_) {
+    const system::moments::MomentVector zero_in_group_moment(in_group_moment.size());
+    AssembleSourceComponents(
+        out_group_scattering_source_components_, *scattering_source_ptr,
+        [&](formulation::Vector& cell_vector,
+            const domain::CellPtr<dim>& cell_ptr,
+            const int component) -> void {
+          formulation_ptr_->FillCellScatteringSourceComponent(cell_vector, cell_ptr, component,
+                                                              group, zero_in_group_moment,
+                                                              current_moments);
+        });
+    is_out_group_scattering_source_stored_ = true;
+  }
+  // The in-group moments are copied once each time the system moments change, not for every angle
+  if (in_group_moments_version_ != to_update.current_moments_version) {
+    for (const auto& [moment_index, moment] : current_moments) {
+      if (moment_index.at(0) == group.get())
+        in_group_moments_[moment_index] = moment;
+    }
+    in_group_moments_version_ = to_update.current_moments_version;
+  }
+  AssembleScatteringSource(*scattering_source_ptr, group, index, in_group_moment,
+                           in_group_moments_, to_update.current_moments_version, false);
+  const auto omega = quadrature_set_ptr_->GetQuadraturePoint(index)->cartesian_position_tensor();
+  scattering_source_ptr->add(1.0, *out_group_scattering_source_components_.at(0));
+  for (int direction = 0; direction < dim; ++direction)
+    scattering_source_ptr->add(omega[direction],
+                               *out_group_scattering_source_components_.at(direction + 1));
+  ScatteringSourceUpdaterI::Add(scattering_source_ptr->l1_norm());
+}
+
+template<int dim>
+void SAAFUpdater<dim>::SetInnerIterationGroup(
+    std::optional<system::EnergyGroup> group) {
+  inner_iteration_group_ = group;
+  is_out_group_scattering_source_stored_ = false;
+  in_group_moments_.clear();
+  in_group_moments_version_ = std::nullopt;
+  // Stored components may hold only the in-group scattering, or all of it
+  scattering_source_state_ = {};
+}
+
+template<int dim>
+void SAAFUpdater<dim>::AssembleScatteringSource(
+    system::MPIVector& to_fill,
+    system::EnergyGroup group,
+    quadrature::QuadraturePointIndex index,
+    const system::moments::MomentVector& in_group_moment,
+    const system::moments::MomentsMap& moments,
+    const std::size_t moments_version,
+    const bool add_value) {
+  to_fill = 0;
+  auto quadrature_point_ptr = quadrature_set_ptr_->GetQuadraturePoint(index);
   auto scattering_source_function =
       [&](formulation::Vector& cell_vector,
           const domain::CellPtr<dim> &cell_ptr) -> void {
-    ScatteringSourceUpdaterI::Add(std::abs(formulation_ptr_->FillCellScatteringSourceTerm(cell_vector,
-                                                                                 cell_ptr,
-                                                                                 quadrature_point_ptr,
-                                                                                 group,
-                                                                                 in_group_moment,
-                                                                                 current_moments)));
+    const double value_added{ formulation_ptr_->FillCellScatteringSourceTerm(cell_vector,
+                                                                             cell_ptr,
+                                                                             quadrature_point_ptr,
+                                                                             group,
+                                                                             in_group_moment,
+                                                                             moments) };
+    if (add_value)
+      ScatteringSourceUpdaterI::Add(std::abs(value_added));
   };
-  stamper_ptr_->StampVector(*scattering_source_ptr, scattering_source_function);
+  if (use_angle_separable_sources_) {
+    if (!IsCurrent(scattering_source_state_, group, std::nullopt, moments_version)) {
+      AssembleSourceComponents(
+          scattering_source_components_, to_fill,
+          [&](formulation::Vector& cell_vector,
+              const domain::CellPtr<dim>& cell_ptr,
+              const int component) -> void {
+            formulation_ptr_->FillCellScatteringSourceComponent(cell_vector, cell_ptr, component,
+                                                                group, in_group_moment,
+                                                                moments);
+          });
+      scattering_source_state_ = {group.get(), std::nullopt, moments_version};
+    }
+    CombineSourceComponents(to_fill, scattering_source_components_,
+                            quadrature_point_ptr->cartesian_position_tensor());
+    if (add_value)
+      ScatteringSourceUpdaterI::Add(to_fill.l1_norm());
+    return;
+  }
+  stamper_ptr_->StampVector(to_fill, scattering_source_function);
+}
+
+template<int dim>
+void SAAFUpdater<dim>::AssembleSourceComponents(
+    SourceComponents& components,
+    const system::MPIVector& layout_template,
+    const CellSourceComponentFunction& fill_function) {
+  components.resize(dim + 1);
+  for (int component = 0; component <= dim; ++component) {
+    auto& component_ptr = components.at(component);
+    if (component_ptr == nullptr) {
+      component_ptr = std::make_shared<system::MPIVector>();
+      component_ptr->reinit(layout_template);
+    }
+    *component_ptr = 0;
+    stamper_ptr_->StampVector(
+        *component_ptr,
+        [&](formulation::Vector& cell_vector,
+            const domain::CellPtr<dim>& cell_ptr) -> void {
+          fill_function(cell_vector, cell_ptr, component);
+        });
+  }
+}
+
+template<int dim>
+void SAAFUpdater<dim>::CombineSourceComponents(
+    system::MPIVector& to_fill,
+    const SourceComponents& components,
+    const dealii::Tensor<1, dim>& omega) const {
+  to_fill = *components.at(0);
+  for (int direction = 0; direction < dim; ++direction)
+    to_fill.add(omega[direction], *components.at(direction + 1));
+}
+
+template<int dim>
+bool SAAFUpdater<dim>::IsCurrent(
+    const SourceComponentsState& state,
+    system::EnergyGroup group,
+    std::optional<double> k_effective,
+    const std::size_t moments_version) {
+  return state.group == group.get() && state.k_effective == k_effective &&
+      state.moments_version == moments_version;
 }
 
 template class SAAFUpdater<1>;
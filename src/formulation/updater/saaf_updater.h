@@ -1,8 +1,13 @@
 #ifndef BART_SRC_FORMULATION_UPDATER_TESTS_SAAF_UPDATER_H_
 #define BART_SRC_FORMULATION_UPDATER_TESTS_SAAF_UPDATER_H_
 
+#include <cstddef>
+#include <functional>
+#include <map>
 #include <memory>
+#include <optional>
 #include <unordered_set>
+#include <vector>
 
 #include "formulation/angular/self_adjoint_angular_flux_i.h"
 #include "formulation/stamper_i.hpp"
@@ -13,6 +18,7 @@
 #include "quadrature/quadrature_set_i.hpp"
 #include "problem/parameter_types.hpp"
 #include "system/solution/solution_types.h"
+#include "system/terms/paired_direction_operator.hpp"
 #include "utility/has_description.h"
 
 namespace bart {
@@ -47,6 +53,12 @@ class SAAFUpdater :
   void UpdateBoundaryConditions(system::System &to_update,
                                 system::EnergyGroup group,
                                 quadrature::QuadraturePointIndex index) override;
+  /*! \brief Updates the fixed terms for a group and angle.
+   *
+   * If the left hand side operator of the system is a PairedDirectionOperator,
+   * the matrices it shares between opposite directions are assembled instead
+   * of a fixed matrix for each angle.
+   */
   void UpdateFixedTerms(system::System &to_update,
                         system::EnergyGroup group,
                         quadrature::QuadraturePointIndex index) override;
@@ -56,6 +68,50 @@ class SAAFUpdater :
   void UpdateScatteringSource(system::System &to_update,
                               system::EnergyGroup group,
                               quadrature::QuadraturePointIndex index) override;
+  /*! \brief Sets the group being solved by inner iterations.
+   *
+   * While set, the scattering source from the other groups is stamped once,
+   * as angle-separable components, the first time the group's scattering
+   * source is updated. Later updates stamp only the in-group scattering.
+   */
+  void SetInnerIterationGroup(std::optional<system::EnergyGroup> group) override;
+
+  /*! \brief Enables assembly of the fixed bilinear term by angular decomposition.
+   *
+   * The collision matrix does not depend on the angle and is always stamped
+   * once per group. When enabled, the dim(dim+1)/2 angle-independent
+   * streaming basis matrices are also stamped once per group. The fixed
+   * matrix for each angle is then formed as a weighted sum of these matrices,
+   * instead of re-assembling the streaming term for every angle. Only the
+   * basis for the most recently updated group is stored.
+   */
+  auto set_use_angular_decomposition(const bool to_set) -> SAAFUpdater& {
+    use_angular_decomposition_ = to_set;
+    return *this; }
+  auto use_angular_decomposition() const -> bool {
+    return use_angular_decomposition_; }
+
+  /*! \brief Enables angle-separable assembly of the linear source terms.
+   *
+   * When enabled, the fixed, scattering, and fission sources are assembled as
+   * an isotropic vector and dim gradient-moment vectors, and the right-hand
+   * side for each angle is formed as \f$\vec{v}_0 + \sum_a\Omega_a\vec{v}_a\f$.
+   * The components are re-assembled only when the group, k-effective, or
+   * the current_moments_version of the system differ from those used for the
+   * stored components, so each source is stamped once per group per iteration
+   * instead of once per angle.
+   *
+   * In this mode the value added to the aggregated scattering and fission
+   * source ports for each angle is the l1 norm of the assembled source vector.
+   * Otherwise it is the sum of the absolute values of the cell contributions,
+   * which is larger where contributions of different cells, or of the
+   * isotropic and streaming parts, have opposite signs.
+   */
+  auto set_use_angle_separable_sources(const bool to_set) -> SAAFUpdater& {
+    use_angle_separable_sources_ = to_set;
+    return *this; }
+  auto use_angle_separable_sources() const -> bool {
+    return use_angle_separable_sources_; }
 
   EnergyGroupToAngularSolutionPtrMap angular_solution_ptr_map() const {
     return angular_solution_ptr_map_; }
@@ -66,6 +122,69 @@ class SAAFUpdater :
   QuadratureSetType* quadrature_set_ptr() const {
     return quadrature_set_ptr_.get();};
  private:
+  using DirectionPair = std::pair<int, int>;
+  /*! \brief Assembles the streaming and collision terms for one angle,
+   * overwriting the passed matrix. */
+  void AssembleInteriorMatrix(system::MPISparseMatrix& to_assemble,
+                              system::EnergyGroup group,
+                              const std::shared_ptr<quadrature::QuadraturePointI<dim>>& quadrature_point_ptr);
+  /*! \brief Assembles the matrices a paired direction operator shares
+   * between an angle and its opposite direction. Only done for the pair index,
+   * the interior matrix holds the average of the boundary terms of the two
+   * directions and the boundary correction half of their difference. */
+  void UpdatePairedDirectionTerms(system::terms::PairedDirectionOperator& paired_direction_operator,
+                                  system::EnergyGroup group,
+                                  quadrature::QuadraturePointIndex index,
+                                  const std::shared_ptr<quadrature::QuadraturePointI<dim>>& quadrature_point_ptr);
+  /*! \brief Stamps the collision matrix for a group if it is not already
+   * stored. The passed matrix provides the sparsity pattern. */
+  void AssembleCollisionMatrix(const system::MPISparseMatrix& sparsity_template,
+                               system::EnergyGroup group);
+  /*! \brief Creates the matrix with the template sparsity pattern if needed,
+   * sharing its indices if possible, and sets it to zero. */
+  static void MakeZeroMatrix(std::shared_ptr<system::MPISparseMatrix>& matrix_ptr,
+                             const system::MPISparseMatrix& sparsity_template);
+  /*! \brief Stamps the collision and streaming basis matrices for a group if
+   * they are not already stored. The passed matrix provides the sparsity
+   * pattern. */
+  void AssembleAngularDecomposition(const system::MPISparseMatrix& sparsity_template,
+                                    system::EnergyGroup group);
+  //! Angle-separable components of a source, the isotropic component first
+  using SourceComponents = std::vector<std::shared_ptr<system::MPIVector>>;
+  using CellSourceComponentFunction =
+      std::function<void(formulation::Vector&, const domain::CellPtr<dim>&, const int)>;
+  //! Values used to assemble a set of source components
+  struct SourceComponentsState {
+    int group{ -1 };
+    std::optional<double> k_effective{ std::nullopt };
+    std::optional<std::size_t> moments_version{ std::nullopt };
+  };
+  /*! \brief Stamps each source component, the passed vector provides the
+   * parallel layout. */
+  void AssembleSourceComponents(SourceComponents& components,
+                                const system::MPIVector& layout_template,
+                                const CellSourceComponentFunction& fill_function);
+  /*! \brief Forms the source for one angle from the source components. */
+  void CombineSourceComponents(system::MPIVector& to_fill,
+                               const SourceComponents& components,
+                               const dealii::Tensor<1, dim>& omega) const;
+  /*! \brief Stamps the scattering source for one angle from the passed
+   * moments, adding the stamped values to the updater value if add_value is
+   * true. */
+  void AssembleScatteringSource(system::MPIVector& to_fill,
+                                system::EnergyGroup group,
+                                quadrature::QuadraturePointIndex index,
+                                const system::moments::MomentVector& in_group_moment,
+                                const system::moments::MomentsMap& moments,
+                                std::size_t moments_version,
+                                bool add_value);
+  /*! \brief Checks if source components were assembled with the passed
+   * values, the moments are identified by the version of the system moments
+   * they were taken from. */
+  static bool IsCurrent(const SourceComponentsState& state,
+                        system::EnergyGroup group,
+                        std::optional<double> k_effective,
+                        std::size_t moments_version);
   bool IsOnReflectiveBoundary(const domain::CellPtr<dim>& cell_ptr,
                               const domain::FaceIndex face_index) const {
     return reflective_boundaries_.count(
@@ -77,6 +196,25 @@ class SAAFUpdater :
   std::shared_ptr<QuadratureSetType> quadrature_set_ptr_;
   EnergyGroupToAngularSolutionPtrMap angular_solution_ptr_map_;
   std::unordered_set<Boundary> reflective_boundaries_ = {};
+  // Collision matrix for the most recently updated group, shared by its angles
+  int collision_matrix_group_{ -1 };
+  std::shared_ptr<system::MPISparseMatrix> collision_matrix_ptr_{ nullptr };
+  // Angular decomposition of the fixed bilinear term
+  bool use_angular_decomposition_{ false };
+  int decomposition_group_{ -1 };
+  std::map<DirectionPair, std::shared_ptr<system::MPISparseMatrix>> streaming_basis_ptrs_{};
+  // Angle-separable source components
+  bool use_angle_separable_sources_{ false };
+  int fixed_source_components_group_{ -1 };
+  SourceComponents fixed_source_components_{};
+  SourceComponentsState scattering_source_state_{}, fission_source_state_{};
+  SourceComponents scattering_source_components_{}, fission_source_components_{};
+  // Scattering from other groups, fixed during the inner iterations on a group
+  std::optional<system::EnergyGroup> inner_iteration_group_{ std::nullopt };
+  bool is_out_group_scattering_source_stored_{ false };
+  SourceComponents out_group_scattering_source_components_{};
+  system::moments::MomentsMap in_group_moments_{};
+  std::optional<std::size_t> in_group_moments_version_{ std::nullopt };
 };
 
 } // namespace updater
@@ -1,6 +1,8 @@
 #ifndef BART_SRC_FORMULATION_UPDATER_SCATTERING_SOURCE_UPDATER_I_H_
 #define BART_SRC_FORMULATION_UPDATER_SCATTERING_SOURCE_UPDATER_I_H_
 
+#include <optional>
+
 #include "system/system.hpp"
 #include "system/system_types.h"
 #include "quadrature/quadrature_types.h"
@@ -19,6 +21,15 @@ using AggregatedScatteringSourceValue = instrumentation::Port<double, struct Sca
   virtual void UpdateScatteringSource(system::System& to_update,
                                       system::EnergyGroup,
                                       quadrature::QuadraturePointIndex) = 0;
+  /*! \brief Sets the group being solved by inner iterations, or std::nullopt
+   * when no group is.
+   *
+   * While a group is set, the moments of all other groups are fixed, so the
+   * scattering source from other groups may be stored the first time the
+   * group's scattering source is updated, and only the in-group scattering
+   * recalculated afterwards. Setting a group discards any stored source.
+   */
+  virtual void SetInnerIterationGroup(std::optional<system::EnergyGroup>) {}
 };
 
 } // namespace bart::formulation::updater
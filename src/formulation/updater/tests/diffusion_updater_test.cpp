@@ -44,6 +44,17 @@ void FormulationUpdaterDiffusionTest<DimensionWrapper>::SetUp() {
   auto stamper_ptr = this->MakeStamper();
   stamper_obs_ptr_ = stamper_ptr.get();
 
+  // Batched fills are checked through the per-cell fill of each cell in the batch
+  using bart::formulation::updater::test_helpers::FillEachCellInBatch;
+  ON_CALL(*formulation_obs_ptr_, FillCellStreamingTermBatch(_, _, _))
+      .WillByDefault(Invoke(FillEachCellInBatch<dim>(
+          [this](formulation::FullMatrix& cell_matrix, const domain::CellPtr<dim>& cell_ptr, int group) {
+            formulation_obs_ptr_->FillCellStreamingTerm(cell_matrix, cell_ptr, group); })));
+  ON_CALL(*formulation_obs_ptr_, FillCellCollisionTermBatch(_, _, _))
+      .WillByDefault(Invoke(FillEachCellInBatch<dim>(
+          [this](formulation::FullMatrix& cell_matrix, const domain::CellPtr<dim>& cell_ptr, int group) {
+            formulation_obs_ptr_->FillCellCollisionTerm(cell_matrix, cell_ptr, group); })));
+
   test_updater_ptr_ = std::make_unique<UpdaterType>(std::move(formulation_ptr), std::move(stamper_ptr),
                                                     reflective_boundaries);
 }
@@ -108,6 +119,8 @@ TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateFixedTermTest) {
 
   EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetFixedTermPtr(scalar_index)).WillOnce(DoDefault());
   EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(scalar_index)).WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, MarkModified(scalar_index));
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, MarkModified(scalar_index));
 
   for (auto& cell : this->cells_) {
     EXPECT_CALL(*this->formulation_obs_ptr_, FillCellStreamingTerm(_, cell, this->group_number));
@@ -130,7 +143,7 @@ TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateFixedTermTest) {
     }
   }
 
-  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrix(Ref(*this->matrix_to_stamp), _))
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrixBatch(Ref(*this->matrix_to_stamp), _))
       .Times(2).WillRepeatedly(DoDefault());
   EXPECT_CALL(*this->stamper_obs_ptr_, StampBoundaryMatrix(Ref(*this->matrix_to_stamp), _)).WillOnce(DoDefault());
   EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(Ref(*this->vector_to_stamp), _)).WillOnce(DoDefault());
@@ -151,6 +164,8 @@ TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateFixedTermWithRHSConstantTest)
 
   EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetFixedTermPtr(scalar_index)).WillOnce(DoDefault());
   EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(scalar_index)).WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, MarkModified(scalar_index));
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, MarkModified(scalar_index));
 
   for (auto& cell : this->cells_) {
     EXPECT_CALL(*this->formulation_obs_ptr_, FillCellStreamingTerm(_, cell, this->group_number));
@@ -174,7 +189,7 @@ TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateFixedTermWithRHSConstantTest)
     }
   }
 
-  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrix(Ref(*this->matrix_to_stamp), _))
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrixBatch(Ref(*this->matrix_to_stamp), _))
       .Times(2).WillRepeatedly(DoDefault());
   EXPECT_CALL(*this->stamper_obs_ptr_, StampBoundaryMatrix(Ref(*this->matrix_to_stamp), _)).WillOnce(DoDefault());
   EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(Ref(*this->vector_to_stamp), _))
@@ -197,6 +212,7 @@ TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateScatteringSourceTest) {
   EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(scalar_index,
                                                            system::terms::VariableLinearTerms::kScatteringSource))
       .WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, MarkModified(scalar_index));
   EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_)).WillOnce(DoDefault());
   EXPECT_CALL(*this->current_moments_obs_ptr_, moments()).WillOnce(DoDefault());
   for (auto& cell : this->cells_) {
@@ -209,6 +225,37 @@ TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateScatteringSourceTest) {
   EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result, *this->vector_to_stamp));
 }
 
+// The scattering source should be stamped once during the inner iterations on a group, and stamped again once the
+// inner iterations have ended
+TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateScatteringSourceInnerIterationsTest) {
+  system::EnergyGroup group_number(this->group_number);
+  quadrature::QuadraturePointIndex angle_index(this->angle_index);
+  bart::system::Index scalar_index{this->group_number, 0};
+  const int n_updates{ 3 };
+
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(scalar_index,
+                                                           system::terms::VariableLinearTerms::kScatteringSource))
+      .Times(n_updates + 1).WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, MarkModified(scalar_index)).Times(n_updates + 1);
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_)).Times(2).WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->current_moments_obs_ptr_, moments()).Times(2).WillRepeatedly(DoDefault());
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellScatteringSource(_, cell, group_number.get(),
+                                                                      Ref(this->current_iteration_moments_)))
+        .Times(2).WillRepeatedly(DoDefault());
+  }
+
+  this->test_updater_ptr_->SetInnerIterationGroup(group_number);
+  for (int update = 0; update < n_updates; ++update) {
+    *this->vector_to_stamp = update + 1.0;
+    this->test_updater_ptr_->UpdateScatteringSource(this->test_system_, group_number, angle_index);
+    EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result, *this->vector_to_stamp));
+  }
+  this->test_updater_ptr_->SetInnerIterationGroup(std::nullopt);
+  this->test_updater_ptr_->UpdateScatteringSource(this->test_system_, group_number, angle_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result, *this->vector_to_stamp));
+}
+
 // ===== UpdateFissionSource TEST ==============================================
 TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateFissionSourceTest) {
   system::EnergyGroup group_number(this->group_number);
@@ -221,6 +268,7 @@ TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateFissionSourceTest) {
   EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(scalar_index,
                                                            system::terms::VariableLinearTerms::kFissionSource))
       .WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, MarkModified(scalar_index));
   EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_)).WillOnce(DoDefault());
   EXPECT_CALL(*this->current_moments_obs_ptr_, moments()).WillOnce(DoDefault());
   for (auto& cell : this->cells_) {
@@ -242,6 +290,7 @@ TYPED_TEST(FormulationUpdaterDiffusionTest, UpdateFixedSourceTest) {
   bart::system::Index scalar_index{this->group_number, 0};
 
   EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(scalar_index)).WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, MarkModified(scalar_index));
   EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_)).WillOnce(DoDefault());
 
   for (auto& cell : this->cells_) {
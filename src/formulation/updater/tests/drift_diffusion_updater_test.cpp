@@ -20,7 +20,8 @@ template <int dim>
 using UpdaterTest = bart::formulation::updater::test_helpers::UpdaterTests<dim>;
 
 using ::testing::A;
-using ::testing::ContainerEq, ::testing::DoDefault, ::testing::_, ::testing::Ref, ::testing::Return, ::testing::ReturnRef;
+using ::testing::ContainerEq, ::testing::DoDefault, ::testing::_, ::testing::Invoke, ::testing::Ref, ::testing::Return,
+::testing::ReturnRef;
 
 template <typename DimensionWrapper>
 class FormulationUpdaterDriftDiffusionTest : public UpdaterTest<DimensionWrapper::value> {
@@ -73,6 +74,17 @@ void FormulationUpdaterDriftDiffusionTest<DimensionWrapper>::SetUp() {
   integrated_flux_calculator_obs_ptr_ = integrated_flux_calculator_ptr.get();
   auto stamper_ptr = std::shared_ptr<Stamper>(this->MakeStamper());
   stamper_obs_ptr_ = stamper_ptr.get();
+
+  // Batched fills are checked through the per-cell fill of each cell in the batch
+  using bart::formulation::updater::test_helpers::FillEachCellInBatch;
+  ON_CALL(*diffusion_formulation_obs_ptr_, FillCellStreamingTermBatch(_, _, _))
+      .WillByDefault(Invoke(FillEachCellInBatch<dim>(
+          [this](formulation::FullMatrix& cell_matrix, const domain::CellPtr<dim>& cell_ptr, int group) {
+            diffusion_formulation_obs_ptr_->FillCellStreamingTerm(cell_matrix, cell_ptr, group); })));
+  ON_CALL(*diffusion_formulation_obs_ptr_, FillCellCollisionTermBatch(_, _, _))
+      .WillByDefault(Invoke(FillEachCellInBatch<dim>(
+          [this](formulation::FullMatrix& cell_matrix, const domain::CellPtr<dim>& cell_ptr, int group) {
+            diffusion_formulation_obs_ptr_->FillCellCollisionTerm(cell_matrix, cell_ptr, group); })));
   high_order_moments_ptr_ = std::make_shared<HighOrderMoments>();
   group_scalar_flux_ = dealii::Vector<double>(angular_flux_size);
 
@@ -209,7 +221,9 @@ TYPED_TEST(FormulationUpdaterDriftDiffusionTest, UpdateFixedTermTest) {
   }
 
   EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrix(Ref(*this->matrix_to_stamp), _))
-      .Times(3)
+      .WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrixBatch(Ref(*this->matrix_to_stamp), _))
+      .Times(2)
       .WillRepeatedly(DoDefault());
   EXPECT_CALL(*this->stamper_obs_ptr_, StampBoundaryMatrix(Ref(*this->matrix_to_stamp), _))
       .Times(2)
@@ -1,5 +1,8 @@
 #include "formulation/updater/saaf_updater.h"
 
+#include <numeric>
+
+#include "quadrature/tests/quadrature_point_mock.hpp"
 #include "quadrature/tests/quadrature_set_mock.hpp"
 #include "formulation/angular/tests/self_adjoint_angular_flux_mock.h"
 #include "formulation/tests/stamper_mock.hpp"
@@ -15,7 +18,7 @@ using namespace bart;
 
 using ::testing::Return, ::testing::Ref, ::testing::Invoke, ::testing::_,
 ::testing::A, ::testing::WithArg, ::testing::DoDefault, ::testing::ReturnRef,
-::testing::NiceMock;
+::testing::NiceMock, ::testing::Not;
 
 template <typename DimensionWrapper>
 class FormulationUpdaterSAAFTest :
@@ -57,6 +60,20 @@ void FormulationUpdaterSAAFTest<DimensionWrapper>::SetUp() {
   stamper_obs_ptr_ = stamper_ptr.get();
   quadrature_set_ptr_ = std::make_shared<QuadratureSetType>();
 
+  // Batched fills are checked through the per-cell fill of each cell in the batch
+  using bart::formulation::updater::test_helpers::FillEachCellInBatch;
+  using QuadraturePointPtr = std::shared_ptr<quadrature::QuadraturePointI<dim>>;
+  ON_CALL(*formulation_obs_ptr_, FillCellStreamingTermBatch(_, _, _, _))
+      .WillByDefault(Invoke(FillEachCellInBatch<dim>(
+          [this](formulation::FullMatrix& cell_matrix, const domain::CellPtr<dim>& cell_ptr,
+                 const QuadraturePointPtr& quadrature_point, const system::EnergyGroup group) {
+            formulation_obs_ptr_->FillCellStreamingTerm(cell_matrix, cell_ptr, quadrature_point, group); })));
+  ON_CALL(*formulation_obs_ptr_, FillCellCollisionTermBatch(_, _, _))
+      .WillByDefault(Invoke(FillEachCellInBatch<dim>(
+          [this](formulation::FullMatrix& cell_matrix, const domain::CellPtr<dim>& cell_ptr,
+                 const system::EnergyGroup group) {
+            formulation_obs_ptr_->FillCellCollisionTerm(cell_matrix, cell_ptr, group); })));
+
   ON_CALL(*quadrature_set_ptr_, size())
       .WillByDefault(Return(this->total_angles));
 
@@ -183,6 +200,7 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateBoundaryConditionsTest) {
   EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetVariableTermPtr(
       this->index, VariableLinearTerms::kReflectiveBoundaryCondition))
       .WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, MarkModified(this->index));
   // -- Get the quadrature point identified by the passed index
   EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
       .WillOnce(Return(quadrature_point_ptr_));
@@ -258,6 +276,8 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsTest) {
       .WillOnce(DoDefault());
   EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(this->index))
       .WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, MarkModified(this->index));
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, MarkModified(this->index));
   EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
       .WillOnce(Return(quadrature_point_ptr_));
 
@@ -284,10 +304,12 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsTest) {
     }
   }
 
+  // The collision term is stamped into a separate matrix shared by all angles of the group
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrixBatch(_,_))
+      .WillOnce(DoDefault());
   EXPECT_CALL(*this->stamper_obs_ptr_,
-      StampMatrix(Ref(*this->matrix_to_stamp),_))
-      .Times(2)
-      .WillRepeatedly(DoDefault());
+      StampMatrixBatch(Ref(*this->matrix_to_stamp),_))
+      .WillOnce(DoDefault());
 
   EXPECT_CALL(*this->stamper_obs_ptr_,
       StampBoundaryMatrix(Ref(*this->matrix_to_stamp),_))
@@ -305,6 +327,153 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsTest) {
                                      *this->vector_to_stamp));
 }
 
+/* With a paired direction operator, the matrices shared by an angle and its
+ * opposite direction should be assembled once, when the pair index is updated,
+ * and no fixed matrices should be used. */
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsPairedDirectionsTest) {
+  constexpr int dim = this->dim;
+  using QuadraturePointType = quadrature::QuadraturePointI<dim>;
+  using QuadraturePointMockType = NiceMock<quadrature::QuadraturePointMock<dim>>;
+
+  system::EnergyGroup group_number(this->group_number);
+  const quadrature::QuadraturePointIndex quad_index(this->angle_index);
+  const quadrature::QuadraturePointIndex reflected_quad_index(this->reflected_angle_index);
+  std::shared_ptr<QuadraturePointType> quadrature_point_ptr = std::make_shared<QuadraturePointMockType>();
+  std::shared_ptr<QuadraturePointType> reflected_quadrature_point_ptr = std::make_shared<QuadraturePointMockType>();
+
+  std::vector<int> opposite_angles(this->reflected_angle_index + 1);
+  std::iota(opposite_angles.begin(), opposite_angles.end(), 0);
+  std::swap(opposite_angles.at(this->angle_index), opposite_angles.at(this->reflected_angle_index));
+  auto paired_operator_ptr = std::make_shared<system::terms::PairedDirectionOperator>(opposite_angles);
+  this->test_system_.left_hand_side_operator_ptr_ = paired_operator_ptr;
+  auto interior_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
+  auto boundary_correction_ptr = std::make_shared<system::MPISparseMatrix>();
+  interior_matrix_ptr->reinit(this->matrix_1);
+  boundary_correction_ptr->reinit(this->matrix_1);
+  this->StampMatrix(*interior_matrix_ptr, test_helpers::RandomDouble(1, 10));
+  this->StampMatrix(*boundary_correction_ptr, test_helpers::RandomDouble(1, 10));
+  paired_operator_ptr->SetInteriorTermPtr(this->index, interior_matrix_ptr);
+  paired_operator_ptr->SetBoundaryCorrectionPtr(this->index, boundary_correction_ptr);
+
+  EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetFixedTermPtr(A<system::Index>())).Times(0);
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(this->index)).WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(this->reflected_index)).WillOnce(DoDefault());
+  EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
+      .WillOnce(Return(quadrature_point_ptr));
+  // Used for the boundary terms of the pair, and for the fixed source of the opposite direction
+  EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(reflected_quad_index))
+      .Times(2)
+      .WillRepeatedly(Return(reflected_quadrature_point_ptr));
+
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellStreamingTerm(_, cell, quadrature_point_ptr, group_number));
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellCollisionTerm(_, cell, group_number));
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFixedSourceTerm(_, cell, _, group_number)).Times(2);
+    int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+    if (cell->at_boundary()) {
+      for (int face = 0; face < faces_per_cell; ++face) {
+        if (cell->face(face)->at_boundary()) {
+          // Both directions are filled for the interior matrix and the boundary correction
+          EXPECT_CALL(*this->formulation_obs_ptr_,
+                      FillBoundaryBilinearTerm(_, cell, domain::FaceIndex(face), quadrature_point_ptr,
+                                               group_number))
+              .Times(2);
+          EXPECT_CALL(*this->formulation_obs_ptr_,
+                      FillBoundaryBilinearTerm(_, cell, domain::FaceIndex(face), reflected_quadrature_point_ptr,
+                                               group_number))
+              .Times(2);
+        }
+      }
+    }
+  }
+
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrixBatch(_,_)).WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrixBatch(Ref(*interior_matrix_ptr),_)).WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampBoundaryMatrix(Ref(*interior_matrix_ptr),_)).WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampBoundaryMatrix(Ref(*boundary_correction_ptr),_)).WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(Ref(*this->vector_to_stamp),_))
+      .Times(2)
+      .WillRepeatedly(DoDefault());
+
+  this->test_updater_ptr->UpdateFixedTerms(this->test_system_, group_number, quad_index);
+  this->test_updater_ptr->UpdateFixedTerms(this->test_system_, group_number, reflected_quad_index);
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_result, *interior_matrix_ptr));
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_result, *boundary_correction_ptr));
+  EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result, *this->vector_to_stamp));
+}
+
+/* With angular decomposition enabled, the collision and streaming basis
+ * matrices should be stamped once for the group, and re-used for a second
+ * angle in the same group. */
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsAngularDecompositionTest) {
+  constexpr int dim = this->dim;
+  using QuadraturePointType = quadrature::QuadraturePointMock<dim>;
+
+  system::EnergyGroup group_number(this->group_number);
+  const std::array<quadrature::QuadraturePointIndex, 2> quad_indices{
+      quadrature::QuadraturePointIndex(this->angle_index),
+      quadrature::QuadraturePointIndex(this->reflected_angle_index)};
+  auto quadrature_point_ptr = std::make_shared<NiceMock<QuadraturePointType>>();
+  dealii::Tensor<1, dim> omega;
+  for (int i = 0; i < dim; ++i)
+    omega[i] = test_helpers::RandomDouble(-1, 1);
+  ON_CALL(*quadrature_point_ptr, cartesian_position_tensor()).WillByDefault(Return(omega));
+
+  EXPECT_FALSE(this->test_updater_ptr->use_angular_decomposition());
+  this->test_updater_ptr->set_use_angular_decomposition(true);
+  EXPECT_TRUE(this->test_updater_ptr->use_angular_decomposition());
+
+  for (const auto quad_index : quad_indices) {
+    EXPECT_CALL(*this->mock_lhs_obs_ptr_, GetFixedTermPtr(system::Index{group_number.get(), quad_index.get()}))
+        .WillOnce(DoDefault());
+    EXPECT_CALL(*this->mock_rhs_obs_ptr_, GetFixedTermPtr(system::Index{group_number.get(), quad_index.get()}))
+        .WillOnce(DoDefault());
+    EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
+        .WillOnce(Return(quadrature_point_ptr));
+  }
+
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellStreamingTerm(_, cell, _, _)).Times(0);
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellCollisionTerm(_, cell, group_number));
+    for (int a = 0; a < dim; ++a) {
+      for (int b = a; b < dim; ++b) {
+        EXPECT_CALL(*this->formulation_obs_ptr_, FillCellStreamingBasisTerm(_, cell, a, b, group_number));
+      }
+    }
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFixedSourceTerm(_, cell, _, group_number))
+        .Times(2);
+    int faces_per_cell = dealii::GeometryInfo<dim>::faces_per_cell;
+    if (cell->at_boundary()) {
+      for (int face = 0; face < faces_per_cell; ++face) {
+        if (cell->face(face)->at_boundary()) {
+          EXPECT_CALL(*this->formulation_obs_ptr_,
+                      FillBoundaryBilinearTerm(_, cell, domain::FaceIndex(face), _, group_number))
+              .Times(2);
+        }
+      }
+    }
+  }
+
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrix(_,_))
+      .Times(dim * (dim + 1) / 2)
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrix(Ref(*this->matrix_to_stamp),_)).Times(0);
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrixBatch(_,_)).WillOnce(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampMatrixBatch(Ref(*this->matrix_to_stamp),_)).Times(0);
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampBoundaryMatrix(Ref(*this->matrix_to_stamp),_))
+      .Times(2)
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(Ref(*this->vector_to_stamp),_))
+      .Times(2)
+      .WillRepeatedly(DoDefault());
+
+  for (const auto quad_index : quad_indices) {
+    this->test_updater_ptr->UpdateFixedTerms(this->test_system_, group_number, quad_index);
+    EXPECT_TRUE(test_helpers::AreEqual(this->expected_result, *this->matrix_to_stamp));
+    EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result, *this->vector_to_stamp));
+  }
+}
+
 TYPED_TEST(FormulationUpdaterSAAFTest, UpdateScatteringSourceTest) {
   constexpr int dim = this->dim;
   using QuadraturePointType = quadrature::QuadraturePointI<dim>;
@@ -319,6 +488,7 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateScatteringSourceTest) {
       this->index,
       system::terms::VariableLinearTerms::kScatteringSource))
       .WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, MarkModified(this->index));
   EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
       .WillOnce(Return(quadrature_point_ptr_));
   EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
@@ -362,6 +532,7 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFissionSourceTest) {
       this->index,
       system::terms::VariableLinearTerms::kFissionSource))
       .WillOnce(DoDefault());
+  EXPECT_CALL(*this->mock_rhs_obs_ptr_, MarkModified(this->index));
   EXPECT_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(quad_index))
       .WillOnce(Return(quadrature_point_ptr_));
   EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
@@ -389,4 +560,173 @@ TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFissionSourceTest) {
   EXPECT_DOUBLE_EQ(dynamic_ptr->value(), value_added);
 }
 
+/* During the inner iterations on a group, the scattering from other groups
+ * should be stamped once as angle-separable components, and only the in-group
+ * scattering stamped for each update. Once the inner iterations end, the full
+ * scattering source should be stamped again. */
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateScatteringSourceInnerIterationsTest) {
+  constexpr int dim = this->dim;
+  using QuadraturePointType = quadrature::QuadraturePointMock<dim>;
+
+  system::EnergyGroup group_number(this->group_number);
+  auto quadrature_point_ptr = std::make_shared<NiceMock<QuadraturePointType>>();
+  ON_CALL(*quadrature_point_ptr, cartesian_position_tensor())
+      .WillByDefault(Return(dealii::Tensor<1, dim>()));
+  ON_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(_))
+      .WillByDefault(Return(quadrature_point_ptr));
+  const int n_updates{ 2 };
+
+  for (auto& cell : this->cells_) {
+    for (int component = 0; component <= dim; ++component) {
+      EXPECT_CALL(*this->formulation_obs_ptr_, FillCellScatteringSourceComponent(
+          _, cell, component, group_number, _, Ref(this->current_iteration_moments_)))
+          .Times(1);
+    }
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellScatteringSourceTerm(
+        _, cell, _, group_number, _, Not(Ref(this->current_iteration_moments_))))
+        .Times(n_updates);
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellScatteringSourceTerm(
+        _, cell, _, group_number, _, Ref(this->current_iteration_moments_)))
+        .Times(1);
+  }
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
+      .Times((dim + 1) + n_updates + 1)
+      .WillRepeatedly(DoDefault());
+
+  this->test_updater_ptr->SetInnerIterationGroup(group_number);
+  for (const int angle : {this->angle_index, this->reflected_angle_index}) {
+    this->test_updater_ptr->UpdateScatteringSource(this->test_system_, group_number,
+                                                   quadrature::QuadraturePointIndex(angle));
+    EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result, *this->vector_to_stamp));
+  }
+  this->test_updater_ptr->SetInnerIterationGroup(std::nullopt);
+  this->test_updater_ptr->UpdateScatteringSource(this->test_system_, group_number,
+                                                 quadrature::QuadraturePointIndex(this->angle_index));
+}
+
+// ===== Angle-separable source tests ==========================================
+
+/* With angle-separable sources, the scattering source components should be
+ * stamped once for two angles with the same moments, and re-stamped when the
+ * moments change. */
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateScatteringSourceAngleSeparableTest) {
+  constexpr int dim = this->dim;
+  using QuadraturePointType = quadrature::QuadraturePointMock<dim>;
+
+  system::EnergyGroup group_number(this->group_number);
+  auto quadrature_point_ptr = std::make_shared<NiceMock<QuadraturePointType>>();
+  ON_CALL(*quadrature_point_ptr, cartesian_position_tensor())
+      .WillByDefault(Return(dealii::Tensor<1, dim>()));
+  ON_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(_))
+      .WillByDefault(Return(quadrature_point_ptr));
+
+  this->test_updater_ptr->set_use_angle_separable_sources(true);
+  EXPECT_TRUE(this->test_updater_ptr->use_angle_separable_sources());
+
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellScatteringSourceTerm(_, cell, _, _, _, _)).Times(0);
+    for (int component = 0; component <= dim; ++component) {
+      EXPECT_CALL(*this->formulation_obs_ptr_, FillCellScatteringSourceComponent(
+          _, cell, component, group_number, _, Ref(this->current_iteration_moments_)))
+          .Times(2);
+    }
+  }
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
+      .Times(2 * (dim + 1))
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(Ref(*this->vector_to_stamp),_)).Times(0);
+
+  for (const int angle : {this->angle_index, this->reflected_angle_index}) {
+    this->test_updater_ptr->UpdateScatteringSource(this->test_system_, group_number,
+                                                   quadrature::QuadraturePointIndex(angle));
+    EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result, *this->vector_to_stamp));
+  }
+  // A new version of the moments requires new source components
+  ++this->test_system_.current_moments_version;
+  this->test_updater_ptr->UpdateScatteringSource(this->test_system_, group_number,
+                                                 quadrature::QuadraturePointIndex(this->angle_index));
+}
+
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFissionSourceAngleSeparableTest) {
+  constexpr int dim = this->dim;
+  using QuadraturePointType = quadrature::QuadraturePointMock<dim>;
+
+  system::EnergyGroup group_number(this->group_number);
+  const double k_effective = 1.045;
+  this->test_system_.k_effective = k_effective;
+  auto quadrature_point_ptr = std::make_shared<NiceMock<QuadraturePointType>>();
+  ON_CALL(*quadrature_point_ptr, cartesian_position_tensor())
+      .WillByDefault(Return(dealii::Tensor<1, dim>()));
+  ON_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(_))
+      .WillByDefault(Return(quadrature_point_ptr));
+
+  this->test_updater_ptr->set_use_angle_separable_sources(true);
+
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFissionSourceTerm(_, cell, _, _, _, _, _)).Times(0);
+    for (int component = 0; component <= dim; ++component) {
+      EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFissionSourceComponent(
+          _, cell, component, group_number, k_effective,
+          Ref(this->current_iteration_moments_.at({group_number.get(), 0, 0})),
+          Ref(this->current_iteration_moments_)))
+          .Times(2);
+    }
+  }
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
+      .Times(2 * (dim + 1))
+      .WillRepeatedly(DoDefault());
+
+  for (const int angle : {this->angle_index, this->reflected_angle_index}) {
+    this->test_updater_ptr->UpdateFissionSource(this->test_system_, group_number,
+                                                quadrature::QuadraturePointIndex(angle));
+    EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result, *this->vector_to_stamp));
+  }
+  // Changing k_effective requires new source components
+  this->test_system_.k_effective = 2 * k_effective;
+  for (auto& cell : this->cells_) {
+    for (int component = 0; component <= dim; ++component) {
+      EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFissionSourceComponent(
+          _, cell, component, group_number, 2 * k_effective, _, _));
+    }
+  }
+  this->test_updater_ptr->UpdateFissionSource(this->test_system_, group_number,
+                                              quadrature::QuadraturePointIndex(this->angle_index));
+}
+
+TYPED_TEST(FormulationUpdaterSAAFTest, UpdateFixedTermsAngleSeparableTest) {
+  constexpr int dim = this->dim;
+  using QuadraturePointType = quadrature::QuadraturePointMock<dim>;
+
+  system::EnergyGroup group_number(this->group_number);
+  auto quadrature_point_ptr = std::make_shared<NiceMock<QuadraturePointType>>();
+  ON_CALL(*quadrature_point_ptr, cartesian_position_tensor())
+      .WillByDefault(Return(dealii::Tensor<1, dim>()));
+  ON_CALL(*this->quadrature_set_ptr_, GetQuadraturePoint(_))
+      .WillByDefault(Return(quadrature_point_ptr));
+
+  this->test_updater_ptr->set_use_angle_separable_sources(true);
+
+  for (auto& cell : this->cells_) {
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellStreamingTerm(_, cell, _, group_number)).Times(2);
+    // The collision term is shared by both angles
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellCollisionTerm(_, cell, group_number)).Times(1);
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillBoundaryBilinearTerm(_, cell, _, _, group_number))
+        .Times(::testing::AnyNumber());
+    EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFixedSourceTerm(_, cell, _, _)).Times(0);
+    for (int component = 0; component <= dim; ++component) {
+      EXPECT_CALL(*this->formulation_obs_ptr_, FillCellFixedSourceComponent(_, cell, component, group_number));
+    }
+  }
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(_,_))
+      .Times(dim + 1)
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->stamper_obs_ptr_, StampVector(Ref(*this->vector_to_stamp),_)).Times(0);
+
+  for (const int angle : {this->angle_index, this->reflected_angle_index}) {
+    this->test_updater_ptr->UpdateFixedTerms(this->test_system_, group_number,
+                                             quadrature::QuadraturePointIndex(angle));
+    EXPECT_TRUE(test_helpers::AreEqual(this->expected_vector_result, *this->vector_to_stamp));
+  }
+}
+
 } // namespace
@@ -15,6 +15,7 @@ class ScatteringSourceUpdaterMock : public ScatteringSourceUpdaterI {
   MOCK_METHOD(void, UpdateScatteringSource,
               (system::System&, system::EnergyGroup, quadrature::QuadraturePointIndex),
               (override));
+  MOCK_METHOD(void, SetInnerIterationGroup, (std::optional<system::EnergyGroup>), (override));
 };
 
 } // namespace updater
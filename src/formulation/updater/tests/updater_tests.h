@@ -1,10 +1,13 @@
 #ifndef BART_SRC_FORMULATION_UPDATER_TESTS_UPDATER_TESTS_H_
 #define BART_SRC_FORMULATION_UPDATER_TESTS_UPDATER_TESTS_H_
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <span>
 
 #include "domain/domain_types.hpp"
+#include "formulation/cell_batch_assembler.hpp"
 #include "formulation/formulation_types.hpp"
 #include "formulation/tests/stamper_mock.hpp"
 #include "system/terms/tests/bilinear_term_mock.hpp"
@@ -70,6 +73,8 @@ class UpdaterTests : public ::testing::Test,
   // Functions invoked by the Stamper to actually evaluate the passed function
   void EvaluateMatrixFunctionOnDomain(std::function<void(formulation::FullMatrix&,
                                                          const domain::CellPtr<dim>&)> stamp_function);
+  void EvaluateMatrixBatchFunctionOnDomain(std::function<void(std::span<formulation::FullMatrix>,
+                                                              std::span<const domain::CellPtr<dim>>)> stamp_function);
   void EvaluateVectorFunctionOnDomain(std::function<void(formulation::Vector&,
                                                          const domain::CellPtr<dim>&)> stamp_function);
   void EvaluateMatrixFunctionOnBoundary(std::function<void(formulation::FullMatrix&,
@@ -96,6 +101,8 @@ std::unique_ptr<StamperMock<dim>> UpdaterTests<dim>::MakeStamper() {
 
   ON_CALL(*mock_stamper_ptr, StampMatrix(_,_))
       .WillByDefault(WithArg<1>(Invoke(this, &formulation::updater::test_helpers::UpdaterTests<dim>::EvaluateMatrixFunctionOnDomain)));
+  ON_CALL(*mock_stamper_ptr, StampMatrixBatch(_,_))
+      .WillByDefault(WithArg<1>(Invoke(this, &formulation::updater::test_helpers::UpdaterTests<dim>::EvaluateMatrixBatchFunctionOnDomain)));
   ON_CALL(*mock_stamper_ptr, StampBoundaryMatrix(_,_))
       .WillByDefault(WithArg<1>(Invoke(this, &formulation::updater::test_helpers::UpdaterTests<dim>::EvaluateMatrixFunctionOnBoundary)));
   ON_CALL(*mock_stamper_ptr, StampVector(_,_))
@@ -206,6 +213,19 @@ void UpdaterTests<dim>::EvaluateMatrixFunctionOnDomain(
   }
 }
 
+template <int dim>
+void UpdaterTests<dim>::EvaluateMatrixBatchFunctionOnDomain(
+    std::function<void(std::span<formulation::FullMatrix>,
+                       std::span<const domain::CellPtr<dim>>)> stamp_function) {
+  std::vector<formulation::FullMatrix> to_stamp(formulation::kCellBatchSize);
+  const std::span<const domain::CellPtr<dim>> cells{ this->cells_ };
+  for (std::size_t batch_start = 0; batch_start < cells.size(); batch_start += formulation::kCellBatchSize) {
+    const std::size_t batch_size{ std::min<std::size_t>(formulation::kCellBatchSize, cells.size() - batch_start) };
+    stamp_function(std::span<formulation::FullMatrix>(to_stamp).first(batch_size),
+                   cells.subspan(batch_start, batch_size));
+  }
+}
+
 template <int dim>
 void UpdaterTests<dim>::EvaluateVectorFunctionOnDomain(
     std::function<void(formulation::Vector&,
@@ -252,6 +272,17 @@ void UpdaterTests<dim>::EvaluateVectorFunctionOnBoundary(
   }
 }
 
+/* Returns an action for a batched formulation fill function that calls the matching per-cell fill function for each
+ * cell in the batch, so that tests can set expectations for each cell. */
+template <int dim, typename CellFillFunction>
+auto FillEachCellInBatch(CellFillFunction cell_fill_function) {
+  return [cell_fill_function](std::span<formulation::FullMatrix> to_fill,
+                              std::span<const domain::CellPtr<dim>> cell_ptrs, auto... args) {
+    for (std::size_t i = 0; i < cell_ptrs.size(); ++i)
+      cell_fill_function(to_fill[i], cell_ptrs[i], args...);
+  };
+}
+
 } // namespace test_helpers
 
 } // namespace updater
@@ -2,6 +2,7 @@
 
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/mpi.h>
+#include <deal.II/base/multithread_info.h>
 #include <sstream>
 #include <fstream>
 #include <quadrature/calculators/angular_flux_integrator.hpp>
@@ -28,9 +29,12 @@
 #include "domain/mesh/mesh_cartesian.hpp"
 
 // Formulation classes
+#include "formulation/angular/saaf_matrix_free_operator.hpp"
 #include "formulation/angular/self_adjoint_angular_flux.h"
 #include "formulation/scalar/diffusion.hpp"
+#include "formulation/scalar/diffusion_matrix_free_operator.hpp"
 #include "formulation/scalar/drift_diffusion.hpp"
+#include "formulation/parallel_stamper.hpp"
 #include "formulation/stamper.hpp"
 #include "formulation/updater/saaf_updater.h"
 #include "formulation/updater/diffusion_updater.hpp"
@@ -66,6 +70,7 @@
 
 // System classes
 #include "system/system.hpp"
+#include "system/terms/paired_direction_operator.hpp"
 #include "system/solution/mpi_group_angular_solution.h"
 #include "system/solution/solution_types.h"
 
@@ -112,6 +117,29 @@ auto FrameworkBuilder<dim>::BuildDiffusionFormulation(const std::shared_ptr<Fini
   return return_ptr;
 }
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildDiffusionMatrixFreeOperator(
+    const Domain& domain,
+    const std::shared_ptr<CrossSections>& cross_sections_ptr,
+    const std::set<problem::Boundary>& reflective_boundaries,
+    const FrameworkParameters::PolynomialDegree polynomial_degree,
+    const std::shared_ptr<data::cross_sections::OneGroupCrossSectionsI>& one_group_cross_sections_ptr)
+-> std::shared_ptr<LeftHandSideOperator> {
+  ReportBuildingComponant("Matrix-free diffusion operator");
+  std::shared_ptr<LeftHandSideOperator> return_ptr{ nullptr };
+  try {
+    return_ptr = formulation::scalar::MakeDiffusionMatrixFreeOperator<dim>(domain, cross_sections_ptr,
+                                                                          reflective_boundaries,
+                                                                          polynomial_degree.get(),
+                                                                          one_group_cross_sections_ptr);
+    ReportBuildSuccess("Matrix-free diffusion operator with geometric multigrid preconditioner");
+  } catch (...) {
+    ReportBuildError("matrix-free diffusion operator initialization error.");
+    throw;
+  }
+  return return_ptr;
+}
+
 template<int dim>
 auto FrameworkBuilder<dim>::BuildDriftDiffusionFormulation(
     const std::shared_ptr<AngularFluxIntegrator>& angular_flux_integrator_ptr,
@@ -128,7 +156,8 @@ template<int dim>
 auto FrameworkBuilder<dim>::BuildDomain(FrameworkParameters::DomainSize domain_size,
                                         FrameworkParameters::NumberOfCells number_of_cells,
                                         const std::shared_ptr<FiniteElement>& finite_element_ptr,
-                                        std::string material_mapping) -> std::unique_ptr<Domain> {
+                                        std::string material_mapping,
+                                        const bool build_multigrid_hierarchy) -> std::unique_ptr<Domain> {
   std::unique_ptr<Domain> return_ptr = nullptr;
   try {
     ReportBuildingComponant("Mesh");
@@ -137,7 +166,9 @@ auto FrameworkBuilder<dim>::BuildDomain(FrameworkParameters::DomainSize domain_s
     ReportBuildSuccess(mesh_ptr->description());
 
     ReportBuildingComponant("Domain");
-    return_ptr = std::move(std::make_unique<domain::Domain<dim>>(std::move(mesh_ptr), finite_element_ptr));
+    return_ptr = std::move(std::make_unique<domain::Domain<dim>>(std::move(mesh_ptr), finite_element_ptr,
+                                                                 problem::DiscretizationType::kContinuousFEM,
+                                                                 build_multigrid_hierarchy));
     ReportBuildSuccess(return_ptr->description());
   } catch (...) {
     ReportBuildError();
@@ -159,7 +190,9 @@ auto FrameworkBuilder<dim>::BuildFiniteElement(problem::CellFiniteElementType fi
     switch (finite_element_type) {
       case problem::CellFiniteElementType::kGaussian: {
         using ReturnType = domain::finite_element::FiniteElementGaussian<dim>;
-        return_ptr = std::move(std::make_unique<ReturnType>(discretization_type, polynomial_degree.get()));
+        auto finite_element_ptr = std::make_unique<ReturnType>(discretization_type, polynomial_degree.get());
+        finite_element_ptr->set_cell_kernels(domain::finite_element::SelectCellKernels<dim>(polynomial_degree.get()));
+        return_ptr = std::move(finite_element_ptr);
       }
     }
   } catch (...) {
@@ -247,6 +280,7 @@ auto FrameworkBuilder<dim>::BuildUpdaterPointers(
   auto saaf_updater_ptr = std::make_shared<ReturnType>(std::move(formulation_ptr),
                                                        std::move(stamper_ptr),
                                                        quadrature_set_ptr);
+  saaf_updater_ptr->set_use_angular_decomposition(true).set_use_angle_separable_sources(true);
   ReportBuildSuccess(saaf_updater_ptr->description());
   return_struct.fixed_updater_ptr = saaf_updater_ptr;
   return_struct.scattering_source_updater_ptr = saaf_updater_ptr;
@@ -280,6 +314,7 @@ auto FrameworkBuilder<dim>::BuildUpdaterPointers(
                                                        quadrature_set_ptr,
                                                        angular_flux_storage,
                                                        reflective_boundary_set);
+  saaf_updater_ptr->set_use_angular_decomposition(true).set_use_angle_separable_sources(true);
   ReportBuildSuccess(saaf_updater_ptr->description());
 
   return_struct.fixed_updater_ptr = saaf_updater_ptr;
@@ -545,6 +580,27 @@ auto FrameworkBuilder<dim>::BuildOuterIteration(
   return return_ptr;
 }
 
+template<int dim>
+auto FrameworkBuilder<dim>::BuildPairedDirectionOperator(const std::shared_ptr<QuadratureSet>& quadrature_set_ptr)
+-> std::shared_ptr<LeftHandSideOperator> {
+  ReportBuildingComponant("Paired direction operator");
+  // Directions without a reflection in the quadrature set are paired with themselves
+  std::vector<int> opposite_angles;
+  for (int angle = 0; angle < static_cast<int>(quadrature_set_ptr->size()); ++angle) {
+    const auto quadrature_point_ptr = quadrature_set_ptr->GetQuadraturePoint(quadrature::QuadraturePointIndex(angle));
+    opposite_angles.push_back(quadrature_set_ptr->GetReflectionIndex(quadrature_point_ptr).value_or(angle));
+  }
+  std::shared_ptr<LeftHandSideOperator> return_ptr{ nullptr };
+  try {
+    return_ptr = std::make_shared<system::terms::PairedDirectionOperator>(opposite_angles);
+    ReportBuildSuccess("Paired direction operator");
+  } catch (...) {
+    ReportBuildError("paired direction operator initialization error.");
+    throw;
+  }
+  return return_ptr;
+}
+
 template<int dim>
 auto FrameworkBuilder<dim>::BuildParameterConvergenceChecker(
     double max_delta, int max_iterations)
@@ -623,18 +679,74 @@ auto FrameworkBuilder<dim>::BuildSAAFFormulation(
 }
 
 template<int dim>
-auto FrameworkBuilder<dim>::BuildSingleGroupSolver(const int max_iterations, const double convergence_tolerance)
+auto FrameworkBuilder<dim>::BuildSAAFMatrixFreeOperator(
+    const Domain& domain,
+    const std::shared_ptr<CrossSections>& cross_sections_ptr,
+    const std::shared_ptr<QuadratureSet>& quadrature_set_ptr,
+    const FrameworkParameters::PolynomialDegree polynomial_degree) -> std::shared_ptr<LeftHandSideOperator> {
+  ReportBuildingComponant("Matrix-free SAAF operator");
+  std::shared_ptr<LeftHandSideOperator> return_ptr{ nullptr };
+  try {
+    return_ptr = formulation::angular::MakeSAAFMatrixFreeOperator<dim>(domain, cross_sections_ptr, quadrature_set_ptr,
+                                                                       polynomial_degree.get());
+    ReportBuildSuccess("Matrix-free SAAF operator");
+  } catch (...) {
+    ReportBuildError("matrix-free SAAF operator initialization error.");
+    throw;
+  }
+  return return_ptr;
+}
+
+template<int dim>
+auto FrameworkBuilder<dim>::BuildSingleGroupSolver(const problem::LinearSolverType linear_solver_type,
+                                                   const int max_iterations, const double convergence_tolerance,
+                                                   const problem::PreconditionerType preconditioner_type,
+                                                   const bool use_inexact_solves)
 -> std::unique_ptr<SingleGroupSolver> {
   using SolverName = solver::builder::SolverName;
   using SolverBuilder = solver::builder::SolverBuilder;
+  using LinearSolverType = problem::LinearSolverType;
 
   ReportBuildingComponant("Single group solver");
   std::unique_ptr<SingleGroupSolver> return_ptr = nullptr;
 
-  return_ptr = std::move(SolverBuilder::BuildSolver(SolverName::kDefaultGMRESGroupSolver, max_iterations,
-                                                    convergence_tolerance));
+  SolverName solver_name{ SolverName::kDefaultGMRESGroupSolver };
+  std::string solver_description{ "GMRES" };
+  switch (linear_solver_type) {
+    case LinearSolverType::kConjugateGradient: {
+      solver_name = SolverName::kDefaultConjugateGradientGroupSolver;
+      solver_description = "conjugate gradient";
+      break;
+    }
+    case LinearSolverType::kBiCGStab: {
+      solver_name = SolverName::kDefaultBiCGStabGroupSolver;
+      solver_description = "BiCGStab";
+      break;
+    }
+    case LinearSolverType::kDirectLU: {
+      solver_name = SolverName::kDefaultDirectLUGroupSolver;
+      solver_description = "direct LU solver";
+      break;
+    }
+    case LinearSolverType::kDirectCholesky: {
+      solver_name = SolverName::kDefaultDirectCholeskyGroupSolver;
+      solver_description = "direct Cholesky solver";
+      break;
+    }
+    case LinearSolverType::kMixedPrecisionGMRES: {
+      solver_name = SolverName::kDefaultMixedPrecisionGMRESGroupSolver;
+      solver_description = "mixed precision GMRES";
+      break;
+    }
+    case LinearSolverType::kNone:
+    case LinearSolverType::kGMRES:
+      break;
+  }
+
+  return_ptr = std::move(SolverBuilder::BuildSolver(solver_name, max_iterations, convergence_tolerance,
+                                                    preconditioner_type, use_inexact_solves));
 
-  ReportBuildSuccess("Default implementation with GMRES");
+  ReportBuildSuccess("Default implementation with " + solver_description);
 
   return return_ptr;
 }
@@ -646,7 +758,8 @@ auto FrameworkBuilder<dim>::BuildSystem(
     const Domain& domain,
     const std::size_t solution_size,
     bool is_eigenvalue_problem,
-    bool need_rhs_boundary_condition) -> std::unique_ptr<System> {
+    bool need_rhs_boundary_condition,
+    const std::shared_ptr<LeftHandSideOperator>& left_hand_side_operator_ptr) -> std::unique_ptr<System> {
   std::unique_ptr<System> return_ptr;
 
   ReportBuildingComponant("system");
@@ -654,6 +767,8 @@ auto FrameworkBuilder<dim>::BuildSystem(
     return_ptr = std::move(std::make_unique<System>());
     system_helper_.InitializeSystem(*return_ptr, total_groups, total_angles,
                              is_eigenvalue_problem, need_rhs_boundary_condition);
+    // Must be set before the terms are set up so that left hand side matrices are not allocated
+    return_ptr->left_hand_side_operator_ptr_ = left_hand_side_operator_ptr;
     system_helper_.SetUpSystemTerms(*return_ptr, domain);
     system_helper_.SetUpSystemMoments(*return_ptr, solution_size);
     ReportBuildSuccess("system");
@@ -666,11 +781,18 @@ auto FrameworkBuilder<dim>::BuildSystem(
 }
 
 template<int dim>
-auto FrameworkBuilder<dim>::BuildStamper(const std::shared_ptr<Domain>& domain_ptr) -> std::unique_ptr<Stamper> {
+auto FrameworkBuilder<dim>::BuildStamper(const std::shared_ptr<Domain>& domain_ptr,
+                                         const bool stamp_cells_in_parallel) -> std::unique_ptr<Stamper> {
   ReportBuildingComponant("Stamper");
   std::unique_ptr<Stamper> return_ptr = nullptr;
 
-  return_ptr = std::move(std::make_unique<formulation::Stamper<dim>>(domain_ptr));
+  // Formulations are safe to fill from multiple threads, but a parallel stamper is only used if it is requested and
+  // more than one thread is available
+  if (stamp_cells_in_parallel && dealii::MultithreadInfo::n_threads() > 1) {
+    return_ptr = std::move(std::make_unique<formulation::ParallelStamper<dim>>(domain_ptr));
+  } else {
+    return_ptr = std::move(std::make_unique<formulation::Stamper<dim>>(domain_ptr));
+  }
   ReportBuildSuccess(return_ptr->description());
   return return_ptr;
 }
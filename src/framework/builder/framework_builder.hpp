@@ -33,6 +33,7 @@ class FrameworkBuilder : public data_port::StatusDataPort, public FrameworkBuild
   using typename FrameworkBuilderI<dim>::GroupSolveIteration;
   using typename FrameworkBuilderI<dim>::Initializer;
   using typename FrameworkBuilderI<dim>::KEffectiveUpdater;
+  using typename FrameworkBuilderI<dim>::LeftHandSideOperator;
   using typename FrameworkBuilderI<dim>::MomentCalculator;
   using typename FrameworkBuilderI<dim>::MomentConvergenceChecker;
   using typename FrameworkBuilderI<dim>::MomentMapConvergenceChecker;
@@ -76,6 +77,17 @@ class FrameworkBuilder : public data_port::StatusDataPort, public FrameworkBuild
       const std::shared_ptr<data::cross_sections::CrossSectionsI>&,
       const DiffusionFormulationImpl implementation = DiffusionFormulationImpl::kDefault)
   -> std::unique_ptr<DiffusionFormulation> override;
+  /*! \brief Builds a matrix-free diffusion left hand side operator with a geometric multigrid preconditioner.
+   *
+   * If one-group cross-sections are provided, the operator matches the two-grid diffusion formulation.
+   */
+  [[nodiscard]] auto BuildDiffusionMatrixFreeOperator(
+      const Domain&,
+      const std::shared_ptr<CrossSections>&,
+      const std::set<problem::Boundary>& reflective_boundaries,
+      const FrameworkParameters::PolynomialDegree,
+      const std::shared_ptr<data::cross_sections::OneGroupCrossSectionsI>&)
+  -> std::shared_ptr<LeftHandSideOperator> override;
 
   [[nodiscard]] auto BuildDriftDiffusionFormulation(
       const std::shared_ptr<AngularFluxIntegrator>&,
@@ -85,7 +97,8 @@ class FrameworkBuilder : public data_port::StatusDataPort, public FrameworkBuild
   [[nodiscard]] auto BuildDomain(const FrameworkParameters::DomainSize,
                                  const FrameworkParameters::NumberOfCells,
                                  const std::shared_ptr<FiniteElement>&,
-                                 const std::string material_mapping) -> std::unique_ptr<Domain> override;
+                                 const std::string material_mapping,
+                                 const bool build_multigrid_hierarchy) -> std::unique_ptr<Domain> override;
   [[nodiscard]] auto BuildFiniteElement(
       const problem::CellFiniteElementType finite_element_type,
       const problem::DiscretizationType discretization_type,
@@ -133,6 +146,8 @@ class FrameworkBuilder : public data_port::StatusDataPort, public FrameworkBuild
       std::unique_ptr<KEffectiveUpdater>,
       const std::shared_ptr<FissionSourceUpdater>&,
       const std::string& output_filename_base) -> std::unique_ptr<OuterIteration> override;
+  [[nodiscard]] auto BuildPairedDirectionOperator(
+      const std::shared_ptr<QuadratureSet>&) -> std::shared_ptr<LeftHandSideOperator> override;
   [[nodiscard]] auto BuildParameterConvergenceChecker(
       double max_delta,
       int max_iterations) -> std::unique_ptr<ParameterConvergenceChecker> override;
@@ -145,10 +160,20 @@ class FrameworkBuilder : public data_port::StatusDataPort, public FrameworkBuild
       const std::shared_ptr<QuadratureSet>&,
       const formulation::SAAFFormulationImpl implementation = formulation::SAAFFormulationImpl::kDefault)
   -> std::unique_ptr<SAAFFormulation> override;
+  /*! \brief Builds a matrix-free SAAF left hand side operator, specialized for polynomial degrees 1 to 3. */
+  [[nodiscard]] auto BuildSAAFMatrixFreeOperator(
+      const Domain&,
+      const std::shared_ptr<CrossSections>&,
+      const std::shared_ptr<QuadratureSet>&,
+      const FrameworkParameters::PolynomialDegree) -> std::shared_ptr<LeftHandSideOperator> override;
   [[nodiscard]] auto BuildSingleGroupSolver(
+      const problem::LinearSolverType,
       const int max_iterations,
-      const double convergence_tolerance) -> std::unique_ptr<SingleGroupSolver> override;
-  [[nodiscard]] auto BuildStamper(const std::shared_ptr<Domain>&) -> std::unique_ptr<Stamper> override;
+      const double convergence_tolerance,
+      const problem::PreconditionerType,
+      const bool use_inexact_solves) -> std::unique_ptr<SingleGroupSolver> override;
+  [[nodiscard]] auto BuildStamper(const std::shared_ptr<Domain>&,
+                                  const bool stamp_cells_in_parallel) -> std::unique_ptr<Stamper> override;
   [[nodiscard]] auto BuildSubroutine(std::unique_ptr<FrameworkI>,
                                      const SubroutineName) -> std::unique_ptr<Subroutine> override;
   [[nodiscard]] auto BuildSystem(const int n_groups,
@@ -156,7 +181,9 @@ class FrameworkBuilder : public data_port::StatusDataPort, public FrameworkBuild
                                  const Domain& domain,
                                  const std::size_t solution_size,
                                  bool is_eigenvalue_problem,
-                                 bool need_rhs_boundary_condition) -> std::unique_ptr<System> override;
+                                 bool need_rhs_boundary_condition,
+                                 const std::shared_ptr<LeftHandSideOperator>& left_hand_side_operator_ptr)
+  -> std::unique_ptr<System> override;
 
   [[nodiscard]] auto BuildUpdaterPointers(std::unique_ptr<DiffusionFormulation>,
                                     std::unique_ptr<DriftDiffusionFormulation>,
@@ -2,6 +2,7 @@
 #define BART_SRC_FRAMEWORK_BUILDER_FRAMEWORK_BUILDER_I_HPP_
 
 #include <memory>
+#include <set>
 #include <string>
 
 #include "data/cross_sections/material_cross_sections.hpp"
@@ -36,6 +37,7 @@
 #include "system/moments/spherical_harmonic_types.h"
 #include "system/solution/solution_types.h"
 #include "system/system.hpp"
+#include "system/terms/bilinear_operator_i.hpp"
 #include "utility/colors.hpp"
 
 namespace bart::framework::builder {
@@ -55,6 +57,7 @@ class FrameworkBuilderI {
   using GroupSolveIteration = iteration::group::GroupSolveIterationI;
   using Initializer = iteration::initializer::InitializerI;
   using KEffectiveUpdater = eigenvalue::k_eigenvalue::K_EigenvalueCalculatorI;
+  using LeftHandSideOperator = system::terms::BilinearOperatorI;
   using MomentCalculator = quadrature::calculators::SphericalHarmonicMomentsI;
   using MomentConvergenceChecker = convergence::IterationCompletionCheckerI<system::moments::MomentVector>;
   using MomentMapConvergenceChecker = convergence::IterationCompletionCheckerI<system::moments::MomentsMap>;
@@ -105,6 +108,13 @@ class FrameworkBuilderI {
       const std::shared_ptr<FiniteElement>&,
       const std::shared_ptr<data::cross_sections::CrossSectionsI>&,
       const DiffusionFormulationImpl) -> std::unique_ptr<DiffusionFormulation> = 0;
+  virtual auto BuildDiffusionMatrixFreeOperator(
+      const Domain&,
+      const std::shared_ptr<CrossSections>&,
+      const std::set<problem::Boundary>& reflective_boundaries,
+      const FrameworkParameters::PolynomialDegree,
+      const std::shared_ptr<data::cross_sections::OneGroupCrossSectionsI>&)
+  -> std::shared_ptr<LeftHandSideOperator> = 0;
   virtual auto BuildDriftDiffusionFormulation(
       const std::shared_ptr<AngularFluxIntegrator>&,
       const std::shared_ptr<FiniteElement>&,
@@ -112,7 +122,8 @@ class FrameworkBuilderI {
   virtual auto BuildDomain(const FrameworkParameters::DomainSize,
                            const FrameworkParameters::NumberOfCells,
                            const std::shared_ptr<FiniteElement>&,
-                           const std::string material_mapping) -> std::unique_ptr<Domain> = 0;
+                           const std::string material_mapping,
+                           const bool build_multigrid_hierarchy) -> std::unique_ptr<Domain> = 0;
   virtual auto BuildFiniteElement(
       const problem::CellFiniteElementType,
       const problem::DiscretizationType,
@@ -153,6 +164,8 @@ class FrameworkBuilderI {
       std::unique_ptr<KEffectiveUpdater>,
       const std::shared_ptr<FissionSourceUpdater>&,
       const std::string& output_filename_base) -> std::unique_ptr<OuterIteration> = 0;
+  virtual auto BuildPairedDirectionOperator(
+      const std::shared_ptr<QuadratureSet>&) -> std::shared_ptr<LeftHandSideOperator> = 0;
   virtual auto BuildParameterConvergenceChecker(double max_delta,
                                                 int max_iterations) -> std::unique_ptr<ParameterConvergenceChecker> = 0;
   virtual auto BuildQuadratureSet(
@@ -162,16 +175,27 @@ class FrameworkBuilderI {
                                     const std::shared_ptr<data::cross_sections::CrossSectionsI>&,
                                     const std::shared_ptr<QuadratureSet>&,
                                     const formulation::SAAFFormulationImpl) -> std::unique_ptr<SAAFFormulation> = 0;
-  virtual auto BuildSingleGroupSolver(const int max_iterations,
-                                      const double convergence_tolerance) -> std::unique_ptr<SingleGroupSolver> = 0;
-  virtual auto BuildStamper(const std::shared_ptr<Domain>&) -> std::unique_ptr<Stamper> = 0;
+  virtual auto BuildSAAFMatrixFreeOperator(
+      const Domain&,
+      const std::shared_ptr<CrossSections>&,
+      const std::shared_ptr<QuadratureSet>&,
+      const FrameworkParameters::PolynomialDegree) -> std::shared_ptr<LeftHandSideOperator> = 0;
+  virtual auto BuildSingleGroupSolver(const problem::LinearSolverType,
+                                      const int max_iterations,
+                                      const double convergence_tolerance,
+                                      const problem::PreconditionerType,
+                                      const bool use_inexact_solves) -> std::unique_ptr<SingleGroupSolver> = 0;
+  virtual auto BuildStamper(const std::shared_ptr<Domain>&,
+                            const bool stamp_cells_in_parallel) -> std::unique_ptr<Stamper> = 0;
   virtual auto BuildSubroutine(std::unique_ptr<FrameworkI>, const SubroutineName) -> std::unique_ptr<Subroutine> = 0;
   virtual auto BuildSystem(const int n_groups,
                            const int n_angles,
                            const Domain& domain,
                            const std::size_t solution_size,
                            bool is_eigenvalue_problem,
-                           bool need_rhs_boundary_condition) -> std::unique_ptr<System> = 0;
+                           bool need_rhs_boundary_condition,
+                           const std::shared_ptr<LeftHandSideOperator>& left_hand_side_operator_ptr)
+  -> std::unique_ptr<System> = 0;
 
   virtual auto BuildUpdaterPointers(std::unique_ptr<DiffusionFormulation>,
                                     std::unique_ptr<DriftDiffusionFormulation>,
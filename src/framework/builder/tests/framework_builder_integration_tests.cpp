@@ -1,6 +1,7 @@
 #include <stdio.h>
 #include <filesystem>
 
+#include <deal.II/base/multithread_info.h>
 #include <deal.II/fe/fe_q.h>
 
 #include "framework/builder/framework_builder.hpp"
@@ -21,6 +22,7 @@
 #include "formulation/updater/saaf_updater.h"
 #include "formulation/updater/diffusion_updater.hpp"
 #include "formulation/updater/drift_diffusion_updater.hpp"
+#include "formulation/parallel_stamper.hpp"
 #include "formulation/stamper.hpp"
 #include "instrumentation/instrument.h"
 #include "instrumentation/basic_instrument.h"
@@ -30,7 +32,10 @@
 #include "quadrature/calculators/angular_flux_integrator.hpp"
 #include "quadrature/calculators/spherical_harmonic_zeroth_moment.h"
 #include "quadrature/quadrature_set.hpp"
+#include "solver/linear/conjugate_gradient.hpp"
+#include "solver/linear/direct.hpp"
 #include "solver/linear/gmres.h"
+#include "solver/linear/mixed_precision_gmres.hpp"
 #include "solver/group/single_group_solver.h"
 #include "system/solution/mpi_group_angular_solution.h"
 #include "iteration/initializer/initialize_fixed_terms_once.h"
@@ -40,6 +45,7 @@
 #include "system/system_types.h"
 #include "system/solution/solution_types.h"
 #include "system/system_helper.hpp"
+#include "system/terms/paired_direction_operator.hpp"
 
 // Mock objects
 #include "convergence/tests/convergence_checker_mock.hpp"
@@ -62,6 +68,7 @@
 #include "problem/tests/parameters_mock.hpp"
 #include "formulation/updater/tests/fixed_updater_mock.h"
 #include "quadrature/calculators/tests/angular_flux_integrator_mock.hpp"
+#include "quadrature/tests/quadrature_point_mock.hpp"
 #include "quadrature/tests/quadrature_set_mock.hpp"
 #include "quadrature/calculators/tests/spherical_harmonic_moments_mock.h"
 #include "solver/group/tests/single_group_solver_mock.h"
@@ -405,6 +412,10 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSAAFUpdaterPointers) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
   EXPECT_THAT(updater_struct.fission_source_updater_ptr.get(),
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  auto saaf_updater_ptr = dynamic_cast<ExpectedType*>(updater_struct.fixed_updater_ptr.get());
+  ASSERT_NE(saaf_updater_ptr, nullptr);
+  EXPECT_TRUE(saaf_updater_ptr->use_angular_decomposition());
+  EXPECT_TRUE(saaf_updater_ptr->use_angle_separable_sources());
 }
 
 TYPED_TEST(FrameworkBuilderIntegrationTest,
@@ -429,6 +440,10 @@ TYPED_TEST(FrameworkBuilderIntegrationTest,
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
   EXPECT_THAT(updater_struct.boundary_conditions_updater_ptr.get(),
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  auto saaf_updater_ptr = dynamic_cast<ExpectedType*>(updater_struct.fixed_updater_ptr.get());
+  ASSERT_NE(saaf_updater_ptr, nullptr);
+  EXPECT_TRUE(saaf_updater_ptr->use_angular_decomposition());
+  EXPECT_TRUE(saaf_updater_ptr->use_angle_separable_sources());
 }
 
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainParametersTest) {
@@ -439,11 +454,19 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainParametersTest) {
   auto test_domain_ptr = this->test_builder_ptr_->BuildDomain(Parameters::DomainSize(this->spatial_max),
                                                               Parameters::NumberOfCells(this->n_cells),
                                                               finite_element_ptr,
-                                                              "1 1 2 2");
+                                                              "1 1 2 2", false);
 
   using ExpectedType = domain::Domain<this->dim>;
 
   ASSERT_THAT(test_domain_ptr.get(), WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_FALSE(dynamic_cast<ExpectedType*>(test_domain_ptr.get())->build_multigrid_hierarchy());
+
+  auto multigrid_domain_ptr = this->test_builder_ptr_->BuildDomain(Parameters::DomainSize(this->spatial_max),
+                                                                   Parameters::NumberOfCells(this->n_cells),
+                                                                   finite_element_ptr,
+                                                                   "1 1 2 2", true);
+  ASSERT_THAT(multigrid_domain_ptr.get(), WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  EXPECT_TRUE(dynamic_cast<ExpectedType*>(multigrid_domain_ptr.get())->build_multigrid_hierarchy());
 }
 
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainNullFiniteElementPtr) {
@@ -452,7 +475,7 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainNullFiniteElementPtr) {
   auto test_domain_ptr = this->test_builder_ptr_->BuildDomain(Parameters::DomainSize(this->spatial_max),
                                                               Parameters::NumberOfCells(this->n_cells),
                                                               nullptr,
-                                                              "1 1 2 2");
+                                                              "1 1 2 2", false);
                    });
 }
 
@@ -469,7 +492,7 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainBadDomainSize) {
     auto test_domain_ptr = this->test_builder_ptr_->BuildDomain(Parameters::DomainSize(bad_spatial_max),
                                                                 Parameters::NumberOfCells(this->n_cells),
                                                                 finite_element_ptr,
-                                                                "1 1 2 2");
+                                                                "1 1 2 2", false);
                    });
 }
 
@@ -486,7 +509,7 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildDomainBadNCells) {
                      auto test_domain_ptr = this->test_builder_ptr_->BuildDomain(Parameters::DomainSize(this->spatial_max),
                                                                                  Parameters::NumberOfCells(bad_n_cells),
                                                                                  finite_element_ptr,
-                                                                                 "1 1 2 2");
+                                                                                 "1 1 2 2", false);
                    });
 }
 
@@ -556,6 +579,11 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildFiniteElementFrameworkParameter
   EXPECT_EQ(finite_element_ptr->polynomial_degree(), this->polynomial_degree);
   auto dealii_finite_element_ptr = dynamic_cast<dealii::FE_Q<dim>*>(finite_element_ptr->finite_element());
   ASSERT_NE(dealii_finite_element_ptr, nullptr);
+  const auto& cell_kernels = finite_element_ptr->cell_kernels();
+  EXPECT_TRUE(cell_kernels.is_specialized());
+  EXPECT_EQ(cell_kernels.dofs_per_cell, finite_element_ptr->dofs_per_cell());
+  EXPECT_EQ(cell_kernels.n_cell_quad_pts, finite_element_ptr->n_cell_quad_pts());
+  EXPECT_EQ(cell_kernels.n_face_quad_pts, finite_element_ptr->n_face_quad_pts());
 }
 
 // BuildFiniteElement should throw if bad parameters are passed
@@ -620,6 +648,34 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BulidMomentCalculatorAngular) {
               WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+/* Angles should be paired with the index of their reflection in the quadrature
+ * set, and angles without a reflection with themselves. */
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildPairedDirectionOperator) {
+  constexpr int dim = this->dim;
+  using QuadraturePointType = quadrature::QuadraturePointI<dim>;
+  const std::vector<std::optional<int>> reflection_indices{1, 0, std::nullopt};
+  const int n_angles{ static_cast<int>(reflection_indices.size()) };
+
+  EXPECT_CALL(*this->quadrature_set_sptr_, size()).WillRepeatedly(Return(n_angles));
+  std::vector<std::shared_ptr<QuadraturePointType>> quadrature_points;
+  for (int angle = 0; angle < n_angles; ++angle) {
+    quadrature_points.push_back(std::make_shared<quadrature::QuadraturePointMock<dim>>());
+    EXPECT_CALL(*this->quadrature_set_sptr_, GetQuadraturePoint(quadrature::QuadraturePointIndex(angle)))
+        .WillOnce(Return(quadrature_points.back()));
+    EXPECT_CALL(*this->quadrature_set_sptr_, GetReflectionIndex(quadrature_points.back()))
+        .WillOnce(Return(reflection_indices.at(angle)));
+  }
+
+  auto operator_ptr = this->test_builder_ptr_->BuildPairedDirectionOperator(this->quadrature_set_sptr_);
+  using ExpectedType = system::terms::PairedDirectionOperator;
+  ASSERT_THAT(operator_ptr.get(), WhenDynamicCastTo<ExpectedType*>(NotNull()));
+  auto paired_direction_operator_ptr = dynamic_cast<ExpectedType*>(operator_ptr.get());
+  EXPECT_EQ(paired_direction_operator_ptr->total_angles(), n_angles);
+  EXPECT_EQ(paired_direction_operator_ptr->opposite_angle(0), 1);
+  EXPECT_EQ(paired_direction_operator_ptr->opposite_angle(1), 0);
+  EXPECT_EQ(paired_direction_operator_ptr->opposite_angle(2), 2);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildPowerIterationTest) {
   EXPECT_CALL(*this->validator_obs_ptr_, AddPart(Part::FissionSourceUpdate)).WillOnce(DoDefault());
 
@@ -706,12 +762,15 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildkNoneTypeQuadratureSetWithParam
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSingleGroupSolver) {
   using ExpectedType = solver::group::SingleGroupSolver;
 
-  auto solver_ptr = this->test_builder_ptr_->BuildSingleGroupSolver(100, 1e-12);
+  auto solver_ptr = this->test_builder_ptr_->BuildSingleGroupSolver(problem::LinearSolverType::kGMRES, 100, 1e-12,
+                                                                    problem::PreconditionerType::kJacobi, true);
 
   ASSERT_NE(nullptr, solver_ptr);
 
   auto dynamic_ptr = dynamic_cast<ExpectedType*>(solver_ptr.get());
   ASSERT_NE(nullptr, dynamic_ptr);
+  EXPECT_EQ(dynamic_ptr->preconditioner_type(), problem::PreconditionerType::kJacobi);
+  EXPECT_TRUE(dynamic_ptr->use_inexact_solves());
 
   using ExpectedLinearSolverType = solver::linear::GMRES;
 
@@ -723,6 +782,39 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSingleGroupSolver) {
   EXPECT_EQ(linear_solver_ptr->max_iterations(), 100);
 }
 
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSingleGroupSolverConjugateGradient) {
+  auto solver_ptr = this->test_builder_ptr_->BuildSingleGroupSolver(problem::LinearSolverType::kConjugateGradient, 100,
+                                                                    1e-12, problem::PreconditionerType::kNone, false);
+  auto dynamic_ptr = dynamic_cast<solver::group::SingleGroupSolver*>(solver_ptr.get());
+  ASSERT_NE(nullptr, dynamic_ptr);
+  auto linear_solver_ptr = dynamic_cast<solver::linear::ConjugateGradient*>(dynamic_ptr->linear_solver_ptr());
+  ASSERT_NE(nullptr, linear_solver_ptr);
+  EXPECT_EQ(linear_solver_ptr->convergence_tolerance(), 1e-12);
+  EXPECT_EQ(linear_solver_ptr->max_iterations(), 100);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSingleGroupSolverDirect) {
+  auto solver_ptr = this->test_builder_ptr_->BuildSingleGroupSolver(problem::LinearSolverType::kDirectCholesky, 100,
+                                                                    1e-12, problem::PreconditionerType::kNone, false);
+  auto dynamic_ptr = dynamic_cast<solver::group::SingleGroupSolver*>(solver_ptr.get());
+  ASSERT_NE(nullptr, dynamic_ptr);
+  auto linear_solver_ptr = dynamic_cast<solver::linear::Direct*>(dynamic_ptr->linear_solver_ptr());
+  ASSERT_NE(nullptr, linear_solver_ptr);
+  EXPECT_EQ(linear_solver_ptr->factorization(), solver::linear::Direct::Factorization::kCholesky);
+}
+
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSingleGroupSolverMixedPrecision) {
+  auto solver_ptr = this->test_builder_ptr_->BuildSingleGroupSolver(problem::LinearSolverType::kMixedPrecisionGMRES,
+                                                                    100, 1e-12, problem::PreconditionerType::kNone,
+                                                                    false);
+  auto dynamic_ptr = dynamic_cast<solver::group::SingleGroupSolver*>(solver_ptr.get());
+  ASSERT_NE(nullptr, dynamic_ptr);
+  auto linear_solver_ptr = dynamic_cast<solver::linear::MixedPrecisionGMRES*>(dynamic_ptr->linear_solver_ptr());
+  ASSERT_NE(nullptr, linear_solver_ptr);
+  EXPECT_EQ(linear_solver_ptr->convergence_tolerance(), 1e-12);
+  EXPECT_EQ(linear_solver_ptr->max_iterations(), 100);
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildConvergenceChecker) {
   const double max_delta = 1e-4;
   const int max_iterations = 100;
@@ -798,11 +890,32 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildStamper) {
   auto domain_ptr = std::make_shared<domain::DomainMock<dim>>();
 
   using ExpectedType = formulation::Stamper<dim>;
-  auto stamper_ptr = this->test_builder_ptr_->BuildStamper(domain_ptr);
+  auto stamper_ptr = this->test_builder_ptr_->BuildStamper(domain_ptr, false);
 
   EXPECT_THAT(stamper_ptr.get(), WhenDynamicCastTo<ExpectedType*>(NotNull()));
 }
 
+// Cells should only be stamped in parallel if requested, even if more than one thread is available
+TYPED_TEST(FrameworkBuilderIntegrationTest, BuildStamperMultipleThreads) {
+  constexpr int dim = this->dim;
+
+  auto domain_ptr = std::make_shared<domain::DomainMock<dim>>();
+
+  const auto thread_limit = dealii::MultithreadInfo::n_threads();
+  dealii::MultithreadInfo::set_thread_limit(2);
+  const bool is_threaded = dealii::MultithreadInfo::n_threads() > 1;
+  auto serial_stamper_ptr = this->test_builder_ptr_->BuildStamper(domain_ptr, false);
+  auto parallel_stamper_ptr = this->test_builder_ptr_->BuildStamper(domain_ptr, true);
+  dealii::MultithreadInfo::set_thread_limit(thread_limit);
+
+  EXPECT_THAT(serial_stamper_ptr.get(), WhenDynamicCastTo<formulation::Stamper<dim>*>(NotNull()));
+  if (is_threaded) {
+    EXPECT_THAT(parallel_stamper_ptr.get(), WhenDynamicCastTo<formulation::ParallelStamper<dim>*>(NotNull()));
+  } else {
+    EXPECT_THAT(parallel_stamper_ptr.get(), WhenDynamicCastTo<formulation::Stamper<dim>*>(NotNull()));
+  }
+}
+
 TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSubroutine) {
   using ExpectedType = iteration::subroutine::GetScalarFluxFromFramework;
   auto subroutine_ptr = this->test_builder_ptr_->BuildSubroutine(
@@ -831,7 +944,7 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSystem) {
 
   auto system_ptr = this->test_builder_ptr_->BuildSystem(
       total_groups, total_angles, mock_domain, solution_size,
-      is_eigenvalue_problem, need_rhs_boundary_condition);
+      is_eigenvalue_problem, need_rhs_boundary_condition, nullptr);
 
   auto& system = *system_ptr;
 
@@ -843,6 +956,7 @@ TYPED_TEST(FrameworkBuilderIntegrationTest, BuildSystem) {
             ::testing::UnorderedElementsAre(VariableLinearTerms::kFissionSource,
                                             VariableLinearTerms::kScatteringSource));
   ASSERT_NE(nullptr, system.left_hand_side_ptr_);
+  EXPECT_EQ(nullptr, system.left_hand_side_operator_ptr_);
 
   for (const auto& moments : {system.current_moments.get(),
                               system.previous_moments.get()}) {
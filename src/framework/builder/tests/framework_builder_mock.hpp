@@ -21,6 +21,7 @@ class FrameworkBuilderMock : public FrameworkBuilderI<dim>     {
   using typename FrameworkBuilderI<dim>::Initializer;
   using typename FrameworkBuilderI<dim>::InitializerName;
   using typename FrameworkBuilderI<dim>::KEffectiveUpdater;
+  using typename FrameworkBuilderI<dim>::LeftHandSideOperator;
   using typename FrameworkBuilderI<dim>::MomentCalculator;
   using typename FrameworkBuilderI<dim>::MomentConvergenceChecker;
   using typename FrameworkBuilderI<dim>::MomentMapConvergenceChecker;
@@ -55,12 +56,16 @@ class FrameworkBuilderMock : public FrameworkBuilderI<dim>     {
   MOCK_METHOD(std::unique_ptr<DiffusionFormulation>, BuildDiffusionFormulation,
       (const std::shared_ptr<FiniteElement>&, const std::shared_ptr<data::cross_sections::CrossSectionsI>&,
       const DiffusionFormulationImpl), (override));
+  MOCK_METHOD(std::shared_ptr<LeftHandSideOperator>, BuildDiffusionMatrixFreeOperator, (const Domain&,
+      const std::shared_ptr<CrossSections>&, const std::set<problem::Boundary>&,
+      const FrameworkParameters::PolynomialDegree,
+      const std::shared_ptr<data::cross_sections::OneGroupCrossSectionsI>&), (override));
   MOCK_METHOD(std::unique_ptr<DriftDiffusionFormulation>, BuildDriftDiffusionFormulation,
   (const std::shared_ptr<AngularFluxIntegrator>&, const std::shared_ptr<FiniteElement>&,
       const std::shared_ptr<data::cross_sections::CrossSectionsI>&), (override));
   MOCK_METHOD(std::unique_ptr<Domain>, BuildDomain, (const FrameworkParameters::DomainSize,
       const FrameworkParameters::NumberOfCells, const std::shared_ptr<FiniteElement>&,
-      const std::string material_mapping), (override));
+      const std::string material_mapping, const bool build_multigrid_hierarchy), (override));
   MOCK_METHOD(std::unique_ptr<FiniteElement>, BuildFiniteElement, (const problem::CellFiniteElementType,
       const problem::DiscretizationType, const FrameworkParameters::PolynomialDegree), (override));
   MOCK_METHOD(std::unique_ptr<GroupSolution>, BuildGroupSolution, (const int), (override));
@@ -85,18 +90,26 @@ class FrameworkBuilderMock : public FrameworkBuilderI<dim>     {
   MOCK_METHOD(std::unique_ptr<OuterIteration>, BuildOuterIteration, (std::unique_ptr<GroupSolveIteration>,
       std::unique_ptr<ParameterConvergenceChecker>, std::unique_ptr<KEffectiveUpdater>,
       const std::shared_ptr<FissionSourceUpdater>&, const std::string&), (override));
+  MOCK_METHOD(std::shared_ptr<LeftHandSideOperator>, BuildPairedDirectionOperator,
+              (const std::shared_ptr<QuadratureSet>&), (override));
   MOCK_METHOD(std::unique_ptr<ParameterConvergenceChecker>, BuildParameterConvergenceChecker, (double, int), (override));
   MOCK_METHOD(std::shared_ptr<QuadratureSet>, BuildQuadratureSet, (const problem::AngularQuadType,
       const FrameworkParameters::AngularQuadratureOrder), (override));
   MOCK_METHOD(std::unique_ptr<SAAFFormulation>, BuildSAAFFormulation, (const std::shared_ptr<FiniteElement>&,
       const std::shared_ptr<data::cross_sections::CrossSectionsI>&, const std::shared_ptr<QuadratureSet>&,
       const formulation::SAAFFormulationImpl), (override));
-  MOCK_METHOD(std::unique_ptr<SingleGroupSolver>, BuildSingleGroupSolver,(const int, const double), (override));
-  MOCK_METHOD(std::unique_ptr<Stamper>, BuildStamper, (const std::shared_ptr<Domain>&), (override));
+  MOCK_METHOD(std::shared_ptr<LeftHandSideOperator>, BuildSAAFMatrixFreeOperator, (const Domain&,
+      const std::shared_ptr<CrossSections>&, const std::shared_ptr<QuadratureSet>&,
+      const FrameworkParameters::PolynomialDegree), (override));
+  MOCK_METHOD(std::unique_ptr<SingleGroupSolver>, BuildSingleGroupSolver,
+              (const problem::LinearSolverType, const int, const double, const problem::PreconditionerType,
+                  const bool), (override));
+  MOCK_METHOD(std::unique_ptr<Stamper>, BuildStamper, (const std::shared_ptr<Domain>&, const bool), (override));
   MOCK_METHOD(std::unique_ptr<Subroutine>, BuildSubroutine, (std::unique_ptr<FrameworkI>,
       const SubroutineName), (override));
   MOCK_METHOD(std::unique_ptr<System>, BuildSystem, (const int, const int, const Domain&,
-      const std::size_t solution_size, bool is_eigenvalue_problem, bool need_rhs_boundary_condition), (override));
+      const std::size_t solution_size, bool is_eigenvalue_problem, bool need_rhs_boundary_condition,
+      const std::shared_ptr<LeftHandSideOperator>&), (override));
   MOCK_METHOD(UpdaterPointers, BuildUpdaterPointers, (std::unique_ptr<DiffusionFormulation>,
       std::unique_ptr<DriftDiffusionFormulation>, std::shared_ptr<Stamper>, std::shared_ptr<AngularFluxIntegrator>,
       std::shared_ptr<SphericalHarmonicMoments>, AngularFluxStorage&, (const std::map<problem::Boundary, bool>&)),(override));
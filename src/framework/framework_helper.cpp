@@ -62,6 +62,9 @@ auto FrameworkHelper<dim>::ToFrameworkParameters(
     .equation_type{ problem_parameters.TransportModel() },
     .k_effective_updater{ problem_parameters.K_EffectiveUpdaterType() },
     .group_solver_type{ problem_parameters.InGroupSolver() },
+    .linear_solver_type{ problem_parameters.LinearSolver() },
+    .preconditioner_type{ problem_parameters.Preconditioner() },
+    .use_inexact_linear_solves{ problem_parameters.UseInexactLinearSolves() },
     .angular_quadrature_type{ problem_parameters.AngularQuad() },
     .angular_quadrature_order{ quadrature::Order(problem_parameters.AngularQuadOrder()) },
     .spatial_dimension{ framework::FrameworkParameters::SpatialDimension(problem_parameters.SpatialDimension()) },
@@ -72,6 +75,9 @@ auto FrameworkHelper<dim>::ToFrameworkParameters(
     .polynomial_degree{ framework::FrameworkParameters::PolynomialDegree(problem_parameters.FEPolynomialDegree()) },
     .use_nda_{ problem_parameters.DoNDA() },
     .use_two_grid_{ problem_parameters.UseTwoGridAcceleration() },
+    .use_matrix_free_operator{ problem_parameters.UseMatrixFreeOperator() },
+    .share_opposite_direction_matrices{ problem_parameters.ShareOppositeDirectionMatrices() },
+    .stamp_cells_in_parallel{ problem_parameters.StampCellsInParallel() },
     .output_aggregated_source_data{ problem_parameters.OutputAggregatedSourceData() },
     .output_scalar_flux_as_vtu{ problem_parameters.OutputScalarFluxAsVTU() },
     .output_fission_source_as_vtu{ problem_parameters.OutputFissionSourceAsVTU() },
@@ -162,6 +168,7 @@ auto FrameworkHelper<dim>::BuildFramework(
   const int n_groups{ parameters.neutron_energy_groups };
   const bool need_angular_solution_storage{ validator.NeededParts().contains(FrameworkPart::AngularSolutionStorage) };
   const bool has_reflective_boundaries { !parameters.reflective_boundaries.empty() };
+  const bool stamp_cells_in_parallel { parameters.stamp_cells_in_parallel };
   const std::string output_filename_base { parameters.output_filename_base };
 
   fmt::print(fg(fmt::color::green) | fmt::emphasis::bold, "Building framework: {}\n", parameters.name);
@@ -169,8 +176,13 @@ auto FrameworkHelper<dim>::BuildFramework(
   auto finite_element_ptr = Shared(builder.BuildFiniteElement(parameters.cell_finite_element_type,
                                                               parameters.discretization_type,
                                                               parameters.polynomial_degree));
+  // Only the matrix-free diffusion operators use the multigrid hierarchy, for their preconditioners
+  const bool build_multigrid_hierarchy{ parameters.use_matrix_free_operator
+      && (parameters.equation_type == problem::EquationType::kDiffusion
+          || parameters.equation_type == problem::EquationType::kTwoGridDiffusion) };
   auto domain_ptr = Shared(builder.BuildDomain(parameters.domain_size, parameters.number_of_cells,
-                                               finite_element_ptr, parameters.material_mapping));
+                                               finite_element_ptr, parameters.material_mapping,
+                                               build_multigrid_hierarchy));
 
   fmt::print("Setting up domain...\n");
   domain_ptr->SetUpMesh(parameters.uniform_refinements);
@@ -179,6 +191,7 @@ auto FrameworkHelper<dim>::BuildFramework(
   // These objects will be set up differently depending on the implementation
   std::shared_ptr<QuadratureSet> quadrature_set_ptr{ nullptr };
   UpdaterPointers updater_pointers;
+  std::shared_ptr<system::terms::BilinearOperatorI> left_hand_side_operator_ptr{ nullptr };
   std::unique_ptr<MomentCalculator> moment_calculator_ptr{ nullptr };
 
 
@@ -224,8 +237,13 @@ auto FrameworkHelper<dim>::BuildFramework(
         finite_element_ptr, parameters.cross_sections_.value(),
         parameters.two_grid_data_.one_group_cross_sections_ptr_);
     two_grid_diffusion_formulation->Precalculate(domain_ptr->Cells().at(0));
+    if (parameters.use_matrix_free_operator) {
+      left_hand_side_operator_ptr = builder.BuildDiffusionMatrixFreeOperator(
+          *domain_ptr, parameters.cross_sections_.value(), parameters.reflective_boundaries,
+          parameters.polynomial_degree, parameters.two_grid_data_.one_group_cross_sections_ptr_);
+    }
     updater_pointers = builder.BuildUpdaterPointers(std::move(two_grid_diffusion_formulation),
-                                                    builder.BuildStamper(domain_ptr),
+                                                    builder.BuildStamper(domain_ptr, stamp_cells_in_parallel),
                                                     reflective_boundaries);
     std::cout << "Build two-grid diffusion formulation\n";
   } else if (parameters.equation_type == problem::EquationType::kSelfAdjointAngularFlux) {
@@ -234,15 +252,23 @@ auto FrameworkHelper<dim>::BuildFramework(
                                                              quadrature_set_ptr,
                                                              formulation::SAAFFormulationImpl::kDefault);
     saaf_formulation_ptr->Initialize(domain_ptr->Cells().at(0));
+    if (parameters.use_matrix_free_operator) {
+      left_hand_side_operator_ptr = builder.BuildSAAFMatrixFreeOperator(*domain_ptr,
+                                                                        parameters.cross_sections_.value(),
+                                                                        quadrature_set_ptr,
+                                                                        parameters.polynomial_degree);
+    } else if (parameters.share_opposite_direction_matrices) {
+      left_hand_side_operator_ptr = builder.BuildPairedDirectionOperator(quadrature_set_ptr);
+    }
     if (has_reflective_boundaries) {
       updater_pointers = builder.BuildUpdaterPointers(std::move(saaf_formulation_ptr),
-                                                      builder.BuildStamper(domain_ptr),
+                                                      builder.BuildStamper(domain_ptr, stamp_cells_in_parallel),
                                                       quadrature_set_ptr,
                                                       reflective_boundaries,
                                                       angular_solutions_);
     } else {
       updater_pointers = builder.BuildUpdaterPointers(std::move(saaf_formulation_ptr),
-                                                      builder.BuildStamper(domain_ptr),
+                                                      builder.BuildStamper(domain_ptr, stamp_cells_in_parallel),
                                                       quadrature_set_ptr);
     }
   } else if (parameters.equation_type == EquationType::kDiffusion ||
@@ -259,18 +285,34 @@ auto FrameworkHelper<dim>::BuildFramework(
       updater_pointers = builder.BuildUpdaterPointers(
           std::move(diffusion_formulation_ptr),
           std::move(drift_diffusion_formulation_ptr),
-          builder.BuildStamper(domain_ptr),
+          builder.BuildStamper(domain_ptr, stamp_cells_in_parallel),
           parameters.nda_data_.angular_flux_integrator_ptr_,
           parameters.nda_data_.higher_order_moments_ptr_,
           parameters.nda_data_.higher_order_angular_flux_,
           reflective_boundaries);
     } else {
+      if (parameters.use_matrix_free_operator) {
+        left_hand_side_operator_ptr = builder.BuildDiffusionMatrixFreeOperator(
+            *domain_ptr, parameters.cross_sections_.value(), parameters.reflective_boundaries,
+            parameters.polynomial_degree, nullptr);
+      }
       updater_pointers = builder.BuildUpdaterPointers(std::move(diffusion_formulation_ptr),
-                                                      builder.BuildStamper(domain_ptr),
+                                                      builder.BuildStamper(domain_ptr, stamp_cells_in_parallel),
                                                       reflective_boundaries);
     }
   }
 
+  if (parameters.use_matrix_free_operator && left_hand_side_operator_ptr == nullptr) {
+    std::cout << "Warning: Matrix-free operator was selected but is only available for the SAAF, diffusion and "
+                 "two-grid diffusion formulations, left hand side matrices will be assembled.\n";
+  }
+  if (parameters.share_opposite_direction_matrices &&
+      (parameters.equation_type != problem::EquationType::kSelfAdjointAngularFlux ||
+       parameters.use_matrix_free_operator)) {
+    std::cout << "Warning: Sharing opposite direction matrices is only available for assembled SAAF left hand sides, "
+                 "matrices will not be shared.\n";
+  }
+
   if (parameters.output_aggregated_source_data) {
     auto make_source_instrument = [](const std::string filename) {
       return Shared(InstrumentBuilder::BuildInstrument<double>(
@@ -302,7 +344,8 @@ auto FrameworkHelper<dim>::BuildFramework(
   system_helper_ptr_->SetUpMPIAngularSolution(*group_solution_ptr, *domain_ptr, 1.0);
 
   auto group_iteration_ptr = builder.BuildGroupSolveIteration(
-      builder.BuildSingleGroupSolver(10000, 1e-10),
+      builder.BuildSingleGroupSolver(parameters.linear_solver_type, 10000, 1e-10, parameters.preconditioner_type,
+                                     parameters.use_inexact_linear_solves),
       builder.BuildMomentConvergenceChecker(1e-6, 1000),
       std::move(moment_calculator_ptr),
       group_solution_ptr,
@@ -331,7 +374,8 @@ auto FrameworkHelper<dim>::BuildFramework(
                                         *domain_ptr,
                                         group_solution_ptr->GetSolution(0).size(),
                                         parameters.eigen_solver_type.has_value(),
-                                        need_angular_solution_storage);
+                                        need_angular_solution_storage,
+                                        left_hand_side_operator_ptr);
 
   std::unique_ptr<iteration::subroutine::SubroutineI> group_post_processing_subroutine{ nullptr };
   if (parameters.use_two_grid_) {
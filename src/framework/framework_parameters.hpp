@@ -43,6 +43,9 @@ struct FrameworkParameters {
   std::optional<problem::EigenSolverType> eigen_solver_type{std::nullopt};
   K_EffectiveUpdaterName                  k_effective_updater{ K_EffectiveUpdaterName::kCalculatorViaFissionSource };
   problem::InGroupSolverType              group_solver_type{problem::InGroupSolverType::kSourceIteration};
+  problem::LinearSolverType               linear_solver_type{ problem::LinearSolverType::kGMRES };
+  problem::PreconditionerType             preconditioner_type{ problem::PreconditionerType::kNone };
+  bool                                    use_inexact_linear_solves{ false };
 
   // Angular quadrature parameters
   problem::AngularQuadType angular_quadrature_type{ problem::AngularQuadType::kNone };
@@ -82,6 +85,13 @@ struct FrameworkParameters {
   NDA_Data nda_data_{};
   TwoGridData two_grid_data_{};
 
+  // Apply the left hand side matrix-free instead of assembling a matrix for each group and angle
+  bool use_matrix_free_operator{ false };
+  // Share the SAAF left hand side matrices of opposite directions, keeping a boundary correction for each direction
+  bool share_opposite_direction_matrices{ false };
+  // Stamp system matrices from multiple threads if more than one is available
+  bool stamp_cells_in_parallel{ false };
+
   // Instrumentation options
   bool output_aggregated_source_data{ false };
   bool output_scalar_flux_as_vtu{ false };
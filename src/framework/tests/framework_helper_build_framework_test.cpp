@@ -37,6 +37,7 @@
 #include "system/moments/tests/spherical_harmonic_mock.h"
 #include "system/moments/spherical_harmonic_types.h"
 #include "system/system.hpp"
+#include "system/terms/tests/bilinear_operator_mock.hpp"
 
 namespace  {
 
@@ -44,7 +45,7 @@ using namespace bart;
 using ::testing::Return, ::testing::ByMove, ::testing::DoDefault, ::testing::_, ::testing::NiceMock;
 using ::testing::Ref, ::testing::Pointee, ::testing::ReturnRef, ::testing::ContainerEq, ::testing::SizeIs;
 using ::testing::A, ::testing::AllOf;
-using ::testing::NotNull, ::testing::WhenDynamicCastTo;
+using ::testing::NotNull, ::testing::IsNull, ::testing::WhenDynamicCastTo;
 using ::testing::AtLeast;
 
 using FrameworkPart = framework::builder::FrameworkPart;
@@ -67,6 +68,7 @@ class FrameworkHelperBuildFrameworkIntegrationTests : public ::testing::Test {
   using GroupSolveIterationMock = iteration::group::GroupSolveIterationMock;
   using InitializerMock = iteration::initializer::InitializerMock;
   using KEffectiveUpdaterMock = eigenvalue::k_eigenvalue::K_EigenvalueCalculatorMock;
+  using LeftHandSideOperatorMock = system::terms::BilinearOperatorMock;
   using MomentCalculatorMock = quadrature::calculators::SphericalHarmonicMomentsMock;
   using MomentConvergenceCheckerMock = convergence::IterationCompletionCheckerMock<system::moments::MomentVector>;
   using MomentMapConvergenceCheckerMock = convergence::IterationCompletionCheckerMock<system::moments::MomentsMap>;
@@ -104,6 +106,7 @@ class FrameworkHelperBuildFrameworkIntegrationTests : public ::testing::Test {
   InitializerMock* initializer_obs_ptr_{ nullptr };
   KEffectiveUpdaterMock* k_effective_updater_obs_ptr_{ nullptr };
   KEffectiveUpdaterMock* k_effective_updater_rayleigh_obs_ptr_{ nullptr };
+  std::shared_ptr<LeftHandSideOperatorMock> left_hand_side_operator_mock_ptr_{ nullptr };
   MomentCalculatorMock* moment_calculator_obs_ptr_{ nullptr };
   MomentConvergenceCheckerMock* moment_convergence_checker_obs_ptr_{ nullptr };
   MomentMapConvergenceCheckerMock* moment_map_convergence_checker_obs_ptr_{ nullptr };
@@ -187,6 +190,7 @@ auto FrameworkHelperBuildFrameworkIntegrationTests<DimensionWrapper>::SetUp() ->
   k_effective_updater_obs_ptr_ = k_effective_updater_ptr.get();
   auto k_effective_updater_rayleigh_ptr = std::make_unique<NiceMock<KEffectiveUpdaterMock>>();
   k_effective_updater_rayleigh_obs_ptr_ = k_effective_updater_rayleigh_ptr.get();
+  left_hand_side_operator_mock_ptr_ = std::make_shared<LeftHandSideOperatorMock>();
   auto moment_calculator_ptr = std::make_unique<NiceMock<MomentCalculatorMock>>();
   moment_calculator_obs_ptr_ = moment_calculator_ptr.get();
   auto moment_convergence_checker_ptr = std::make_unique<NiceMock<MomentConvergenceCheckerMock>>();
@@ -228,7 +232,7 @@ auto FrameworkHelperBuildFrameworkIntegrationTests<DimensionWrapper>::SetUp() ->
 
   ON_CALL(mock_builder_, BuildAngularFluxIntegrator(_)).WillByDefault(ReturnByMove(angular_flux_integrator_ptr));
   ON_CALL(mock_builder_, BuildDiffusionFormulation(_,_,_)).WillByDefault(ReturnByMove(diffusion_formulation_ptr));
-  ON_CALL(mock_builder_, BuildDomain(_, _, _, _)).WillByDefault(ReturnByMove(domain_ptr));
+  ON_CALL(mock_builder_, BuildDomain(_, _, _, _, _)).WillByDefault(ReturnByMove(domain_ptr));
   ON_CALL(mock_builder_, BuildDriftDiffusionFormulation(_, _, _))
       .WillByDefault(ReturnByMove(drift_diffusion_formulation_ptr));
   ON_CALL(mock_builder_, BuildFiniteElement(_,_,_)).WillByDefault(ReturnByMove(finite_element_ptr));
@@ -248,15 +252,19 @@ auto FrameworkHelperBuildFrameworkIntegrationTests<DimensionWrapper>::SetUp() ->
       .WillByDefault(ReturnByMove(parameter_convergence_checker_ptr));
   ON_CALL(mock_builder_, BuildQuadratureSet(_,_)).WillByDefault(Return(quadrature_set_mock_ptr_));
   ON_CALL(mock_builder_, BuildSAAFFormulation(_,_,_,_)).WillByDefault(ReturnByMove(saaf_ptr));
-  ON_CALL(mock_builder_, BuildSingleGroupSolver(_,_)).WillByDefault(ReturnByMove(single_group_solver_ptr));
-  ON_CALL(mock_builder_, BuildStamper(_)).WillByDefault(ReturnByMove(stamper_ptr));
+  ON_CALL(mock_builder_, BuildSAAFMatrixFreeOperator(_,_,_,_)).WillByDefault(Return(left_hand_side_operator_mock_ptr_));
+  ON_CALL(mock_builder_, BuildPairedDirectionOperator(_)).WillByDefault(Return(left_hand_side_operator_mock_ptr_));
+  ON_CALL(mock_builder_, BuildDiffusionMatrixFreeOperator(_,_,_,_,_))
+      .WillByDefault(Return(left_hand_side_operator_mock_ptr_));
+  ON_CALL(mock_builder_, BuildSingleGroupSolver(_,_,_,_,_)).WillByDefault(ReturnByMove(single_group_solver_ptr));
+  ON_CALL(mock_builder_, BuildStamper(_,_)).WillByDefault(ReturnByMove(stamper_ptr));
   ON_CALL(mock_builder_, BuildSubroutine(_,_)).WillByDefault(ReturnByMove(subroutine_ptr));
   ON_CALL(mock_builder_, BuildUpdaterPointers(A<SAAFFormulationPtr>(),_,_)).WillByDefault(Return(updater_pointers_));
   ON_CALL(mock_builder_, BuildUpdaterPointers(A<DiffusionFormulationPtr>(),_,_)).WillByDefault(Return(updater_pointers_));
   ON_CALL(mock_builder_, BuildUpdaterPointers(A<DiffusionFormulationPtr>(), A<DriftDiffusionFormulationPtr>(),_,_,_,_,_))
       .WillByDefault(Return(updater_pointers_));
   ON_CALL(mock_builder_, BuildUpdaterPointers(_,_,_,_,_)).WillByDefault(Return(updater_pointers_));
-  ON_CALL(mock_builder_, BuildSystem(_,_,_,_,_,_)).WillByDefault(ReturnByMove(system_ptr));
+  ON_CALL(mock_builder_, BuildSystem(_,_,_,_,_,_,_)).WillByDefault(ReturnByMove(system_ptr));
   ON_CALL(mock_builder_, set_color_status_instrument_ptr(_)).WillByDefault(ReturnRef(mock_builder_));
   ON_CALL(mock_builder_, set_convergence_status_instrument_ptr(_)).WillByDefault(ReturnRef(mock_builder_));
   ON_CALL(mock_builder_, set_status_instrument_ptr(_)).WillByDefault(ReturnRef(mock_builder_));
@@ -294,12 +302,17 @@ auto FrameworkHelperBuildFrameworkIntegrationTests<DimensionWrapper>::SetExpecta
                                                parameters.discretization_type,
                                                parameters.polynomial_degree))
       .WillOnce(DoDefault());
+  const bool expect_multigrid_hierarchy{ parameters.use_matrix_free_operator
+      && (parameters.equation_type == problem::EquationType::kDiffusion
+          || parameters.equation_type == problem::EquationType::kTwoGridDiffusion) };
   EXPECT_CALL(mock_builder, BuildDomain(parameters.domain_size,
                                         parameters.number_of_cells,
                                         Pointee(Ref(*this->finite_element_obs_ptr_)),
-                                        parameters.material_mapping))
+                                        parameters.material_mapping,
+                                        expect_multigrid_hierarchy))
       .WillOnce(DoDefault());
-  EXPECT_CALL(mock_builder, BuildStamper(Pointee(Ref(*this->domain_obs_ptr_))))
+  EXPECT_CALL(mock_builder, BuildStamper(Pointee(Ref(*this->domain_obs_ptr_)),
+                                         parameters.stamp_cells_in_parallel))
       .WillOnce(DoDefault());
 
   // Domain calls
@@ -340,6 +353,16 @@ auto FrameworkHelperBuildFrameworkIntegrationTests<DimensionWrapper>::SetExpecta
                                                    formulation::SAAFFormulationImpl::kDefault))
         .WillOnce(DoDefault());
     EXPECT_CALL(*saaf_formulation_obs_ptr_, Initialize(cells_.at(0)));
+    if (parameters.use_matrix_free_operator) {
+      EXPECT_CALL(mock_builder, BuildSAAFMatrixFreeOperator(Ref(*this->domain_obs_ptr_),
+                                                            Pointee(Ref(*parameters.cross_sections_.value())),
+                                                            Pointee(Ref(*quadrature_set_mock_ptr_)),
+                                                            parameters.polynomial_degree))
+          .WillOnce(DoDefault());
+    } else if (parameters.share_opposite_direction_matrices) {
+      EXPECT_CALL(mock_builder, BuildPairedDirectionOperator(Pointee(Ref(*quadrature_set_mock_ptr_))))
+          .WillOnce(DoDefault());
+    }
 
     if (parameters.use_nda_ || !parameters.reflective_boundaries.empty()) {
       need_angular_storage = true;
@@ -371,6 +394,14 @@ auto FrameworkHelperBuildFrameworkIntegrationTests<DimensionWrapper>::SetExpecta
                                                         Pointee(Ref(*parameters.cross_sections_.value())),
                                                         _)).WillOnce(DoDefault());
     EXPECT_CALL(*diffusion_formulation_obs_ptr_, Precalculate(cells_.at(0)));
+    if (parameters.use_matrix_free_operator) {
+      EXPECT_CALL(mock_builder, BuildDiffusionMatrixFreeOperator(Ref(*this->domain_obs_ptr_),
+                                                                 Pointee(Ref(*parameters.cross_sections_.value())),
+                                                                 ContainerEq(parameters.reflective_boundaries),
+                                                                 parameters.polynomial_degree,
+                                                                 IsNull()))
+          .WillOnce(DoDefault());
+    }
     using DiffusionFormulationPtr = std::unique_ptr<typename framework::builder::FrameworkBuilderI<dim>::DiffusionFormulation>;
     EXPECT_CALL(mock_builder, BuildUpdaterPointers(A<DiffusionFormulationPtr>(),
                                                    Pointee(Ref(*stamper_obs_ptr_)),
@@ -403,7 +434,10 @@ auto FrameworkHelperBuildFrameworkIntegrationTests<DimensionWrapper>::SetExpecta
   EXPECT_CALL(*system_helper_mock_ptr_, SetUpMPIAngularSolution(Ref(*group_solution_obs_ptr_),
                                                                 Ref(*domain_obs_ptr_),
                                                                 1.0));
-  EXPECT_CALL(mock_builder, BuildSingleGroupSolver(10000, 1e-10)).WillOnce(DoDefault());
+  EXPECT_CALL(mock_builder, BuildSingleGroupSolver(parameters.linear_solver_type, 10000, 1e-10,
+                                                   parameters.preconditioner_type,
+                                                   parameters.use_inexact_linear_solves))
+      .WillOnce(DoDefault());
   EXPECT_CALL(mock_builder, BuildMomentConvergenceChecker(1e-6, 1000)).WillOnce(DoDefault());
   EXPECT_CALL(mock_builder, BuildMomentMapConvergenceChecker(1e-6, 1000)).WillOnce(DoDefault());
 
@@ -448,13 +482,26 @@ auto FrameworkHelperBuildFrameworkIntegrationTests<DimensionWrapper>::SetExpecta
   EXPECT_CALL(mock_validator_, ReportValidation());
 
 
+  using LeftHandSideOperatorPtr = std::shared_ptr<system::terms::BilinearOperatorI>;
+  ::testing::Matcher<const LeftHandSideOperatorPtr&> left_hand_side_operator_matcher = IsNull();
+  if (parameters.use_matrix_free_operator &&
+      (parameters.equation_type == problem::EquationType::kSelfAdjointAngularFlux ||
+       parameters.equation_type == problem::EquationType::kDiffusion)) {
+    left_hand_side_operator_matcher = Pointee(Ref(*left_hand_side_operator_mock_ptr_));
+  }
+  if (parameters.share_opposite_direction_matrices &&
+      parameters.equation_type == problem::EquationType::kSelfAdjointAngularFlux) {
+    left_hand_side_operator_matcher = Pointee(Ref(*left_hand_side_operator_mock_ptr_));
+  }
+
   EXPECT_CALL(*group_solution_obs_ptr_, GetSolution(0)).WillOnce(DoDefault());
   EXPECT_CALL(mock_builder, BuildSystem(parameters.neutron_energy_groups,
                                         n_angles,
                                         Ref(*domain_obs_ptr_),
                                         _,
                                         is_eigenvalue_solve,
-                                        need_angular_storage)).WillOnce(DoDefault());
+                                        need_angular_storage,
+                                        left_hand_side_operator_matcher)).WillOnce(DoDefault());
 
   if (parameters.use_nda_) {
     EXPECT_CALL(mock_builder, BuildAngularFluxIntegrator(Pointee(Ref(*quadrature_set_mock_ptr_)))).WillOnce(DoDefault());
@@ -497,6 +544,18 @@ TYPED_TEST(FrameworkHelperBuildFrameworkIntegrationTests, BuildFrameworkDiffusio
   this->RunTest(this->default_parameters_);
 }
 
+TYPED_TEST(FrameworkHelperBuildFrameworkIntegrationTests, BuildFrameworkDiffusionMatrixFree) {
+  auto parameters{ this->default_parameters_ };
+  parameters.use_matrix_free_operator = true;
+  this->RunTest(parameters);
+}
+
+TYPED_TEST(FrameworkHelperBuildFrameworkIntegrationTests, BuildFrameworkDiffusionStampCellsInParallel) {
+  auto parameters{ this->default_parameters_ };
+  parameters.stamp_cells_in_parallel = true;
+  this->RunTest(parameters);
+}
+
 TYPED_TEST(FrameworkHelperBuildFrameworkIntegrationTests, BuildFrameworkDiffusionEigensolve) {
   auto parameters{ this->default_parameters_ };
   parameters.eigen_solver_type = problem::EigenSolverType::kPowerIteration;
@@ -547,6 +606,26 @@ TYPED_TEST(FrameworkHelperBuildFrameworkIntegrationTests, BuildFrameworkSAAF) {
   this->RunTest(parameters);
 }
 
+TYPED_TEST(FrameworkHelperBuildFrameworkIntegrationTests, BuildFrameworkSAAFMatrixFree) {
+  auto parameters{ this-> default_parameters_ };
+  using Order = framework::FrameworkParameters::AngularQuadratureOrder;
+  parameters.equation_type = problem::EquationType::kSelfAdjointAngularFlux;
+  parameters.angular_quadrature_type = problem::AngularQuadType::kLevelSymmetricGaussian;
+  parameters.angular_quadrature_order = Order(test_helpers::RandomInt(5, 10));
+  parameters.use_matrix_free_operator = true;
+  this->RunTest(parameters);
+}
+
+TYPED_TEST(FrameworkHelperBuildFrameworkIntegrationTests, BuildFrameworkSAAFSharedOppositeDirections) {
+  auto parameters{ this-> default_parameters_ };
+  using Order = framework::FrameworkParameters::AngularQuadratureOrder;
+  parameters.equation_type = problem::EquationType::kSelfAdjointAngularFlux;
+  parameters.angular_quadrature_type = problem::AngularQuadType::kLevelSymmetricGaussian;
+  parameters.angular_quadrature_order = Order(test_helpers::RandomInt(5, 10));
+  parameters.share_opposite_direction_matrices = true;
+  this->RunTest(parameters);
+}
+
 TYPED_TEST(FrameworkHelperBuildFrameworkIntegrationTests, BuildFrameworkSAAFEigensolve) {
   auto parameters{ this-> default_parameters_ };
   using Order = framework::FrameworkParameters::AngularQuadratureOrder;
@@ -96,6 +96,9 @@ auto FrameworkHelperToFrameworkParametersTest::SetExpectations(
     EXPECT_CALL(parameters_mock_, EigenSolver()).WillOnce(Return(problem::EigenSolverType::kNone));
   }
   EXPECT_CALL(parameters_mock_, InGroupSolver()).WillOnce(Return(parameters.group_solver_type));
+  EXPECT_CALL(parameters_mock_, LinearSolver()).WillOnce(Return(parameters.linear_solver_type));
+  EXPECT_CALL(parameters_mock_, Preconditioner()).WillOnce(Return(parameters.preconditioner_type));
+  EXPECT_CALL(parameters_mock_, UseInexactLinearSolves()).WillOnce(Return(parameters.use_inexact_linear_solves));
   EXPECT_CALL(parameters_mock_, AngularQuad()).WillOnce(Return(parameters.angular_quadrature_type));
   EXPECT_CALL(parameters_mock_, AngularQuadOrder()).WillOnce(Return(parameters.angular_quadrature_order.value().get()));
   EXPECT_CALL(parameters_mock_, SpatialDimension()).WillOnce(Return(parameters.spatial_dimension.get()));
@@ -108,6 +111,10 @@ auto FrameworkHelperToFrameworkParametersTest::SetExpectations(
   EXPECT_CALL(parameters_mock_, NumberOfMaterials()).WillOnce(Return(static_cast<int>(material_filenames_.size())));
   EXPECT_CALL(parameters_mock_, K_EffectiveUpdaterType()).WillOnce(Return(parameters.k_effective_updater));
   EXPECT_CALL(parameters_mock_, DoNDA()).WillOnce(Return(parameters.use_nda_));
+  EXPECT_CALL(parameters_mock_, UseMatrixFreeOperator()).WillOnce(Return(parameters.use_matrix_free_operator));
+  EXPECT_CALL(parameters_mock_, ShareOppositeDirectionMatrices())
+      .WillOnce(Return(parameters.share_opposite_direction_matrices));
+  EXPECT_CALL(parameters_mock_, StampCellsInParallel()).WillOnce(Return(parameters.stamp_cells_in_parallel));
   EXPECT_CALL(parameters_mock_, OutputAggregatedSourceData()).WillOnce(Return(parameters.output_aggregated_source_data));
   EXPECT_CALL(parameters_mock_, OutputScalarFluxAsVTU()).WillOnce(Return(parameters.output_scalar_flux_as_vtu));
   EXPECT_CALL(parameters_mock_, OutputFissionSourceAsVTU()).WillOnce(Return(parameters.output_fission_source_as_vtu));
@@ -132,6 +139,12 @@ AssertionResult AreEqual(const framework::FrameworkParameters& lhs, const framew
     return AssertionFailure() << "eigen solver types do not match";
   } else if (lhs.group_solver_type != rhs.group_solver_type) {
     return AssertionFailure() << "group solver types do not match";
+  } else if (lhs.linear_solver_type != rhs.linear_solver_type) {
+    return AssertionFailure() << "linear solver types do not match";
+  } else if (lhs.preconditioner_type != rhs.preconditioner_type) {
+    return AssertionFailure() << "preconditioner types do not match";
+  } else if (lhs.use_inexact_linear_solves != rhs.use_inexact_linear_solves) {
+    return AssertionFailure() << "use inexact linear solves flags do not match";
   } else if (lhs.angular_quadrature_type != rhs.angular_quadrature_type) {
     return AssertionFailure() << "angular quadrature types do not match";
   } else if (lhs.angular_quadrature_order != rhs.angular_quadrature_order) {
@@ -154,6 +167,12 @@ AssertionResult AreEqual(const framework::FrameworkParameters& lhs, const framew
     return AssertionFailure() << "K-effective updaters do not match";
   } else if (lhs.use_nda_ != rhs.use_nda_) {
     return AssertionFailure() << "use NDA flag do not match";
+  } else if (lhs.use_matrix_free_operator != rhs.use_matrix_free_operator) {
+    return AssertionFailure() << "use matrix-free operator flags do not match";
+  } else if (lhs.share_opposite_direction_matrices != rhs.share_opposite_direction_matrices) {
+    return AssertionFailure() << "share opposite direction matrices flags do not match";
+  } else if (lhs.stamp_cells_in_parallel != rhs.stamp_cells_in_parallel) {
+    return AssertionFailure() << "stamp cells in parallel flags do not match";
   } else if (lhs.output_aggregated_source_data != rhs.output_aggregated_source_data) {
     return AssertionFailure() << "Output aggregated source data flags do not match";
   } else if (lhs.output_scalar_flux_as_vtu != rhs.output_scalar_flux_as_vtu) {
@@ -187,6 +206,56 @@ TEST_F(FrameworkHelperToFrameworkParametersTest, UseNDATrue) {
   EXPECT_TRUE(AreEqual(returned_parameters, test_parameters));
 }
 
+TEST_F(FrameworkHelperToFrameworkParametersTest, UseMatrixFreeOperatorTrue) {
+  auto test_parameters{ default_parameters_ };
+  test_parameters.equation_type = problem::EquationType::kSelfAdjointAngularFlux;
+  test_parameters.use_matrix_free_operator = true;
+  SetExpectations(test_parameters);
+  auto returned_parameters = test_helper_ptr_->ToFrameworkParameters(parameters_mock_);
+  EXPECT_TRUE(AreEqual(returned_parameters, test_parameters));
+}
+
+TEST_F(FrameworkHelperToFrameworkParametersTest, ShareOppositeDirectionMatricesTrue) {
+  auto test_parameters{ default_parameters_ };
+  test_parameters.equation_type = problem::EquationType::kSelfAdjointAngularFlux;
+  test_parameters.share_opposite_direction_matrices = true;
+  SetExpectations(test_parameters);
+  auto returned_parameters = test_helper_ptr_->ToFrameworkParameters(parameters_mock_);
+  EXPECT_TRUE(AreEqual(returned_parameters, test_parameters));
+}
+
+TEST_F(FrameworkHelperToFrameworkParametersTest, StampCellsInParallelTrue) {
+  auto test_parameters{ default_parameters_ };
+  test_parameters.stamp_cells_in_parallel = true;
+  SetExpectations(test_parameters);
+  auto returned_parameters = test_helper_ptr_->ToFrameworkParameters(parameters_mock_);
+  EXPECT_TRUE(AreEqual(returned_parameters, test_parameters));
+}
+
+TEST_F(FrameworkHelperToFrameworkParametersTest, ConjugateGradientLinearSolver) {
+  auto test_parameters{ default_parameters_ };
+  test_parameters.linear_solver_type = problem::LinearSolverType::kConjugateGradient;
+  SetExpectations(test_parameters);
+  auto returned_parameters = test_helper_ptr_->ToFrameworkParameters(parameters_mock_);
+  EXPECT_TRUE(AreEqual(returned_parameters, test_parameters));
+}
+
+TEST_F(FrameworkHelperToFrameworkParametersTest, AlgebraicMultigridPreconditioner) {
+  auto test_parameters{ default_parameters_ };
+  test_parameters.preconditioner_type = problem::PreconditionerType::kAlgebraicMultigrid;
+  SetExpectations(test_parameters);
+  auto returned_parameters = test_helper_ptr_->ToFrameworkParameters(parameters_mock_);
+  EXPECT_TRUE(AreEqual(returned_parameters, test_parameters));
+}
+
+TEST_F(FrameworkHelperToFrameworkParametersTest, UseInexactLinearSolvesTrue) {
+  auto test_parameters{ default_parameters_ };
+  test_parameters.use_inexact_linear_solves = true;
+  SetExpectations(test_parameters);
+  auto returned_parameters = test_helper_ptr_->ToFrameworkParameters(parameters_mock_);
+  EXPECT_TRUE(AreEqual(returned_parameters, test_parameters));
+}
+
 TEST_F(FrameworkHelperToFrameworkParametersTest, SAAFWithLevelSymmetric) {
   auto test_parameters{ default_parameters_ };
   test_parameters.equation_type = problem::EquationType::kSelfAdjointAngularFlux;
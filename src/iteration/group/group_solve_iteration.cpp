@@ -71,8 +71,10 @@ auto GroupSolveIteration<dim>::Iterate(System &system) -> void {
                                               previous_scalar_flux);
 
         data_ports::ConvergenceStatusPort::Expose(convergence_status);
+        group_solver_ptr_->UpdateSourceIterationStatus(convergence_status);
         UpdateCurrentMoments(system, group);
       } while (!convergence_status.is_complete);
+      PerformPostGroup(system, group);
 
       if (is_storing_angular_solution_)
         StoreAngularSolution(system, group);
@@ -109,6 +111,11 @@ auto GroupSolveIteration<dim>::Iterate(System &system) -> void {
     }
   } while(!all_group_convergence_status.is_complete);
   data_ports::NumberOfIterationsPort::Expose(all_group_convergence_status.iteration_number);
+  if (const auto stored_memory = group_solver_ptr_->StoredMemory(); stored_memory > 0) {
+    constexpr double bytes_per_megabyte{ 1024.0 * 1024.0 };
+    data_ports::StatusPort::Expose("..Group solver stored memory (MB): " +
+                                   std::to_string(static_cast<double>(stored_memory) / bytes_per_megabyte) + "\n");
+  }
   ExposeIterationData(system);
 }
 
@@ -138,6 +145,7 @@ auto GroupSolveIteration<dim>::UpdateCurrentMoments(System &system, const int gr
       current_moments[{group, l, m}] = moment_calculator_ptr_->CalculateMoment(group_solution_ptr_.get(), group, l, m);
     }
   }
+  ++system.current_moments_version;
 }
 
 template<int dim>
@@ -90,6 +90,8 @@ class GroupSolveIteration : public GroupSolveIterationI, public utility::HasDepe
   auto post_iteration_subroutine_ptr() const { return post_iteration_subroutine_ptr_.get(); }
  protected:
   virtual auto PerformPerGroup(System& system, int group) -> void;
+  /*! \brief Called once the inner iterations on a group have converged. */
+  virtual auto PerformPostGroup(System& /*system*/, int /*group*/) -> void {};
   virtual auto SolveGroup(int group, System &system) -> void;
   virtual auto StoreAngularSolution(System& system, int group) -> void;
   virtual auto GetScalarFlux(int group, System& system) -> MomentVector;
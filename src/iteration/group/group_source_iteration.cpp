@@ -62,6 +62,8 @@ template<int dim>
 void GroupSourceIteration<dim>::PerformPerGroup(system::System &system,
                                                 const int group) {
   GroupSolveIteration<dim>::PerformPerGroup(system, group);
+  // Moments of the other groups are fixed until the inner iterations on this group converge
+  source_updater_ptr_->SetInnerIterationGroup(system::EnergyGroup(group));
   if (boundary_condition_updater_ptr_ != nullptr) {
     for (int angle = 0; angle < system.total_angles; ++angle) {
       boundary_condition_updater_ptr_->UpdateBoundaryConditions(
@@ -71,6 +73,12 @@ void GroupSourceIteration<dim>::PerformPerGroup(system::System &system,
     }
   }
 }
+template<int dim>
+auto GroupSourceIteration<dim>::PerformPostGroup(system::System& system, const int group) -> void {
+  GroupSolveIteration<dim>::PerformPostGroup(system, group);
+  source_updater_ptr_->SetInnerIterationGroup(std::nullopt);
+}
+
 template<int dim>
 auto GroupSourceIteration<dim>::ExposeIterationData(system::System &system) -> void {
   GroupSolveIteration<dim>::ExposeIterationData(system);
@@ -53,6 +53,7 @@ class GroupSourceIteration : public GroupSolveIteration<dim> {
                     const int angle) override;
   virtual void PerformPerGroup(system::System& system,
                                const int group) override;
+  auto PerformPostGroup(system::System& system, int group) -> void override;
   auto ExposeIterationData(system::System& system) -> void override;
 };
 
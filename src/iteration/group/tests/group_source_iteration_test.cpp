@@ -378,6 +378,10 @@ TYPED_TEST(IterationGroupSourceSystemSolvingTest, Iterate) {
         group, Ref(this->test_system), Ref(*this->group_solution_ptr_)))
         .Times(AtLeast(1))
         .WillRepeatedly(Solve(this));
+    // Each group should be set as the inner iteration group before it is solved
+    EXPECT_CALL(*this->source_updater_ptr_, SetInnerIterationGroup(
+        std::make_optional(system::EnergyGroup(group))))
+        .Times(AtLeast(1));
     for (int angle = 0; angle < this->total_angles; ++angle) {
       EXPECT_CALL(*this->source_updater_ptr_, UpdateScatteringSource(
           Ref(this->test_system),
@@ -393,6 +397,9 @@ TYPED_TEST(IterationGroupSourceSystemSolvingTest, Iterate) {
     }
   }
 
+  EXPECT_CALL(*this->source_updater_ptr_, SetInnerIterationGroup(std::optional<system::EnergyGroup>()))
+      .Times(AtLeast(this->total_groups));
+
   auto mock_group_solution_ptr = dynamic_cast<MockSolutionType*>(this->group_solution_ptr_.get());
 
   convergence::Status moment_map_status;
@@ -418,6 +425,12 @@ TYPED_TEST(IterationGroupSourceSystemSolvingTest, Iterate) {
       .Times(AtLeast(1))
       .WillRepeatedly(ReturnConvergence(this));
 
+  // The group solver should be given the status of each source iteration
+  EXPECT_CALL(*this->single_group_obs_ptr_, UpdateSourceIterationStatus(_))
+      .Times(AtLeast(1));
+  EXPECT_CALL(*this->single_group_obs_ptr_, StoredMemory())
+      .Times(AtLeast(1))
+      .WillRepeatedly(Return(1024 * 1024));
   EXPECT_CALL(*this->convergence_instrument_ptr_, Read(A<const convergence::Status&>()))
       .Times(AtLeast(1));
   EXPECT_CALL(*this->status_instrument_ptr_, Read(_))
@@ -442,8 +455,11 @@ TYPED_TEST(IterationGroupSourceSystemSolvingTest, Iterate) {
 
   EXPECT_CALL(*this->scattering_source_instrument_ptr_, Read(_)).Times(AtLeast(1));
 
+  const auto initial_moments_version{ this->test_system.current_moments_version };
   this->test_iterator_ptr_->Iterate(this->test_system);
   EXPECT_LT(this->iterations, this->max_iterations);
+  // Each update of the current moments is recorded
+  EXPECT_GE(this->test_system.current_moments_version, initial_moments_version + this->total_groups);
   for (int i = 0; i < 4; ++i) {
     EXPECT_NEAR(current_moments.at({0, 0, 0})[i], this->true_scalar_flux_[i], 1e-6);
   }
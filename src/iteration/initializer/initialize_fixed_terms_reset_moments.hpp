@@ -17,6 +17,7 @@ class InitializeFixedTermsResetMoments : public InitializeFixedTerms {
   void Initialize(system::System &system) override {
     for (auto& [index, moment] : *system.current_moments)
       moment = 1.0;
+    ++system.current_moments_version;
     for (auto& [index, moment] : *system.previous_moments)
       moment = 1.0;
     system.k_effective = 1.0;
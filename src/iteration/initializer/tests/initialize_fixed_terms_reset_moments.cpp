@@ -93,4 +93,14 @@ TEST_F(InitializeFixedTermsResetMomentsTest, InitializeAndReset) {
   EXPECT_EQ(test_system_.k_effective, 1.0);
 }
 
+// Resetting the current moments should change their version, so values cached from the old moments are not reused
+TEST_F(InitializeFixedTermsResetMomentsTest, InitializeIncrementsMomentsVersion) {
+  const std::size_t initial_version{ static_cast<std::size_t>(test_helpers::RandomInt(0, 10)) };
+  test_system_.current_moments_version = initial_version;
+
+  test_initializer_ptr_->Initialize(test_system_);
+
+  EXPECT_EQ(test_system_.current_moments_version, initial_version + 1);
+}
+
 } // namespace
\ No newline at end of file
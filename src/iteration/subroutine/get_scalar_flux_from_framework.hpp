@@ -24,6 +24,7 @@ class GetScalarFluxFromFramework : public SubroutineI, public utility::HasDepend
       auto& system_scalar_flux = system.current_moments->GetMoment(index);
       system_scalar_flux = solved_scalar_flux;
     }
+    ++system.current_moments_version;
   };
 
   auto framework_ptr() -> Framework* { return framework_ptr_.get(); }
@@ -41,6 +41,7 @@ auto TwoGridAcceleration::Execute(system::System& system) -> void {
   for (int group = 0; group < system.total_groups; ++group) {
     flux_corrector_ptr_->CorrectFlux(system.current_moments->GetMoment({group, 0, 0}), error_vector, group);
   }
+  ++system.current_moments_version;
 
   for (int group = 0; group < system.total_groups; ++group) {
     previous_iteration_moments_->GetMoment({group, 0, 0}) = system.current_moments->GetMoment({group, 0, 0});
@@ -51,6 +51,20 @@ enum class InGroupSolverType {
 enum class LinearSolverType {
   kNone,
   kGMRES,
+  kConjugateGradient,
+  kBiCGStab,
+  kDirectLU,
+  kDirectCholesky,
+  kMixedPrecisionGMRES,
+};
+
+enum class PreconditionerType {
+  kNone,
+  kJacobi,
+  kBlockJacobi,
+  kIncompleteCholesky,
+  kAlgebraicMultigrid,
+  kAdditiveSchwarz,
 };
 
 } // namespace problem
@@ -50,6 +50,11 @@ auto ParametersDealiiHandler::Parse(dealii::ParameterHandler& handler) -> void {
   k_effective_updater_type_ = kK_EffectiveUpdaterNameMap_.at(handler.get(key_words_.kK_EffectiveUpdaterType_));
   in_group_solver_ = kInGroupSolverTypeMap_.at(handler.get(key_words_.kInGroupSolver_));
   linear_solver_ = kLinearSolverTypeMap_.at(handler.get(key_words_.kLinearSolver_));
+  preconditioner_ = kPreconditionerTypeMap_.at(handler.get(key_words_.kPreconditioner_));
+  use_inexact_linear_solves_ = handler.get_bool(key_words_.kUseInexactLinearSolves_);
+  use_matrix_free_operator_ = handler.get_bool(key_words_.kUseMatrixFreeOperator_);
+  share_opposite_direction_matrices_ = handler.get_bool(key_words_.kShareOppositeDirectionMatrices_);
+  stamp_cells_in_parallel_ = handler.get_bool(key_words_.kStampCellsInParallel_);
 
   // Solver parameters
   angular_quad_ = kAngularQuadTypeMap_.at(handler.get(key_words_.kAngularQuad_));
@@ -190,7 +195,26 @@ auto ParametersDealiiHandler::SetUpSolverParameters(dealii::ParameterHandler &ha
                         "in-group solvers");
   
   handler.declare_entry(key_words_.kLinearSolver_, "gmres", Pattern::Selection(GetOptionString(kLinearSolverTypeMap_)),
-                        "linear solvers");
+                        "linear solvers, cg requires a symmetric positive definite left hand side, mixed "
+                        "precision gmres requires an assembled sparse left hand side");
+
+  handler.declare_entry(key_words_.kPreconditioner_, "none",
+                        Pattern::Selection(GetOptionString(kPreconditionerTypeMap_)),
+                        "preconditioner for the linear solves, built once for each group and angle");
+
+  handler.declare_entry(key_words_.kUseInexactLinearSolves_, "false", Pattern::Bool(),
+                        "solve linear systems to a tolerance based on the change between source iterations");
+
+  handler.declare_entry(key_words_.kUseMatrixFreeOperator_, "false", Pattern::Bool(),
+                        "apply the SAAF left hand side matrix-free instead of assembling a matrix per group and angle");
+
+  handler.declare_entry(key_words_.kShareOppositeDirectionMatrices_, "false", Pattern::Bool(),
+                        "share the SAAF left hand side matrices and preconditioners of opposite directions, storing "
+                        "only a boundary correction for each direction");
+
+  handler.declare_entry(key_words_.kStampCellsInParallel_, "false", Pattern::Bool(),
+                        "stamp system matrices from multiple threads, only used if more than one thread is "
+                        "available");
 }
 
 auto ParametersDealiiHandler::SetUpAngularQuadratureParameters(dealii::ParameterHandler &handler) const -> void {
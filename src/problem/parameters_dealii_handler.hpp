@@ -60,6 +60,11 @@ class ParametersDealiiHandler : public ParametersI {
     const std::string kK_EffectiveUpdaterType_{ "k_effective updater type" };
     const std::string kInGroupSolver_{ "in group solver name" };
     const std::string kLinearSolver_{ "ho linear solver name" };
+    const std::string kPreconditioner_{ "ho preconditioner name" };
+    const std::string kUseInexactLinearSolves_{ "use inexact linear solves" };
+    const std::string kUseMatrixFreeOperator_{ "use matrix-free operator" };
+    const std::string kShareOppositeDirectionMatrices_{ "share opposite direction matrices" };
+    const std::string kStampCellsInParallel_{ "stamp cells in parallel" };
 
     // Quadrature
     const std::string kAngularQuad_{ "angular quadrature name" };
@@ -121,6 +126,11 @@ class ParametersDealiiHandler : public ParametersI {
   auto K_EffectiveUpdaterType() const -> K_EffectiveUpdaterName override { return k_effective_updater_type_; };
   auto InGroupSolver() const -> InGroupSolverType override { return in_group_solver_; }
   auto LinearSolver() const -> LinearSolverType override { return linear_solver_; }
+  auto Preconditioner() const -> PreconditionerType override { return preconditioner_; }
+  auto UseInexactLinearSolves() const -> bool override { return use_inexact_linear_solves_; }
+  auto UseMatrixFreeOperator() const -> bool override { return use_matrix_free_operator_; }
+  auto ShareOppositeDirectionMatrices() const -> bool override { return share_opposite_direction_matrices_; }
+  auto StampCellsInParallel() const -> bool override { return stamp_cells_in_parallel_; }
 
   // Quadrature parameters
   auto AngularQuad() const -> AngularQuadType override { return angular_quad_; }
@@ -163,6 +173,11 @@ class ParametersDealiiHandler : public ParametersI {
   K_EffectiveUpdaterName               k_effective_updater_type_{ K_EffectiveUpdaterName::kCalculatorViaFissionSource };
   InGroupSolverType                    in_group_solver_{ InGroupSolverType::kNone };
   LinearSolverType                     linear_solver_{ LinearSolverType::kNone };
+  PreconditionerType                   preconditioner_{ PreconditionerType::kNone };
+  bool                                 use_inexact_linear_solves_{ false };
+  bool                                 use_matrix_free_operator_{ false };
+  bool                                 share_opposite_direction_matrices_{ false };
+  bool                                 stamp_cells_in_parallel_{ false };
   //Quadrature
   AngularQuadType                      angular_quad_{ AngularQuadType::kNone };
   int                                  angular_quad_order_{ 0 };
@@ -218,11 +233,25 @@ class ParametersDealiiHandler : public ParametersI {
             * files. */
   
   const std::unordered_map<std::string, LinearSolverType> kLinearSolverTypeMap_ {
-    {"gmres",    LinearSolverType::kGMRES},
-    {"none",     LinearSolverType::kNone},
+    {"gmres",           LinearSolverType::kGMRES},
+    {"cg",              LinearSolverType::kConjugateGradient},
+    {"bicgstab",        LinearSolverType::kBiCGStab},
+    {"direct",          LinearSolverType::kDirectLU},
+    {"direct cholesky", LinearSolverType::kDirectCholesky},
+    {"mixed precision gmres", LinearSolverType::kMixedPrecisionGMRES},
+    {"none",            LinearSolverType::kNone},
         };  /*!< Maps linear solver type to strings used in parsed input
              * files. */
 
+  const std::unordered_map<std::string, PreconditionerType> kPreconditionerTypeMap_ {
+    {"none",           PreconditionerType::kNone},
+    {"jacobi",         PreconditionerType::kJacobi},
+    {"block jacobi",   PreconditionerType::kBlockJacobi},
+    {"icc",            PreconditionerType::kIncompleteCholesky},
+    {"gamg",           PreconditionerType::kAlgebraicMultigrid},
+    {"asm",            PreconditionerType::kAdditiveSchwarz},
+  }; /*!< Maps preconditioner type to strings used in parsed input files. */
+
   const std::unordered_map<std::string, AngularQuadType> kAngularQuadTypeMap_ {
     {"level_symmetric_gaussian", AngularQuadType::kLevelSymmetricGaussian},
     {"gauss_legendre",           AngularQuadType::kGaussLegendre},
@@ -77,6 +77,16 @@ class ParametersI {
   virtual auto InGroupSolver() const -> InGroupSolverType = 0;
   /*! \brief Gets solver type for linear solves */
   virtual auto LinearSolver() const -> LinearSolverType = 0;
+  /*! \brief Gets preconditioner type for linear solves */
+  virtual auto Preconditioner() const -> PreconditionerType = 0;
+  /*! \brief Gets if linear solve tolerances should be loosened while source iterations are far from converged */
+  virtual auto UseInexactLinearSolves() const -> bool = 0;
+  /*! \brief Gets if the left hand side should be applied matrix-free instead of assembled */
+  virtual auto UseMatrixFreeOperator() const -> bool = 0;
+  /*! \brief Gets if directions with an opposite direction should share their left hand side matrices */
+  virtual auto ShareOppositeDirectionMatrices() const -> bool = 0;
+  /*! \brief Gets if system matrices should be stamped from multiple threads when threads are available */
+  virtual auto StampCellsInParallel() const -> bool = 0;
                                                                       
   // Quadrature
   /*! \brief Gets type of angular quadrature to use */
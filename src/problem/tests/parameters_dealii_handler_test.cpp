@@ -77,9 +77,14 @@ TEST_F(ParametersDealiiHandlerTest, SolverParametersDefault) {
   test_parameters.Parse(test_parameter_handler);
 
   ASSERT_EQ(test_parameters.LinearSolver(), LinearSolverType::kGMRES) << "Default linear solver";
+  ASSERT_EQ(test_parameters.Preconditioner(), PreconditionerType::kNone) << "Default preconditioner";
   ASSERT_EQ(test_parameters.InGroupSolver(), InGroupSolverType::kSourceIteration) << "Default in-group solver";
   ASSERT_EQ(test_parameters.EigenSolver(), EigenSolverType::kPowerIteration) << "Default eigenvalue solver";
   ASSERT_EQ(test_parameters.K_EffectiveUpdaterType(), K_EffectiveUpdaterName::kCalculatorViaFissionSource);
+  EXPECT_FALSE(test_parameters.UseMatrixFreeOperator());
+  EXPECT_FALSE(test_parameters.ShareOppositeDirectionMatrices());
+  EXPECT_FALSE(test_parameters.StampCellsInParallel());
+  EXPECT_FALSE(test_parameters.UseInexactLinearSolves());
 }
 
 TEST_F(ParametersDealiiHandlerTest, AngularQuadParametersDefault) {
@@ -173,15 +178,25 @@ TEST_F(ParametersDealiiHandlerTest, SolverParametersParsed) {
 
   test_parameter_handler.set(key_words.kEigenSolver_, "none");
   test_parameter_handler.set(key_words.kInGroupSolver_, "none");
-  test_parameter_handler.set(key_words.kLinearSolver_, "gmres");
+  test_parameter_handler.set(key_words.kLinearSolver_, "cg");
+  test_parameter_handler.set(key_words.kPreconditioner_, "block jacobi");
   test_parameter_handler.set(key_words.kK_EffectiveUpdaterType_, "rayleigh quotient");
+  test_parameter_handler.set(key_words.kUseMatrixFreeOperator_, "true");
+  test_parameter_handler.set(key_words.kShareOppositeDirectionMatrices_, "true");
+  test_parameter_handler.set(key_words.kStampCellsInParallel_, "true");
+  test_parameter_handler.set(key_words.kUseInexactLinearSolves_, "true");
   
   test_parameters.Parse(test_parameter_handler);
   
   ASSERT_EQ(test_parameters.EigenSolver(), EigenSolverType::kNone) << "Parsed eigenvalue solver";
   ASSERT_EQ(test_parameters.K_EffectiveUpdaterType(), K_EffectiveUpdaterName::kCalculatorViaRayleighQuotient);
   ASSERT_EQ(test_parameters.InGroupSolver(), InGroupSolverType::kNone) << "Parsed in-group solver";
-  ASSERT_EQ(test_parameters.LinearSolver(), LinearSolverType::kGMRES) << "Parsed linear solver";
+  ASSERT_EQ(test_parameters.LinearSolver(), LinearSolverType::kConjugateGradient) << "Parsed linear solver";
+  ASSERT_EQ(test_parameters.Preconditioner(), PreconditionerType::kBlockJacobi) << "Parsed preconditioner";
+  EXPECT_TRUE(test_parameters.UseMatrixFreeOperator());
+  EXPECT_TRUE(test_parameters.ShareOppositeDirectionMatrices());
+  EXPECT_TRUE(test_parameters.StampCellsInParallel());
+  EXPECT_TRUE(test_parameters.UseInexactLinearSolves());
 }
 
 TEST_F(ParametersDealiiHandlerTest, AngularQuadParametersParsed) {
@@ -35,6 +35,11 @@ class ParametersMock : public ParametersI {
   MOCK_METHOD(eigenvalue::k_eigenvalue::K_EffectiveUpdaterName, K_EffectiveUpdaterType, (), (const));
   MOCK_METHOD(InGroupSolverType, InGroupSolver, (), (const));
   MOCK_METHOD(LinearSolverType, LinearSolver, (), (const));
+  MOCK_METHOD(PreconditionerType, Preconditioner, (), (const));
+  MOCK_METHOD(bool, UseInexactLinearSolves, (), (const));
+  MOCK_METHOD(bool, UseMatrixFreeOperator, (), (const));
+  MOCK_METHOD(bool, ShareOppositeDirectionMatrices, (), (const));
+  MOCK_METHOD(bool, StampCellsInParallel, (), (const));
 
   MOCK_METHOD(AngularQuadType, AngularQuad, (), (const));
   MOCK_METHOD(int, AngularQuadOrder, (), (const));
@@ -6,38 +6,60 @@
 namespace bart::solver::builder {
 
 template <>
-auto SolverBuilder::BuildSolver(const SolverName name, const int max_iterations, const double convergence_tolerance)
+auto SolverBuilder::BuildSolver(const SolverName name, const int max_iterations, const double convergence_tolerance,
+                                const problem::PreconditionerType preconditioner_type, const bool use_inexact_solves)
 -> std::unique_ptr<group::SingleGroupSolverI> {
   // Build linear solver
+  using LinearSolverName = linear::LinearSolverName;
   std::unique_ptr<linear::LinearI> linear_solver_ptr;
+  auto build_iterative_solver = [=](const LinearSolverName linear_solver_name) {
+    return linear::LinearIFactory<int, double>::get().GetConstructor(linear_solver_name)(max_iterations,
+                                                                                         convergence_tolerance);
+  };
   switch (name) {
     case SolverName::kDefaultGMRESGroupSolver: {
-      linear_solver_ptr = std::move(linear::LinearIFactory<int, double>::get()
-                                        .GetConstructor(linear::LinearSolverName::kGMRES)
-                                            (max_iterations, convergence_tolerance));
+      linear_solver_ptr = build_iterative_solver(LinearSolverName::kGMRES);
+      break;
     }
-  }
-
-  // Build group solver
-  std::unique_ptr<group::SingleGroupSolverI> return_ptr;
-  switch (name) {
-    case SolverName::kDefaultGMRESGroupSolver: {
-      return solver::group::SingleGroupSolverIFactory<std::unique_ptr<linear::LinearI>>::get()
-          .GetConstructor(solver::group::GroupSolverName::kDefaultImplementation)
-              (std::move(linear_solver_ptr));
+    case SolverName::kDefaultConjugateGradientGroupSolver: {
+      linear_solver_ptr = build_iterative_solver(LinearSolverName::kConjugateGradient);
+      break;
+    }
+    case SolverName::kDefaultBiCGStabGroupSolver: {
+      linear_solver_ptr = build_iterative_solver(LinearSolverName::kBiCGStab);
+      break;
+    }
+    case SolverName::kDefaultDirectLUGroupSolver: {
+      linear_solver_ptr = linear::LinearIFactory<>::get().GetConstructor(LinearSolverName::kDirectLU)();
+      break;
+    }
+    case SolverName::kDefaultDirectCholeskyGroupSolver: {
+      linear_solver_ptr = linear::LinearIFactory<>::get().GetConstructor(LinearSolverName::kDirectCholesky)();
+      break;
+    }
+    case SolverName::kDefaultMixedPrecisionGMRESGroupSolver: {
+      linear_solver_ptr = build_iterative_solver(LinearSolverName::kMixedPrecisionGMRES);
+      break;
     }
   }
-  return nullptr;
+  if (linear_solver_ptr == nullptr)
+    return nullptr;
+
+  // Build group solver, all linear solvers use the default implementation
+  return solver::group::SingleGroupSolverIFactory<std::unique_ptr<linear::LinearI>, problem::PreconditionerType, bool>
+      ::get().GetConstructor(solver::group::GroupSolverName::kDefaultImplementation)
+          (std::move(linear_solver_ptr), preconditioner_type, use_inexact_solves);
+}
+
+template <>
+auto SolverBuilder::BuildSolver(const SolverName name, const int max_iterations, const double convergence_tolerance)
+-> std::unique_ptr<group::SingleGroupSolverI> {
+  return BuildSolver(name, max_iterations, convergence_tolerance, problem::PreconditionerType::kNone, false);
 }
 
 template <>
 auto SolverBuilder::BuildSolver(const SolverName name) -> std::unique_ptr<group::SingleGroupSolverI> {
-  switch (name) {
-    case SolverName::kDefaultGMRESGroupSolver: {
-      return BuildSolver(SolverName::kDefaultGMRESGroupSolver, 100, 1e-10);
-    }
-  }
-  return nullptr;
+  return BuildSolver(name, 100, 1e-10);
 }
 
 } // namespace bart::solver::builder
@@ -1,12 +1,18 @@
 #ifndef BART_SRC_SOLVER_BUILDER_SOLVER_BUILDER_HPP_
 #define BART_SRC_SOLVER_BUILDER_SOLVER_BUILDER_HPP_
 
+#include "problem/parameter_types.hpp"
 #include "solver/group/single_group_solver_i.h"
 
 namespace bart::solver::builder {
 
 enum class SolverName {
   kDefaultGMRESGroupSolver = 0,
+  kDefaultConjugateGradientGroupSolver = 1,
+  kDefaultBiCGStabGroupSolver = 2,
+  kDefaultDirectLUGroupSolver = 3,
+  kDefaultDirectCholeskyGroupSolver = 4,
+  kDefaultMixedPrecisionGMRESGroupSolver = 5,
 };
 
 class SolverBuilder {
@@ -1,7 +1,11 @@
 #include "solver/builder/solver_builder.hpp"
 
 #include "solver/group/single_group_solver.h"
+#include "solver/linear/bicgstab.hpp"
+#include "solver/linear/conjugate_gradient.hpp"
+#include "solver/linear/direct.hpp"
 #include "solver/linear/gmres.h"
+#include "solver/linear/mixed_precision_gmres.hpp"
 
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/test_helper_functions.h"
@@ -30,6 +34,8 @@ TEST_F(SolverBuilderDefaultGMRESTest, DefaultParameters) {
   ASSERT_NE(linear_solver_ptr, nullptr);
   EXPECT_EQ(linear_solver_ptr->max_iterations(), default_max_iterations);
   EXPECT_EQ(linear_solver_ptr->convergence_tolerance(), default_convergence_tolerance);
+  EXPECT_EQ(group_solver_ptr->preconditioner_type(), bart::problem::PreconditionerType::kNone);
+  EXPECT_FALSE(group_solver_ptr->use_inexact_solves());
 }
 
 TEST_F(SolverBuilderDefaultGMRESTest, SetParameters) {
@@ -46,4 +52,52 @@ TEST_F(SolverBuilderDefaultGMRESTest, SetParameters) {
   EXPECT_EQ(linear_solver_ptr->convergence_tolerance(), convergence_tolerance);
 }
 
+TEST_F(SolverBuilderDefaultGMRESTest, SetPreconditioner) {
+  using PreconditionerType = bart::problem::PreconditionerType;
+  const int max_iterations { test_helpers::RandomInt(150, 200) };
+  const double convergence_tolerance { test_helpers::RandomDouble(1e-10, 1e-6) };
+  auto solver_ptr = builder::SolverBuilder::BuildSolver(SolverName::kDefaultGMRESGroupSolver, max_iterations,
+                                                        convergence_tolerance, PreconditionerType::kIncompleteCholesky,
+                                                        true);
+  ASSERT_NE(solver_ptr, nullptr);
+  auto group_solver_ptr = dynamic_cast<ExpectedGroupSolver*>(solver_ptr.get());
+  ASSERT_NE(group_solver_ptr, nullptr);
+  EXPECT_EQ(group_solver_ptr->preconditioner_type(), PreconditionerType::kIncompleteCholesky);
+  EXPECT_TRUE(group_solver_ptr->use_inexact_solves());
+  auto linear_solver_ptr = dynamic_cast<ExpectedLinearSolver*>(group_solver_ptr->linear_solver_ptr());
+  ASSERT_NE(linear_solver_ptr, nullptr);
+  EXPECT_EQ(linear_solver_ptr->max_iterations(), max_iterations);
+  EXPECT_EQ(linear_solver_ptr->convergence_tolerance(), convergence_tolerance);
+}
+
+/* Returns the linear solver of a default group solver built with the given name, cast to the expected type. The group
+ * solver is stored in solver_ptr to keep the linear solver alive. */
+template <typename ExpectedLinearSolver>
+auto BuiltLinearSolver(const SolverName name, std::unique_ptr<solver::group::SingleGroupSolverI>& solver_ptr)
+-> ExpectedLinearSolver* {
+  solver_ptr = builder::SolverBuilder::BuildSolver(name);
+  auto group_solver_ptr = dynamic_cast<solver::group::SingleGroupSolver*>(solver_ptr.get());
+  if (group_solver_ptr == nullptr)
+    return nullptr;
+  return dynamic_cast<ExpectedLinearSolver*>(group_solver_ptr->linear_solver_ptr());
+}
+
+// Each solver name should build the default group solver with the matching linear solver
+TEST(SolverBuilderTest, LinearSolverTypes) {
+  using Direct = solver::linear::Direct;
+  std::unique_ptr<solver::group::SingleGroupSolverI> solver_ptr;
+  EXPECT_NE(BuiltLinearSolver<solver::linear::ConjugateGradient>(SolverName::kDefaultConjugateGradientGroupSolver,
+                                                                 solver_ptr), nullptr);
+  EXPECT_NE(BuiltLinearSolver<solver::linear::BiCGStab>(SolverName::kDefaultBiCGStabGroupSolver, solver_ptr),
+            nullptr);
+  auto direct_ptr = BuiltLinearSolver<Direct>(SolverName::kDefaultDirectLUGroupSolver, solver_ptr);
+  ASSERT_NE(direct_ptr, nullptr);
+  EXPECT_EQ(direct_ptr->factorization(), Direct::Factorization::kLU);
+  direct_ptr = BuiltLinearSolver<Direct>(SolverName::kDefaultDirectCholeskyGroupSolver, solver_ptr);
+  ASSERT_NE(direct_ptr, nullptr);
+  EXPECT_EQ(direct_ptr->factorization(), Direct::Factorization::kCholesky);
+  EXPECT_NE(BuiltLinearSolver<solver::linear::MixedPrecisionGMRES>(
+      SolverName::kDefaultMixedPrecisionGMRESGroupSolver, solver_ptr), nullptr);
+}
+
 } // namespace
@@ -1,6 +1,10 @@
 #include "solver/group/single_group_solver.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "solver/group/factory.hpp"
+#include "solver/linear/preconditioner.hpp"
 #include "system/system.hpp"
 #include "system/solution/mpi_group_angular_solution_i.h"
 
@@ -11,8 +15,17 @@ namespace solver {
 namespace group {
 
 SingleGroupSolver::SingleGroupSolver(
-    std::unique_ptr<LinearSolver> linear_solver_ptr)
-    : linear_solver_ptr_(std::move(linear_solver_ptr)) {}
+    std::unique_ptr<LinearSolver> linear_solver_ptr,
+    const PreconditionerType preconditioner_type,
+    const bool use_inexact_solves)
+    : linear_solver_ptr_(std::move(linear_solver_ptr)),
+      preconditioner_type_(preconditioner_type),
+      use_inexact_solves_(use_inexact_solves) {
+  if (use_inexact_solves_) {
+    forcing_term_ = kMaxForcingTerm;
+    linear_solver_ptr_->SetRelativeTolerance(forcing_term_);
+  }
+}
 
 bool SingleGroupSolver::is_registered_ =
     SingleGroupSolverIFactory<std::unique_ptr<LinearSolver>>::get()
@@ -22,6 +35,17 @@ bool SingleGroupSolver::is_registered_ =
               std::make_unique<SingleGroupSolver>(std::move(linear_solver_ptr));
           return return_ptr; });
 
+bool SingleGroupSolver::is_registered_with_options_ =
+    SingleGroupSolverIFactory<std::unique_ptr<SingleGroupSolver::LinearSolver>, problem::PreconditionerType,
+                              bool>::get()
+    .RegisterConstructor(GroupSolverName::kDefaultImplementation,
+        [](std::unique_ptr<LinearSolver> linear_solver_ptr, problem::PreconditionerType preconditioner_type,
+           bool use_inexact_solves) {
+          std::unique_ptr<SingleGroupSolverI> return_ptr =
+              std::make_unique<SingleGroupSolver>(std::move(linear_solver_ptr), preconditioner_type,
+                                                  use_inexact_solves);
+          return return_ptr; });
+
 void SingleGroupSolver::SolveGroup(const int group,
                                    const system::System &system,
                                    system::solution::MPIGroupAngularSolutionI &group_solution) {
@@ -36,16 +60,78 @@ void SingleGroupSolver::SolveGroup(const int group,
   for (int angle = 0; angle < total_angles; ++angle) {
     system::Index index{group, angle};
     auto& solution = group_solution[angle];
-    auto left_hand_side_ptr = system.left_hand_side_ptr_->GetFullTermPtr(index);
     auto right_hand_side_ptr = system.right_hand_side_ptr_->GetFullTermPtr(index);
-    dealii::PETScWrappers::PreconditionNone no_conditioner(*left_hand_side_ptr);
+    std::shared_ptr<system::MPISparseMatrix> assembled_left_hand_side_ptr{ nullptr };
+    dealii::PETScWrappers::MatrixBase* left_hand_side_ptr{ nullptr };
+    dealii::PETScWrappers::MatrixBase* preconditioner_matrix_ptr{ nullptr };
+    dealii::PETScWrappers::PreconditionerBase* preconditioner_ptr{ nullptr };
+
+    if (system.left_hand_side_operator_ptr_ != nullptr) {
+      left_hand_side_ptr = system.left_hand_side_operator_ptr_->GetOperatorPtr(index);
+      preconditioner_ptr = system.left_hand_side_operator_ptr_->GetPreconditionerPtr(index);
+      if (preconditioner_ptr == nullptr)
+        preconditioner_matrix_ptr = system.left_hand_side_operator_ptr_->GetPreconditionerMatrixPtr(index);
+    } else {
+      assembled_left_hand_side_ptr = system.left_hand_side_ptr_->GetFullTermPtr(index);
+      left_hand_side_ptr = assembled_left_hand_side_ptr.get();
+      preconditioner_matrix_ptr = left_hand_side_ptr;
+    }
+    if (preconditioner_ptr == nullptr) {
+      const bool uses_preconditioner{ linear_solver_ptr_->UsesPreconditioner() };
+      /* Solvers that do not apply a preconditioner still need it to find the
+       * matrix to factorize, if it is not the operator */
+      if (preconditioner_matrix_ptr != nullptr &&
+          (uses_preconditioner || preconditioner_matrix_ptr != left_hand_side_ptr)) {
+        const auto preconditioner_type = uses_preconditioner ? preconditioner_type_ : PreconditionerType::kNone;
+        preconditioner_ptr = GetPreconditioner(preconditioner_type, *preconditioner_matrix_ptr);
+      } else if (uses_preconditioner) {
+        // Matrix-based preconditioners cannot be built for operators
+        preconditioner_ptr = GetPreconditioner(PreconditionerType::kNone, *left_hand_side_ptr);
+      }
+    }
 
     linear_solver_ptr_->Solve(
-        left_hand_side_ptr.get(),
+        left_hand_side_ptr,
         &solution,
         right_hand_side_ptr.get(),
-        &no_conditioner);
+        preconditioner_ptr);
+  }
+}
+
+void SingleGroupSolver::UpdateSourceIterationStatus(const convergence::Status& source_iteration_status) {
+  if (!use_inexact_solves_)
+    return;
+  if (source_iteration_status.is_complete) {
+    // The next group starts with a loose tolerance again
+    forcing_term_ = kMaxForcingTerm;
+    previous_delta_ = std::nullopt;
+  } else if (source_iteration_status.delta.has_value()) {
+    // Eisenstat-Walker choice 2, with gamma = 0.9 and alpha = 2
+    constexpr double gamma{ 0.9 }, alpha{ 2.0 };
+    const double delta{ source_iteration_status.delta.value() };
+    if (previous_delta_.has_value() && previous_delta_.value() > 0) {
+      const double forcing_term{ gamma * std::pow(delta / previous_delta_.value(), alpha) };
+      forcing_term_ = std::min(forcing_term, kMaxForcingTerm);
+    }
+    previous_delta_ = delta;
+  }
+  linear_solver_ptr_->SetRelativeTolerance(forcing_term_);
+}
+
+auto SingleGroupSolver::GetPreconditioner(const PreconditionerType preconditioner_type,
+                                          const dealii::PETScWrappers::MatrixBase& matrix) -> Preconditioner* {
+  PetscObjectState matrix_state{ 0 };
+  const Mat& petsc_matrix = matrix;
+  const PetscErrorCode error_code = PetscObjectStateGet(reinterpret_cast<PetscObject>(petsc_matrix), &matrix_state);
+  AssertThrow(error_code == 0,
+              dealii::ExcMessage("Error in SingleGroupSolver function GetPreconditioner: failed to get matrix state"))
+
+  auto& stored_preconditioner = preconditioners_[petsc_matrix];
+  if (stored_preconditioner.preconditioner_ptr == nullptr || stored_preconditioner.matrix_state != matrix_state) {
+    stored_preconditioner.preconditioner_ptr = solver::linear::MakePreconditioner(preconditioner_type, matrix);
+    stored_preconditioner.matrix_state = matrix_state;
   }
+  return stored_preconditioner.preconditioner_ptr.get();
 }
 
 } // namespace group
@@ -1,8 +1,13 @@
 #ifndef BART_SRC_SOLVER_GROUP_SINGLE_GROUP_SOLVER_H_
 #define BART_SRC_SOLVER_GROUP_SINGLE_GROUP_SOLVER_H_
 
+#include <map>
 #include <memory>
+#include <optional>
 
+#include <petscmat.h>
+
+#include "problem/parameter_types.hpp"
 #include "solver/group/single_group_solver_i.h"
 #include "solver/linear/linear_i.hpp"
 
@@ -12,24 +17,73 @@ namespace solver {
 
 namespace group {
 
+/*! \brief Solves each angle of a group using a linear solver.
+ *
+ * A preconditioner is built for the left hand side of each group and angle the
+ * first time it is solved, and is reused for later solves as long as the
+ * matrix values are unchanged. If the left hand side is applied by an operator,
+ * the preconditioner provided by the operator is used instead, or if it
+ * provides none, a preconditioner built for the operator's preconditioner
+ * matrix. Preconditioners are stored by matrix, so operators sharing a
+ * preconditioner matrix, such as opposite directions, share the
+ * preconditioner. No preconditioners are built for linear solvers that do not
+ * use them, unless the matrix to factorize differs from the operator.
+ *
+ * Each solve starts from the current angular solution. With inexact solves,
+ * the linear solver tolerance relative to the initial residual is set from the
+ * change between source iterations (Eisenstat-Walker forcing terms), so early
+ * source iterations are not solved to the full convergence tolerance.
+ */
 class SingleGroupSolver : public SingleGroupSolverI {
  public:
 
   using LinearSolver = bart::solver::linear::LinearI;
+  using PreconditionerType = problem::PreconditionerType;
 
-  SingleGroupSolver(std::unique_ptr<LinearSolver> linear_solver_ptr);
+  SingleGroupSolver(std::unique_ptr<LinearSolver> linear_solver_ptr,
+                    PreconditionerType preconditioner_type = PreconditionerType::kNone,
+                    bool use_inexact_solves = false);
   virtual ~SingleGroupSolver() = default;
 
   void SolveGroup(const int group,
                   const system::System &system,
                   system::solution::MPIGroupAngularSolutionI &group_solution) override;
+  void UpdateSourceIterationStatus(const convergence::Status& source_iteration_status) override;
+  auto StoredMemory() const -> std::size_t override { return linear_solver_ptr_->StoredMemory(); }
 
   LinearSolver* linear_solver_ptr() const {
     return linear_solver_ptr_.get();
   }
+  PreconditionerType preconditioner_type() const { return preconditioner_type_; }
+  bool use_inexact_solves() const { return use_inexact_solves_; }
+  /*! Relative tolerance used for the next inexact solve. */
+  double forcing_term() const { return forcing_term_; }
+
+  //! Largest relative tolerance used for inexact solves
+  static constexpr double kMaxForcingTerm{ 0.1 };
  protected:
+  using Preconditioner = dealii::PETScWrappers::PreconditionerBase;
+  /*! Preconditioner and the state of the matrix values it was built for. The
+   * preconditioner holds a reference to the PETSc matrix, so it cannot be freed
+   * and replaced by another matrix at the same address. */
+  struct StoredPreconditioner {
+    PetscObjectState matrix_state{ 0 };
+    std::unique_ptr<Preconditioner> preconditioner_ptr{ nullptr };
+  };
+
+  /*! \brief Returns the stored preconditioner for a matrix, rebuilding it if
+   * the matrix values have changed. */
+  auto GetPreconditioner(PreconditionerType preconditioner_type,
+                         const dealii::PETScWrappers::MatrixBase& matrix) -> Preconditioner*;
+
   std::unique_ptr<LinearSolver> linear_solver_ptr_ = nullptr;
+  const PreconditionerType preconditioner_type_;
+  const bool use_inexact_solves_;
+  double forcing_term_{ 0.0 };
+  std::optional<double> previous_delta_{ std::nullopt };
+  std::map<Mat, StoredPreconditioner> preconditioners_;
   static bool is_registered_;
+  static bool is_registered_with_options_;
 };
 
 } // namespace group
@@ -1,6 +1,9 @@
 #ifndef BART_SRC_SOLVER_GROUP_TESTS_SINGLE_GROUP_SOLVER_I_H_
 #define BART_SRC_SOLVER_GROUP_TESTS_SINGLE_GROUP_SOLVER_I_H_
 
+#include <cstddef>
+
+#include "convergence/status.hpp"
 #include "system/system.hpp"
 #include "system/solution/mpi_group_angular_solution_i.h"
 
@@ -25,6 +28,14 @@ class SingleGroupSolverI {
   virtual void SolveGroup(const int group,
                           const system::System& system,
                           system::solution::MPIGroupAngularSolutionI& group_solution) = 0;
+  /*! \brief Provides the status of the source iteration after each group solve.
+   *
+   * Solvers may use the change in the solution between source iterations to
+   * adjust how accurately each group is solved.
+   */
+  virtual void UpdateSourceIterationStatus(const convergence::Status& /*source_iteration_status*/) {}
+  /*! \brief Returns the memory in bytes held between group solves on this process, such as stored factorizations. */
+  virtual auto StoredMemory() const -> std::size_t { return 0; }
 };
 
 } // namespace group
@@ -21,4 +21,22 @@ TEST(SolverGroupFactoryTests, SingleGroupSolverDefaultImplementation) {
   ASSERT_NE(dynamic_cast<ExpectedType*>(group_solver_ptr.get()), nullptr);
 }
 
+TEST(SolverGroupFactoryTests, SingleGroupSolverDefaultImplementationWithOptions) {
+  using SolverName = solver::group::GroupSolverName;
+  using ExpectedType = solver::group::SingleGroupSolver;
+  using LinearSolver = solver::linear::LinearI;
+  using PreconditionerType = bart::problem::PreconditionerType;
+
+  auto group_solver_ptr =
+      solver::group::SingleGroupSolverIFactory<std::unique_ptr<LinearSolver>, PreconditionerType, bool>::get()
+          .GetConstructor(SolverName::kDefaultImplementation)(
+              std::make_unique<::testing::NiceMock<solver::linear::LinearMock>>(),
+              PreconditionerType::kAlgebraicMultigrid, true);
+  ASSERT_NE(group_solver_ptr, nullptr);
+  auto dynamic_ptr = dynamic_cast<ExpectedType*>(group_solver_ptr.get());
+  ASSERT_NE(dynamic_ptr, nullptr);
+  EXPECT_EQ(dynamic_ptr->preconditioner_type(), PreconditionerType::kAlgebraicMultigrid);
+  EXPECT_TRUE(dynamic_ptr->use_inexact_solves());
+}
+
 } // namespace
@@ -18,6 +18,8 @@ class SingleGroupSolverMock : public SingleGroupSolverI {
                   const system::System& system,
                   system::solution::MPIGroupAngularSolutionI& group_solution),
               (override));
+  MOCK_METHOD(void, UpdateSourceIterationStatus, (const convergence::Status&), (override));
+  MOCK_METHOD(std::size_t, StoredMemory, (), (const, override));
 };
 
 } // namespace group
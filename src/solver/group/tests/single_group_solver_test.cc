@@ -5,7 +5,9 @@
 #include "system/system.hpp"
 #include "system/solution/tests/mpi_group_angular_solution_mock.h"
 #include "system/terms/tests/linear_term_mock.hpp"
+#include "system/terms/tests/bilinear_operator_mock.hpp"
 #include "system/terms/tests/bilinear_term_mock.hpp"
+#include "solver/linear/preconditioner.hpp"
 #include "solver/linear/tests/linear_mock.h"
 #include "test_helpers/dealii_test_domain.h"
 #include "test_helpers/gmock_wrapper.h"
@@ -16,7 +18,7 @@ using namespace bart;
 
 using ::testing::DoDefault, ::testing::NiceMock, ::testing::Return;
 using ::testing::ReturnRef, ::testing::_;
-using ::testing::Pointee, ::testing::Ref;
+using ::testing::Pointee, ::testing::Ref, ::testing::NotNull;
 
 class SolverGroupSingleGroupSolverTest :
     public ::testing::Test,
@@ -71,6 +73,14 @@ TEST_F(SolverGroupSingleGroupSolverTest, Constructor) {
   auto test_ptr = dynamic_cast<LinearSolver*>(test_solver.linear_solver_ptr());
 
   EXPECT_NE(test_ptr, nullptr);
+  EXPECT_EQ(test_solver.preconditioner_type(), problem::PreconditionerType::kNone);
+  EXPECT_FALSE(test_solver.use_inexact_solves());
+}
+
+TEST_F(SolverGroupSingleGroupSolverTest, ConstructorWithPreconditioner) {
+  solver::group::SingleGroupSolver test_solver(std::move(linear_solver_ptr_), problem::PreconditionerType::kJacobi);
+  EXPECT_NE(dynamic_cast<LinearSolver*>(test_solver.linear_solver_ptr()), nullptr);
+  EXPECT_EQ(test_solver.preconditioner_type(), problem::PreconditionerType::kJacobi);
 }
 
 TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupOperation) {
@@ -118,6 +128,134 @@ TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupOperation) {
   test_solver.SolveGroup(test_group_, test_system_, solution_);
 }
 
+TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupWithOperator) {
+  solver::group::SingleGroupSolver test_solver(std::move(linear_solver_ptr_));
+  auto operator_ptr = std::make_shared<system::terms::BilinearOperatorMock>();
+  test_system_.left_hand_side_operator_ptr_ = operator_ptr;
+
+  std::vector<system::MPIVector> solution_vectors_(total_angles_);
+  std::vector<system::MPISparseMatrix> operator_matrices_(total_angles_);
+  std::vector<std::shared_ptr<system::MPIVector>> rhs_vectors_(total_angles_);
+  std::vector<std::unique_ptr<dealii::PETScWrappers::PreconditionNone>> preconditioners_(total_angles_);
+
+  EXPECT_CALL(solution_, total_angles()).WillOnce(Return(total_angles_));
+  // Assembled left hand sides should not be used
+  EXPECT_CALL(*lhs_obs_ptr_, GetFullTermPtr(_)).Times(0);
+
+  for (int angle = 0; angle < total_angles_; ++angle) {
+    system::Index index{test_group_, angle};
+    rhs_vectors_[angle] = std::make_shared<system::MPIVector>();
+    operator_matrices_[angle].reinit(matrix_1);
+    // The second angle has no preconditioner and should fall back to no preconditioning
+    if (angle == 0)
+      preconditioners_[angle] = std::make_unique<dealii::PETScWrappers::PreconditionNone>(operator_matrices_[angle]);
+
+    EXPECT_CALL(solution_, BracketOp(angle)).WillOnce(ReturnRef(solution_vectors_[angle]));
+    EXPECT_CALL(*operator_ptr, GetOperatorPtr(index)).WillOnce(Return(&operator_matrices_[angle]));
+    EXPECT_CALL(*operator_ptr, GetPreconditionerPtr(index)).WillOnce(Return(preconditioners_[angle].get()));
+    EXPECT_CALL(*operator_ptr, GetPreconditionerMatrixPtr(index))
+        .Times(angle == 0 ? 0 : 1)
+        .WillRepeatedly(Return(nullptr));
+    EXPECT_CALL(*rhs_obs_ptr_, GetFullTermPtr(index)).WillOnce(Return(rhs_vectors_[angle]));
+
+    if (angle == 0) {
+      EXPECT_CALL(*linear_solver_obs_ptr_, Solve(&operator_matrices_[angle], Pointee(solution_vectors_[angle]),
+                                                 rhs_vectors_[angle].get(), preconditioners_[angle].get()));
+    } else {
+      EXPECT_CALL(*linear_solver_obs_ptr_, Solve(&operator_matrices_[angle], Pointee(solution_vectors_[angle]),
+                                                 rhs_vectors_[angle].get(), NotNull()));
+    }
+  }
+
+  test_solver.SolveGroup(test_group_, test_system_, solution_);
+}
+
+/* Operators that provide the same preconditioner matrix, such as opposite
+ * directions, should share one preconditioner built for that matrix */
+TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupWithSharedPreconditionerMatrix) {
+  using Preconditioner = dealii::PETScWrappers::PreconditionerBase;
+  solver::group::SingleGroupSolver test_solver(std::move(linear_solver_ptr_), problem::PreconditionerType::kJacobi);
+  auto operator_ptr = std::make_shared<system::terms::BilinearOperatorMock>();
+  test_system_.left_hand_side_operator_ptr_ = operator_ptr;
+
+  std::vector<system::MPIVector> solution_vectors_(total_angles_);
+  std::vector<system::MPISparseMatrix> operator_matrices_(total_angles_);
+  std::vector<std::shared_ptr<system::MPIVector>> rhs_vectors_(total_angles_);
+  std::vector<Preconditioner*> used_preconditioners_;
+  system::MPISparseMatrix preconditioner_matrix;
+  preconditioner_matrix.reinit(matrix_1);
+  StampMatrix(preconditioner_matrix, 1);
+
+  EXPECT_CALL(solution_, total_angles()).WillOnce(Return(total_angles_));
+  EXPECT_CALL(*lhs_obs_ptr_, GetFullTermPtr(_)).Times(0);
+  for (int angle = 0; angle < total_angles_; ++angle) {
+    system::Index index{test_group_, angle};
+    rhs_vectors_[angle] = std::make_shared<system::MPIVector>();
+    operator_matrices_[angle].reinit(matrix_1);
+
+    EXPECT_CALL(solution_, BracketOp(angle)).WillOnce(ReturnRef(solution_vectors_[angle]));
+    EXPECT_CALL(*operator_ptr, GetOperatorPtr(index)).WillOnce(Return(&operator_matrices_[angle]));
+    EXPECT_CALL(*operator_ptr, GetPreconditionerPtr(index)).WillOnce(Return(nullptr));
+    EXPECT_CALL(*operator_ptr, GetPreconditionerMatrixPtr(index)).WillOnce(Return(&preconditioner_matrix));
+    EXPECT_CALL(*rhs_obs_ptr_, GetFullTermPtr(index)).WillOnce(Return(rhs_vectors_[angle]));
+    EXPECT_CALL(*linear_solver_obs_ptr_, Solve(&operator_matrices_[angle], Pointee(solution_vectors_[angle]),
+                                               rhs_vectors_[angle].get(), NotNull()))
+        .WillOnce([&used_preconditioners_](auto, auto, auto, Preconditioner* preconditioner_ptr) {
+          used_preconditioners_.push_back(preconditioner_ptr); });
+  }
+
+  test_solver.SolveGroup(test_group_, test_system_, solution_);
+
+  ASSERT_EQ(used_preconditioners_.size(), static_cast<std::size_t>(total_angles_));
+  EXPECT_EQ(used_preconditioners_[0], used_preconditioners_[1]);
+  const Mat& expected_matrix = preconditioner_matrix;
+  EXPECT_EQ(solver::linear::GetPreconditionerMatrix(*used_preconditioners_[0]), expected_matrix);
+}
+
+// Preconditioners should be built once for each angle, and only rebuilt if the matrix values change
+TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupPreconditionerReused) {
+  using Preconditioner = dealii::PETScWrappers::PreconditionerBase;
+  solver::group::SingleGroupSolver test_solver(std::move(linear_solver_ptr_), problem::PreconditionerType::kJacobi);
+  const int n_solves{ 3 };
+
+  std::vector<system::MPIVector> solution_vectors_(total_angles_);
+  std::vector<std::shared_ptr<system::MPISparseMatrix>> lhs_matrices_(total_angles_);
+  std::vector<std::shared_ptr<system::MPIVector>> rhs_vectors_(total_angles_);
+  std::vector<std::vector<Preconditioner*>> used_preconditioners_(total_angles_);
+
+  EXPECT_CALL(solution_, total_angles()).Times(n_solves).WillRepeatedly(Return(total_angles_));
+  for (int angle = 0; angle < total_angles_; ++angle) {
+    system::Index index{test_group_, angle};
+    rhs_vectors_[angle] = std::make_shared<system::MPIVector>();
+    lhs_matrices_[angle] = std::make_shared<system::MPISparseMatrix>();
+    lhs_matrices_[angle]->reinit(matrix_1);
+    StampMatrix(*lhs_matrices_[angle], 1);
+
+    EXPECT_CALL(solution_, BracketOp(angle)).Times(n_solves).WillRepeatedly(ReturnRef(solution_vectors_[angle]));
+    EXPECT_CALL(*lhs_obs_ptr_, GetFullTermPtr(index)).Times(n_solves).WillRepeatedly(Return(lhs_matrices_[angle]));
+    EXPECT_CALL(*rhs_obs_ptr_, GetFullTermPtr(index)).Times(n_solves).WillRepeatedly(Return(rhs_vectors_[angle]));
+    EXPECT_CALL(*linear_solver_obs_ptr_, Solve(lhs_matrices_[angle].get(), Pointee(solution_vectors_[angle]),
+                                               rhs_vectors_[angle].get(), NotNull()))
+        .Times(n_solves)
+        .WillRepeatedly([&used_preconditioners_, angle](auto, auto, auto, Preconditioner* preconditioner_ptr) {
+          used_preconditioners_[angle].push_back(preconditioner_ptr); });
+  }
+
+  test_solver.SolveGroup(test_group_, test_system_, solution_);
+  test_solver.SolveGroup(test_group_, test_system_, solution_);
+  // Changing the values of the first matrix should cause its preconditioner to be rebuilt
+  StampMatrix(*lhs_matrices_[0], 1);
+  test_solver.SolveGroup(test_group_, test_system_, solution_);
+
+  ASSERT_EQ(used_preconditioners_[0].size(), static_cast<std::size_t>(n_solves));
+  ASSERT_EQ(used_preconditioners_[1].size(), static_cast<std::size_t>(n_solves));
+  EXPECT_NE(used_preconditioners_[0][0], used_preconditioners_[1][0]);
+  EXPECT_EQ(used_preconditioners_[0][0], used_preconditioners_[0][1]);
+  EXPECT_NE(used_preconditioners_[0][1], used_preconditioners_[0][2]);
+  EXPECT_EQ(used_preconditioners_[1][0], used_preconditioners_[1][1]);
+  EXPECT_EQ(used_preconditioners_[1][1], used_preconditioners_[1][2]);
+}
+
 TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupBadAngles) {
   solver::group::SingleGroupSolver test_solver(std::move(linear_solver_ptr_));
 
@@ -130,4 +268,51 @@ TEST_F(SolverGroupSingleGroupSolverTest, SolveGroupBadAngles) {
 }
 
 
+// Inexact solves should set relative tolerances from the change between source iterations
+TEST_F(SolverGroupSingleGroupSolverTest, InexactSolveTolerances) {
+  using SingleGroupSolver = solver::group::SingleGroupSolver;
+  constexpr double max_forcing_term{ SingleGroupSolver::kMaxForcingTerm };
+  EXPECT_CALL(*linear_solver_obs_ptr_, SetRelativeTolerance(max_forcing_term)).Times(2);
+  SingleGroupSolver test_solver(std::move(linear_solver_ptr_), problem::PreconditionerType::kNone, true);
+  EXPECT_TRUE(test_solver.use_inexact_solves());
+  EXPECT_EQ(test_solver.forcing_term(), max_forcing_term);
+
+  convergence::Status status;
+  status.delta = 1.0;
+  test_solver.UpdateSourceIterationStatus(status);
+  EXPECT_EQ(test_solver.forcing_term(), max_forcing_term);
+
+  // Forcing term is 0.9 * (delta / previous delta)^2
+  const double expected_forcing_term{ 0.9 * 0.01 * 0.01 };
+  EXPECT_CALL(*linear_solver_obs_ptr_, SetRelativeTolerance(::testing::DoubleEq(expected_forcing_term)));
+  status.delta = 0.01;
+  test_solver.UpdateSourceIterationStatus(status);
+  EXPECT_DOUBLE_EQ(test_solver.forcing_term(), expected_forcing_term);
+
+  // A completed source iteration resets the forcing term for the next group
+  EXPECT_CALL(*linear_solver_obs_ptr_, SetRelativeTolerance(max_forcing_term));
+  status.is_complete = true;
+  test_solver.UpdateSourceIterationStatus(status);
+  EXPECT_EQ(test_solver.forcing_term(), max_forcing_term);
+}
+
+// Exact solves should not change the linear solver tolerance
+TEST_F(SolverGroupSingleGroupSolverTest, ExactSolveTolerances) {
+  EXPECT_CALL(*linear_solver_obs_ptr_, SetRelativeTolerance(_)).Times(0);
+  solver::group::SingleGroupSolver test_solver(std::move(linear_solver_ptr_));
+  convergence::Status status;
+  status.delta = 1.0;
+  test_solver.UpdateSourceIterationStatus(status);
+  status.delta = 0.5;
+  test_solver.UpdateSourceIterationStatus(status);
+}
+
+// Stored memory should be the memory stored by the linear solver
+TEST_F(SolverGroupSingleGroupSolverTest, StoredMemory) {
+  const std::size_t stored_memory{ 1024 };
+  EXPECT_CALL(*linear_solver_obs_ptr_, StoredMemory()).WillOnce(Return(stored_memory));
+  solver::group::SingleGroupSolver test_solver(std::move(linear_solver_ptr_));
+  EXPECT_EQ(test_solver.StoredMemory(), stored_memory);
+}
+
 } // namespace
@@ -0,0 +1,16 @@
+#include "solver/linear/bicgstab.hpp"
+#include "solver/linear/factory.hpp"
+
+namespace bart::solver::linear {
+
+BiCGStab::BiCGStab(int max_iterations, double convergence_tolerance)
+    : KrylovSolver(max_iterations, convergence_tolerance, KSPBCGS) {}
+
+bool BiCGStab::is_registered_ = LinearIFactory<int, double>::get()
+    .RegisterConstructor(LinearSolverName::kBiCGStab,
+                         [] (int max_iterations, double convergence_tolerance) {
+                           std::unique_ptr<LinearI> return_ptr;
+                           return_ptr = std::make_unique<BiCGStab>(max_iterations, convergence_tolerance);
+                           return return_ptr; });
+
+} // namespace bart::solver::linear
@@ -0,0 +1,19 @@
+#ifndef BART_SRC_SOLVER_LINEAR_BICGSTAB_HPP_
+#define BART_SRC_SOLVER_LINEAR_BICGSTAB_HPP_
+
+#include "solver/linear/krylov_solver.hpp"
+
+namespace bart::solver::linear {
+
+/*! \brief BiCGStab solver using PETSc. */
+class BiCGStab : public KrylovSolver {
+ public:
+  BiCGStab(int max_iterations = 100, double convergence_tolerance = 1e-10);
+
+ private:
+  static bool is_registered_;
+};
+
+} // namespace bart::solver::linear
+
+#endif //BART_SRC_SOLVER_LINEAR_BICGSTAB_HPP_
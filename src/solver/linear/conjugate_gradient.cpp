@@ -0,0 +1,16 @@
+#include "solver/linear/conjugate_gradient.hpp"
+#include "solver/linear/factory.hpp"
+
+namespace bart::solver::linear {
+
+ConjugateGradient::ConjugateGradient(int max_iterations, double convergence_tolerance)
+    : KrylovSolver(max_iterations, convergence_tolerance, KSPCG) {}
+
+bool ConjugateGradient::is_registered_ = LinearIFactory<int, double>::get()
+    .RegisterConstructor(LinearSolverName::kConjugateGradient,
+                         [] (int max_iterations, double convergence_tolerance) {
+                           std::unique_ptr<LinearI> return_ptr;
+                           return_ptr = std::make_unique<ConjugateGradient>(max_iterations, convergence_tolerance);
+                           return return_ptr; });
+
+} // namespace bart::solver::linear
@@ -0,0 +1,19 @@
+#ifndef BART_SRC_SOLVER_LINEAR_CONJUGATE_GRADIENT_HPP_
+#define BART_SRC_SOLVER_LINEAR_CONJUGATE_GRADIENT_HPP_
+
+#include "solver/linear/krylov_solver.hpp"
+
+namespace bart::solver::linear {
+
+/*! \brief Conjugate gradient solver using PETSc, for symmetric positive definite systems. */
+class ConjugateGradient : public KrylovSolver {
+ public:
+  ConjugateGradient(int max_iterations = 100, double convergence_tolerance = 1e-10);
+
+ private:
+  static bool is_registered_;
+};
+
+} // namespace bart::solver::linear
+
+#endif //BART_SRC_SOLVER_LINEAR_CONJUGATE_GRADIENT_HPP_
@@ -0,0 +1,110 @@
+#include "solver/linear/direct.hpp"
+#include "solver/linear/factory.hpp"
+#include "solver/linear/preconditioner.hpp"
+
+#include <string>
+
+namespace bart::solver::linear {
+
+namespace {
+
+auto CheckPETScError(const PetscErrorCode error_code, const std::string& failed_action) -> void {
+  AssertThrow(error_code == 0, dealii::ExcMessage("Error in Direct function Solve: failed to " + failed_action))
+}
+
+} // namespace
+
+Direct::Direct(const Factorization factorization)
+    : factorization_(factorization) {}
+
+Direct::~Direct() {
+  for (auto& [matrix, ksp] : factorization_solvers_)
+    KSPDestroy(&ksp);
+}
+
+void Direct::Solve(dealii::PETScWrappers::MatrixBase *A,
+                   dealii::PETScWrappers::VectorBase *x,
+                   dealii::PETScWrappers::VectorBase *b,
+                   dealii::PETScWrappers::PreconditionerBase *preconditioner) {
+  const Mat& matrix = *A;
+  Mat factorized_matrix{ matrix };
+  if (preconditioner != nullptr) {
+    if (const Mat preconditioner_matrix = GetPreconditionerMatrix(*preconditioner); preconditioner_matrix != nullptr)
+      factorized_matrix = preconditioner_matrix;
+  }
+  auto& ksp = factorization_solvers_[factorized_matrix];
+  if (ksp == nullptr)
+    ksp = MakeFactorizationSolver(A->get_mpi_communicator(), factorized_matrix != matrix);
+  // PETSc only factorizes again if the values of the factorized matrix have changed
+  CheckPETScError(KSPSetOperators(ksp, matrix, factorized_matrix), "set operators");
+
+  const Vec& right_hand_side = *b;
+  const Vec& solution = *x;
+  CheckPETScError(KSPSolve(ksp, right_hand_side, solution), "solve");
+
+  KSPConvergedReason converged_reason;
+  CheckPETScError(KSPGetConvergedReason(ksp, &converged_reason), "get convergence reason");
+  AssertThrow(converged_reason >= 0,
+              dealii::ExcMessage("Error in Direct function Solve: factorization failed, matrix may be singular"))
+}
+
+auto Direct::StoredMemory() const -> std::size_t {
+  std::size_t stored_memory{ 0 };
+  for (const auto& [matrix, ksp] : factorization_solvers_) {
+    PC pc{ nullptr };
+    Mat factored_matrix{ nullptr };
+    MatInfo info;
+    if (KSPGetPC(ksp, &pc) != 0 || PCFactorGetMatrix(pc, &factored_matrix) != 0 || factored_matrix == nullptr ||
+        MatGetInfo(factored_matrix, MAT_LOCAL, &info) != 0)
+      continue;
+    // Each stored entry of the factors has a value and a column index
+    stored_memory += static_cast<std::size_t>(info.nz_used) * (sizeof(PetscScalar) + sizeof(PetscInt));
+  }
+  return stored_memory;
+}
+
+auto Direct::MakeFactorizationSolver(const MPI_Comm communicator, const bool preconditioned_iterations) const -> KSP {
+  KSP ksp{ nullptr };
+  CheckPETScError(KSPCreate(communicator, &ksp), "create solver");
+  if (preconditioned_iterations) {
+    CheckPETScError(KSPSetType(ksp, KSPGMRES), "set solver type");
+    CheckPETScError(KSPSetInitialGuessNonzero(ksp, PETSC_TRUE), "set initial guess");
+    CheckPETScError(KSPSetTolerances(ksp, kOperatorRelativeTolerance, PETSC_DEFAULT, PETSC_DEFAULT, PETSC_DEFAULT),
+                    "set tolerances");
+  } else {
+    CheckPETScError(KSPSetType(ksp, KSPPREONLY), "set solver type");
+  }
+  PC pc{ nullptr };
+  CheckPETScError(KSPGetPC(ksp, &pc), "access factorization");
+  CheckPETScError(PCSetType(pc, factorization_ == Factorization::kLU ? PCLU : PCCHOLESKY),
+                  "set factorization type");
+  int n_processes{ 1 };
+  MPI_Comm_size(communicator, &n_processes);
+  // PETSc's own factorizations are serial only
+  if (n_processes > 1) {
+#ifdef PETSC_HAVE_MUMPS
+    CheckPETScError(PCFactorSetMatSolverType(pc, MATSOLVERMUMPS), "set factorization package");
+#else
+    KSPDestroy(&ksp);
+    AssertThrow(false, dealii::ExcMessage("Error in Direct function Solve: parallel direct solves require PETSc to "
+                                          "be built with MUMPS"))
+#endif
+  }
+  return ksp;
+}
+
+bool Direct::is_registered_lu_ = LinearIFactory<>::get()
+    .RegisterConstructor(LinearSolverName::kDirectLU,
+                         [] () {
+                           std::unique_ptr<LinearI> return_ptr;
+                           return_ptr = std::make_unique<Direct>(Direct::Factorization::kLU);
+                           return return_ptr; });
+
+bool Direct::is_registered_cholesky_ = LinearIFactory<>::get()
+    .RegisterConstructor(LinearSolverName::kDirectCholesky,
+                         [] () {
+                           std::unique_ptr<LinearI> return_ptr;
+                           return_ptr = std::make_unique<Direct>(Direct::Factorization::kCholesky);
+                           return return_ptr; });
+
+} // namespace bart::solver::linear
@@ -0,0 +1,79 @@
+#ifndef BART_SRC_SOLVER_LINEAR_DIRECT_HPP_
+#define BART_SRC_SOLVER_LINEAR_DIRECT_HPP_
+
+#include <map>
+
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/petsc_matrix_base.h>
+#include <deal.II/lac/petsc_vector_base.h>
+
+#include <petscksp.h>
+
+#include "solver/linear/linear_i.hpp"
+
+namespace bart::solver::linear {
+
+/*! \brief Sparse direct solver using PETSc factorizations.
+ *
+ * Solves by factorizing the matrix and applying forward and back substitution.
+ * A factorization is stored for each matrix that is solved, so when each group
+ * and angle has its own left hand side, each is factorized once at its first
+ * solve and all later solves only apply the substitutions. A factorization is
+ * only recomputed if the values of its matrix change. Stored factorizations
+ * can be large, their size is given by StoredMemory. When run on more than one
+ * process, MUMPS is used for the factorization, which requires PETSc to be
+ * built with MUMPS.
+ *
+ * The provided preconditioner is not applied, and the relative tolerance is
+ * ignored, the factorization is always solved exactly. If the preconditioner
+ * was built for a different matrix than the operator, such as a matrix shared
+ * by the operators of opposite directions, that matrix is factorized instead
+ * and used to precondition GMRES on the operator, solved to
+ * kOperatorRelativeTolerance. The factorization is then shared by all
+ * operators with the same preconditioner matrix.
+ */
+class Direct : public LinearI {
+ public:
+  enum class Factorization {
+    kLU = 0,       //!< LU factorization, for any non-singular matrix
+    kCholesky = 1, //!< Cholesky factorization, for symmetric positive definite matrices
+  };
+
+  explicit Direct(Factorization factorization = Factorization::kLU);
+  Direct(const Direct&) = delete;
+  auto operator=(const Direct&) -> Direct& = delete;
+  ~Direct();
+
+  void Solve(dealii::PETScWrappers::MatrixBase *A,
+             dealii::PETScWrappers::VectorBase *x,
+             dealii::PETScWrappers::VectorBase *b,
+             dealii::PETScWrappers::PreconditionerBase *preconditioner) override;
+
+  auto UsesPreconditioner() const -> bool override { return false; }
+  /*! \brief Returns an estimate of the memory used by all stored factorizations on this process. */
+  auto StoredMemory() const -> std::size_t override;
+
+  Factorization factorization() const { return factorization_; }
+  int n_stored_factorizations() const { return static_cast<int>(factorization_solvers_.size()); }
+
+  //! Relative tolerance for operators that are preconditioned by the factorization of a different matrix
+  static constexpr double kOperatorRelativeTolerance{ 1e-12 };
+
+ private:
+  /*! Creates a solver that factorizes a matrix, if preconditioned_iterations
+   * is true the factorization preconditions GMRES instead of being applied
+   * directly. */
+  auto MakeFactorizationSolver(MPI_Comm communicator, bool preconditioned_iterations) const -> KSP;
+
+  const Factorization factorization_;
+  /*! Solvers holding the factorization of each matrix. Each solver holds a
+   * reference to its matrix, so it cannot be freed and replaced by another
+   * matrix at the same address. */
+  std::map<Mat, KSP> factorization_solvers_;
+  static bool is_registered_lu_;
+  static bool is_registered_cholesky_;
+};
+
+} // namespace bart::solver::linear
+
+#endif //BART_SRC_SOLVER_LINEAR_DIRECT_HPP_
@@ -10,6 +10,11 @@ class LinearI;
 
 enum class LinearSolverName {
   kGMRES = 0, //solver::linear::GMRES
+  kConjugateGradient = 1, //solver::linear::ConjugateGradient
+  kBiCGStab = 2, //solver::linear::BiCGStab
+  kDirectLU = 3, //solver::linear::Direct
+  kDirectCholesky = 4, //solver::linear::Direct
+  kMixedPrecisionGMRES = 5, //solver::linear::MixedPrecisionGMRES
 };
 
 BART_INTERFACE_FACTORY(LinearI, LinearSolverName)
@@ -19,6 +24,16 @@ BART_INTERFACE_FACTORY(LinearI, LinearSolverName)
   switch (to_convert) {
     case LinearSolverName::kGMRES:
       return std::string{"LinearSolverName::kGMRES"};
+    case LinearSolverName::kConjugateGradient:
+      return std::string{"LinearSolverName::kConjugateGradient"};
+    case LinearSolverName::kBiCGStab:
+      return std::string{"LinearSolverName::kBiCGStab"};
+    case LinearSolverName::kDirectLU:
+      return std::string{"LinearSolverName::kDirectLU"};
+    case LinearSolverName::kDirectCholesky:
+      return std::string{"LinearSolverName::kDirectCholesky"};
+    case LinearSolverName::kMixedPrecisionGMRES:
+      return std::string{"LinearSolverName::kMixedPrecisionGMRES"};
   }
   return std::string{"String not defined for specified LinearSolverName"};
 }
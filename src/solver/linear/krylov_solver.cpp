@@ -0,0 +1,67 @@
+#include "solver/linear/krylov_solver.hpp"
+
+#include <string>
+
+#include "solver/linear/preconditioner.hpp"
+
+namespace bart::solver::linear {
+
+namespace {
+
+auto CheckPETScError(const PetscErrorCode error_code, const std::string& failed_action) -> void {
+  AssertThrow(error_code == 0, dealii::ExcMessage("Error in KrylovSolver function Solve: failed to " + failed_action))
+}
+
+} // namespace
+
+KrylovSolver::KrylovSolver(const int max_iterations, const double convergence_tolerance, const KSPType krylov_type)
+    : solver_control_(max_iterations, convergence_tolerance),
+      krylov_type_(krylov_type) {}
+
+KrylovSolver::~KrylovSolver() {
+  if (ksp_ != nullptr)
+    KSPDestroy(&ksp_);
+}
+
+void KrylovSolver::Solve(dealii::PETScWrappers::MatrixBase *A,
+                         dealii::PETScWrappers::VectorBase *x,
+                         dealii::PETScWrappers::VectorBase *b,
+                         dealii::PETScWrappers::PreconditionerBase *preconditioner) {
+  if (ksp_ == nullptr) {
+    CheckPETScError(KSPCreate(A->get_mpi_communicator(), &ksp_), "create solver");
+    CheckPETScError(KSPSetType(ksp_, krylov_type_), "set solver type");
+    CheckPETScError(KSPSetInitialGuessNonzero(ksp_, PETSC_TRUE), "set initial guess");
+  }
+  /* The preconditioner is set before the operators, and is given the same
+   * matrix it was built with so it is not set up again. This matrix may differ
+   * from A, if the preconditioner is shared by several operators. */
+  CheckPETScError(KSPSetPC(ksp_, preconditioner->get_pc()), "set preconditioner");
+  const Mat& matrix = *A;
+  const Mat preconditioner_matrix{ GetPreconditionerMatrix(*preconditioner) };
+  CheckPETScError(KSPSetOperators(ksp_, matrix, preconditioner_matrix == nullptr ? matrix : preconditioner_matrix),
+                  "set operators");
+  CheckPETScError(KSPSetTolerances(ksp_, relative_tolerance_, solver_control_.tolerance(), PETSC_DEFAULT,
+                                   solver_control_.max_steps()), "set tolerances");
+
+  const Vec& right_hand_side = *b;
+  const Vec& solution = *x;
+  CheckPETScError(KSPSolve(ksp_, right_hand_side, solution), "solve");
+
+  KSPConvergedReason converged_reason;
+  PetscInt iterations{ 0 };
+  PetscReal residual_norm{ 0 };
+  CheckPETScError(KSPGetConvergedReason(ksp_, &converged_reason), "get convergence reason");
+  CheckPETScError(KSPGetIterationNumber(ksp_, &iterations), "get iteration number");
+  CheckPETScError(KSPGetResidualNorm(ksp_, &residual_norm), "get residual norm");
+  if (converged_reason < 0)
+    throw dealii::SolverControl::NoConvergence(iterations, residual_norm);
+}
+
+void KrylovSolver::SetRelativeTolerance(const double relative_tolerance) {
+  AssertThrow(relative_tolerance >= 0 && relative_tolerance < 1,
+              dealii::ExcMessage("Error in KrylovSolver function SetRelativeTolerance: relative tolerance must be in "
+                                 "[0, 1)"))
+  relative_tolerance_ = relative_tolerance;
+}
+
+} // namespace bart::solver::linear
@@ -0,0 +1,56 @@
+#ifndef BART_SRC_SOLVER_LINEAR_KRYLOV_SOLVER_HPP_
+#define BART_SRC_SOLVER_LINEAR_KRYLOV_SOLVER_HPP_
+
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/petsc_matrix_base.h>
+#include <deal.II/lac/petsc_vector_base.h>
+
+#include <petscksp.h>
+
+#include "solver/linear/linear_i.hpp"
+
+namespace bart::solver::linear {
+
+/*! \brief Base class for Krylov solvers using PETSc.
+ *
+ * The PETSc solver object is created at the first solve and reused for all
+ * following solves. The solution vector passed to Solve is used as the initial
+ * guess, so solves are warm-started from the previous solution. A solve that
+ * does not converge in the maximum number of iterations throws
+ * dealii::SolverControl::NoConvergence.
+ */
+class KrylovSolver : public LinearI {
+ public:
+  /*! \brief Constructor.
+   *
+   * @param max_iterations maximum iterations for each solve.
+   * @param convergence_tolerance absolute tolerance on the residual.
+   * @param krylov_type PETSc type of the Krylov method.
+   */
+  KrylovSolver(int max_iterations, double convergence_tolerance, KSPType krylov_type);
+  KrylovSolver(const KrylovSolver&) = delete;
+  auto operator=(const KrylovSolver&) -> KrylovSolver& = delete;
+  virtual ~KrylovSolver();
+
+  void Solve(dealii::PETScWrappers::MatrixBase *A,
+             dealii::PETScWrappers::VectorBase *x,
+             dealii::PETScWrappers::VectorBase *b,
+             dealii::PETScWrappers::PreconditionerBase *preconditioner) override;
+  void SetRelativeTolerance(double relative_tolerance) override;
+  int max_iterations() const { return solver_control_.max_steps(); };
+  double convergence_tolerance() const { return solver_control_.tolerance(); };
+  double relative_tolerance() const { return relative_tolerance_; };
+
+  const dealii::SolverControl& solver_control() const { return solver_control_;};
+
+ private:
+  dealii::SolverControl solver_control_;
+  const KSPType krylov_type_;
+  double relative_tolerance_{ 0.0 };
+  KSP ksp_{ nullptr };
+};
+
+} // namespace bart::solver::linear
+
+#endif //BART_SRC_SOLVER_LINEAR_KRYLOV_SOLVER_HPP_
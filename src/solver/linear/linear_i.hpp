@@ -1,6 +1,8 @@
 #ifndef BART_SOLVER_LINEAR_I_H_
 #define BART_SOLVER_LINEAR_I_H_
 
+#include <cstddef>
+
 #include <deal.II/lac/petsc_precondition.h>
 #include <deal.II/lac/petsc_matrix_base.h>
 #include <deal.II/lac/petsc_vector_base.h>
@@ -9,6 +11,7 @@ namespace bart::solver::linear {
 /*! \brief Linear solver class.
  *
  * This class is all solvers that solve an equation in the form \f$Ax = b\f$.
+ * The value of \f$x\f$ passed to Solve is used as the initial guess.
  *
  */
 class LinearI {
@@ -19,6 +22,19 @@ class LinearI {
       dealii::PETScWrappers::VectorBase *x,
       dealii::PETScWrappers::VectorBase *b,
       dealii::PETScWrappers::PreconditionerBase *preconditioner) = 0;
+  /*! \brief Sets a tolerance on the residual relative to the initial residual for following solves.
+   *
+   * Solves are converged when either the relative tolerance or the absolute convergence tolerance of the solver is
+   * met. A relative tolerance of zero uses only the absolute tolerance. Solvers that do not iterate ignore it.
+   */
+  virtual void SetRelativeTolerance(double /*relative_tolerance*/) {}
+  /*! \brief Returns true if the preconditioner passed to Solve is applied.
+   *
+   * Solvers that do not apply it may still use the matrix it was built for, if that matrix differs from the operator.
+   */
+  virtual auto UsesPreconditioner() const -> bool { return true; }
+  /*! \brief Returns the memory in bytes held between solves on this process, such as stored factorizations. */
+  virtual auto StoredMemory() const -> std::size_t { return 0; }
 };
 
 } // namespace bart::solver::linear
@@ -0,0 +1,292 @@
+#include "solver/linear/mixed_precision_gmres.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "solver/linear/factory.hpp"
+#include "solver/linear/preconditioner.hpp"
+
+namespace bart::solver::linear {
+
+namespace {
+
+auto CheckPETScError(const PetscErrorCode error_code, const std::string& failed_action) -> void {
+  AssertThrow(error_code == 0,
+              dealii::ExcMessage("Error in MixedPrecisionGMRES function Solve: failed to " + failed_action))
+}
+
+// Dot products are accumulated in double precision, only the stored vectors are single precision
+auto Dot(const std::vector<float>& a, const std::vector<float>& b) -> double {
+  double sum{ 0 };
+  for (std::size_t i = 0; i < a.size(); ++i)
+    sum += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+  return sum;
+}
+
+} // namespace
+
+MixedPrecisionGMRES::MixedPrecisionGMRES(const int max_iterations, const double convergence_tolerance,
+                                         const int inner_iterations)
+    : solver_control_(max_iterations, convergence_tolerance),
+      inner_iterations_(inner_iterations) {
+  AssertThrow(inner_iterations_ > 0, dealii::ExcMessage("Error in constructor of MixedPrecisionGMRES: inner "
+                                                        "iterations must be greater than zero"))
+}
+
+MixedPrecisionGMRES::~MixedPrecisionGMRES() {
+  if (ksp_ != nullptr)
+    KSPDestroy(&ksp_);
+  for (auto& [matrix, single_precision_matrix] : single_precision_matrices_)
+    MatDestroy(&single_precision_matrix.matrix);
+}
+
+void MixedPrecisionGMRES::Solve(dealii::PETScWrappers::MatrixBase *A,
+                                dealii::PETScWrappers::VectorBase *x,
+                                dealii::PETScWrappers::VectorBase *b,
+                                dealii::PETScWrappers::PreconditionerBase *preconditioner) {
+  const Mat& operator_matrix = *A;
+  Mat stored_matrix{ operator_matrix };
+  if (preconditioner != nullptr) {
+    if (const Mat preconditioner_matrix = GetPreconditionerMatrix(*preconditioner); preconditioner_matrix != nullptr)
+      stored_matrix = preconditioner_matrix;
+  }
+
+  if (ksp_ == nullptr) {
+    CheckPETScError(KSPCreate(A->get_mpi_communicator(), &ksp_), "create solver");
+    CheckPETScError(KSPSetType(ksp_, KSPFGMRES), "set solver type");
+    CheckPETScError(KSPSetInitialGuessNonzero(ksp_, PETSC_TRUE), "set initial guess");
+    PC pc{ nullptr };
+    CheckPETScError(KSPGetPC(ksp_, &pc), "access preconditioner");
+    CheckPETScError(PCSetType(pc, PCSHELL), "set preconditioner type");
+    CheckPETScError(PCShellSetContext(pc, this), "set preconditioner context");
+    CheckPETScError(PCShellSetApply(pc, &MixedPrecisionGMRES::ShellApply), "set preconditioner apply");
+  }
+  CheckPETScError(KSPSetOperators(ksp_, operator_matrix, operator_matrix), "set operators");
+  CheckPETScError(KSPSetTolerances(ksp_, relative_tolerance_, solver_control_.tolerance(), PETSC_DEFAULT,
+                                   solver_control_.max_steps()), "set tolerances");
+
+  current_matrix_ptr_ = &GetSinglePrecisionMatrix(stored_matrix);
+  const Vec& right_hand_side = *b;
+  const Vec& solution = *x;
+  const PetscErrorCode solve_error_code{ KSPSolve(ksp_, right_hand_side, solution) };
+  const PetscErrorCode restore_error_code{ RestoreIndices(*current_matrix_ptr_) };
+  current_matrix_ptr_ = nullptr;
+  CheckPETScError(solve_error_code, "solve");
+  CheckPETScError(restore_error_code, "restore matrix indices");
+
+  KSPConvergedReason converged_reason;
+  PetscInt iterations{ 0 };
+  PetscReal residual_norm{ 0 };
+  CheckPETScError(KSPGetConvergedReason(ksp_, &converged_reason), "get convergence reason");
+  CheckPETScError(KSPGetIterationNumber(ksp_, &iterations), "get iteration number");
+  CheckPETScError(KSPGetResidualNorm(ksp_, &residual_norm), "get residual norm");
+  if (converged_reason < 0)
+    throw dealii::SolverControl::NoConvergence(iterations, residual_norm);
+}
+
+void MixedPrecisionGMRES::SetRelativeTolerance(const double relative_tolerance) {
+  AssertThrow(relative_tolerance >= 0 && relative_tolerance < 1,
+              dealii::ExcMessage("Error in MixedPrecisionGMRES function SetRelativeTolerance: relative tolerance must "
+                                 "be in [0, 1)"))
+  relative_tolerance_ = relative_tolerance;
+}
+
+auto MixedPrecisionGMRES::StoredMemory() const -> std::size_t {
+  std::size_t stored_memory{ 0 };
+  for (const auto& [matrix, single_precision_matrix] : single_precision_matrices_) {
+    stored_memory += sizeof(float) * (single_precision_matrix.values.size()
+        + single_precision_matrix.inverse_diagonal.size());
+  }
+  return stored_memory;
+}
+
+auto MixedPrecisionGMRES::GetSinglePrecisionMatrix(Mat matrix) -> SinglePrecisionMatrix& {
+  PetscBool is_mpi_aij{ PETSC_FALSE }, is_seq_aij{ PETSC_FALSE };
+  CheckPETScError(PetscObjectTypeCompare(reinterpret_cast<PetscObject>(matrix), MATMPIAIJ, &is_mpi_aij),
+                  "get matrix type");
+  CheckPETScError(PetscObjectTypeCompare(reinterpret_cast<PetscObject>(matrix), MATSEQAIJ, &is_seq_aij),
+                  "get matrix type");
+  AssertThrow(is_mpi_aij == PETSC_TRUE || is_seq_aij == PETSC_TRUE,
+              dealii::ExcMessage("Error in MixedPrecisionGMRES function Solve: the matrix stored in single precision "
+                                 "must be an assembled sparse matrix, provide one with the preconditioner if the "
+                                 "operator is not"))
+
+  auto& single_precision_matrix = single_precision_matrices_[matrix];
+  if (single_precision_matrix.matrix == nullptr) {
+    CheckPETScError(PetscObjectReference(reinterpret_cast<PetscObject>(matrix)), "reference matrix");
+    single_precision_matrix.matrix = matrix;
+  }
+  Mat local_block{ matrix };
+  if (is_mpi_aij == PETSC_TRUE)
+    CheckPETScError(MatMPIAIJGetSeqAIJ(matrix, &local_block, nullptr, nullptr), "get local block");
+  single_precision_matrix.local_block = local_block;
+
+  PetscBool done{ PETSC_FALSE };
+  CheckPETScError(MatGetRowIJ(local_block, 0, PETSC_FALSE, PETSC_FALSE, &single_precision_matrix.n_rows,
+                              &single_precision_matrix.row_offsets, &single_precision_matrix.column_indices, &done),
+                  "get matrix indices");
+  AssertThrow(done == PETSC_TRUE,
+              dealii::ExcMessage("Error in MixedPrecisionGMRES function Solve: matrix does not provide its indices"))
+
+  PetscObjectState matrix_state{ 0 };
+  CheckPETScError(PetscObjectStateGet(reinterpret_cast<PetscObject>(matrix), &matrix_state), "get matrix state");
+  const auto n_rows{ static_cast<std::size_t>(single_precision_matrix.n_rows) };
+  const auto n_entries{ static_cast<std::size_t>(single_precision_matrix.row_offsets[n_rows]) };
+  if (single_precision_matrix.values.size() != n_entries || single_precision_matrix.matrix_state != matrix_state) {
+    const PetscScalar* values{ nullptr };
+    CheckPETScError(MatSeqAIJGetArrayRead(local_block, &values), "get matrix values");
+    single_precision_matrix.values.assign(values, values + n_entries);
+    CheckPETScError(MatSeqAIJRestoreArrayRead(local_block, &values), "restore matrix values");
+
+    // Jacobi preconditioning of the inner iterations, rows without a diagonal entry are not scaled
+    single_precision_matrix.inverse_diagonal.assign(n_rows, 1.0f);
+    for (std::size_t row = 0; row < n_rows; ++row) {
+      for (auto entry = single_precision_matrix.row_offsets[row]; entry < single_precision_matrix.row_offsets[row + 1];
+           ++entry) {
+        const float value{ single_precision_matrix.values[entry] };
+        if (single_precision_matrix.column_indices[entry] == static_cast<PetscInt>(row) && value != 0.0f)
+          single_precision_matrix.inverse_diagonal[row] = 1.0f / value;
+      }
+    }
+    single_precision_matrix.matrix_state = matrix_state;
+  }
+  return single_precision_matrix;
+}
+
+auto MixedPrecisionGMRES::RestoreIndices(SinglePrecisionMatrix& single_precision_matrix) -> PetscErrorCode {
+  PetscBool done{ PETSC_FALSE };
+  const PetscErrorCode error_code{ MatRestoreRowIJ(single_precision_matrix.local_block, 0, PETSC_FALSE, PETSC_FALSE,
+                                                   &single_precision_matrix.n_rows,
+                                                   &single_precision_matrix.row_offsets,
+                                                   &single_precision_matrix.column_indices, &done) };
+  single_precision_matrix.row_offsets = nullptr;
+  single_precision_matrix.column_indices = nullptr;
+  return error_code;
+}
+
+auto MixedPrecisionGMRES::ShellApply(PC pc, Vec r, Vec z) -> PetscErrorCode {
+  void* context{ nullptr };
+  if (const PetscErrorCode error_code = PCShellGetContext(pc, &context); error_code != 0)
+    return error_code;
+  // Exceptions may not propagate through PETSc
+  try {
+    static_cast<MixedPrecisionGMRES*>(context)->ApplyInnerSolve(r, z);
+  } catch (...) {
+    return PETSC_ERR_LIB;
+  }
+  return 0;
+}
+
+auto MixedPrecisionGMRES::ApplyInnerSolve(Vec r, Vec z) -> void {
+  const auto& matrix = *current_matrix_ptr_;
+  const auto n_rows{ static_cast<std::size_t>(matrix.n_rows) };
+  const auto max_iterations{ static_cast<std::size_t>(inner_iterations_) };
+  inner_workspace_.Reinit(n_rows, max_iterations);
+  auto& [basis, hessenberg, cosines, sines, residual, coefficients, preconditioned, y] = inner_workspace_;
+
+  // Krylov basis of the right preconditioned system A D^{-1} y = r, with z = D^{-1} y
+  const PetscScalar* r_values{ nullptr };
+  CheckPETScError(VecGetArrayRead(r, &r_values), "get residual values");
+  std::copy(r_values, r_values + n_rows, basis[0].begin());
+  CheckPETScError(VecRestoreArrayRead(r, &r_values), "restore residual values");
+
+  std::fill(y.begin(), y.end(), 0.0f);
+  const double initial_norm{ std::sqrt(Dot(basis[0], basis[0])) };
+  if (initial_norm > 0) {
+    for (auto& value : basis[0])
+      value = static_cast<float>(value / initial_norm);
+
+    // Hessenberg matrix, stored by column, reduced to upper triangular form by Givens rotations
+    residual[0] = initial_norm;
+    std::size_t n_iterations{ 0 };
+
+    for (std::size_t j = 0; j < max_iterations; ++j) {
+      for (std::size_t i = 0; i < n_rows; ++i)
+        preconditioned[i] = matrix.inverse_diagonal[i] * basis[j][i];
+      auto& w = basis[j + 1];
+      matrix.Vmult(preconditioned.data(), w.data());
+
+      auto& column = hessenberg[j];
+      for (std::size_t i = 0; i <= j; ++i) {
+        column[i] = Dot(w, basis[i]);
+        const auto coefficient{ static_cast<float>(column[i]) };
+        for (std::size_t k = 0; k < n_rows; ++k)
+          w[k] -= coefficient * basis[i][k];
+      }
+      column[j + 1] = std::sqrt(Dot(w, w));
+      if (column[j + 1] > 0) {
+        for (auto& value : w)
+          value = static_cast<float>(value / column[j + 1]);
+      }
+
+      for (std::size_t i = 0; i < j; ++i) {
+        const double rotated{ cosines[i] * column[i] + sines[i] * column[i + 1] };
+        column[i + 1] = -sines[i] * column[i] + cosines[i] * column[i + 1];
+        column[i] = rotated;
+      }
+      const double norm{ std::hypot(column[j], column[j + 1]) };
+      cosines[j] = norm > 0 ? column[j] / norm : 1.0;
+      sines[j] = norm > 0 ? column[j + 1] / norm : 0.0;
+      column[j] = norm;
+      column[j + 1] = 0;
+      residual[j + 1] = -sines[j] * residual[j];
+      residual[j] = cosines[j] * residual[j];
+
+      n_iterations = j + 1;
+      if (norm == 0 || std::abs(residual[j + 1]) <= kInnerRelativeTolerance * initial_norm)
+        break;
+    }
+
+    // Back substitution for the basis coefficients, then y = D^{-1} V c
+    for (std::size_t i = n_iterations; i-- > 0;) {
+      double sum{ residual[i] };
+      for (std::size_t k = i + 1; k < n_iterations; ++k)
+        sum -= hessenberg[k][i] * coefficients[k];
+      coefficients[i] = hessenberg[i][i] != 0 ? sum / hessenberg[i][i] : 0.0;
+    }
+    for (std::size_t k = 0; k < n_iterations; ++k) {
+      const auto coefficient{ static_cast<float>(coefficients[k]) };
+      for (std::size_t i = 0; i < n_rows; ++i)
+        y[i] += coefficient * basis[k][i];
+    }
+    for (std::size_t i = 0; i < n_rows; ++i)
+      y[i] *= matrix.inverse_diagonal[i];
+  }
+
+  PetscScalar* z_values{ nullptr };
+  CheckPETScError(VecGetArray(z, &z_values), "get correction values");
+  std::copy(y.cbegin(), y.cend(), z_values);
+  CheckPETScError(VecRestoreArray(z, &z_values), "restore correction values");
+}
+
+auto MixedPrecisionGMRES::InnerWorkspace::Reinit(const std::size_t n_rows, const std::size_t max_iterations) -> void {
+  if (basis.size() == max_iterations + 1 && y.size() == n_rows)
+    return;
+  basis.assign(max_iterations + 1, std::vector<float>(n_rows));
+  hessenberg.assign(max_iterations, std::vector<double>(max_iterations + 1, 0.0));
+  cosines.assign(max_iterations, 0.0);
+  sines.assign(max_iterations, 0.0);
+  residual.assign(max_iterations + 1, 0.0);
+  coefficients.assign(max_iterations, 0.0);
+  preconditioned.assign(n_rows, 0.0f);
+  y.assign(n_rows, 0.0f);
+}
+
+auto MixedPrecisionGMRES::SinglePrecisionMatrix::Vmult(const float* x, float* y) const -> void {
+  for (PetscInt row = 0; row < n_rows; ++row) {
+    float sum{ 0.0f };
+    for (PetscInt entry = row_offsets[row]; entry < row_offsets[row + 1]; ++entry)
+      sum += values[entry] * x[column_indices[entry]];
+    y[row] = sum;
+  }
+}
+
+bool MixedPrecisionGMRES::is_registered_ = LinearIFactory<int, double>::get()
+    .RegisterConstructor(LinearSolverName::kMixedPrecisionGMRES,
+                         [] (int max_iterations, double convergence_tolerance) {
+                           std::unique_ptr<LinearI> return_ptr;
+                           return_ptr = std::make_unique<MixedPrecisionGMRES>(max_iterations, convergence_tolerance);
+                           return return_ptr; });
+
+} // namespace bart::solver::linear
@@ -0,0 +1,125 @@
+#ifndef BART_SRC_SOLVER_LINEAR_MIXED_PRECISION_GMRES_HPP_
+#define BART_SRC_SOLVER_LINEAR_MIXED_PRECISION_GMRES_HPP_
+
+#include <map>
+#include <vector>
+
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/petsc_matrix_base.h>
+#include <deal.II/lac/petsc_vector_base.h>
+
+#include <petscksp.h>
+
+#include "solver/linear/linear_i.hpp"
+
+namespace bart::solver::linear {
+
+/*! \brief Flexible GMRES in double precision, preconditioned by GMRES in single precision.
+ *
+ * The values of each matrix solved are stored a second time in single precision, sharing the sparsity indices of
+ * the PETSc matrix. Each outer flexible GMRES iteration applies the double precision operator once, and
+ * preconditions with up to inner_iterations iterations of right Jacobi preconditioned GMRES in single precision,
+ * stopped early when the inner residual is reduced by kInnerRelativeTolerance. The single precision iterations read
+ * half the memory of double precision iterations, and the outer iterations correct their rounding error, so
+ * solutions are converged to the same tolerances as the other solvers and are checked by the same convergence
+ * checkers.
+ *
+ * The single precision iterations only use the locally owned block of the matrix, without communication, so in
+ * parallel they act as a block Jacobi preconditioner for the outer iterations.
+ *
+ * As for direct solves, the provided preconditioner is not applied, it is only used to find the matrix to store in
+ * single precision. If it was built for a different matrix than the operator, such as a matrix shared by the
+ * operators of opposite directions, that matrix is stored once and used to precondition all of its operators.
+ * Otherwise the operator is stored, and must be an assembled sparse matrix. The single precision values are only
+ * updated if the values of the matrix change.
+ */
+class MixedPrecisionGMRES : public LinearI {
+ public:
+  /*! \brief Constructor.
+   *
+   * @param max_iterations maximum outer iterations for each solve.
+   * @param convergence_tolerance absolute tolerance on the (double precision) residual.
+   * @param inner_iterations maximum single precision iterations for each outer iteration.
+   */
+  MixedPrecisionGMRES(int max_iterations = 100, double convergence_tolerance = 1e-10,
+                      int inner_iterations = kDefaultInnerIterations);
+  MixedPrecisionGMRES(const MixedPrecisionGMRES&) = delete;
+  auto operator=(const MixedPrecisionGMRES&) -> MixedPrecisionGMRES& = delete;
+  ~MixedPrecisionGMRES();
+
+  void Solve(dealii::PETScWrappers::MatrixBase *A,
+             dealii::PETScWrappers::VectorBase *x,
+             dealii::PETScWrappers::VectorBase *b,
+             dealii::PETScWrappers::PreconditionerBase *preconditioner) override;
+  void SetRelativeTolerance(double relative_tolerance) override;
+  auto UsesPreconditioner() const -> bool override { return false; }
+  /*! \brief Returns the memory used by all single precision values and diagonals stored on this process. */
+  auto StoredMemory() const -> std::size_t override;
+
+  int max_iterations() const { return solver_control_.max_steps(); }
+  double convergence_tolerance() const { return solver_control_.tolerance(); }
+  double relative_tolerance() const { return relative_tolerance_; }
+  int inner_iterations() const { return inner_iterations_; }
+  int n_stored_matrices() const { return static_cast<int>(single_precision_matrices_.size()); }
+
+  //! Default maximum single precision iterations for each outer iteration
+  static constexpr int kDefaultInnerIterations{ 20 };
+  //! Reduction of the inner residual at which single precision iterations stop
+  static constexpr float kInnerRelativeTolerance{ 1e-4f };
+
+ private:
+  /*! Locally owned block of a matrix, with values stored in single precision. The row offsets and column indices are
+   * those of the PETSc matrix block, and are only accessed during a solve. */
+  struct SinglePrecisionMatrix {
+    Mat matrix{ nullptr };
+    Mat local_block{ nullptr };
+    PetscObjectState matrix_state{ 0 };
+    std::vector<float> values;
+    std::vector<float> inverse_diagonal;
+    const PetscInt* row_offsets{ nullptr };
+    const PetscInt* column_indices{ nullptr };
+    PetscInt n_rows{ 0 };
+
+    /*! Computes \f$y = Ax\f$ in single precision. */
+    auto Vmult(const float* x, float* y) const -> void;
+  };
+
+  /*! Vectors and Hessenberg matrix of the inner iterations, allocated once and reused by each inner solve. */
+  struct InnerWorkspace {
+    std::vector<std::vector<float>> basis;
+    std::vector<std::vector<double>> hessenberg;
+    std::vector<double> cosines, sines, residual, coefficients;
+    std::vector<float> preconditioned, y;
+
+    /*! Sizes the workspace for a matrix and number of iterations, only allocating if they have changed. */
+    auto Reinit(std::size_t n_rows, std::size_t max_iterations) -> void;
+  };
+
+  /*! Returns the single precision copy of a matrix, updating its values if they have changed, with access to the
+   * indices of the matrix until RestoreIndices is called. */
+  auto GetSinglePrecisionMatrix(Mat matrix) -> SinglePrecisionMatrix&;
+  /*! Ends access to the indices of the PETSc matrix of a single precision copy. */
+  static auto RestoreIndices(SinglePrecisionMatrix& single_precision_matrix) -> PetscErrorCode;
+  /*! Approximately solves \f$Az = r\f$ with single precision GMRES, the shell preconditioner of the outer solver. */
+  auto ApplyInnerSolve(Vec r, Vec z) -> void;
+  /*! PETSc shell preconditioner apply function, calls ApplyInnerSolve of the solver in the shell context. */
+  static auto ShellApply(PC pc, Vec r, Vec z) -> PetscErrorCode;
+
+  dealii::SolverControl solver_control_;
+  const int inner_iterations_;
+  double relative_tolerance_{ 0.0 };
+  KSP ksp_{ nullptr };
+  /*! Matrix used by the inner iterations of the current solve. */
+  SinglePrecisionMatrix* current_matrix_ptr_{ nullptr };
+  /*! Single precision copy of each matrix. Each holds a reference to its PETSc
+   * matrix, so it cannot be freed and replaced by another matrix at the same
+   * address. */
+  std::map<Mat, SinglePrecisionMatrix> single_precision_matrices_;
+  InnerWorkspace inner_workspace_;
+  static bool is_registered_;
+};
+
+} // namespace bart::solver::linear
+
+#endif //BART_SRC_SOLVER_LINEAR_MIXED_PRECISION_GMRES_HPP_
@@ -0,0 +1,84 @@
+#include "solver/linear/preconditioner.hpp"
+
+#include <string>
+
+#include <petscksp.h>
+
+namespace bart::solver::linear {
+
+namespace {
+
+using PreconditionerBase = dealii::PETScWrappers::PreconditionerBase;
+
+auto CheckPETScError(const PetscErrorCode error_code, const std::string& failed_action,
+                     const std::string& function_name = "MakePreconditioner") -> void {
+  AssertThrow(error_code == 0, dealii::ExcMessage("Error in function " + function_name + ": failed to " + failed_action))
+}
+
+/* Builds and sets up a preconditioner of a PETSc type without a deal.II wrapper. For block Jacobi preconditioners,
+ * sub_block_type sets the preconditioner used on each local block. */
+auto MakePETScPreconditioner(const dealii::PETScWrappers::MatrixBase& matrix, const PCType type,
+                             const PCType sub_block_type = nullptr) -> std::unique_ptr<PreconditionerBase> {
+  PC pc{ nullptr };
+  CheckPETScError(PCCreate(matrix.get_mpi_communicator(), &pc), "create preconditioner");
+  CheckPETScError(PCSetOperators(pc, matrix, matrix), "set preconditioner matrix");
+  CheckPETScError(PCSetType(pc, type), "set preconditioner type");
+  CheckPETScError(PCSetUp(pc), "set up preconditioner");
+
+  if (sub_block_type != nullptr) {
+    PetscInt n_local_blocks{ 0 }, first_local_block{ 0 };
+    KSP* sub_ksps{ nullptr };
+    CheckPETScError(PCBJacobiGetSubKSP(pc, &n_local_blocks, &first_local_block, &sub_ksps),
+                    "access preconditioner blocks");
+    for (PetscInt block = 0; block < n_local_blocks; ++block) {
+      PC sub_pc{ nullptr };
+      CheckPETScError(KSPGetPC(sub_ksps[block], &sub_pc), "access preconditioner block");
+      CheckPETScError(PCSetType(sub_pc, sub_block_type), "set preconditioner block type");
+    }
+  }
+  // Factorizes local blocks now instead of at the first application
+  CheckPETScError(PCSetUpOnBlocks(pc), "set up preconditioner blocks");
+
+  // The returned preconditioner holds its own reference to the PETSc object
+  auto return_ptr = std::make_unique<PreconditionerBase>(pc);
+  CheckPETScError(PCDestroy(&pc), "release preconditioner");
+  return return_ptr;
+}
+
+} // namespace
+
+auto MakePreconditioner(const problem::PreconditionerType preconditioner_type,
+                        const dealii::PETScWrappers::MatrixBase& matrix) -> std::unique_ptr<PreconditionerBase> {
+  using PreconditionerType = problem::PreconditionerType;
+  namespace PETScWrappers = dealii::PETScWrappers;
+  switch (preconditioner_type) {
+    case PreconditionerType::kNone:
+      return std::make_unique<PETScWrappers::PreconditionNone>(matrix);
+    case PreconditionerType::kJacobi:
+      return std::make_unique<PETScWrappers::PreconditionJacobi>(matrix);
+    case PreconditionerType::kBlockJacobi:
+      return std::make_unique<PETScWrappers::PreconditionBlockJacobi>(matrix);
+    case PreconditionerType::kIncompleteCholesky:
+      return MakePETScPreconditioner(matrix, PCBJACOBI, PCICC);
+    case PreconditionerType::kAlgebraicMultigrid:
+      return MakePETScPreconditioner(matrix, PCGAMG);
+    case PreconditionerType::kAdditiveSchwarz:
+      return MakePETScPreconditioner(matrix, PCASM);
+  }
+  AssertThrow(false, dealii::ExcMessage("Error in function MakePreconditioner: unsupported preconditioner type"))
+  return nullptr;
+}
+
+auto GetPreconditionerMatrix(const PreconditionerBase& preconditioner) -> Mat {
+  const PC pc{ preconditioner.get_pc() };
+  PetscBool matrix_set{ PETSC_FALSE };
+  CheckPETScError(PCGetOperatorsSet(pc, nullptr, &matrix_set), "check preconditioner matrix",
+                  "GetPreconditionerMatrix");
+  if (!matrix_set)
+    return nullptr;
+  Mat matrix{ nullptr };
+  CheckPETScError(PCGetOperators(pc, nullptr, &matrix), "get preconditioner matrix", "GetPreconditionerMatrix");
+  return matrix;
+}
+
+} // namespace bart::solver::linear
@@ -0,0 +1,43 @@
+#ifndef BART_SRC_SOLVER_LINEAR_PRECONDITIONER_HPP_
+#define BART_SRC_SOLVER_LINEAR_PRECONDITIONER_HPP_
+
+#include <memory>
+
+#include <deal.II/lac/petsc_matrix_base.h>
+#include <deal.II/lac/petsc_precondition.h>
+
+#include "problem/parameter_types.hpp"
+
+namespace bart::solver::linear {
+
+/*! \brief Builds a preconditioner for a matrix.
+ *
+ * The preconditioner is fully set up on return (including any factorizations or multigrid hierarchies), so it can be
+ * stored and reused for every solve with the same matrix. PETSc only sets a preconditioner up again if the matrix
+ * values have changed.
+ *
+ * Incomplete factorizations are applied to the locally owned block of each process: block Jacobi uses ILU(0) and
+ * incomplete Cholesky uses ICC(0) on each block, and additive Schwarz uses ILU(0) on overlapping blocks. In serial
+ * these are the full incomplete factorizations.
+ *
+ * @param preconditioner_type type of preconditioner to build.
+ * @param matrix matrix to build the preconditioner for, must remain valid for the life of the preconditioner.
+ * @return preconditioner.
+ */
+[[nodiscard]] auto MakePreconditioner(problem::PreconditionerType preconditioner_type,
+                                      const dealii::PETScWrappers::MatrixBase& matrix)
+-> std::unique_ptr<dealii::PETScWrappers::PreconditionerBase>;
+
+/*! \brief Returns the matrix a preconditioner was built for.
+ *
+ * Solvers pass this matrix to PETSc with their operator, so a preconditioner built for a different matrix than the
+ * operator, such as one shared by several operators, is not set up again for each operator.
+ *
+ * @param preconditioner preconditioner to get the matrix of.
+ * @return PETSc matrix, or nullptr if the preconditioner has no matrix set.
+ */
+[[nodiscard]] auto GetPreconditionerMatrix(const dealii::PETScWrappers::PreconditionerBase& preconditioner) -> Mat;
+
+} // namespace bart::solver::linear
+
+#endif //BART_SRC_SOLVER_LINEAR_PRECONDITIONER_HPP_
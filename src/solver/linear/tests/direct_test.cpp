@@ -0,0 +1,147 @@
+#include "solver/linear/direct.hpp"
+
+#include <deal.II/lac/petsc_full_matrix.h>
+#include <deal.II/lac/petsc_vector.h>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+namespace solver = bart::solver;
+
+class SolverLinearDirectTest : public ::testing::Test {
+ protected:
+  using FullMatrix = dealii::PETScWrappers::FullMatrix;
+  using Vector = dealii::PETScWrappers::MPI::Vector;
+  using Direct = solver::linear::Direct;
+
+  // Returns a 3x3 PETSc matrix with the given values
+  static auto MakeMatrix(const std::vector<std::vector<double>>& values) -> std::unique_ptr<FullMatrix>;
+  // Returns a PETSc vector of length 3 with the given values
+  static auto MakeVector(const std::vector<double>& values) -> Vector;
+  // Solves Ax = b with the given factorization and checks the result
+  auto SolveAndCheck(Direct::Factorization factorization, const std::vector<std::vector<double>>& A,
+                     const std::vector<double>& x, const std::vector<double>& b) -> void;
+};
+
+auto SolverLinearDirectTest::MakeMatrix(const std::vector<std::vector<double>>& values)
+-> std::unique_ptr<FullMatrix> {
+  auto matrix_ptr = std::make_unique<FullMatrix>(3, 3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      matrix_ptr->set(i, j, values[i][j]);
+    }
+  }
+  matrix_ptr->compress(dealii::VectorOperation::insert);
+  return matrix_ptr;
+}
+
+auto SolverLinearDirectTest::MakeVector(const std::vector<double>& values) -> Vector {
+  std::vector<unsigned int> indices{0,1,2};
+  Vector petsc_vector(MPI_COMM_WORLD, 3, 3);
+  petsc_vector.set(indices, values);
+  petsc_vector.compress(dealii::VectorOperation::insert);
+  return petsc_vector;
+}
+
+auto SolverLinearDirectTest::SolveAndCheck(const Direct::Factorization factorization,
+                                           const std::vector<std::vector<double>>& A,
+                                           const std::vector<double>& x,
+                                           const std::vector<double>& b) -> void {
+  std::vector<unsigned int> indices{0,1,2};
+  std::vector<double> zeroes(3,0);
+
+  Vector petsc_b(MPI_COMM_WORLD, 3, 3);
+  petsc_b.set(indices, b);
+  petsc_b.compress(dealii::VectorOperation::insert);
+  Vector petsc_x(MPI_COMM_WORLD, 3, 3);
+  petsc_x.set(indices, zeroes);
+  petsc_x.compress(dealii::VectorOperation::insert);
+  FullMatrix petsc_A(3,3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      petsc_A.set(i, j, A[i][j]);
+    }
+  }
+  petsc_A.compress(dealii::VectorOperation::insert);
+
+  // The preconditioner is not used by direct solves
+  Direct solver(factorization);
+  EXPECT_EQ(solver.factorization(), factorization);
+  EXPECT_NO_THROW(solver.Solve(&petsc_A, &petsc_x, &petsc_b, nullptr));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(petsc_x[i], x[i], 1e-10);
+  }
+
+  EXPECT_EQ(solver.n_stored_factorizations(), 1);
+  const auto stored_memory{ solver.StoredMemory() };
+  EXPECT_GT(stored_memory, 0);
+
+  // A second solve reuses the factorization
+  petsc_x.set(indices, zeroes);
+  petsc_x.compress(dealii::VectorOperation::insert);
+  EXPECT_NO_THROW(solver.Solve(&petsc_A, &petsc_x, &petsc_b, nullptr));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(petsc_x[i], x[i], 1e-10);
+  }
+  EXPECT_EQ(solver.n_stored_factorizations(), 1);
+  EXPECT_EQ(solver.StoredMemory(), stored_memory);
+
+  // A different matrix gets its own stored factorization
+  FullMatrix scaled_A(3,3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      scaled_A.set(i, j, 2 * A[i][j]);
+    }
+  }
+  scaled_A.compress(dealii::VectorOperation::insert);
+  EXPECT_NO_THROW(solver.Solve(&scaled_A, &petsc_x, &petsc_b, nullptr));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(petsc_x[i], x[i] / 2, 1e-10);
+  }
+  EXPECT_EQ(solver.n_stored_factorizations(), 2);
+  EXPECT_GT(solver.StoredMemory(), stored_memory);
+}
+
+TEST_F(SolverLinearDirectTest, ConstructorDefaultValues) {
+  Direct solver;
+  EXPECT_EQ(solver.factorization(), Direct::Factorization::kLU);
+  EXPECT_FALSE(solver.UsesPreconditioner());
+  EXPECT_EQ(solver.n_stored_factorizations(), 0);
+  EXPECT_EQ(solver.StoredMemory(), 0);
+}
+
+TEST_F(SolverLinearDirectTest, SolveLU) {
+  SolveAndCheck(Direct::Factorization::kLU, {{1, 3, -2}, {3, 5, 6}, {2, 4, 3}}, {-15, 8, 2}, {5, 7, 8});
+}
+
+TEST_F(SolverLinearDirectTest, SolveCholesky) {
+  SolveAndCheck(Direct::Factorization::kCholesky, {{4, 1, 0}, {1, 3, 1}, {0, 1, 2}}, {1, 2, 3}, {6, 10, 8});
+}
+
+/* Operators that differ from the matrix their preconditioner was built for
+ * should be solved using the factorization of the preconditioner matrix, which
+ * is shared by both operators. */
+TEST_F(SolverLinearDirectTest, SolveWithSharedPreconditionerMatrix) {
+  auto preconditioner_matrix_ptr = MakeMatrix({{4, 1, 0}, {1, 3, 1}, {0, 1, 2}});
+  auto plus_operator_ptr = MakeMatrix({{4.5, 1, 0}, {1, 3, 1}, {0, 1, 1.5}});
+  auto minus_operator_ptr = MakeMatrix({{3.5, 1, 0}, {1, 3, 1}, {0, 1, 2.5}});
+  dealii::PETScWrappers::PreconditionNone preconditioner(*preconditioner_matrix_ptr);
+  const std::vector<double> expected_solution{1, 2, 3};
+
+  Direct solver;
+  for (const auto& [operator_ptr, right_hand_side] :
+      {std::pair{plus_operator_ptr.get(), std::vector<double>{6.5, 10, 6.5}},
+       std::pair{minus_operator_ptr.get(), std::vector<double>{5.5, 10, 9.5}}}) {
+    auto petsc_b = MakeVector(right_hand_side);
+    auto petsc_x = MakeVector({0, 0, 0});
+    EXPECT_NO_THROW(solver.Solve(operator_ptr, &petsc_x, &petsc_b, &preconditioner));
+    for (int i = 0; i < 3; ++i) {
+      EXPECT_NEAR(petsc_x[i], expected_solution[i], 1e-8);
+    }
+    EXPECT_EQ(solver.n_stored_factorizations(), 1);
+  }
+  EXPECT_GT(solver.StoredMemory(), 0);
+}
+
+} // namespace
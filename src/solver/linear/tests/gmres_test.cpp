@@ -75,5 +75,50 @@ TEST_F(SolverLinearGMRESTest, SolveTestNoPrecon) {
   }
 }
 
-} // namespace
+TEST_F(SolverLinearGMRESTest, SetRelativeTolerance) {
+  GMRES_Solver solver;
+  EXPECT_EQ(solver.relative_tolerance(), 0);
+  const double relative_tolerance{ test_helpers::RandomDouble(1e-3, 0.5) };
+  solver.SetRelativeTolerance(relative_tolerance);
+  EXPECT_EQ(solver.relative_tolerance(), relative_tolerance);
+  EXPECT_EQ(solver.convergence_tolerance(), default_tolerance_);
+  for (const double bad_tolerance : {-0.1, 1.0})
+    EXPECT_ANY_THROW(solver.SetRelativeTolerance(bad_tolerance));
+}
 
+// The provided solution should be used as the initial guess
+TEST_F(SolverLinearGMRESTest, SolveWarmStarted) {
+  std::vector<double> b{5,7,8};
+  std::vector<double> x{-15, 8, 2};
+  std::vector<std::vector<double>> A = {{1, 3, -2}, {3, 5, 6}, {2, 4, 3}};
+  std::vector<unsigned int> indices{0,1,2};
+  std::vector<double> zeroes(3,0);
+
+  Vector petsc_b(MPI_COMM_WORLD, 3, 3);
+  petsc_b.set(indices, b);
+  petsc_b.compress(dealii::VectorOperation::insert);
+  FullMatrix petsc_A(3,3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      petsc_A.set(i, j, A[i][j]);
+    }
+  }
+  petsc_A.compress(dealii::VectorOperation::insert);
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+
+  // A single iteration is not enough to converge from zero, but the exact solution needs none
+  GMRES_Solver solver(1, 1e-6);
+  Vector petsc_x(MPI_COMM_WORLD, 3, 3);
+  petsc_x.set(indices, zeroes);
+  petsc_x.compress(dealii::VectorOperation::insert);
+  EXPECT_ANY_THROW(solver.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner));
+
+  petsc_x.set(indices, x);
+  petsc_x.compress(dealii::VectorOperation::insert);
+  EXPECT_NO_THROW(solver.Solve(&petsc_A, &petsc_x, &petsc_b, &no_conditioner));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(petsc_x[i], x[i], 1e-6);
+  }
+}
+
+} // namespace
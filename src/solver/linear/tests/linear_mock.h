@@ -10,6 +10,8 @@ class LinearMock : public LinearI {
  public:
   MOCK_METHOD(void, Solve, (dealii::PETScWrappers::MatrixBase *, dealii::PETScWrappers::VectorBase *,
       dealii::PETScWrappers::VectorBase *, dealii::PETScWrappers::PreconditionerBase *), (override));
+  MOCK_METHOD(void, SetRelativeTolerance, (double), (override));
+  MOCK_METHOD(std::size_t, StoredMemory, (), (const, override));
 };
 
 } // bart::solver::linear
@@ -1,6 +1,10 @@
 #include "solver/linear/factory.hpp"
 
+#include "solver/linear/bicgstab.hpp"
+#include "solver/linear/conjugate_gradient.hpp"
+#include "solver/linear/direct.hpp"
 #include "solver/linear/gmres.h"
+#include "solver/linear/mixed_precision_gmres.hpp"
 #include "test_helpers/gmock_wrapper.h"
 #include "test_helpers/test_helper_functions.h"
 
@@ -23,4 +27,43 @@ TEST(SolverFactoryTest, GMRES) {
   EXPECT_EQ(dynamic_ptr->convergence_tolerance(), tolerance);
 }
 
+TEST(SolverFactoryTest, KrylovSolvers) {
+  using SolverName = solver::linear::LinearSolverName;
+  const int max_iterations{test_helpers::RandomInt(200, 1000)};
+  const double tolerance{test_helpers::RandomDouble(1e-16, 1e-10)};
+  auto& factory = solver::linear::LinearIFactory<int, double>::get();
+
+  auto cg_ptr = factory.GetConstructor(SolverName::kConjugateGradient)(max_iterations, tolerance);
+  auto cg_dynamic_ptr = dynamic_cast<solver::linear::ConjugateGradient*>(cg_ptr.get());
+  ASSERT_NE(cg_dynamic_ptr, nullptr);
+  EXPECT_EQ(cg_dynamic_ptr->max_iterations(), max_iterations);
+  EXPECT_EQ(cg_dynamic_ptr->convergence_tolerance(), tolerance);
+
+  auto bicgstab_ptr = factory.GetConstructor(SolverName::kBiCGStab)(max_iterations, tolerance);
+  auto bicgstab_dynamic_ptr = dynamic_cast<solver::linear::BiCGStab*>(bicgstab_ptr.get());
+  ASSERT_NE(bicgstab_dynamic_ptr, nullptr);
+  EXPECT_EQ(bicgstab_dynamic_ptr->max_iterations(), max_iterations);
+  EXPECT_EQ(bicgstab_dynamic_ptr->convergence_tolerance(), tolerance);
+
+  auto mixed_ptr = factory.GetConstructor(SolverName::kMixedPrecisionGMRES)(max_iterations, tolerance);
+  auto mixed_dynamic_ptr = dynamic_cast<solver::linear::MixedPrecisionGMRES*>(mixed_ptr.get());
+  ASSERT_NE(mixed_dynamic_ptr, nullptr);
+  EXPECT_EQ(mixed_dynamic_ptr->max_iterations(), max_iterations);
+  EXPECT_EQ(mixed_dynamic_ptr->convergence_tolerance(), tolerance);
+}
+
+TEST(SolverFactoryTest, Direct) {
+  using SolverName = solver::linear::LinearSolverName;
+  using Direct = solver::linear::Direct;
+  auto lu_ptr = solver::linear::LinearIFactory<>::get().GetConstructor(SolverName::kDirectLU)();
+  auto lu_dynamic_ptr = dynamic_cast<Direct*>(lu_ptr.get());
+  ASSERT_NE(lu_dynamic_ptr, nullptr);
+  EXPECT_EQ(lu_dynamic_ptr->factorization(), Direct::Factorization::kLU);
+
+  auto cholesky_ptr = solver::linear::LinearIFactory<>::get().GetConstructor(SolverName::kDirectCholesky)();
+  auto cholesky_dynamic_ptr = dynamic_cast<Direct*>(cholesky_ptr.get());
+  ASSERT_NE(cholesky_dynamic_ptr, nullptr);
+  EXPECT_EQ(cholesky_dynamic_ptr->factorization(), Direct::Factorization::kCholesky);
+}
+
 } // namespace
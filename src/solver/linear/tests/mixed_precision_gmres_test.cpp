@@ -0,0 +1,189 @@
+#include "solver/linear/mixed_precision_gmres.hpp"
+
+#include <deal.II/lac/petsc_full_matrix.h>
+#include <deal.II/lac/petsc_precondition.h>
+#include <deal.II/lac/petsc_sparse_matrix.h>
+#include <deal.II/lac/petsc_vector.h>
+
+#include "solver/linear/gmres.h"
+#include "solver/linear/preconditioner.hpp"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_helper_functions.h"
+
+namespace  {
+
+namespace solver = bart::solver;
+namespace test_helpers = bart::test_helpers;
+
+class SolverLinearMixedPrecisionGMRESTest : public ::testing::Test {
+ protected:
+  using SparseMatrix = dealii::PETScWrappers::SparseMatrix;
+  using Vector = dealii::PETScWrappers::MPI::Vector;
+  using MixedPrecisionGMRES = solver::linear::MixedPrecisionGMRES;
+
+  const std::vector<std::vector<double>> A_{{1, 3, -2}, {3, 5, 6}, {2, 4, 3}};
+  const std::vector<double> x_{-15, 8, 2};
+  const std::vector<double> b_{5, 7, 8};
+
+  // Fills a 3x3 PETSc matrix with the values of A_ multiplied by factor
+  template <typename MatrixType>
+  auto FillMatrix(MatrixType& matrix, double factor) const -> void;
+  // Returns a PETSc vector of length 3 with the given values
+  static auto MakeVector(const std::vector<double>& values) -> Vector;
+  // Checks that a PETSc vector has the given values
+  static auto ExpectValues(const Vector& vector, const std::vector<double>& values) -> void;
+};
+
+template <typename MatrixType>
+auto SolverLinearMixedPrecisionGMRESTest::FillMatrix(MatrixType& matrix, const double factor) const -> void {
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      matrix.set(i, j, factor * A_[i][j]);
+    }
+  }
+  matrix.compress(dealii::VectorOperation::insert);
+}
+
+auto SolverLinearMixedPrecisionGMRESTest::MakeVector(const std::vector<double>& values) -> Vector {
+  std::vector<unsigned int> indices{0,1,2};
+  Vector petsc_vector(MPI_COMM_WORLD, 3, 3);
+  petsc_vector.set(indices, values);
+  petsc_vector.compress(dealii::VectorOperation::insert);
+  return petsc_vector;
+}
+
+auto SolverLinearMixedPrecisionGMRESTest::ExpectValues(const Vector& vector, const std::vector<double>& values)
+-> void {
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_NEAR(vector[i], values[i], 1e-8);
+  }
+}
+
+TEST_F(SolverLinearMixedPrecisionGMRESTest, ConstructorDefaultValues) {
+  MixedPrecisionGMRES solver;
+  EXPECT_EQ(solver.max_iterations(), 100);
+  EXPECT_EQ(solver.convergence_tolerance(), 1e-10);
+  EXPECT_EQ(solver.relative_tolerance(), 0);
+  EXPECT_EQ(solver.inner_iterations(), MixedPrecisionGMRES::kDefaultInnerIterations);
+  EXPECT_FALSE(solver.UsesPreconditioner());
+  EXPECT_EQ(solver.n_stored_matrices(), 0);
+  EXPECT_EQ(solver.StoredMemory(), 0);
+}
+
+TEST_F(SolverLinearMixedPrecisionGMRESTest, ConstructorValues) {
+  const int max_iterations{ test_helpers::RandomInt(200, 1000) };
+  const double tolerance{ test_helpers::RandomDouble(1e-16, 1e-10) };
+  const int inner_iterations{ test_helpers::RandomInt(1, 50) };
+  MixedPrecisionGMRES solver(max_iterations, tolerance, inner_iterations);
+  EXPECT_EQ(solver.max_iterations(), max_iterations);
+  EXPECT_EQ(solver.convergence_tolerance(), tolerance);
+  EXPECT_EQ(solver.inner_iterations(), inner_iterations);
+  EXPECT_ANY_THROW(MixedPrecisionGMRES(max_iterations, tolerance, 0));
+}
+
+TEST_F(SolverLinearMixedPrecisionGMRESTest, SetRelativeTolerance) {
+  MixedPrecisionGMRES solver;
+  solver.SetRelativeTolerance(1e-3);
+  EXPECT_EQ(solver.relative_tolerance(), 1e-3);
+  EXPECT_ANY_THROW(solver.SetRelativeTolerance(-1e-3));
+  EXPECT_ANY_THROW(solver.SetRelativeTolerance(1));
+}
+
+TEST_F(SolverLinearMixedPrecisionGMRESTest, Solve) {
+  SparseMatrix petsc_A(3, 3, 3);
+  FillMatrix(petsc_A, 1);
+  auto petsc_b = MakeVector(b_);
+  auto petsc_x = MakeVector({0, 0, 0});
+
+  // The single precision inner iterations are corrected to the double precision tolerance
+  MixedPrecisionGMRES solver(100, 1e-12);
+  EXPECT_NO_THROW(solver.Solve(&petsc_A, &petsc_x, &petsc_b, nullptr));
+  ExpectValues(petsc_x, x_);
+  EXPECT_EQ(solver.n_stored_matrices(), 1);
+  const auto stored_memory{ solver.StoredMemory() };
+  EXPECT_EQ(stored_memory, sizeof(float) * (9 + 3));
+
+  // Changed values are stored again in single precision
+  FillMatrix(petsc_A, 2);
+  petsc_x = MakeVector({0, 0, 0});
+  EXPECT_NO_THROW(solver.Solve(&petsc_A, &petsc_x, &petsc_b, nullptr));
+  ExpectValues(petsc_x, {x_[0] / 2, x_[1] / 2, x_[2] / 2});
+  EXPECT_EQ(solver.n_stored_matrices(), 1);
+  EXPECT_EQ(solver.StoredMemory(), stored_memory);
+
+  // A different matrix gets its own single precision copy
+  SparseMatrix other_A(3, 3, 3);
+  FillMatrix(other_A, 1);
+  petsc_x = MakeVector({0, 0, 0});
+  EXPECT_NO_THROW(solver.Solve(&other_A, &petsc_x, &petsc_b, nullptr));
+  ExpectValues(petsc_x, x_);
+  EXPECT_EQ(solver.n_stored_matrices(), 2);
+  EXPECT_EQ(solver.StoredMemory(), 2 * stored_memory);
+}
+
+TEST_F(SolverLinearMixedPrecisionGMRESTest, SolveWithPreconditionerMatrix) {
+  using bart::problem::PreconditionerType;
+  // The operator is dense, only the matrix the preconditioner was built for is stored in single precision
+  dealii::PETScWrappers::FullMatrix petsc_A(3, 3);
+  FillMatrix(petsc_A, 1);
+  SparseMatrix preconditioner_A(3, 3, 3);
+  FillMatrix(preconditioner_A, 1);
+  auto preconditioner_ptr = solver::linear::MakePreconditioner(PreconditionerType::kJacobi, preconditioner_A);
+  auto petsc_b = MakeVector(b_);
+  auto petsc_x = MakeVector({0, 0, 0});
+
+  MixedPrecisionGMRES solver(100, 1e-12);
+  EXPECT_ANY_THROW(solver.Solve(&petsc_A, &petsc_x, &petsc_b, nullptr));
+  EXPECT_NO_THROW(solver.Solve(&petsc_A, &petsc_x, &petsc_b, preconditioner_ptr.get()));
+  ExpectValues(petsc_x, x_);
+  EXPECT_EQ(solver.n_stored_matrices(), 1);
+
+  // Operators sharing the preconditioner matrix share its single precision copy
+  SparseMatrix other_A(3, 3, 3);
+  FillMatrix(other_A, 1);
+  petsc_x = MakeVector({0, 0, 0});
+  EXPECT_NO_THROW(solver.Solve(&other_A, &petsc_x, &petsc_b, preconditioner_ptr.get()));
+  ExpectValues(petsc_x, x_);
+  EXPECT_EQ(solver.n_stored_matrices(), 1);
+}
+
+/* Solutions should match those of GMRES on the same system to within the convergence tolerance, including when the
+ * inner iterations are reused for a system of a different size. */
+TEST_F(SolverLinearMixedPrecisionGMRESTest, SolveMatchesGMRES) {
+  const int size{ 50 };
+  const double tolerance{ 1e-10 };
+  SparseMatrix petsc_A(size, size, 3);
+  for (int i = 0; i < size; ++i) {
+    petsc_A.set(i, i, test_helpers::RandomDouble(4, 8));
+    if (i > 0)
+      petsc_A.set(i, i - 1, test_helpers::RandomDouble(-1, 1));
+    if (i < size - 1)
+      petsc_A.set(i, i + 1, test_helpers::RandomDouble(-1, 1));
+  }
+  petsc_A.compress(dealii::VectorOperation::insert);
+  Vector petsc_b(MPI_COMM_WORLD, size, size), petsc_x(MPI_COMM_WORLD, size, size),
+      expected_x(MPI_COMM_WORLD, size, size);
+  for (int i = 0; i < size; ++i)
+    petsc_b[i] = test_helpers::RandomDouble(-10, 10);
+  petsc_b.compress(dealii::VectorOperation::insert);
+  petsc_x = 0;
+  expected_x = 0;
+
+  dealii::PETScWrappers::PreconditionNone no_conditioner(petsc_A);
+  solver::linear::GMRES gmres(100, tolerance);
+  gmres.Solve(&petsc_A, &expected_x, &petsc_b, &no_conditioner);
+
+  MixedPrecisionGMRES solver(100, tolerance, 5);
+  EXPECT_NO_THROW(solver.Solve(&petsc_A, &petsc_x, &petsc_b, nullptr));
+  for (int i = 0; i < size; ++i)
+    EXPECT_NEAR(petsc_x[i], expected_x[i], 1e-8);
+
+  SparseMatrix small_A(3, 3, 3);
+  FillMatrix(small_A, 1.0);
+  auto small_b = MakeVector(b_);
+  auto small_x = MakeVector({0, 0, 0});
+  EXPECT_NO_THROW(solver.Solve(&small_A, &small_x, &small_b, nullptr));
+  ExpectValues(small_x, x_);
+}
+
+} // namespace
@@ -0,0 +1,60 @@
+#include "solver/linear/preconditioner.hpp"
+
+#include "system/system_types.h"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_assertions.hpp"
+
+namespace  {
+
+using namespace bart;
+
+using PreconditionerType = problem::PreconditionerType;
+
+/* Preconditioners are built for a diagonal matrix with 2.0 on the diagonal. All preconditioners except the algebraic
+ * multigrid are exact inverses of a diagonal matrix. */
+class SolverLinearPreconditionerTest : public ::testing::TestWithParam<PreconditionerType>,
+                                       public bart::testing::DealiiTestDomain<2> {
+ public:
+  system::MPISparseMatrix& matrix_ = matrix_1;
+  system::MPIVector& source_ = vector_1;
+  system::MPIVector& result_ = vector_2;
+  system::MPIVector& expected_result_ = vector_3;
+
+  void SetUp() override;
+};
+
+void SolverLinearPreconditionerTest::SetUp() {
+  SetUpDealii();
+  for (const auto index : locally_owned_dofs_)
+    matrix_.set(index, index, 2.0);
+  matrix_.compress(dealii::VectorOperation::insert);
+  source_ = 1.0;
+  expected_result_ = 0.5;
+}
+
+TEST_P(SolverLinearPreconditionerTest, MakePreconditionerMPI) {
+  const auto preconditioner_type = GetParam();
+  std::unique_ptr<dealii::PETScWrappers::PreconditionerBase> preconditioner_ptr;
+  EXPECT_NO_THROW({ preconditioner_ptr = solver::linear::MakePreconditioner(preconditioner_type, matrix_); });
+  ASSERT_NE(preconditioner_ptr, nullptr);
+  const Mat& matrix = matrix_;
+  EXPECT_EQ(solver::linear::GetPreconditionerMatrix(*preconditioner_ptr), matrix);
+
+  EXPECT_NO_THROW(preconditioner_ptr->vmult(result_, source_));
+  if (preconditioner_type == PreconditionerType::kNone) {
+    EXPECT_TRUE(test_helpers::AreEqual(source_, result_));
+  } else if (preconditioner_type != PreconditionerType::kAlgebraicMultigrid) {
+    EXPECT_TRUE(test_helpers::AreEqual(expected_result_, result_));
+  } else {
+    EXPECT_GT(result_.l2_norm(), 0);
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllPreconditioners, SolverLinearPreconditionerTest,
+                         ::testing::Values(PreconditionerType::kNone, PreconditionerType::kJacobi,
+                                           PreconditionerType::kBlockJacobi, PreconditionerType::kIncompleteCholesky,
+                                           PreconditionerType::kAlgebraicMultigrid,
+                                           PreconditionerType::kAdditiveSchwarz));
+
+} // namespace
@@ -0,0 +1,159 @@
+#include "system/shared_sparsity_matrix_store.hpp"
+
+#include <algorithm>
+#include <string>
+
+#include <petscmat.h>
+
+namespace bart::system {
+
+namespace {
+
+auto CheckPETScError(const PetscErrorCode error_code, const std::string& failed_action,
+                     const std::string& function_name) -> void {
+  AssertThrow(error_code == 0, dealii::ExcMessage("Error in " + function_name + ": failed to " + failed_action))
+}
+
+/* Copies the compressed sparse row structure of a sequential AIJ block into the given offsets and indices. If a column
+ * map is provided, the (compacted) block column indices are mapped to global indices. */
+auto CopyBlockIndices(Mat block, const PetscInt* column_map,
+                      std::vector<PetscInt>& row_offsets, std::vector<PetscInt>& column_indices) -> void {
+  const std::string function_name{ "constructor of SharedSparsityMatrixStore" };
+  PetscInt n_rows{ 0 };
+  const PetscInt* block_row_offsets{ nullptr };
+  const PetscInt* block_column_indices{ nullptr };
+  PetscBool done{ PETSC_FALSE };
+  CheckPETScError(MatGetRowIJ(block, 0, PETSC_FALSE, PETSC_FALSE, &n_rows, &block_row_offsets, &block_column_indices,
+                              &done), "get block row structure", function_name);
+  AssertThrow(done == PETSC_TRUE, dealii::ExcMessage("Error in " + function_name + ": matrix does not provide its "
+                                                     "row structure"))
+  row_offsets.assign(block_row_offsets, block_row_offsets + n_rows + 1);
+  column_indices.assign(block_column_indices, block_column_indices + block_row_offsets[n_rows]);
+  if (column_map != nullptr) {
+    std::transform(column_indices.cbegin(), column_indices.cend(), column_indices.begin(),
+                   [column_map](const PetscInt local_column) { return column_map[local_column]; });
+  }
+  CheckPETScError(MatRestoreRowIJ(block, 0, PETSC_FALSE, PETSC_FALSE, &n_rows, &block_row_offsets,
+                                  &block_column_indices, &done), "restore block row structure", function_name);
+}
+
+} // namespace
+
+auto SparsityIndices::memory_consumption() const -> std::size_t {
+  return sizeof(PetscInt) * (row_offsets.size() + column_indices.size() + off_diagonal_row_offsets.size()
+      + off_diagonal_column_indices.size());
+}
+
+// SHARED SPARSITY MATRIX ==============================================================================================
+
+SharedSparsityMatrix::SharedSparsityMatrix(std::shared_ptr<const SparsityIndices> shared_indices_ptr,
+                                           MPI_Comm communicator)
+    : SharedSparsityMatrixStorage{std::move(shared_indices_ptr)} {
+  const std::string function_name{ "constructor of SharedSparsityMatrix" };
+  AssertThrow(indices_ptr != nullptr, dealii::ExcMessage("Error in " + function_name + ": indices pointer is null"))
+  const auto& shared_indices = *indices_ptr;
+  values.assign(shared_indices.column_indices.size(), 0.0);
+  off_diagonal_values.assign(shared_indices.off_diagonal_column_indices.size(), 0.0);
+  off_diagonal_row_offsets = shared_indices.off_diagonal_row_offsets;
+  off_diagonal_column_indices = shared_indices.off_diagonal_column_indices;
+
+  // PETSc does not modify the diagonal block indices, they are shared read-only by all matrices
+  Mat shared_matrix{ nullptr };
+  CheckPETScError(MatCreateMPIAIJWithSplitArrays(
+      communicator, shared_indices.local_rows, shared_indices.local_columns, shared_indices.global_rows,
+      shared_indices.global_columns, const_cast<PetscInt*>(shared_indices.row_offsets.data()),
+      const_cast<PetscInt*>(shared_indices.column_indices.data()),
+      values.data(), off_diagonal_row_offsets.data(), off_diagonal_column_indices.data(), off_diagonal_values.data(),
+      &shared_matrix), "create matrix on shared indices", function_name);
+  CheckPETScError(MatSetOption(shared_matrix, MAT_NEW_NONZERO_LOCATION_ERR, PETSC_TRUE),
+                  "disallow new nonzero locations", function_name);
+  // The wrapper takes its own reference to the matrix
+  dealii::PETScWrappers::MatrixBase::reinit(shared_matrix);
+  CheckPETScError(MatDestroy(&shared_matrix), "release matrix reference", function_name);
+}
+
+auto SharedSparsityMatrix::UsesSharedStorage() const -> bool {
+  const std::string function_name{ "SharedSparsityMatrix function UsesSharedStorage" };
+  Mat diagonal_block{ nullptr };
+  CheckPETScError(MatMPIAIJGetSeqAIJ(*this, &diagonal_block, nullptr, nullptr), "get diagonal block", function_name);
+  PetscInt n_rows{ 0 };
+  const PetscInt* row_offsets{ nullptr };
+  const PetscInt* column_indices{ nullptr };
+  PetscBool done{ PETSC_FALSE };
+  CheckPETScError(MatGetRowIJ(diagonal_block, 0, PETSC_FALSE, PETSC_FALSE, &n_rows, &row_offsets, &column_indices,
+                              &done), "get row structure", function_name);
+  const bool uses_shared_indices{ done == PETSC_TRUE && row_offsets == indices_ptr->row_offsets.data()
+                                      && column_indices == indices_ptr->column_indices.data() };
+  CheckPETScError(MatRestoreRowIJ(diagonal_block, 0, PETSC_FALSE, PETSC_FALSE, &n_rows, &row_offsets, &column_indices,
+                                  &done), "restore row structure", function_name);
+  const PetscScalar* block_values{ nullptr };
+  CheckPETScError(MatSeqAIJGetArrayRead(diagonal_block, &block_values), "get values", function_name);
+  const bool uses_owned_values{ block_values == values.data() };
+  CheckPETScError(MatSeqAIJRestoreArrayRead(diagonal_block, &block_values), "restore values", function_name);
+  return uses_shared_indices && uses_owned_values;
+}
+
+auto SharedSparsityMatrix::MakeMatrixSharingIndices() const -> std::shared_ptr<SharedSparsityMatrix> {
+  return std::make_shared<SharedSparsityMatrix>(indices_ptr, get_mpi_communicator());
+}
+
+auto SharedSparsityMatrix::owned_memory_consumption() const -> std::size_t {
+  return sizeof(PetscScalar) * (values.size() + off_diagonal_values.size())
+      + sizeof(PetscInt) * (off_diagonal_row_offsets.size() + off_diagonal_column_indices.size());
+}
+
+// SHARED SPARSITY MATRIX STORE ========================================================================================
+
+SharedSparsityMatrixStore::SharedSparsityMatrixStore(const MPISparseMatrix& sparsity_template)
+    : communicator_(sparsity_template.get_mpi_communicator()) {
+  const std::string function_name{ "constructor of SharedSparsityMatrixStore" };
+  Mat template_matrix{ sparsity_template };
+  auto indices_ptr = std::make_shared<SparsityIndices>();
+  auto& indices = *indices_ptr;
+  CheckPETScError(MatGetLocalSize(template_matrix, &indices.local_rows, &indices.local_columns),
+                  "get local size", function_name);
+  CheckPETScError(MatGetSize(template_matrix, &indices.global_rows, &indices.global_columns),
+                  "get global size", function_name);
+
+  PetscBool is_mpi_aij{ PETSC_FALSE };
+  CheckPETScError(PetscObjectTypeCompare(reinterpret_cast<PetscObject>(template_matrix), MATMPIAIJ, &is_mpi_aij),
+                  "get matrix type", function_name);
+  if (is_mpi_aij == PETSC_TRUE) {
+    Mat diagonal_block{ nullptr }, off_diagonal_block{ nullptr };
+    const PetscInt* column_map{ nullptr };
+    CheckPETScError(MatMPIAIJGetSeqAIJ(template_matrix, &diagonal_block, &off_diagonal_block, &column_map),
+                    "get matrix blocks", function_name);
+    CopyBlockIndices(diagonal_block, nullptr, indices.row_offsets, indices.column_indices);
+    CopyBlockIndices(off_diagonal_block, column_map, indices.off_diagonal_row_offsets,
+                     indices.off_diagonal_column_indices);
+  } else {
+    // A sequential matrix is all diagonal block
+    CopyBlockIndices(template_matrix, nullptr, indices.row_offsets, indices.column_indices);
+    indices.off_diagonal_row_offsets.assign(indices.local_rows + 1, 0);
+  }
+  indices_ptr_ = std::move(indices_ptr);
+}
+
+auto SharedSparsityMatrixStore::MakeMatrix() const -> std::shared_ptr<SharedSparsityMatrix> {
+  return std::make_shared<SharedSparsityMatrix>(indices_ptr_, communicator_);
+}
+
+// FREE FUNCTIONS ======================================================================================================
+
+auto MakeMatrixWithPatternOf(const MPISparseMatrix& sparsity_template) -> std::shared_ptr<MPISparseMatrix> {
+  if (auto shared_template_ptr = dynamic_cast<const SharedSparsityMatrix*>(&sparsity_template);
+      shared_template_ptr != nullptr) {
+    return shared_template_ptr->MakeMatrixSharingIndices();
+  }
+  auto matrix_ptr = std::make_shared<MPISparseMatrix>();
+  matrix_ptr->reinit(sparsity_template);
+  *matrix_ptr = 0;
+  return matrix_ptr;
+}
+
+auto AddSamePattern(MPISparseMatrix& to_add_to, const double factor, const MPISparseMatrix& to_add) -> void {
+  CheckPETScError(MatAXPY(to_add_to, factor, to_add, SAME_NONZERO_PATTERN), "add matrix",
+                  "function AddSamePattern");
+}
+
+} // namespace bart::system
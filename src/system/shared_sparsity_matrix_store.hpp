@@ -0,0 +1,136 @@
+#ifndef BART_SRC_SYSTEM_SHARED_SPARSITY_MATRIX_STORE_HPP_
+#define BART_SRC_SYSTEM_SHARED_SPARSITY_MATRIX_STORE_HPP_
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "system/system_types.h"
+
+namespace bart::system {
+
+/*! \brief Compressed sparse row index structure of the locally owned rows of a distributed matrix.
+ *
+ * Follows the PETSc MPIAIJ split: the diagonal block couples locally owned rows to locally owned columns and stores
+ * local column indices, the off-diagonal block couples them to columns owned by other processes and stores global
+ * column indices.
+ */
+struct SparsityIndices {
+  //! Number of locally owned rows
+  PetscInt local_rows{ 0 };
+  //! Number of locally owned columns
+  PetscInt local_columns{ 0 };
+  //! Total number of rows
+  PetscInt global_rows{ 0 };
+  //! Total number of columns
+  PetscInt global_columns{ 0 };
+  //! Offsets of the first entry of each row of the diagonal block, size local_rows + 1
+  std::vector<PetscInt> row_offsets;
+  //! Local column index of each entry of the diagonal block
+  std::vector<PetscInt> column_indices;
+  //! Offsets of the first entry of each row of the off-diagonal block, size local_rows + 1
+  std::vector<PetscInt> off_diagonal_row_offsets;
+  //! Global column index of each entry of the off-diagonal block
+  std::vector<PetscInt> off_diagonal_column_indices;
+
+  /*! \brief Returns true if any locally owned row couples to a column owned by another process. */
+  [[nodiscard]] auto has_off_diagonal_entries() const -> bool { return !off_diagonal_column_indices.empty(); }
+  /*! \brief Returns the memory used by the index arrays in bytes. */
+  [[nodiscard]] auto memory_consumption() const -> std::size_t;
+};
+
+/*! \brief Storage of a shared sparsity matrix, a base class so that it is constructed before, and destroyed after,
+ * the PETSc matrix that uses it. */
+struct SharedSparsityMatrixStorage {
+  //! Index structure shared by all matrices made by the same store
+  std::shared_ptr<const SparsityIndices> indices_ptr;
+  //! Values of the entries of the diagonal block
+  std::vector<PetscScalar> values;
+  //! Values of the entries of the off-diagonal block
+  std::vector<PetscScalar> off_diagonal_values;
+  //! Copy of the off-diagonal row offsets, owned by this matrix
+  std::vector<PetscInt> off_diagonal_row_offsets;
+  //! Copy of the off-diagonal column indices, PETSc compacts these in place when the matrix is assembled
+  std::vector<PetscInt> off_diagonal_column_indices;
+};
+
+/*! \brief Distributed sparse matrix that stores its own values but shares its sparsity indices with other matrices.
+ *
+ * The matrix is a regular PETSc MPIAIJ matrix built on user provided arrays, so it can be assembled, solved and
+ * preconditioned like any other system matrix. Adding entries outside of the shared sparsity pattern is an error.
+ *
+ * The off-diagonal block, coupling to degrees of freedom owned by other processes, is small and PETSc rewrites its
+ * column indices when the matrix is assembled, so each matrix keeps its own copy of those indices.
+ */
+class SharedSparsityMatrix : private SharedSparsityMatrixStorage, public MPISparseMatrix {
+ public:
+  /*! \brief Constructor, all values are initialized to zero.
+   *
+   * @param shared_indices_ptr index structure to share.
+   * @param communicator MPI communicator the matrix is distributed over.
+   */
+  SharedSparsityMatrix(std::shared_ptr<const SparsityIndices> shared_indices_ptr, MPI_Comm communicator);
+
+  /*! \brief Returns true if this matrix and the other share the same index structure. */
+  [[nodiscard]] auto SharesIndicesWith(const SharedSparsityMatrix& other) const -> bool {
+    return indices_ptr == other.indices_ptr; }
+  /*! \brief Returns true if the PETSc matrix still stores its entries in the shared indices and owned values.
+   *
+   * Operations that change the sparsity pattern (such as adding a matrix with a different pattern) replace the PETSc
+   * storage, after which the matrix is still valid but no longer shares its indices.
+   */
+  [[nodiscard]] auto UsesSharedStorage() const -> bool;
+  /*! \brief Makes a new matrix with zero values that shares the index structure of this one. */
+  [[nodiscard]] auto MakeMatrixSharingIndices() const -> std::shared_ptr<SharedSparsityMatrix>;
+  /*! \brief Returns the memory used by the values and other data owned by this matrix alone, in bytes. */
+  [[nodiscard]] auto owned_memory_consumption() const -> std::size_t;
+
+  auto indices() const -> const SparsityIndices& { return *indices_ptr; }
+};
+
+/*! \brief Makes system matrices that share one immutable sparsity index structure.
+ *
+ * Each left hand side matrix (one for each group and angle) has the same sparsity pattern, but a matrix built
+ * directly from a sparsity pattern stores its own row offsets and column indices. Matrices made by this store share
+ * a single copy of the indices and only allocate their values. For discontinuous finite element flux sparsity
+ * patterns the indices take about as much memory as the values, so this nearly halves the memory of the system
+ * matrices.
+ */
+class SharedSparsityMatrixStore {
+ public:
+  /*! \brief Constructor.
+   *
+   * @param sparsity_template assembled matrix with the sparsity pattern to share, the store does not keep a
+   *                          reference to it.
+   */
+  explicit SharedSparsityMatrixStore(const MPISparseMatrix& sparsity_template);
+
+  /*! \brief Makes a new matrix with zero values that shares the index structure of the store. */
+  [[nodiscard]] auto MakeMatrix() const -> std::shared_ptr<SharedSparsityMatrix>;
+  /*! \brief Returns true if the matrix was made by this store (or one sharing its index structure). */
+  [[nodiscard]] auto Owns(const SharedSparsityMatrix& matrix) const -> bool {
+    return &matrix.indices() == indices_ptr_.get(); }
+
+  auto indices() const -> const SparsityIndices& { return *indices_ptr_; }
+  auto communicator() const -> MPI_Comm { return communicator_; }
+ private:
+  const MPI_Comm communicator_;
+  std::shared_ptr<const SparsityIndices> indices_ptr_{ nullptr };
+};
+
+/*! \brief Makes a matrix with zero values and the layout and sparsity pattern of the given matrix.
+ *
+ * If the given matrix is a shared sparsity matrix, the new matrix shares its indices, otherwise it is a copy.
+ */
+auto MakeMatrixWithPatternOf(const MPISparseMatrix& sparsity_template) -> std::shared_ptr<MPISparseMatrix>;
+
+/*! \brief Adds a multiple of a matrix with the same sparsity pattern, \f$A \leftarrow A + \alpha B\f$.
+ *
+ * The deal.II matrix addition assumes the patterns differ and rebuilds the storage of the matrix added to, which
+ * discards shared indices. This addition works on the values in place.
+ */
+auto AddSamePattern(MPISparseMatrix& to_add_to, double factor, const MPISparseMatrix& to_add) -> void;
+
+} // namespace bart::system
+
+#endif //BART_SRC_SYSTEM_SHARED_SPARSITY_MATRIX_STORE_HPP_
@@ -1,12 +1,14 @@
 #ifndef BART_DATA_SYSTEM_SYSTEM_HPP_
 #define BART_DATA_SYSTEM_SYSTEM_HPP_
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 
 #include "system/moments/spherical_harmonic_i.h"
 #include "system/moments/spherical_harmonic_types.h"
 #include "system/system_types.h"
+#include "system/terms/bilinear_operator_i.hpp"
 #include "system/terms/term_i.h"
 
 namespace bart::system {
@@ -18,8 +20,14 @@ struct System {
   std::unique_ptr<system::terms::MPILinearTermI> right_hand_side_ptr_{ nullptr };
   //! Pointer to left hand side bilinear term
   std::unique_ptr<system::terms::MPIBilinearTermI> left_hand_side_ptr_{ nullptr };
+  /*! Optional matrix-free left hand side operator. If set, it is used in place of the full left hand side term and no
+   * fixed left hand side matrices are allocated. */
+  std::shared_ptr<system::terms::BilinearOperatorI> left_hand_side_operator_ptr_{ nullptr };
   //! Flux moments for the current iteration
   std::shared_ptr<system::moments::SphericalHarmonicI> current_moments{ nullptr };
+  /*! Incremented each time current_moments is written. Code writing the current moments must increment it, so values
+   * cached from the moments can be checked without comparing them. */
+  std::size_t current_moments_version{ 0 };
   //! Flux moments for the previous iteration
   std::unique_ptr<system::moments::SphericalHarmonicI> previous_moments{ nullptr };
   //! System k_effective
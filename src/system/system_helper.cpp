@@ -1,5 +1,6 @@
 #include "system/system_helper.hpp"
 
+#include "system/terms/paired_direction_operator.hpp"
 #include "system/terms/term.h"
 #include "system/moments/spherical_harmonic.hpp"
 #include "system/solution/mpi_group_angular_solution.h"
@@ -96,6 +97,8 @@ auto SystemHelper<dim>::SetUpSystemTerms(System &system_to_setup,
   const auto variable_terms = system_to_setup.right_hand_side_ptr_->GetVariableTerms();
   const int total_groups = system_to_setup.total_groups;
   const int total_angles = system_to_setup.total_angles;
+  auto paired_direction_operator_ptr =
+      dynamic_cast<terms::PairedDirectionOperator*>(system_to_setup.left_hand_side_operator_ptr_.get());
 
   for (int group = 0; group < total_groups; ++group) {
     for (int angle = 0; angle < total_angles; ++angle) {
@@ -103,7 +106,17 @@ auto SystemHelper<dim>::SetUpSystemTerms(System &system_to_setup,
       auto& lhs = system_to_setup.left_hand_side_ptr_;
       auto& rhs = system_to_setup.right_hand_side_ptr_;
 
-      lhs->SetFixedTermPtr(index, domain_definition.MakeSystemMatrix());
+      if (paired_direction_operator_ptr != nullptr) {
+        // Matrices are shared by opposite directions, and only allocated once for each pair
+        if (paired_direction_operator_ptr->IsPairIndex(index)) {
+          paired_direction_operator_ptr->SetInteriorTermPtr(index, domain_definition.MakeSystemMatrix());
+          if (paired_direction_operator_ptr->HasOppositeAngle(angle))
+            paired_direction_operator_ptr->SetBoundaryCorrectionPtr(index,
+                                                                    domain_definition.MakeBoundarySystemMatrix());
+        }
+      } else if (system_to_setup.left_hand_side_operator_ptr_ == nullptr) {
+        lhs->SetFixedTermPtr(index, domain_definition.MakeSystemMatrix());
+      }
       rhs->SetFixedTermPtr(index, domain_definition.MakeSystemVector());
 
       for (const auto variable_term : variable_terms) {
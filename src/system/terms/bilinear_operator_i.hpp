@@ -0,0 +1,48 @@
+#ifndef BART_SRC_SYSTEM_TERMS_BILINEAR_OPERATOR_I_HPP_
+#define BART_SRC_SYSTEM_TERMS_BILINEAR_OPERATOR_I_HPP_
+
+#include <deal.II/lac/petsc_matrix_base.h>
+#include <deal.II/lac/petsc_precondition.h>
+
+#include "system/system_types.h"
+
+namespace bart::system::terms {
+
+/*! \brief Interface for left hand side operators that are applied without assembling a system matrix.
+ *
+ * An alternative to storing an assembled MPISparseMatrix for each index in an MPIBilinearTermI. The returned operator
+ * can be passed anywhere a PETSc matrix is expected by the linear solvers (for example as a PETSc shell matrix), but
+ * only the action of the operator on a vector is available, not its entries.
+ */
+class BilinearOperatorI {
+ public:
+  virtual ~BilinearOperatorI() = default;
+
+  /*! \brief Returns the operator for the given index.
+   *
+   * @param index group and angle of the operator.
+   * @return pointer to the operator, owned by this object.
+   */
+  virtual auto GetOperatorPtr(Index index) -> dealii::PETScWrappers::MatrixBase* = 0;
+
+  /*! \brief Returns a preconditioner for the operator for the given index.
+   *
+   * @param index group and angle of the operator.
+   * @return pointer to the preconditioner, owned by this object, or nullptr if the operator does not provide one.
+   */
+  virtual auto GetPreconditionerPtr(Index index) -> dealii::PETScWrappers::PreconditionerBase* = 0;
+
+  /*! \brief Returns an assembled matrix that approximates the operator for the given index.
+   *
+   * If the operator does not provide its own preconditioner, preconditioners and factorizations are built on this
+   * matrix instead of the operator. The same matrix may be returned for more than one index, so that they share them.
+   *
+   * @param index group and angle of the operator.
+   * @return pointer to the matrix, owned by this object, or nullptr if the operator does not provide one.
+   */
+  virtual auto GetPreconditionerMatrixPtr(Index /*index*/) -> dealii::PETScWrappers::MatrixBase* { return nullptr; }
+};
+
+} // namespace bart::system::terms
+
+#endif //BART_SRC_SYSTEM_TERMS_BILINEAR_OPERATOR_I_HPP_
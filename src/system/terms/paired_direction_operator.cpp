@@ -0,0 +1,136 @@
+#include "system/terms/paired_direction_operator.hpp"
+
+#include <algorithm>
+
+namespace bart::system::terms {
+
+PairedDirectionOperator::PairedDirectionOperator(std::vector<int> opposite_angles)
+    : opposite_angles_(std::move(opposite_angles)) {
+  std::string error_start{ "Error in constructor of PairedDirectionOperator: " };
+  AssertThrow(!opposite_angles_.empty(), dealii::ExcMessage(error_start + "no angles provided"))
+  for (int angle = 0; angle < total_angles(); ++angle) {
+    const int opposite = opposite_angles_.at(angle);
+    AssertThrow(opposite >= 0 && opposite < total_angles(),
+                dealii::ExcMessage(error_start + "opposite angle index is out of range"))
+    AssertThrow(opposite_angles_.at(opposite) == angle,
+                dealii::ExcMessage(error_start + "opposite angles are not paired with each other"))
+  }
+}
+
+auto PairedDirectionOperator::GetOperatorPtr(const Index index) -> dealii::PETScWrappers::MatrixBase* {
+  const auto pair_index = PairIndex(index);
+  auto interior_term_ptr = GetInteriorTermPtr(index);
+  AssertThrow(interior_term_ptr != nullptr,
+              dealii::ExcMessage("Error in PairedDirectionOperator function GetOperatorPtr: no interior term set for "
+                                 "index"))
+  if (boundary_correction_ptrs_.count(pair_index) == 0)
+    return interior_term_ptr.get();
+
+  auto& shell_matrix_ptr = shell_matrices_[index];
+  if (shell_matrix_ptr == nullptr)
+    shell_matrix_ptr = std::make_unique<ShellMatrix>(*this, index, *interior_term_ptr);
+  return shell_matrix_ptr.get();
+}
+
+auto PairedDirectionOperator::GetPreconditionerMatrixPtr(const Index index) -> dealii::PETScWrappers::MatrixBase* {
+  return GetInteriorTermPtr(index).get();
+}
+
+auto PairedDirectionOperator::PairIndex(const Index index) const -> Index {
+  const auto [group, angle] = index;
+  ValidateAngle(angle, __FUNCTION__);
+  return {group, std::min(angle, opposite_angles_[angle])};
+}
+
+auto PairedDirectionOperator::SetInteriorTermPtr(const Index index, std::shared_ptr<MPISparseMatrix> to_set) -> void {
+  interior_term_ptrs_[PairIndex(index)] = std::move(to_set);
+}
+
+auto PairedDirectionOperator::GetInteriorTermPtr(const Index index) const -> std::shared_ptr<MPISparseMatrix> {
+  const auto interior_term_it = interior_term_ptrs_.find(PairIndex(index));
+  return interior_term_it == interior_term_ptrs_.end() ? nullptr : interior_term_it->second;
+}
+
+auto PairedDirectionOperator::SetBoundaryCorrectionPtr(const Index index,
+                                                       std::shared_ptr<MPISparseMatrix> to_set) -> void {
+  AssertThrow(HasOppositeAngle(index.second),
+              dealii::ExcMessage("Error in PairedDirectionOperator function SetBoundaryCorrectionPtr: angle has no "
+                                 "opposite direction"))
+  boundary_correction_ptrs_[PairIndex(index)] = std::move(to_set);
+}
+
+auto PairedDirectionOperator::GetBoundaryCorrectionPtr(const Index index) const -> std::shared_ptr<MPISparseMatrix> {
+  const auto boundary_correction_it = boundary_correction_ptrs_.find(PairIndex(index));
+  return boundary_correction_it == boundary_correction_ptrs_.end() ? nullptr : boundary_correction_it->second;
+}
+
+auto PairedDirectionOperator::Apply(const Index index,
+                                    dealii::PETScWrappers::VectorBase& dst,
+                                    const dealii::PETScWrappers::VectorBase& src,
+                                    const bool add_to_destination) const -> void {
+  const auto& interior_term = *interior_term_ptrs_.at(PairIndex(index));
+  const auto& boundary_correction = *boundary_correction_ptrs_.at(PairIndex(index));
+
+  if (IsPairIndex(index)) {
+    if (add_to_destination)
+      interior_term.vmult_add(dst, src);
+    else
+      interior_term.vmult(dst, src);
+    boundary_correction.vmult_add(dst, src);
+  } else {
+    // The correction is subtracted by adding it to the negated destination
+    if (add_to_destination) {
+      dst *= -1.0;
+      boundary_correction.vmult_add(dst, src);
+    } else {
+      boundary_correction.vmult(dst, src);
+    }
+    dst *= -1.0;
+    interior_term.vmult_add(dst, src);
+  }
+}
+
+auto PairedDirectionOperator::opposite_angle(const int angle) const -> int {
+  ValidateAngle(angle, __FUNCTION__);
+  return opposite_angles_[angle];
+}
+
+auto PairedDirectionOperator::ValidateAngle(const int angle, const std::string& called_function_name) const -> void {
+  AssertThrow(angle >= 0 && angle < total_angles(),
+              dealii::ExcMessage("Error in PairedDirectionOperator function " + called_function_name
+                                     + ": angle index is out of range"))
+}
+
+// SHELL MATRIX ========================================================================================================
+
+PairedDirectionOperator::ShellMatrix::ShellMatrix(const PairedDirectionOperator& parent,
+                                                  const Index index,
+                                                  const MPISparseMatrix& layout_template)
+    : dealii::PETScWrappers::MatrixFree(layout_template.get_mpi_communicator(),
+                                        layout_template.m(), layout_template.n(),
+                                        layout_template.local_size(), layout_template.local_size()),
+      parent_(parent),
+      index_(index) {}
+
+void PairedDirectionOperator::ShellMatrix::vmult(dealii::PETScWrappers::VectorBase& dst,
+                                                 const dealii::PETScWrappers::VectorBase& src) const {
+  parent_.Apply(index_, dst, src);
+}
+
+// Both the interior matrix and the boundary correction are symmetric, so the transpose product is the product
+void PairedDirectionOperator::ShellMatrix::Tvmult(dealii::PETScWrappers::VectorBase& dst,
+                                                  const dealii::PETScWrappers::VectorBase& src) const {
+  parent_.Apply(index_, dst, src);
+}
+
+void PairedDirectionOperator::ShellMatrix::vmult_add(dealii::PETScWrappers::VectorBase& dst,
+                                                     const dealii::PETScWrappers::VectorBase& src) const {
+  parent_.Apply(index_, dst, src, true);
+}
+
+void PairedDirectionOperator::ShellMatrix::Tvmult_add(dealii::PETScWrappers::VectorBase& dst,
+                                                      const dealii::PETScWrappers::VectorBase& src) const {
+  parent_.Apply(index_, dst, src, true);
+}
+
+} // namespace bart::system::terms
@@ -0,0 +1,102 @@
+#ifndef BART_SRC_SYSTEM_TERMS_PAIRED_DIRECTION_OPERATOR_HPP_
+#define BART_SRC_SYSTEM_TERMS_PAIRED_DIRECTION_OPERATOR_HPP_
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <deal.II/lac/petsc_matrix_free.h>
+
+#include "system/system_types.h"
+#include "system/terms/bilinear_operator_i.hpp"
+
+namespace bart::system::terms {
+
+/*! \brief Left hand side operator that shares its matrices between angles with opposite directions.
+ *
+ * For angular formulations where the interior terms are identical for \f$\vec{\Omega}\f$ and
+ * \f$-\vec{\Omega}\f$ (such as the streaming and collision terms of the self-adjoint angular flux formulation), the
+ * operator for an angle is stored as
+ * \f[
+ * A_{\pm\vec{\Omega}} = P \pm K,
+ * \f]
+ * where the interior matrix \f$P\f$ holds the interior terms and the average of the boundary terms of the two
+ * directions, and the boundary correction \f$K\f$ holds half of their difference. Both are stored once for each
+ * group and pair of opposite angles, under the pair index (the lower of the two angles). The boundary correction only
+ * couples degrees of freedom on boundary cells, so storage is roughly half that of a matrix for each angle.
+ *
+ * Each index is exposed as a PETSc shell matrix. The interior matrix is returned as the preconditioner matrix, so
+ * preconditioners and factorizations are shared by both directions. Angles without an opposite direction in the
+ * quadrature set have no boundary correction, their interior matrix holds all their terms and is returned as the
+ * operator.
+ */
+class PairedDirectionOperator : public BilinearOperatorI {
+ public:
+  /*! \brief Constructor.
+   *
+   * @param opposite_angles index of the angle with the opposite direction for each angle, an angle without one has
+   *                        its own index.
+   */
+  explicit PairedDirectionOperator(std::vector<int> opposite_angles);
+
+  auto GetOperatorPtr(Index index) -> dealii::PETScWrappers::MatrixBase* override;
+  /*! \brief No preconditioner is provided, returns nullptr. */
+  auto GetPreconditionerPtr(Index) -> dealii::PETScWrappers::PreconditionerBase* override { return nullptr; }
+  /*! \brief Returns the interior matrix shared by the index and its opposite direction. */
+  auto GetPreconditionerMatrixPtr(Index index) -> dealii::PETScWrappers::MatrixBase* override;
+
+  /*! \brief Returns the index the shared matrices of the pair containing the given index are stored under. */
+  auto PairIndex(Index index) const -> Index;
+  /*! \brief Returns true if the given index is the one the shared matrices of its pair are stored under. */
+  auto IsPairIndex(Index index) const -> bool { return PairIndex(index) == index; }
+  /*! \brief Returns true if the angle has an opposite direction. */
+  auto HasOppositeAngle(int angle) const -> bool { return opposite_angle(angle) != angle; }
+
+  /*! \brief Sets the interior matrix for the pair containing the given index. */
+  auto SetInteriorTermPtr(Index index, std::shared_ptr<MPISparseMatrix> to_set) -> void;
+  /*! \brief Returns the interior matrix for the pair containing the given index. */
+  auto GetInteriorTermPtr(Index index) const -> std::shared_ptr<MPISparseMatrix>;
+  /*! \brief Sets the boundary correction for the pair containing the given index, it is added for the pair index and
+   * subtracted for its opposite. */
+  auto SetBoundaryCorrectionPtr(Index index, std::shared_ptr<MPISparseMatrix> to_set) -> void;
+  /*! \brief Returns the boundary correction for the pair containing the given index, or nullptr if it has none. */
+  auto GetBoundaryCorrectionPtr(Index index) const -> std::shared_ptr<MPISparseMatrix>;
+
+  /*! \brief Applies the operator for an index, \f$\text{dst} = A\,\text{src}\f$, or adds it to dst if
+   * add_to_destination is true. */
+  auto Apply(Index index, dealii::PETScWrappers::VectorBase& dst, const dealii::PETScWrappers::VectorBase& src,
+             bool add_to_destination = false) const -> void;
+
+  auto opposite_angle(int angle) const -> int;
+  auto total_angles() const -> int { return static_cast<int>(opposite_angles_.size()); }
+
+ private:
+  /*! \brief PETSc shell matrix for a single group and angle that forwards products to the parent operator. */
+  class ShellMatrix : public dealii::PETScWrappers::MatrixFree {
+   public:
+    ShellMatrix(const PairedDirectionOperator& parent, Index index, const MPISparseMatrix& layout_template);
+    using dealii::PETScWrappers::MatrixFree::vmult;
+    void vmult(dealii::PETScWrappers::VectorBase& dst, const dealii::PETScWrappers::VectorBase& src) const override;
+    void Tvmult(dealii::PETScWrappers::VectorBase& dst, const dealii::PETScWrappers::VectorBase& src) const override;
+    void vmult_add(dealii::PETScWrappers::VectorBase& dst,
+                   const dealii::PETScWrappers::VectorBase& src) const override;
+    void Tvmult_add(dealii::PETScWrappers::VectorBase& dst,
+                    const dealii::PETScWrappers::VectorBase& src) const override;
+   private:
+    const PairedDirectionOperator& parent_;
+    const Index index_;
+  };
+
+  auto ValidateAngle(int angle, const std::string& called_function_name) const -> void;
+
+  const std::vector<int> opposite_angles_;
+  //! Matrices shared by each pair, stored under the pair index
+  std::map<Index, std::shared_ptr<MPISparseMatrix>> interior_term_ptrs_{}, boundary_correction_ptrs_{};
+  //! Shell matrices, created the first time an index with a boundary correction is requested
+  std::map<Index, std::unique_ptr<ShellMatrix>> shell_matrices_{};
+};
+
+} // namespace bart::system::terms
+
+#endif //BART_SRC_SYSTEM_TERMS_PAIRED_DIRECTION_OPERATOR_HPP_
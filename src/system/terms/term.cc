@@ -1,6 +1,9 @@
 #include "term.h"
 
 #include <utility>
+#include <vector>
+
+#include <petscvec.h>
 
 namespace bart {
 
@@ -20,6 +23,7 @@ Term<TermPair>::Term(std::unordered_set<VariableTermType> variable_terms)
 template <typename TermPair>
 void Term<TermPair>::SetFixedTermPtr(Index index, std::shared_ptr<StorageType> to_set) {
   fixed_term_ptrs_[index] = to_set;
+  stale_full_term_indices_.insert(index);
 }
 
 template <typename TermPair>
@@ -49,6 +53,7 @@ void Term<TermPair>::SetVariableTermPtr(Index index,
               dealii::ExcMessage("Tried to set a right hand side with a variable "
                                  "term that it does not have set as variable"));
   variable_term_ptrs_[term][index] = to_set;
+  stale_full_term_indices_.insert(index);
 }
 
 template <typename TermPair>
@@ -80,36 +85,66 @@ auto Term<TermPair>::GetVariableTermPtr(GroupNumber group,
 template <>
 std::shared_ptr<system::MPIVector> Term<MPILinearTermPair>::GetFullTermPtr(
     Index index) const {
-
-  auto& fixed_term_vector = *fixed_term_ptrs_.at(index);
-  auto return_vector_ptr =
-      std::make_shared<system::MPIVector>(fixed_term_vector);
-
-  for (auto& variable_term_pair : variable_term_ptrs_) {
-    auto& variable_term_vector = *variable_term_pair.second.at(index);
-    return_vector_ptr->add(1, variable_term_vector);
-    return_vector_ptr->compress(dealii::VectorOperation::add);
+  const auto& fixed_term_ptr = fixed_term_ptrs_.at(index);
+  auto& full_term_ptr = full_term_ptrs_[index];
+  if (full_term_ptr != nullptr && stale_full_term_indices_.count(index) == 0)
+    return full_term_ptr;
+
+  if (full_term_ptr == nullptr)
+    full_term_ptr = std::make_shared<system::MPIVector>(*fixed_term_ptr);
+  else
+    *full_term_ptr = *fixed_term_ptr;
+
+  /* All variable terms are added in a single pass over the locally owned
+   * entries. Vector-vector operations only touch owned entries, so no
+   * communication (compress) is required. */
+  if (!variable_term_ptrs_.empty()) {
+    std::vector<Vec> variable_term_vectors;
+    variable_term_vectors.reserve(variable_term_ptrs_.size());
+    for (auto& variable_term_pair : variable_term_ptrs_) {
+      const Vec& variable_term_vector = *variable_term_pair.second.at(index);
+      variable_term_vectors.push_back(variable_term_vector);
+    }
+    const std::vector<PetscScalar> scaling_factors(variable_term_vectors.size(), 1.0);
+    const Vec& full_term_vector = *full_term_ptr;
+    const PetscErrorCode error_code = VecMAXPY(full_term_vector,
+                                               static_cast<PetscInt>(variable_term_vectors.size()),
+                                               scaling_factors.data(),
+                                               variable_term_vectors.data());
+    AssertThrow(error_code == 0,
+                dealii::ExcMessage("Error in Term function GetFullTermPtr: failed to add variable terms"))
   }
+  stale_full_term_indices_.erase(index);
 
-  return return_vector_ptr;
+  return full_term_ptr;
 }
 
 template <>
 std::shared_ptr<system::MPISparseMatrix> Term<MPIBilinearTermPair>::GetFullTermPtr(
     Index index) const {
-  auto return_matrix_ptr = std::make_shared<system::MPISparseMatrix>();
-  auto& fixed_term_matrix = *fixed_term_ptrs_.at(index);
-
-  return_matrix_ptr->reinit(fixed_term_matrix);
-  return_matrix_ptr->copy_from(fixed_term_matrix);
+  const auto& fixed_term_ptr = fixed_term_ptrs_.at(index);
+  // Without variable terms the full term is the fixed term, and is shared instead of copied
+  if (variable_term_ptrs_.empty())
+    return fixed_term_ptr;
+
+  auto& full_term_ptr = full_term_ptrs_[index];
+  if (full_term_ptr != nullptr && stale_full_term_indices_.count(index) == 0)
+    return full_term_ptr;
+
+  if (full_term_ptr == nullptr) {
+    full_term_ptr = std::make_shared<system::MPISparseMatrix>();
+    full_term_ptr->reinit(*fixed_term_ptr);
+  }
+  full_term_ptr->copy_from(*fixed_term_ptr);
 
   for (auto& variable_term_pair : variable_term_ptrs_) {
     auto& variable_term_matrix = *variable_term_pair.second.at(index);
-    return_matrix_ptr->add(1, variable_term_matrix);
-    return_matrix_ptr->compress(dealii::VectorOperation::add);
+    full_term_ptr->add(1, variable_term_matrix);
   }
+  full_term_ptr->compress(dealii::VectorOperation::add);
+  stale_full_term_indices_.erase(index);
 
-  return return_matrix_ptr;
+  return full_term_ptr;
 }
 
 template class Term<system::terms::MPILinearTermPair>;
@@ -3,6 +3,7 @@
 
 #include <memory>
 #include <map>
+#include <set>
 
 #include "system/system_types.h"
 #include "system/terms/term_i.h"
@@ -47,6 +48,13 @@ namespace terms {
  * You would then be able to set fixed vectors, and variable vectors for the
  * kNewVariableTerm term.
  *
+ * The full term for each index is stored and only re-assembled, in place,
+ * after one of its fixed or variable terms is set, or MarkModified is called
+ * for the index after a term is modified in place. Bilinear terms without
+ * variable terms are not copied, their fixed term is returned, so that each
+ * system matrix (and any storage it shares with others) is held only once.
+ * The returned full term must not be modified.
+ *
  */
 template <typename TermPair>
 class Term : public TermI<TermPair> {
@@ -87,6 +95,7 @@ class Term : public TermI<TermPair> {
   std::shared_ptr<StorageType> GetVariableTermPtr(GroupNumber group,
                                                   VariableTermType term) override;
   std::shared_ptr<StorageType> GetFullTermPtr(Index index) const override;
+  void MarkModified(Index index) override { stale_full_term_indices_.insert(index); }
 
  private:
   const std::unordered_set<VariableTermType> variable_terms_;
@@ -96,6 +105,10 @@ class Term : public TermI<TermPair> {
   TermPtrMap fixed_term_ptrs_;
 
   std::map<VariableTermType, TermPtrMap> variable_term_ptrs_;
+
+  //! Assembled full terms, and indices with fixed or variable terms that may have changed since assembly
+  mutable TermPtrMap full_term_ptrs_;
+  mutable std::set<Index> stale_full_term_indices_;
 };
 
 using MPILinearTerm = Term<system::terms::MPILinearTermPair>;
@@ -26,6 +26,15 @@ class TermI {
    */
   virtual std::shared_ptr<StorageType> GetFullTermPtr(Index index) const = 0;
 
+  /*! \brief Marks the full term for an index as requiring re-assembly.
+   *
+   * Must be called by anything that modifies the fixed or variable terms
+   * returned by the getters in place.
+   *
+   * @param index index of the modified terms
+   */
+  virtual void MarkModified(Index index) = 0;
+
   /*! \brief Returns the set of terms that are set as variable. */
   virtual std::unordered_set<VariableTermType> GetVariableTerms() const = 0;
 
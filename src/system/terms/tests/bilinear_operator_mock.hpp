@@ -0,0 +1,19 @@
+#ifndef BART_SRC_SYSTEM_TERMS_TESTS_BILINEAR_OPERATOR_MOCK_HPP_
+#define BART_SRC_SYSTEM_TERMS_TESTS_BILINEAR_OPERATOR_MOCK_HPP_
+
+#include "system/terms/bilinear_operator_i.hpp"
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace bart::system::terms {
+
+class BilinearOperatorMock : public BilinearOperatorI {
+ public:
+  MOCK_METHOD(dealii::PETScWrappers::MatrixBase*, GetOperatorPtr, (Index), (override));
+  MOCK_METHOD(dealii::PETScWrappers::PreconditionerBase*, GetPreconditionerPtr, (Index), (override));
+  MOCK_METHOD(dealii::PETScWrappers::MatrixBase*, GetPreconditionerMatrixPtr, (Index), (override));
+};
+
+} // namespace bart::system::terms
+
+#endif //BART_SRC_SYSTEM_TERMS_TESTS_BILINEAR_OPERATOR_MOCK_HPP_
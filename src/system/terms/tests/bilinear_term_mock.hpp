@@ -18,6 +18,7 @@ class BilinearTermMock : public TermI<system::terms::MPIBilinearTermPair> {
   MOCK_METHOD(std::shared_ptr<MPISparseMatrix>, GetFixedTermPtr, (Index), (override));
   MOCK_METHOD(std::shared_ptr<MPISparseMatrix>, GetFixedTermPtr, (GroupNumber), (override));
   MOCK_METHOD(std::shared_ptr<MPISparseMatrix>, GetFullTermPtr, (Index), (const, override));
+  MOCK_METHOD(void, MarkModified, (Index), (override));
   MOCK_METHOD(std::shared_ptr<MPISparseMatrix>, GetVariableTermPtr, (Index, VariableBilinearTerms), (override));
   MOCK_METHOD(std::shared_ptr<MPISparseMatrix>, GetVariableTermPtr, (GroupNumber, VariableBilinearTerms), (override));
   MOCK_METHOD(std::unordered_set<VariableBilinearTerms>, GetVariableTerms, (), (const, override));
@@ -16,6 +16,7 @@ class LinearTermMock : public TermI<system::terms::MPILinearTermPair> {
   MOCK_METHOD(std::shared_ptr<MPIVector>, GetFixedTermPtr, (Index), (override));
   MOCK_METHOD(std::shared_ptr<MPIVector>, GetFixedTermPtr, (GroupNumber));
   MOCK_METHOD(std::shared_ptr<MPIVector>, GetFullTermPtr, (Index), (const, override));
+  MOCK_METHOD(void, MarkModified, (Index), (override));
   MOCK_METHOD(std::shared_ptr<MPIVector>, GetVariableTermPtr, (Index, VariableLinearTerms), (override));
   MOCK_METHOD(std::shared_ptr<MPIVector>, GetVariableTermPtr, (GroupNumber, VariableLinearTerms), (override));
   MOCK_METHOD(std::unordered_set<VariableLinearTerms>, GetVariableTerms, (), (const, override));
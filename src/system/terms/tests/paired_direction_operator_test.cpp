@@ -0,0 +1,109 @@
+#include "system/terms/paired_direction_operator.hpp"
+
+#include "test_helpers/test_assertions.hpp"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_helper_functions.h"
+
+namespace  {
+
+using namespace bart;
+
+class SystemTermsPairedDirectionOperatorTest : public ::testing::Test,
+                                               public bart::testing::DealiiTestDomain<2> {
+ protected:
+  using PairedDirectionOperator = system::terms::PairedDirectionOperator;
+  // Angles 0 and 1 are opposite directions, angle 2 has no opposite
+  const std::vector<int> opposite_angles_{1, 0, 2};
+  const int group_{ 1 };
+  std::shared_ptr<system::MPISparseMatrix> interior_term_ptr_, boundary_correction_ptr_, unpaired_term_ptr_;
+  void SetUp() override;
+};
+
+void SystemTermsPairedDirectionOperatorTest::SetUp() {
+  SetUpDealii();
+  interior_term_ptr_ = std::make_shared<system::MPISparseMatrix>();
+  boundary_correction_ptr_ = std::make_shared<system::MPISparseMatrix>();
+  unpaired_term_ptr_ = std::make_shared<system::MPISparseMatrix>();
+  for (const auto& matrix_ptr : {interior_term_ptr_, boundary_correction_ptr_, unpaired_term_ptr_})
+    matrix_ptr->reinit(matrix_1);
+  StampMatrix(*interior_term_ptr_, 3);
+  StampMatrix(*boundary_correction_ptr_, 1);
+  StampMatrix(*unpaired_term_ptr_, 2);
+
+  // Integer values so that products are exact regardless of the order of operations
+  auto [local_begin, local_end] = vector_1.local_range();
+  for (auto i = local_begin; i < local_end; ++i)
+    vector_1(i) = test_helpers::RandomInt(-10, 10);
+  vector_1.compress(dealii::VectorOperation::insert);
+}
+
+TEST_F(SystemTermsPairedDirectionOperatorTest, ConstructorBadPairing) {
+  EXPECT_ANY_THROW({ PairedDirectionOperator test_operator(std::vector<int>{}); });
+  EXPECT_ANY_THROW({ PairedDirectionOperator test_operator(std::vector<int>{1, 2, 0}); });
+  EXPECT_ANY_THROW({ PairedDirectionOperator test_operator(std::vector<int>{1, 3}); });
+}
+
+TEST_F(SystemTermsPairedDirectionOperatorTest, PairIndices) {
+  PairedDirectionOperator test_operator(opposite_angles_);
+  EXPECT_EQ(test_operator.total_angles(), 3);
+  EXPECT_EQ(test_operator.PairIndex({group_, 0}), system::Index(group_, 0));
+  EXPECT_EQ(test_operator.PairIndex({group_, 1}), system::Index(group_, 0));
+  EXPECT_EQ(test_operator.PairIndex({group_, 2}), system::Index(group_, 2));
+  EXPECT_TRUE(test_operator.IsPairIndex({group_, 0}));
+  EXPECT_FALSE(test_operator.IsPairIndex({group_, 1}));
+  EXPECT_TRUE(test_operator.HasOppositeAngle(1));
+  EXPECT_FALSE(test_operator.HasOppositeAngle(2));
+  EXPECT_ANY_THROW({ [[maybe_unused]] auto index = test_operator.PairIndex({group_, 3}); });
+  EXPECT_ANY_THROW(test_operator.SetBoundaryCorrectionPtr({group_, 2}, boundary_correction_ptr_));
+}
+
+TEST_F(SystemTermsPairedDirectionOperatorTest, MatricesSharedByOppositeDirections) {
+  PairedDirectionOperator test_operator(opposite_angles_);
+  test_operator.SetInteriorTermPtr({group_, 1}, interior_term_ptr_);
+  test_operator.SetBoundaryCorrectionPtr({group_, 0}, boundary_correction_ptr_);
+  test_operator.SetInteriorTermPtr({group_, 2}, unpaired_term_ptr_);
+
+  EXPECT_EQ(test_operator.GetInteriorTermPtr({group_, 0}), interior_term_ptr_);
+  EXPECT_EQ(test_operator.GetInteriorTermPtr({group_, 1}), interior_term_ptr_);
+  EXPECT_EQ(test_operator.GetBoundaryCorrectionPtr({group_, 1}), boundary_correction_ptr_);
+  EXPECT_EQ(test_operator.GetBoundaryCorrectionPtr({group_, 2}), nullptr);
+  EXPECT_EQ(test_operator.GetInteriorTermPtr({group_ + 1, 0}), nullptr);
+
+  EXPECT_EQ(test_operator.GetPreconditionerMatrixPtr({group_, 0}), interior_term_ptr_.get());
+  EXPECT_EQ(test_operator.GetPreconditionerMatrixPtr({group_, 1}), interior_term_ptr_.get());
+  EXPECT_EQ(test_operator.GetPreconditionerPtr({group_, 0}), nullptr);
+  // Angles without an opposite direction use the assembled matrix directly
+  EXPECT_EQ(test_operator.GetOperatorPtr({group_, 2}), unpaired_term_ptr_.get());
+  EXPECT_NE(test_operator.GetOperatorPtr({group_, 0}), test_operator.GetOperatorPtr({group_, 1}));
+  EXPECT_ANY_THROW({ [[maybe_unused]] auto operator_ptr = test_operator.GetOperatorPtr({group_ + 1, 0}); });
+}
+
+TEST_F(SystemTermsPairedDirectionOperatorTest, OperatorAction) {
+  PairedDirectionOperator test_operator(opposite_angles_);
+  test_operator.SetInteriorTermPtr({group_, 0}, interior_term_ptr_);
+  test_operator.SetBoundaryCorrectionPtr({group_, 0}, boundary_correction_ptr_);
+
+  // Expected action is the interior term plus the correction for angle 0, and minus the correction for angle 1
+  system::MPIVector interior_product(vector_1), correction_product(vector_1);
+  interior_term_ptr_->vmult(interior_product, vector_1);
+  boundary_correction_ptr_->vmult(correction_product, vector_1);
+  system::MPIVector expected_plus(interior_product), expected_minus(interior_product);
+  expected_plus += correction_product;
+  expected_minus -= correction_product;
+
+  system::MPIVector result(vector_1);
+  test_operator.GetOperatorPtr({group_, 0})->vmult(result, vector_1);
+  EXPECT_TRUE(test_helpers::AreEqual(expected_plus, result));
+  test_operator.GetOperatorPtr({group_, 1})->vmult(result, vector_1);
+  EXPECT_TRUE(test_helpers::AreEqual(expected_minus, result));
+
+  // Adding to the destination
+  system::MPIVector expected_sum(expected_minus);
+  expected_sum += vector_1;
+  result = vector_1;
+  test_operator.Apply({group_, 1}, result, vector_1, true);
+  EXPECT_TRUE(test_helpers::AreEqual(expected_sum, result));
+}
+
+} // namespace
@@ -41,6 +41,17 @@ TEST_F(SystemTermsFullTermTest, BilinearFullTermOperationOnlyFixedMPI) {
   EXPECT_TRUE(bart::test_helpers::AreEqual(matrix_3, *term_matrix_ptr));
 }
 
+// Without variable terms, the fixed term should be returned without copying
+TEST_F(SystemTermsFullTermTest, BilinearFullTermOnlyFixedSharedMPI) {
+  system::terms::MPIBilinearTerm test_bilinear_term;
+
+  auto fixed_term_ptr = std::make_shared<system::MPISparseMatrix>();
+  fixed_term_ptr->reinit(matrix_1);
+  test_bilinear_term.SetFixedTermPtr({0, 0}, fixed_term_ptr);
+
+  EXPECT_EQ(test_bilinear_term.GetFullTermPtr({0, 0}), fixed_term_ptr);
+}
+
 TEST_F(SystemTermsFullTermTest, LinearFullTermOperationOnlyFixedMPI) {
   system::terms::MPILinearTerm test_linear_term;
 
@@ -83,6 +94,37 @@ TEST_F(SystemTermsFullTermTest, BilinearFullTermOperationMPI) {
   EXPECT_TRUE(bart::test_helpers::AreEqual(matrix_3, *term_matrix_ptr));
 }
 
+// The full term should be stored, and re-assembled only after its terms are marked as modified
+TEST_F(SystemTermsFullTermTest, BilinearFullTermStoredMPI) {
+  auto other_source = system::terms::VariableBilinearTerms::kOther;
+  system::terms::MPIBilinearTerm test_bilinear_term({other_source});
+
+  auto fixed_term_ptr = std::make_shared<system::MPISparseMatrix>();
+  auto variable_term_ptr = std::make_shared<system::MPISparseMatrix>();
+  fixed_term_ptr->reinit(matrix_1);
+  variable_term_ptr->reinit(matrix_2);
+  StampMatrix(*fixed_term_ptr, 2);
+  StampMatrix(*variable_term_ptr, 1);
+
+  test_bilinear_term.SetFixedTermPtr({0, 0}, fixed_term_ptr);
+  test_bilinear_term.SetVariableTermPtr({0, 0}, other_source, variable_term_ptr);
+
+  auto first_matrix_ptr = test_bilinear_term.GetFullTermPtr({0, 0});
+  auto second_matrix_ptr = test_bilinear_term.GetFullTermPtr({0, 0});
+  EXPECT_EQ(first_matrix_ptr, second_matrix_ptr);
+  StampMatrix(matrix_3, 3);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(matrix_3, *second_matrix_ptr));
+
+  StampMatrix(*test_bilinear_term.GetVariableTermPtr({0, 0}, other_source), 1);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(matrix_3, *test_bilinear_term.GetFullTermPtr({0, 0})));
+  test_bilinear_term.MarkModified({0, 0});
+  auto updated_matrix_ptr = test_bilinear_term.GetFullTermPtr({0, 0});
+  EXPECT_EQ(updated_matrix_ptr, first_matrix_ptr);
+  StampMatrix(matrix_3, 1);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(matrix_3, *updated_matrix_ptr));
+  EXPECT_NE(fixed_term_ptr, updated_matrix_ptr);
+}
+
 TEST_F(SystemTermsFullTermTest, LinearFullTermOperationMPI) {
   using VariableTerms = system::terms::VariableLinearTerms;
   system::terms::MPILinearTerm test_linear_term({VariableTerms::kFissionSource,
@@ -115,4 +157,46 @@ TEST_F(SystemTermsFullTermTest, LinearFullTermOperationMPI) {
   EXPECT_TRUE(bart::test_helpers::AreEqual(vector_1, *term_vector_ptr));
 }
 
+// The full term should be stored, and updated in place only after its terms are marked as modified
+TEST_F(SystemTermsFullTermTest, LinearFullTermStoredMPI) {
+  using VariableTerms = system::terms::VariableLinearTerms;
+  system::terms::MPILinearTerm test_linear_term({VariableTerms::kFissionSource,
+                                                 VariableTerms::kOther});
+
+  auto fixed_term_ptr = std::make_shared<system::MPIVector>();
+  auto fission_term_ptr = std::make_shared<system::MPIVector>();
+  auto other_term_ptr = std::make_shared<system::MPIVector>();
+
+  auto set_value = [&](system::MPIVector& vector, int value) {
+    vector.reinit(vector_1);
+    vector.add(value);
+    vector.compress(dealii::VectorOperation::add);
+  };
+
+  set_value(*fixed_term_ptr, 1);
+  set_value(*fission_term_ptr, 2);
+  set_value(*other_term_ptr, 3);
+
+  test_linear_term.SetFixedTermPtr({0, 0}, fixed_term_ptr);
+  test_linear_term.SetVariableTermPtr({0, 0}, VariableTerms::kFissionSource, fission_term_ptr);
+  test_linear_term.SetVariableTermPtr({0, 0}, VariableTerms::kOther, other_term_ptr);
+
+  auto first_vector_ptr = test_linear_term.GetFullTermPtr({0, 0});
+  auto second_vector_ptr = test_linear_term.GetFullTermPtr({0, 0});
+  EXPECT_EQ(first_vector_ptr, second_vector_ptr);
+  set_value(vector_1, 6);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(vector_1, *second_vector_ptr));
+
+  set_value(*test_linear_term.GetVariableTermPtr({0, 0}, VariableTerms::kOther), 5);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(vector_1, *test_linear_term.GetFullTermPtr({0, 0})));
+  test_linear_term.MarkModified({0, 0});
+  auto updated_vector_ptr = test_linear_term.GetFullTermPtr({0, 0});
+  EXPECT_EQ(updated_vector_ptr, first_vector_ptr);
+  set_value(vector_1, 8);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(vector_1, *updated_vector_ptr));
+  EXPECT_NE(fixed_term_ptr, updated_vector_ptr);
+  set_value(vector_1, 1);
+  EXPECT_TRUE(bart::test_helpers::AreEqual(vector_1, *fixed_term_ptr));
+}
+
 } // namespace
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include "system/shared_sparsity_matrix_store.hpp"
+
+#include "test_helpers/test_assertions.hpp"
+#include "test_helpers/dealii_test_domain.h"
+#include "test_helpers/gmock_wrapper.h"
+#include "test_helpers/test_helper_functions.h"
+
+namespace  {
+
+using namespace bart;
+
+class SystemSharedSparsityMatrixStoreTest : public ::testing::Test,
+                                            public bart::testing::DealiiTestDomain<2> {
+ protected:
+  std::unique_ptr<system::SharedSparsityMatrixStore> test_store_ptr_;
+  void SetUp() override;
+};
+
+void SystemSharedSparsityMatrixStoreTest::SetUp() {
+  SetUpDealii();
+  test_store_ptr_ = std::make_unique<system::SharedSparsityMatrixStore>(matrix_1);
+
+  // Integer values so that products are exact regardless of the order of operations
+  auto [local_begin, local_end] = vector_1.local_range();
+  for (auto i = local_begin; i < local_end; ++i) {
+    vector_1(i) = test_helpers::RandomInt(-10, 10);
+    vector_2(i) = test_helpers::RandomInt(-10, 10);
+  }
+  vector_1.compress(dealii::VectorOperation::insert);
+  vector_2.compress(dealii::VectorOperation::insert);
+}
+
+TEST_F(SystemSharedSparsityMatrixStoreTest, MatricesShareIndicesMPI) {
+  auto matrix_a_ptr = test_store_ptr_->MakeMatrix();
+  auto matrix_b_ptr = test_store_ptr_->MakeMatrix();
+  ASSERT_NE(matrix_a_ptr, nullptr);
+  ASSERT_NE(matrix_b_ptr, nullptr);
+  EXPECT_NE(matrix_a_ptr, matrix_b_ptr);
+
+  EXPECT_TRUE(matrix_a_ptr->SharesIndicesWith(*matrix_b_ptr));
+  EXPECT_TRUE(test_store_ptr_->Owns(*matrix_a_ptr));
+  EXPECT_TRUE(matrix_a_ptr->UsesSharedStorage());
+  EXPECT_EQ(&matrix_a_ptr->indices(), &test_store_ptr_->indices());
+
+  for (const auto& matrix_ptr : {matrix_a_ptr, matrix_b_ptr}) {
+    EXPECT_EQ(matrix_ptr->m(), matrix_1.m());
+    EXPECT_EQ(matrix_ptr->n(), matrix_1.n());
+    EXPECT_EQ(matrix_ptr->local_size(), matrix_1.local_size());
+    EXPECT_EQ(matrix_ptr->n_nonzero_elements(), matrix_1.n_nonzero_elements());
+    EXPECT_EQ(matrix_ptr->frobenius_norm(), 0);
+  }
+
+  // Matrices from another store do not share indices, even with the same pattern
+  system::SharedSparsityMatrixStore other_store(matrix_1);
+  auto other_matrix_ptr = other_store.MakeMatrix();
+  EXPECT_FALSE(other_matrix_ptr->SharesIndicesWith(*matrix_a_ptr));
+  EXPECT_FALSE(test_store_ptr_->Owns(*other_matrix_ptr));
+  EXPECT_TRUE(matrix_a_ptr->MakeMatrixSharingIndices()->SharesIndicesWith(*matrix_a_ptr));
+}
+
+TEST_F(SystemSharedSparsityMatrixStoreTest, MemoryConsumptionMPI) {
+  const auto& indices = test_store_ptr_->indices();
+  const std::size_t local_entries{ indices.column_indices.size() + indices.off_diagonal_column_indices.size() };
+  EXPECT_EQ(indices.row_offsets.size(), matrix_1.local_size() + 1);
+  EXPECT_GT(indices.memory_consumption(), sizeof(PetscInt) * local_entries);
+
+  // Each matrix only owns its values and the off-diagonal indices
+  auto matrix_ptr = test_store_ptr_->MakeMatrix();
+  EXPECT_EQ(matrix_ptr->owned_memory_consumption(),
+            sizeof(PetscScalar) * local_entries
+                + sizeof(PetscInt) * (indices.off_diagonal_row_offsets.size()
+                    + indices.off_diagonal_column_indices.size()));
+}
+
+TEST_F(SystemSharedSparsityMatrixStoreTest, IndependentValuesMPI) {
+  auto matrix_a_ptr = test_store_ptr_->MakeMatrix();
+  auto matrix_b_ptr = test_store_ptr_->MakeMatrix();
+  StampMatrix(*matrix_a_ptr, 3);
+  StampMatrix(*matrix_b_ptr, 1);
+  StampMatrix(matrix_1, 3);
+  StampMatrix(matrix_2, 1);
+
+  EXPECT_TRUE(test_helpers::AreEqual(matrix_1, *matrix_a_ptr));
+  EXPECT_TRUE(test_helpers::AreEqual(matrix_2, *matrix_b_ptr));
+  EXPECT_TRUE(matrix_a_ptr->UsesSharedStorage());
+
+  system::MPIVector expected(vector_1), result(vector_1);
+  matrix_1.vmult(expected, vector_1);
+  matrix_a_ptr->vmult(result, vector_1);
+  EXPECT_TRUE(test_helpers::AreEqual(expected, result));
+
+  // Adding a matrix with the same pattern keeps the shared storage
+  system::AddSamePattern(*matrix_a_ptr, 2.0, *matrix_b_ptr);
+  EXPECT_TRUE(matrix_a_ptr->UsesSharedStorage());
+  StampMatrix(matrix_1, 2);
+  EXPECT_TRUE(test_helpers::AreEqual(matrix_1, *matrix_a_ptr));
+}
+
+TEST_F(SystemSharedSparsityMatrixStoreTest, MakeMatrixWithPatternOfMPI) {
+  auto shared_matrix_ptr = test_store_ptr_->MakeMatrix();
+  auto sharing_matrix_ptr = system::MakeMatrixWithPatternOf(*shared_matrix_ptr);
+  auto shared_sharing_matrix_ptr = std::dynamic_pointer_cast<system::SharedSparsityMatrix>(sharing_matrix_ptr);
+  ASSERT_NE(shared_sharing_matrix_ptr, nullptr);
+  EXPECT_TRUE(shared_sharing_matrix_ptr->SharesIndicesWith(*shared_matrix_ptr));
+
+  StampMatrix(matrix_2, 4);
+  auto copy_ptr = system::MakeMatrixWithPatternOf(matrix_2);
+  EXPECT_EQ(std::dynamic_pointer_cast<system::SharedSparsityMatrix>(copy_ptr), nullptr);
+  EXPECT_EQ(copy_ptr->n_nonzero_elements(), matrix_2.n_nonzero_elements());
+  EXPECT_EQ(copy_ptr->frobenius_norm(), 0);
+}
+
+} // namespace
@@ -10,11 +10,13 @@
 #include "test_helpers/test_assertions.hpp"
 #include "test_helpers/test_helper_functions.h"
 
+#include "system/terms/paired_direction_operator.hpp"
 #include "system/terms/term.h"
 #include "system/moments/spherical_harmonic.hpp"
 #include "system/moments/spherical_harmonic_types.h"
 #include "system/moments/tests/spherical_harmonic_mock.h"
 #include "system/terms/tests/linear_term_mock.hpp"
+#include "system/terms/tests/bilinear_operator_mock.hpp"
 #include "system/terms/tests/bilinear_term_mock.hpp"
 #include "system/solution/solution_types.h"
 
@@ -288,6 +290,65 @@ TYPED_TEST(SystemHelperSetUpSystemTermsTests, SetUpProperly) {
   this->test_helper_.SetUpSystemTerms(test_system_, *this->definition_ptr);
 }
 
+TYPED_TEST(SystemHelperSetUpSystemTermsTests, SetUpWithLeftHandSideOperator) {
+  auto& test_system_ = this->test_system_;
+  const int total_groups = test_system_.total_groups;
+  const int total_angles = test_system_.total_angles;
+  test_system_.left_hand_side_operator_ptr_ = std::make_shared<bart::system::terms::BilinearOperatorMock>();
+
+  EXPECT_CALL(*this->rhs_mock_obs_ptr_, GetVariableTerms()).WillOnce(DoDefault());
+
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSystemMatrix()).Times(0);
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSystemVector())
+      .Times(total_groups * total_angles * (1 + this->source_terms_.size()))
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->lhs_mock_obs_ptr_, SetFixedTermPtr(_, _)).Times(0);
+
+  for (int group = 0; group < total_groups; ++group) {
+    for (int angle = 0; angle < total_angles; ++angle) {
+      bart::system::Index index{group, angle};
+      EXPECT_CALL(*this->rhs_mock_obs_ptr_, SetFixedTermPtr(index, NotNull()));
+      for (auto term : this->source_terms_)
+        EXPECT_CALL(*this->rhs_mock_obs_ptr_, SetVariableTermPtr(index, term, NotNull()));
+    }
+  }
+
+  this->test_helper_.SetUpSystemTerms(test_system_, *this->definition_ptr);
+}
+
+TYPED_TEST(SystemHelperSetUpSystemTermsTests, SetUpWithPairedDirectionOperator) {
+  auto& test_system_ = this->test_system_;
+  const int total_groups = test_system_.total_groups;
+  // Angles 0 and 1 are opposite directions, angle 2 has no opposite
+  test_system_.total_angles = 3;
+  auto paired_operator_ptr = std::make_shared<bart::system::terms::PairedDirectionOperator>(std::vector<int>{1, 0, 2});
+  test_system_.left_hand_side_operator_ptr_ = paired_operator_ptr;
+  auto boundary_matrix_ptr = std::make_shared<bart::system::MPISparseMatrix>();
+
+  EXPECT_CALL(*this->rhs_mock_obs_ptr_, GetVariableTerms()).WillOnce(DoDefault());
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSystemMatrix()).Times(total_groups * 2).WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeBoundarySystemMatrix())
+      .Times(total_groups)
+      .WillRepeatedly(Return(boundary_matrix_ptr));
+  EXPECT_CALL(*this->domain_mock_obs_ptr_, MakeSystemVector())
+      .Times(total_groups * 3 * (1 + this->source_terms_.size()))
+      .WillRepeatedly(DoDefault());
+  EXPECT_CALL(*this->lhs_mock_obs_ptr_, SetFixedTermPtr(_, _)).Times(0);
+  EXPECT_CALL(*this->rhs_mock_obs_ptr_, SetFixedTermPtr(_, NotNull())).Times(total_groups * 3);
+  EXPECT_CALL(*this->rhs_mock_obs_ptr_, SetVariableTermPtr(_, _, NotNull()))
+      .Times(total_groups * 3 * this->source_terms_.size());
+
+  this->test_helper_.SetUpSystemTerms(test_system_, *this->definition_ptr);
+
+  for (int group = 0; group < total_groups; ++group) {
+    EXPECT_EQ(paired_operator_ptr->GetInteriorTermPtr({group, 0}), this->system_matrix_ptr_);
+    EXPECT_EQ(paired_operator_ptr->GetInteriorTermPtr({group, 1}), this->system_matrix_ptr_);
+    EXPECT_EQ(paired_operator_ptr->GetInteriorTermPtr({group, 2}), this->system_matrix_ptr_);
+    EXPECT_EQ(paired_operator_ptr->GetBoundaryCorrectionPtr({group, 1}), boundary_matrix_ptr);
+    EXPECT_EQ(paired_operator_ptr->GetBoundaryCorrectionPtr({group, 2}), nullptr);
+  }
+}
+
 // ===== SetUpSystemMomentsTests ===============================================
 
 class SystemHelperSetUpSystemMomentsTests : public ::testing::Test {
@@ -0,0 +1,45 @@
+#ifndef BART_SRC_UTILITY_SCRATCH_ARENA_HPP_
+#define BART_SRC_UTILITY_SCRATCH_ARENA_HPP_
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include <deal.II/base/thread_local_storage.h>
+
+namespace bart::utility {
+
+/*! \brief Reusable buffers for temporary values in hot loops.
+ *
+ * Each thread has its own buffers, which keep their capacity between calls, so once every buffer has grown to the
+ * largest size requested no more memory is allocated. Buffers are identified by an index chosen by the owner; a buffer
+ * returned by Get is valid until Get is next called with the same index on the same thread.
+ *
+ * \tparam T type of the buffered values, must be default constructible.
+ */
+template <typename T>
+class BasicScratchArena {
+ public:
+  /*! \brief Returns a buffer of value-initialized entries for the calling thread.
+   *
+   * \param buffer_index index of the buffer.
+   * \param size number of values in the returned buffer.
+   */
+  auto Get(const std::size_t buffer_index, const std::size_t size) -> std::span<T> {
+    auto& thread_buffers = buffers_.get();
+    if (thread_buffers.size() <= buffer_index)
+      thread_buffers.resize(buffer_index + 1);
+    auto& buffer = thread_buffers[buffer_index];
+    buffer.assign(size, T{});
+    return { buffer.data(), size };
+  }
+ private:
+  dealii::Threads::ThreadLocalStorage<std::vector<std::vector<T>>> buffers_{};
+};
+
+//! Scratch buffers of doubles, the most common use
+using ScratchArena = BasicScratchArena<double>;
+
+} // namespace bart::utility
+
+#endif //BART_SRC_UTILITY_SCRATCH_ARENA_HPP_
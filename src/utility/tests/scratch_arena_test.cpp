@@ -0,0 +1,61 @@
+#include "utility/scratch_arena.hpp"
+
+#include <thread>
+
+#include "test_helpers/gmock_wrapper.h"
+
+namespace  {
+
+using namespace bart;
+
+using ::testing::Each;
+
+class UtilityScratchArenaTest : public ::testing::Test {
+ public:
+  utility::ScratchArena test_arena_;
+};
+
+// Buffers should be zeroed and have the requested size
+TEST_F(UtilityScratchArenaTest, GetZeroed) {
+  auto buffer = test_arena_.Get(0, 4);
+  ASSERT_EQ(buffer.size(), 4U);
+  EXPECT_THAT(buffer, Each(0.0));
+  buffer[2] = 3.0;
+  buffer = test_arena_.Get(0, 6);
+  ASSERT_EQ(buffer.size(), 6U);
+  EXPECT_THAT(buffer, Each(0.0));
+}
+
+// Memory should be reused for smaller requests and buffers with different indices should not overlap
+TEST_F(UtilityScratchArenaTest, GetReusesMemory) {
+  const auto first_buffer = test_arena_.Get(0, 8);
+  const auto second_buffer = test_arena_.Get(1, 8);
+  EXPECT_NE(first_buffer.data(), second_buffer.data());
+  first_buffer[0] = 1.0;
+  EXPECT_EQ(second_buffer[0], 0.0);
+  EXPECT_EQ(test_arena_.Get(0, 4).data(), first_buffer.data());
+}
+
+// Each thread should be given its own buffers
+TEST_F(UtilityScratchArenaTest, GetMultipleThreads) {
+  const auto main_thread_buffer = test_arena_.Get(0, 4);
+  main_thread_buffer[0] = 1.0;
+  double* other_thread_data{ nullptr };
+  std::thread other_thread([&]() { other_thread_data = test_arena_.Get(0, 4).data(); });
+  other_thread.join();
+  EXPECT_NE(other_thread_data, main_thread_buffer.data());
+  EXPECT_EQ(main_thread_buffer[0], 1.0);
+}
+
+// Buffers of other types should be value-initialized
+TEST_F(UtilityScratchArenaTest, GetPointerBuffer) {
+  utility::BasicScratchArena<const double*> pointer_arena;
+  const double value{ 2.0 };
+  auto buffer = pointer_arena.Get(0, 3);
+  ASSERT_EQ(buffer.size(), 3U);
+  EXPECT_THAT(buffer, Each(nullptr));
+  buffer[1] = &value;
+  EXPECT_THAT(pointer_arena.Get(0, 3), Each(nullptr));
+}
+
+} // namespace